@@ -0,0 +1,423 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/bandwidth_reduction.cpp  Tests the reorderings of compressed_matrix (Cuthill-McKee, nested dissection) and the application of permutations.
+*   \test  Tests the reorderings of compressed_matrix (Cuthill-McKee, nested dissection), the application of permutations, solvers on permuted matrices, and graph colorings.
+**/
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <set>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/ilu.hpp"
+#include "viennacl/linalg/sor_precond.hpp"
+#include "viennacl/misc/bandwidth_reduction.hpp"
+#include "viennacl/misc/graph_coloring.hpp"
+#include "viennacl/permuted_matrix.hpp"
+
+
+/** @brief 5-point Laplacian on an N-by-M grid, the nodes are randomly shuffled if requested. Two additional isolated nodes make the graph disconnected. */
+std::vector<std::map<unsigned int, double> > grid_matrix(std::size_t N, std::size_t M, bool shuffle)
+{
+  std::size_t n = N * M + 2;
+  std::vector<unsigned int> label(n);
+  for (std::size_t i = 0; i < n; ++i)
+    label[i] = static_cast<unsigned int>(i);
+  if (shuffle)
+  {
+    srand(42);
+    for (std::size_t i = n - 1; i > 0; --i)
+      std::swap(label[i], label[static_cast<std::size_t>(rand()) % (i + 1)]);
+  }
+
+  std::vector<std::map<unsigned int, double> > A(n);
+  for (std::size_t i = 0; i < N; ++i)
+    for (std::size_t j = 0; j < M; ++j)
+    {
+      unsigned int row = label[i * M + j];
+      A[row][row] = 4.0;
+      if (i > 0)     A[row][label[(i - 1) * M + j]] = -1.0;
+      if (i + 1 < N) A[row][label[(i + 1) * M + j]] = -1.0;
+      if (j > 0)     A[row][label[i * M + j - 1]] = -1.0;
+      if (j + 1 < M) A[row][label[i * M + j + 1]] = -1.0;
+    }
+  A[label[n - 2]][label[n - 2]] = 1.0;
+  A[label[n - 1]][label[n - 1]] = 1.0;
+  return A;
+}
+
+/** @brief Checks that r is a permutation of 0, ..., n-1 */
+bool is_permutation(std::vector<unsigned int> const & r)
+{
+  std::vector<bool> found(r.size(), false);
+  for (std::size_t i = 0; i < r.size(); ++i)
+  {
+    if (r[i] >= r.size() || found[r[i]])
+      return false;
+    found[r[i]] = true;
+  }
+  return true;
+}
+
+/** @brief Bandwidth of the matrix after relabeling node i to r[i] */
+std::size_t bandwidth(std::vector<std::map<unsigned int, double> > const & A, std::vector<unsigned int> const & r)
+{
+  std::size_t bw = 0;
+  for (std::size_t i = 0; i < A.size(); ++i)
+    for (std::map<unsigned int, double>::const_iterator it = A[i].begin(); it != A[i].end(); ++it)
+      bw = std::max<std::size_t>(bw, static_cast<std::size_t>(std::abs(long(r[i]) - long(r[it->first]))));
+  return bw;
+}
+
+/** @brief Number of nonzeros of the Cholesky factor after relabeling node i to r[i], computed by symbolic elimination */
+std::size_t cholesky_nnz(std::vector<std::map<unsigned int, double> > const & A, std::vector<unsigned int> const & r)
+{
+  std::size_t n = A.size();
+  std::vector<std::set<unsigned int> > pattern(n);  // strictly lower part of column k of L
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::map<unsigned int, double>::const_iterator it = A[i].begin(); it != A[i].end(); ++it)
+      if (r[it->first] > r[i])
+        pattern[r[i]].insert(r[it->first]);
+
+  std::size_t nnz = n;
+  for (std::size_t k = 0; k < n; ++k)
+  {
+    nnz += pattern[k].size();
+    if (pattern[k].empty())
+      continue;
+    unsigned int parent = *pattern[k].begin();   // merge into the parent in the elimination tree
+    for (std::set<unsigned int>::const_iterator it = pattern[k].begin(); it != pattern[k].end(); ++it)
+      if (*it != parent)
+        pattern[parent].insert(*it);
+  }
+  return nnz;
+}
+
+/** @brief Checks B(r[i], r[j]) = A(i, j) and P A x = B P x */
+int check_permute(std::vector<std::map<unsigned int, double> > const & A, viennacl::compressed_matrix<double> const & vcl_A, std::vector<unsigned int> const & r)
+{
+  viennacl::compressed_matrix<double> vcl_B = viennacl::permute(vcl_A, r);
+
+  std::vector<std::map<unsigned int, double> > B(A.size());
+  viennacl::copy(vcl_B, B);
+  std::size_t nnz = 0;
+  for (std::size_t i = 0; i < A.size(); ++i)
+  {
+    nnz += A[i].size();
+    for (std::map<unsigned int, double>::const_iterator it = A[i].begin(); it != A[i].end(); ++it)
+      if (B[r[i]].count(r[it->first]) == 0 || B[r[i]].find(r[it->first])->second != it->second)
+      {
+        std::cout << "# Error: Entry (" << i << ", " << it->first << ") not permuted correctly!" << std::endl;
+        return EXIT_FAILURE;
+      }
+  }
+  if (vcl_B.nnz() != nnz)
+  {
+    std::cout << "# Error: Permuted matrix has " << vcl_B.nnz() << " instead of " << nnz << " nonzeros!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  viennacl::vector<double> x(A.size());
+  for (std::size_t i = 0; i < A.size(); ++i)
+    x[i] = double(i % 13) - 5.0;
+  viennacl::vector<double> Ax  = viennacl::linalg::prod(vcl_A, x);
+  viennacl::vector<double> PAx = viennacl::permute(Ax, r);
+  viennacl::vector<double> Px  = viennacl::permute(x, r);
+  viennacl::vector<double> BPx = viennacl::linalg::prod(vcl_B, Px);
+  BPx -= PAx;
+  if (viennacl::linalg::norm_2(BPx) > 1e-12 * viennacl::linalg::norm_2(PAx))
+  {
+    std::cout << "# Error: Permuted matrix-vector product does not match!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/** @brief Checks that solving with a permuted_matrix yields the solution of the original system in the original ordering */
+template<typename ReorderTagT>
+int check_permuted_solve(viennacl::compressed_matrix<double> const & vcl_A, ReorderTagT const & tag)
+{
+  viennacl::permuted_matrix<double> P(vcl_A, tag);
+
+  viennacl::vector<double> x(vcl_A.size1());
+  for (std::size_t i = 0; i < x.size(); ++i)
+    x[i] = double(i % 7) + 1.0;
+  viennacl::vector<double> rhs = viennacl::linalg::prod(vcl_A, x);
+
+  // permutation round trip:
+  viennacl::vector<double> y(x.size()), z(x.size());
+  P.permute(x, y);
+  P.inverse_permute(y, z);
+  z -= x;
+  if (viennacl::linalg::norm_2(z) > 0)
+  {
+    std::cout << "# Error: Permutation round trip of permuted_matrix failed!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  viennacl::linalg::ilu0_precond<viennacl::compressed_matrix<double> > ilu0(P.matrix(), viennacl::linalg::ilu0_tag());
+  viennacl::vector<double> result_cg       = viennacl::linalg::solve(P, rhs, viennacl::linalg::cg_tag(1e-12, 1000));
+  viennacl::vector<double> result_bicgstab = viennacl::linalg::solve(P, rhs, viennacl::linalg::bicgstab_tag(1e-12, 1000), ilu0);
+  viennacl::vector<double> result_gmres    = viennacl::linalg::solve(P, rhs, viennacl::linalg::gmres_tag(1e-12, 1000, 30), ilu0);
+  result_cg       -= x;
+  result_bicgstab -= x;
+  result_gmres    -= x;
+  if (   viennacl::linalg::norm_2(result_cg)       > 1e-8 * viennacl::linalg::norm_2(x)
+      || viennacl::linalg::norm_2(result_bicgstab) > 1e-8 * viennacl::linalg::norm_2(x)
+      || viennacl::linalg::norm_2(result_gmres)    > 1e-8 * viennacl::linalg::norm_2(x))
+  {
+    std::cout << "# Error: Solution of permuted system does not match!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/** @brief Checks that nodes with the same color are not coupled (distance 1) and have no common neighbor (distance 2) */
+bool is_coloring(std::vector<std::map<unsigned int, double> > const & A, std::vector<unsigned int> const & colors, std::size_t distance)
+{
+  for (std::size_t i = 0; i < A.size(); ++i)
+    for (std::map<unsigned int, double>::const_iterator it = A[i].begin(); it != A[i].end(); ++it)
+    {
+      if (it->first != i && colors[it->first] == colors[i])
+        return false;
+      if (distance > 1)
+        for (std::map<unsigned int, double>::const_iterator it2 = A[it->first].begin(); it2 != A[it->first].end(); ++it2)
+          if (it2->first != i && colors[it2->first] == colors[i])
+            return false;
+    }
+  return true;
+}
+
+/** @brief Checks the colorings and the preconditioners using them (multicolor SOR, multicolor ILU0) */
+int check_coloring(std::vector<std::map<unsigned int, double> > const & A, viennacl::compressed_matrix<double> const & vcl_A)
+{
+  std::vector<unsigned int> colors_1 = viennacl::color(vcl_A, viennacl::graph_coloring_tag(1));
+  std::vector<unsigned int> colors_2 = viennacl::color(vcl_A, viennacl::graph_coloring_tag(2));
+  std::cout << "Colors of distance-1 coloring: " << *std::max_element(colors_1.begin(), colors_1.end()) + 1
+            << ", of distance-2 coloring: " << *std::max_element(colors_2.begin(), colors_2.end()) + 1 << std::endl;
+  if (!is_coloring(A, colors_1, 1) || !is_coloring(A, colors_2, 2))
+  {
+    std::cout << "# Error: Invalid graph coloring!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<unsigned int> r = viennacl::reorder(vcl_A, viennacl::graph_coloring_tag());
+  if (!is_permutation(r))
+  {
+    std::cout << "# Error: Multicolor ordering is not a permutation!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (std::size_t i = 0; i < A.size(); ++i)
+    for (std::size_t j = 0; j < A.size(); ++j)
+      if (r[i] < r[j] && colors_1[i] > colors_1[j])
+      {
+        std::cout << "# Error: Multicolor ordering does not number the nodes color by color!" << std::endl;
+        return EXIT_FAILURE;
+      }
+
+  viennacl::vector<double> x(vcl_A.size1());
+  for (std::size_t i = 0; i < x.size(); ++i)
+    x[i] = double(i % 7) + 1.0;
+  viennacl::vector<double> rhs = viennacl::linalg::prod(vcl_A, x);
+
+  viennacl::linalg::cg_tag unprecond_tag(1e-10, 1000);
+  viennacl::linalg::solve(vcl_A, rhs, unprecond_tag);
+
+  viennacl::linalg::cg_tag ssor_tag(1e-10, 1000);
+  viennacl::linalg::sor_precond<viennacl::compressed_matrix<double> > ssor(vcl_A, viennacl::linalg::sor_tag(1.2, 1, true));
+  viennacl::vector<double> result_ssor = viennacl::linalg::solve(vcl_A, rhs, ssor_tag, ssor);
+
+  viennacl::linalg::bicgstab_tag gs_tag(1e-10, 1000);
+  viennacl::linalg::sor_precond<viennacl::compressed_matrix<double> > gs(vcl_A, viennacl::linalg::sor_tag());
+  viennacl::vector<double> result_gs = viennacl::linalg::solve(vcl_A, rhs, gs_tag, gs);
+
+  viennacl::linalg::bicgstab_tag ilu_tag(1e-10, 1000);
+  viennacl::linalg::ilu0_precond<viennacl::compressed_matrix<double> > ilu0(vcl_A, viennacl::linalg::ilu0_tag(false, true));
+  viennacl::vector<double> result_ilu0 = viennacl::linalg::solve(vcl_A, rhs, ilu_tag, ilu0);
+
+  std::cout << "CG iterations without preconditioner: " << unprecond_tag.iters() << ", with multicolor SSOR: " << ssor_tag.iters()
+            << " (" << ssor.colors() << " colors)" << std::endl;
+  std::cout << "BiCGStab iterations with multicolor Gauss-Seidel: " << gs_tag.iters() << ", with multicolor ILU0: " << ilu_tag.iters()
+            << " (" << ilu0.levels() << " levels)" << std::endl;
+
+  result_ssor -= x;
+  result_gs   -= x;
+  result_ilu0 -= x;
+  if (   viennacl::linalg::norm_2(result_ssor) > 1e-7 * viennacl::linalg::norm_2(x)
+      || viennacl::linalg::norm_2(result_gs)   > 1e-7 * viennacl::linalg::norm_2(x)
+      || viennacl::linalg::norm_2(result_ilu0) > 1e-7 * viennacl::linalg::norm_2(x))
+  {
+    std::cout << "# Error: Solution with multicolor preconditioner does not match!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (ssor_tag.iters() >= unprecond_tag.iters() || ilu0.levels() > ssor.colors())
+  {
+    std::cout << "# Error: Multicolor preconditioners not effective!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/** @brief Removes the coupling a_ki of every third pair of coupled nodes i < k, which results in a nonsymmetric pattern */
+std::vector<std::map<unsigned int, double> > nonsymmetric_matrix(std::vector<std::map<unsigned int, double> > const & A)
+{
+  std::vector<std::map<unsigned int, double> > B(A);
+  for (std::size_t i = 0; i < A.size(); ++i)
+    for (std::map<unsigned int, double>::const_iterator it = A[i].begin(); it != A[i].end(); ++it)
+      if (i < it->first && (i + it->first) % 3 == 0)
+        B[it->first].erase(static_cast<unsigned int>(i));
+  return B;
+}
+
+/** @brief Checks the colorings and the multicolor preconditioners for a matrix with nonsymmetric pattern: nodes i and k are coupled if a_ik != 0 or a_ki != 0 */
+int check_nonsymmetric_coloring(std::vector<std::map<unsigned int, double> > const & A)
+{
+  viennacl::compressed_matrix<double> vcl_A;
+  viennacl::copy(A, vcl_A);
+
+  // adjacency graph A + A^T:
+  std::vector<std::map<unsigned int, double> > A_sym(A);
+  for (std::size_t i = 0; i < A.size(); ++i)
+    for (std::map<unsigned int, double>::const_iterator it = A[i].begin(); it != A[i].end(); ++it)
+      A_sym[it->first][static_cast<unsigned int>(i)] = 1.0;
+
+  std::vector<unsigned int> colors_1 = viennacl::color(vcl_A, viennacl::graph_coloring_tag(1));
+  std::vector<unsigned int> colors_2 = viennacl::color(vcl_A, viennacl::graph_coloring_tag(2));
+  std::cout << "Nonsymmetric pattern: colors of distance-1 coloring: " << *std::max_element(colors_1.begin(), colors_1.end()) + 1
+            << ", of distance-2 coloring: " << *std::max_element(colors_2.begin(), colors_2.end()) + 1 << std::endl;
+  if (!is_coloring(A_sym, colors_1, 1) || !is_coloring(A_sym, colors_2, 2))
+  {
+    std::cout << "# Error: Invalid graph coloring for nonsymmetric pattern!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  viennacl::vector<double> x(vcl_A.size1());
+  for (std::size_t i = 0; i < x.size(); ++i)
+    x[i] = double(i % 7) + 1.0;
+  viennacl::vector<double> rhs = viennacl::linalg::prod(vcl_A, x);
+
+  viennacl::linalg::bicgstab_tag gs_tag(1e-10, 1000);
+  viennacl::linalg::sor_precond<viennacl::compressed_matrix<double> > gs(vcl_A, viennacl::linalg::sor_tag());
+  viennacl::vector<double> result_gs = viennacl::linalg::solve(vcl_A, rhs, gs_tag, gs);
+
+  viennacl::linalg::bicgstab_tag ilu_tag(1e-10, 1000);
+  viennacl::linalg::ilu0_precond<viennacl::compressed_matrix<double> > ilu0(vcl_A, viennacl::linalg::ilu0_tag(false, true));
+  viennacl::vector<double> result_ilu0 = viennacl::linalg::solve(vcl_A, rhs, ilu_tag, ilu0);
+
+  std::cout << "Nonsymmetric pattern: BiCGStab iterations with multicolor Gauss-Seidel: " << gs_tag.iters() << ", with multicolor ILU0: " << ilu_tag.iters() << std::endl;
+
+  result_gs   -= x;
+  result_ilu0 -= x;
+  if (   viennacl::linalg::norm_2(result_gs)   > 1e-7 * viennacl::linalg::norm_2(x)
+      || viennacl::linalg::norm_2(result_ilu0) > 1e-7 * viennacl::linalg::norm_2(x))
+  {
+    std::cout << "# Error: Solution with multicolor preconditioner does not match for nonsymmetric pattern!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: Reordering of Sparse Matrices" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  std::size_t N = 40;
+  std::size_t M = 30;
+  std::vector<std::map<unsigned int, double> > A = grid_matrix(N, M, true);
+  viennacl::compressed_matrix<double> vcl_A;
+  viennacl::copy(A, vcl_A);
+
+  std::vector<unsigned int> identity(A.size());
+  for (std::size_t i = 0; i < identity.size(); ++i)
+    identity[i] = static_cast<unsigned int>(i);
+  std::size_t shuffled_bandwidth = bandwidth(A, identity);
+  std::cout << "Bandwidth of shuffled matrix: " << shuffled_bandwidth << std::endl;
+
+  // Cuthill-McKee and reverse Cuthill-McKee:
+  std::vector<unsigned int> r_cm  = viennacl::reorder(vcl_A, viennacl::cuthill_mckee_tag());
+  std::vector<unsigned int> r_rcm = viennacl::reorder(vcl_A, viennacl::reverse_cuthill_mckee_tag());
+  if (!is_permutation(r_cm) || !is_permutation(r_rcm))
+  {
+    std::cout << "# Error: Cuthill-McKee did not return a permutation!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Bandwidth after Cuthill-McKee: " << bandwidth(A, r_cm) << ", after reverse Cuthill-McKee: " << bandwidth(A, r_rcm) << std::endl;
+  if (bandwidth(A, r_cm) > M + 1 || bandwidth(A, r_rcm) != bandwidth(A, r_cm))
+  {
+    std::cout << "# Error: Bandwidth not reduced sufficiently!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (std::size_t i = 0; i < A.size(); ++i)
+    if (r_rcm[i] != A.size() - 1 - r_cm[i])
+    {
+      std::cout << "# Error: Reverse Cuthill-McKee ordering is not the reversed Cuthill-McKee ordering!" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+  // nested dissection:
+  std::vector<unsigned int> r_nd = viennacl::reorder(vcl_A, viennacl::nested_dissection_tag(16));
+  if (!is_permutation(r_nd))
+  {
+    std::cout << "# Error: Nested dissection did not return a permutation!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::size_t fill_rcm = cholesky_nnz(A, r_rcm);
+  std::size_t fill_nd  = cholesky_nnz(A, r_nd);
+  std::cout << "Nonzeros of Cholesky factor after reverse Cuthill-McKee: " << fill_rcm << ", after nested dissection: " << fill_nd << std::endl;
+  if (fill_nd >= fill_rcm)
+  {
+    std::cout << "# Error: Nested dissection does not reduce fill-in!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // permutations:
+  if (check_permute(A, vcl_A, r_rcm) != EXIT_SUCCESS || check_permute(A, vcl_A, r_nd) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+  // solvers on permuted matrices:
+  if (   check_permuted_solve(vcl_A, viennacl::reverse_cuthill_mckee_tag()) != EXIT_SUCCESS
+      || check_permuted_solve(vcl_A, viennacl::nested_dissection_tag(16)) != EXIT_SUCCESS
+      || check_permuted_solve(vcl_A, r_rcm) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+  // graph colorings and multicolor preconditioners:
+  if (check_coloring(A, vcl_A) != EXIT_SUCCESS || check_nonsymmetric_coloring(nonsymmetric_matrix(A)) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -29,6 +29,7 @@
 
 #include "viennacl/scalar.hpp"
 #include "viennacl/vector.hpp"
+#include "viennacl/matrix.hpp"
 
 
 #include "viennacl/linalg/bisect.hpp"
@@ -168,6 +169,45 @@ bool runTest(unsigned int mat_size)
          return false;
        }
     }
+
+    // ---------------Check the eigenvectors---------------
+    // Residuals |T z - lambda z| and orthogonality of the eigenvectors computed by inverse iteration
+    std::cout << "Start the inverse iteration..." << std::endl;
+    viennacl::matrix<NumericT> eigenvectors(mat_size, mat_size);
+    bResult = viennacl::linalg::bisect(diagonal, superdiagonal, eigenvalues_bisect, eigenvectors);
+    if (bResult == false)
+     return false;
+
+    std::vector<std::vector<NumericT> > Z(mat_size, std::vector<NumericT>(mat_size));
+    viennacl::copy(eigenvectors, Z);
+    for (unsigned int j = 0; j < mat_size; j++)
+    {
+      for (unsigned int i = 0; i < mat_size; i++)
+      {
+        NumericT residual = (diagonal[i] - eigenvalues_bisect[j]) * Z[i][j];
+        if (i > 0)
+          residual += superdiagonal[i] * Z[i-1][j];
+        if (i + 1 < mat_size)
+          residual += superdiagonal[i+1] * Z[i+1][j];
+        if (std::abs(residual) > EPS)
+        {
+          std::cout << "Residual of eigenvector " << j << " too large: " << residual << "\n";
+          return false;
+        }
+      }
+
+      for (unsigned int k = 0; k <= j; k++)
+      {
+        NumericT dot = 0;
+        for (unsigned int i = 0; i < mat_size; i++)
+          dot += Z[i][j] * Z[i][k];
+        if (std::abs(dot - ((j == k) ? NumericT(1) : NumericT(0))) > EPS)
+        {
+          std::cout << "Eigenvectors " << j << " and " << k << " not orthonormal: " << dot << "\n";
+          return false;
+        }
+      }
+    }
 /*
     // ------------Print the results---------------
     std::cout << "mat_size = " << mat_size << std::endl;
@@ -0,0 +1,275 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/blas3_symmetric.cpp  Tests the symmetric rank-k and rank-2k updates and the symmetric matrix-vector product.
+*   \test  Tests the symmetric rank-k and rank-2k updates and the symmetric matrix-vector product.
+**/
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "viennacl/matrix.hpp"
+#include "viennacl/matrix_proxy.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/matrix_operations.hpp"
+#include "viennacl/tools/random.hpp"
+
+
+/** @brief Returns max_ij |A_ij - B_ij|, where only the lower (lower = true) or upper triangle is compared if triangular is set. */
+template<typename NumericT, typename VCLMatrixType>
+NumericT diff(std::vector<std::vector<NumericT> > const & A, VCLMatrixType const & vcl_B, bool triangular = false, bool lower = true)
+{
+  std::vector<std::vector<NumericT> > B(vcl_B.size1(), std::vector<NumericT>(vcl_B.size2()));
+  viennacl::copy(vcl_B, B);
+
+  NumericT ret = 0;
+  for (std::size_t i=0; i<A.size(); ++i)
+    for (std::size_t j=0; j<A[i].size(); ++j)
+      if (!triangular || (lower ? j <= i : j >= i))
+        ret = std::max(ret, std::fabs(A[i][j] - B[i][j]));
+  return ret;
+}
+
+template<typename NumericT, typename LayoutA, typename LayoutC>
+int test_updates(std::size_t n, std::size_t k, NumericT eps)
+{
+  viennacl::tools::uniform_random_numbers<NumericT> randomNumber;
+  NumericT alpha = NumericT(1.5);
+  NumericT beta  = NumericT(0.5);
+
+  // A and B are k x n, C is symmetric:
+  std::vector<std::vector<NumericT> > A(k, std::vector<NumericT>(n)), B(k, std::vector<NumericT>(n)), C(n, std::vector<NumericT>(n));
+  for (std::size_t i=0; i<k; ++i)
+    for (std::size_t j=0; j<n; ++j)
+    {
+      A[i][j] = randomNumber() - NumericT(0.5);
+      B[i][j] = randomNumber() - NumericT(0.5);
+    }
+  for (std::size_t i=0; i<n; ++i)
+    for (std::size_t j=0; j<=i; ++j)
+      C[i][j] = C[j][i] = randomNumber();
+
+  std::vector<std::vector<NumericT> > AtA(n, std::vector<NumericT>(n)), AtB(n, std::vector<NumericT>(n));
+  for (std::size_t i=0; i<n; ++i)
+    for (std::size_t j=0; j<n; ++j)
+      for (std::size_t l=0; l<k; ++l)
+      {
+        AtA[i][j] += A[l][i] * A[l][j];
+        AtB[i][j] += A[l][i] * B[l][j] + B[l][i] * A[l][j];
+      }
+
+  // operate on submatrices in order to test offsets:
+  viennacl::matrix<NumericT, LayoutA> vcl_A_full(k + 3, n + 2), vcl_B_full(k + 3, n + 2);
+  viennacl::matrix<NumericT, LayoutC> vcl_C_full(n + 2, n + 4);
+  viennacl::matrix_range<viennacl::matrix<NumericT, LayoutA> > vcl_A(vcl_A_full, viennacl::range(1, k + 1), viennacl::range(2, n + 2));
+  viennacl::matrix_range<viennacl::matrix<NumericT, LayoutA> > vcl_B(vcl_B_full, viennacl::range(1, k + 1), viennacl::range(2, n + 2));
+  viennacl::matrix_range<viennacl::matrix<NumericT, LayoutC> > vcl_C(vcl_C_full, viennacl::range(1, n + 1), viennacl::range(3, n + 3));
+  viennacl::copy(A, vcl_A);
+  viennacl::copy(B, vcl_B);
+
+  viennacl::matrix<NumericT, LayoutA> vcl_A_trans = viennacl::trans(vcl_A);
+  viennacl::matrix<NumericT, LayoutA> vcl_B_trans = viennacl::trans(vcl_B);
+
+  std::vector<std::vector<NumericT> > ref(n, std::vector<NumericT>(n));
+
+  // full results:
+  for (std::size_t i=0; i<n; ++i)
+    for (std::size_t j=0; j<n; ++j)
+      ref[i][j] = alpha * AtA[i][j] + beta * C[i][j];
+
+  viennacl::copy(C, vcl_C);
+  viennacl::linalg::syrk(vcl_A, true, vcl_C, alpha, beta);
+  if (diff(ref, vcl_C) > eps)
+  {
+    std::cout << "# Error at syrk(trans(A)) with n = " << n << ", k = " << k << ": " << diff(ref, vcl_C) << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  viennacl::copy(C, vcl_C);
+  viennacl::linalg::syrk(vcl_A_trans, false, vcl_C, alpha, beta);
+  if (diff(ref, vcl_C) > eps)
+  {
+    std::cout << "# Error at syrk(A) with n = " << n << ", k = " << k << ": " << diff(ref, vcl_C) << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (std::size_t i=0; i<n; ++i)
+    for (std::size_t j=0; j<n; ++j)
+      ref[i][j] = alpha * AtB[i][j] + beta * C[i][j];
+
+  viennacl::copy(C, vcl_C);
+  viennacl::linalg::syr2k(vcl_A, vcl_B, true, vcl_C, alpha, beta);
+  if (diff(ref, vcl_C) > eps)
+  {
+    std::cout << "# Error at syr2k(trans(A), trans(B)) with n = " << n << ", k = " << k << ": " << diff(ref, vcl_C) << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // triangular results, the strict lower part must remain unchanged:
+  for (std::size_t i=0; i<n; ++i)
+    for (std::size_t j=0; j<i; ++j)
+      ref[i][j] = C[i][j];
+
+  viennacl::copy(C, vcl_C);
+  viennacl::linalg::syr2k(vcl_A_trans, vcl_B_trans, false, vcl_C, alpha, beta, viennacl::linalg::upper_tag());
+  if (diff(ref, vcl_C) > eps)
+  {
+    std::cout << "# Error at syr2k(A, B, upper_tag) with n = " << n << ", k = " << k << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (std::size_t i=0; i<n; ++i)
+    for (std::size_t j=0; j<n; ++j)
+      ref[i][j] = alpha * AtA[i][j];
+
+  viennacl::copy(C, vcl_C);
+  viennacl::linalg::syrk(vcl_A, true, vcl_C, alpha, NumericT(0), viennacl::linalg::lower_tag());
+  if (diff(ref, vcl_C, true, true) > eps)
+  {
+    std::cout << "# Error at syrk(trans(A), lower_tag) with n = " << n << ", k = " << k << ": " << diff(ref, vcl_C, true, true) << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // expression layer: prod(trans(A), A) and prod(A, trans(A)) are symmetric rank-k updates:
+  for (std::size_t i=0; i<n; ++i)
+    for (std::size_t j=0; j<n; ++j)
+      ref[i][j] = AtA[i][j];
+
+  vcl_C = viennacl::linalg::prod(viennacl::trans(vcl_A), vcl_A);
+  if (diff(ref, vcl_C) > eps)
+  {
+    std::cout << "# Error at C = prod(trans(A), A) with n = " << n << ", k = " << k << ": " << diff(ref, vcl_C) << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vcl_C = viennacl::linalg::prod(vcl_A_trans, viennacl::trans(vcl_A_trans));
+  if (diff(ref, vcl_C) > eps)
+  {
+    std::cout << "# Error at C = prod(A, trans(A)) with n = " << n << ", k = " << k << ": " << diff(ref, vcl_C) << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+template<typename NumericT, typename LayoutT>
+int test_symv(std::size_t n, NumericT eps)
+{
+  viennacl::tools::uniform_random_numbers<NumericT> randomNumber;
+  NumericT alpha = NumericT(2);
+  NumericT beta  = NumericT(0.5);
+
+  std::vector<std::vector<NumericT> > A(n, std::vector<NumericT>(n));
+  std::vector<NumericT> x(n), y(n);
+  for (std::size_t i=0; i<n; ++i)
+  {
+    for (std::size_t j=0; j<n; ++j)
+      A[i][j] = randomNumber();
+    x[i] = randomNumber();
+    y[i] = randomNumber();
+  }
+
+  viennacl::matrix<NumericT, LayoutT> vcl_A_full(n + 3, n + 2);
+  viennacl::matrix_range<viennacl::matrix<NumericT, LayoutT> > vcl_A(vcl_A_full, viennacl::range(1, n + 1), viennacl::range(2, n + 2));
+  viennacl::copy(A, vcl_A);
+
+  viennacl::vector<NumericT> vcl_x_full(2 * n);
+  viennacl::vector_slice<viennacl::vector<NumericT> > vcl_x(vcl_x_full, viennacl::slice(1, 2, n));
+  viennacl::vector<NumericT> vcl_y(n);
+  viennacl::copy(x, vcl_x);
+
+  for (std::size_t upper = 0; upper < 2; ++upper)
+  {
+    viennacl::copy(y, vcl_y);
+    if (upper)
+      viennacl::linalg::symv(vcl_A, vcl_x, vcl_y, alpha, beta, viennacl::linalg::upper_tag());
+    else
+      viennacl::linalg::symv(vcl_A, vcl_x, vcl_y, alpha, beta, viennacl::linalg::lower_tag());
+
+    std::vector<NumericT> result(n);
+    viennacl::copy(vcl_y, result);
+    for (std::size_t i=0; i<n; ++i)
+    {
+      NumericT ref = beta * y[i];
+      for (std::size_t j=0; j<n; ++j)
+        ref += alpha * ((upper ? j >= i : j <= i) ? A[i][j] : A[j][i]) * x[j];
+      if (std::fabs(ref - result[i]) > eps * NumericT(n))
+      {
+        std::cout << "# Error at symv(" << (upper ? "upper" : "lower") << ") with n = " << n << ": " << std::fabs(ref - result[i]) << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
+template<typename NumericT, typename LayoutA, typename LayoutC>
+int test(NumericT eps)
+{
+  std::size_t sizes[] = {1, 17, 70, 131};
+  std::size_t ranks[] = {1, 9, 66};
+
+  for (std::size_t i=0; i<sizeof(sizes) / sizeof(sizes[0]); ++i)
+  {
+    for (std::size_t j=0; j<sizeof(ranks) / sizeof(ranks[0]); ++j)
+      if (test_updates<NumericT, LayoutA, LayoutC>(sizes[i], ranks[j], eps) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+    if (test_symv<NumericT, LayoutA>(sizes[i], eps) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: Symmetric Rank-k Updates and Matrix-Vector Products" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "# Testing setup: float, row-major A, row-major C" << std::endl;
+  if (test<float, viennacl::row_major, viennacl::row_major>(1e-4f) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+  std::cout << "# Testing setup: float, column-major A, row-major C" << std::endl;
+  if (test<float, viennacl::column_major, viennacl::row_major>(1e-4f) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+#ifdef VIENNACL_WITH_OPENCL
+  if ( viennacl::ocl::current_device().double_support() )
+#endif
+  {
+    std::cout << "# Testing setup: double, row-major A, column-major C" << std::endl;
+    if (test<double, viennacl::row_major, viennacl::column_major>(1e-10) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+    std::cout << "# Testing setup: double, column-major A, column-major C" << std::endl;
+    if (test<double, viennacl::column_major, viennacl::column_major>(1e-10) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+  }
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}
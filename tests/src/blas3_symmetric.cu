@@ -0,0 +1 @@
+blas3_symmetric.cpp
\ No newline at end of file
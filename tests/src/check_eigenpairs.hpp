@@ -0,0 +1,63 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/check_eigenpairs.hpp  Helper for checking eigenpairs computed by the iterative eigensolvers.
+**/
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include "viennacl/vector.hpp"
+#include "viennacl/matrix.hpp"
+#include "viennacl/matrix_proxy.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+
+/** @brief Checks |A x_i - lambda_i x_i| for all computed eigenpairs as well as the computed eigenvalues against the reference values. */
+template<typename NumericT, typename MatrixT>
+int check_eigenpairs(MatrixT const & A, viennacl::matrix<NumericT> const & eigenvectors,
+                     std::vector<NumericT> const & eigenvalues, std::vector<NumericT> const & reference,
+                     NumericT eps, std::string const & name)
+{
+  if (eigenvalues.size() != reference.size())
+  {
+    std::cout << "# Error: " << name << " returned " << eigenvalues.size() << " instead of " << reference.size() << " eigenvalues." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (unsigned int i=0; i<reference.size(); ++i)  // column() takes the column index as unsigned int
+  {
+    viennacl::vector<NumericT> x = viennacl::column(eigenvectors, i);
+    viennacl::vector<NumericT> Ax = viennacl::linalg::prod(A, x);
+    Ax -= eigenvalues[i] * x;
+
+    NumericT residual = viennacl::linalg::norm_2(Ax) / viennacl::linalg::norm_2(x);
+    NumericT error    = std::fabs(eigenvalues[i] - reference[i]) / std::fabs(reference[i]);
+    if (residual > eps || error > eps)
+    {
+      std::cout << "# Error: " << name << " failed for eigenvalue " << i << ". Computed: " << eigenvalues[i] << ", reference: " << reference[i]
+                << ", residual: " << residual << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
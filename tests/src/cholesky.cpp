@@ -0,0 +1,178 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/cholesky.cpp  Tests the dense Cholesky and LDL^T factorizations.
+*   \test  Tests the dense Cholesky and LDL^T factorizations.
+**/
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "viennacl/matrix.hpp"
+#include "viennacl/matrix_proxy.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/linalg/cholesky.hpp"
+#include "viennacl/tools/random.hpp"
+
+
+/** @brief Returns the relative residual max_i |(A x - b)_i| / (|A| |x|) for all columns of X */
+template<typename NumericT, typename VCLMatrixType>
+NumericT residual(std::vector<std::vector<NumericT> > const & A, VCLMatrixType const & vcl_X, std::vector<std::vector<NumericT> > const & B)
+{
+  std::vector<std::vector<NumericT> > X(vcl_X.size1(), std::vector<NumericT>(vcl_X.size2()));
+  viennacl::copy(vcl_X, X);
+
+  NumericT norm_A = 0, norm_X = 0, norm_R = 0;
+  for (std::size_t i=0; i<A.size(); ++i)
+    for (std::size_t j=0; j<A.size(); ++j)
+      norm_A = std::max(norm_A, std::fabs(A[i][j]));
+
+  for (std::size_t j=0; j<B[0].size(); ++j)
+    for (std::size_t i=0; i<A.size(); ++i)
+    {
+      NumericT r = -B[i][j];
+      for (std::size_t k=0; k<A.size(); ++k)
+        r += A[i][k] * X[k][j];
+      norm_R = std::max(norm_R, std::fabs(r));
+      norm_X = std::max(norm_X, std::fabs(X[i][j]));
+    }
+
+  return norm_R / (norm_A * norm_X * NumericT(A.size()));
+}
+
+/** @brief Factors a symmetric matrix (positive definite if spd is set, otherwise with zero diagonal to enforce 2x2 pivots) and solves for several right hand sides. */
+template<typename NumericT, typename LayoutT>
+int test_factorization(std::size_t n, bool spd, viennacl::linalg::cholesky_tag const & tag, NumericT eps)
+{
+  viennacl::tools::uniform_random_numbers<NumericT> randomNumber;
+  std::size_t num_rhs = 3;
+
+  std::vector<std::vector<NumericT> > A(n, std::vector<NumericT>(n));
+  std::vector<std::vector<NumericT> > B(n, std::vector<NumericT>(num_rhs));
+  for (std::size_t i=0; i<n; ++i)
+  {
+    for (std::size_t j=0; j<i; ++j)
+      A[i][j] = A[j][i] = randomNumber() - NumericT(0.5);
+    A[i][i] = spd ? NumericT(n) : NumericT(0);
+    for (std::size_t j=0; j<num_rhs; ++j)
+      B[i][j] = randomNumber();
+  }
+
+  // operate on submatrices in order to test offsets:
+  viennacl::matrix<NumericT, LayoutT> vcl_A_full(n + 3, n + 2);
+  viennacl::matrix<NumericT, LayoutT> vcl_B_full(n + 2, num_rhs + 1);
+  viennacl::matrix_range<viennacl::matrix<NumericT, LayoutT> > vcl_A(vcl_A_full, viennacl::range(1, n + 1), viennacl::range(2, n + 2));
+  viennacl::matrix_range<viennacl::matrix<NumericT, LayoutT> > vcl_B(vcl_B_full, viennacl::range(2, n + 2), viennacl::range(1, num_rhs + 1));
+  viennacl::copy(A, vcl_A);
+  viennacl::copy(B, vcl_B);
+
+  if (spd)
+  {
+    viennacl::linalg::cholesky_factorize(vcl_A, tag);
+    viennacl::linalg::cholesky_substitute(vcl_A, vcl_B);
+  }
+  else
+  {
+    std::vector<viennacl::vcl_ptrdiff_t> pivots;
+    if (!viennacl::linalg::ldlt_factorize(vcl_A, pivots, tag))
+    {
+      std::cout << "# Error: LDL^T factorization reports a singular matrix" << std::endl;
+      return EXIT_FAILURE;
+    }
+    viennacl::linalg::ldlt_substitute(vcl_A, pivots, vcl_B);
+  }
+
+  NumericT res = residual(A, vcl_B, B);
+  if (res > eps)
+  {
+    std::cout << "# Error: " << (spd ? "Cholesky" : "LDL^T") << " factorization with n = " << n << ", block size " << tag.block_size()
+              << (tag.left_looking() ? " (left-looking)" : "") << " failed, residual: " << res << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+template<typename NumericT, typename LayoutT>
+int test(NumericT eps)
+{
+  std::size_t sizes[] = {1, 7, 64, 131};
+  viennacl::vcl_size_t block_sizes[] = {4, 32, 96};
+
+  for (std::size_t i=0; i<sizeof(sizes) / sizeof(sizes[0]); ++i)
+    for (std::size_t j=0; j<sizeof(block_sizes) / sizeof(block_sizes[0]); ++j)
+    {
+      if (test_factorization<NumericT, LayoutT>(sizes[i], true, viennacl::linalg::cholesky_tag(block_sizes[j], false), eps) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+      if (test_factorization<NumericT, LayoutT>(sizes[i], true, viennacl::linalg::cholesky_tag(block_sizes[j], true), eps) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+      if (sizes[i] > 1 && test_factorization<NumericT, LayoutT>(sizes[i], false, viennacl::linalg::cholesky_tag(block_sizes[j]), eps) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+    }
+
+  // matrix which is not positive definite:
+  viennacl::matrix<NumericT, LayoutT> vcl_A(2, 2);
+  std::vector<std::vector<NumericT> > A(2, std::vector<NumericT>(2, NumericT(1)));
+  A[1][1] = NumericT(-1);
+  viennacl::copy(A, vcl_A);
+  try
+  {
+    viennacl::linalg::cholesky_factorize(vcl_A);
+    std::cout << "# Error: Cholesky factorization did not detect indefinite matrix" << std::endl;
+    return EXIT_FAILURE;
+  }
+  catch (viennacl::zero_on_diagonal_exception const &) {}
+
+  return EXIT_SUCCESS;
+}
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: Dense Cholesky and LDL^T Factorizations" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "# Testing setup: float, row-major" << std::endl;
+  if (test<float, viennacl::row_major>(1e-4f) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+  std::cout << "# Testing setup: float, column-major" << std::endl;
+  if (test<float, viennacl::column_major>(1e-4f) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+#ifdef VIENNACL_WITH_OPENCL
+  if ( viennacl::ocl::current_device().double_support() )
+#endif
+  {
+    std::cout << "# Testing setup: double, row-major" << std::endl;
+    if (test<double, viennacl::row_major>(1e-10) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+    std::cout << "# Testing setup: double, column-major" << std::endl;
+    if (test<double, viennacl::column_major>(1e-10) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+  }
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}
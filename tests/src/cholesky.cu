@@ -0,0 +1 @@
+cholesky.cpp
\ No newline at end of file
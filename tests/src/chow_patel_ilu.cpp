@@ -0,0 +1,190 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/chow_patel_ilu.cpp  Tests the parallel Chow-Patel ILU0 and ICC0 preconditioners.
+*   \test  Tests the parallel Chow-Patel ILU0 and ICC0 preconditioners including asynchronous sweeps, early termination of stagnating sweeps and warm-started updates.
+**/
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include "viennacl/vector.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/cg.hpp"
+#include "viennacl/linalg/bicgstab.hpp"
+#include "viennacl/linalg/ilu.hpp"
+
+#include "laplace_2d.hpp"
+
+
+void check(bool condition, std::string const & message)
+{
+  if (!condition)
+  {
+    std::cout << "# Error: " << message << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+/** @brief Returns the relative difference of the two preconditioners applied to the same vector */
+template<typename NumericT, typename PrecondT>
+NumericT precond_diff(PrecondT const & P1, PrecondT const & P2, std::size_t N)
+{
+  viennacl::vector<NumericT> v1 = viennacl::scalar_vector<NumericT>(N, NumericT(1));
+  for (std::size_t i=0; i<N; i += 3)
+    v1[i] = NumericT(-0.5);
+  viennacl::vector<NumericT> v2 = v1;
+
+  P1.apply(v1);
+  P2.apply(v2);
+
+  viennacl::vector<NumericT> diff = v1 - v2;
+  return viennacl::linalg::norm_2(diff) / viennacl::linalg::norm_2(v2);
+}
+
+
+template<typename NumericT, typename PrecondT, typename SolverTagT>
+void test_preconditioner(std::string const & name, NumericT epsilon, SolverTagT const & solver_tag)
+{
+  unsigned int n = 30;
+  NumericT convection = (name == "ILU0") ? NumericT(0.4) : NumericT(0);
+
+  viennacl::compressed_matrix<NumericT> A(n * n, n * n);
+  viennacl::copy(laplace_2d<NumericT>(n, convection, NumericT(0)), A);
+  viennacl::compressed_matrix<NumericT> A2(n * n, n * n);
+  viennacl::copy(laplace_2d<NumericT>(n, convection, NumericT(0.1)), A2);
+
+  std::size_t N = A.size1();
+  viennacl::vector<NumericT> rhs = viennacl::scalar_vector<NumericT>(N, NumericT(1));
+
+  viennacl::vcl_size_t max_sweeps = 50;
+
+  //
+  // synchronous sweeps: all sweeps are carried out
+  //
+  viennacl::linalg::chow_patel_tag sync_tag(max_sweeps, 2);
+  PrecondT sync_precond(A, sync_tag);
+  std::cout << "* " << name << ", synchronous sweeps: " << sync_precond.sweeps_performed() << std::endl;
+  check(sync_precond.sweeps_performed() == max_sweeps, name + ": synchronous sweeps did not run to completion");
+
+  //
+  // asynchronous sweeps with stagnation check stop early, but yield the same factorization up to the tolerance
+  //
+  viennacl::linalg::chow_patel_tag async_tag(max_sweeps, 2);
+  async_tag.async_sweeps(true);
+  async_tag.sweep_tolerance(1e-3);
+  PrecondT async_precond(A, async_tag);
+  std::cout << "* " << name << ", asynchronous sweeps: " << async_precond.sweeps_performed() << std::endl;
+  check(async_precond.sweeps_performed() < max_sweeps, name + ": asynchronous sweeps did not stop early");
+  check(precond_diff<NumericT>(async_precond, sync_precond, N) < epsilon, name + ": asynchronous sweeps yield a different factorization");
+
+  //
+  // update() after a value-only change of A matches a fresh factorization and does not need more sweeps
+  //
+  PrecondT fresh_precond(A2, async_tag);
+  async_precond.update(A2);
+  NumericT update_diff = precond_diff<NumericT>(async_precond, fresh_precond, N);
+  std::cout << "* " << name << ", sweeps for update(): " << async_precond.sweeps_performed()
+            << " (fresh factorization: " << fresh_precond.sweeps_performed() << "), difference: " << update_diff << std::endl;
+  check(update_diff < epsilon, name + ": update() differs from fresh factorization");
+  check(async_precond.sweeps_performed() <= fresh_precond.sweeps_performed(), name + ": warm start requires more sweeps than a fresh factorization");
+
+  // the synchronous sweeps also support update():
+  sync_precond.update(A2);
+  check(precond_diff<NumericT>(sync_precond, fresh_precond, N) < epsilon, name + ": synchronous update() differs from fresh factorization");
+
+  //
+  // solver run with the updated preconditioner
+  //
+  SolverTagT unprecond_tag = solver_tag;
+  viennacl::linalg::solve(A2, rhs, unprecond_tag);
+
+  SolverTagT precond_tag = solver_tag;
+  viennacl::vector<NumericT> result = viennacl::linalg::solve(A2, rhs, precond_tag, async_precond);
+  viennacl::vector<NumericT> residual = rhs - viennacl::linalg::prod(A2, result);
+  NumericT rel_residual = viennacl::linalg::norm_2(residual) / viennacl::linalg::norm_2(rhs);
+  std::cout << "* " << name << ", solver iterations: " << precond_tag.iters() << " (unpreconditioned: " << unprecond_tag.iters() << "), rel. residual " << rel_residual << std::endl;
+  check(rel_residual < NumericT(100) * NumericT(solver_tag.tolerance()), name + ": solution not accurate");
+  check(precond_tag.iters() < unprecond_tag.iters(), name + ": preconditioner does not reduce the number of iterations");
+}
+
+
+template<typename NumericT>
+int test(NumericT epsilon, NumericT solver_tolerance)
+{
+  test_preconditioner<NumericT, viennacl::linalg::chow_patel_ilu_precond<viennacl::compressed_matrix<NumericT> > >("ILU0", epsilon, viennacl::linalg::bicgstab_tag(solver_tolerance, 1000));
+  test_preconditioner<NumericT, viennacl::linalg::chow_patel_icc_precond<viennacl::compressed_matrix<NumericT> > >("ICC0", epsilon, viennacl::linalg::cg_tag(solver_tolerance, 1000));
+  return EXIT_SUCCESS;
+}
+
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: Chow-Patel ILU0 and ICC0" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  int retval = EXIT_SUCCESS;
+
+  {
+    typedef float NumericT;
+    NumericT epsilon = static_cast<NumericT>(1E-2);
+    std::cout << "# Testing setup:" << std::endl;
+    std::cout << "  eps:     " << epsilon << std::endl;
+    std::cout << "  numeric: float" << std::endl;
+    retval = test<NumericT>(epsilon, NumericT(1e-5));
+    if ( retval == EXIT_SUCCESS )
+      std::cout << "# Test passed" << std::endl;
+    else
+      return retval;
+  }
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+#ifdef VIENNACL_WITH_OPENCL
+  if ( viennacl::ocl::current_device().double_support() )
+#endif
+  {
+    typedef double NumericT;
+    NumericT epsilon = 1.0E-2;
+    std::cout << "# Testing setup:" << std::endl;
+    std::cout << "  eps:     " << epsilon << std::endl;
+    std::cout << "  numeric: double" << std::endl;
+    retval = test<NumericT>(epsilon, NumericT(1e-8));
+    if ( retval == EXIT_SUCCESS )
+      std::cout << "# Test passed" << std::endl;
+    else
+      return retval;
+  }
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return retval;
+}
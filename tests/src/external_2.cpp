@@ -51,6 +51,8 @@
 #include "viennacl/linalg/bisect.hpp"
 #include "viennacl/linalg/bisect_gpu.hpp"
 #include "viennacl/linalg/cg.hpp"
+#include "viennacl/linalg/cholesky.hpp"
+#include "viennacl/linalg/tsqr.hpp"
 #include "viennacl/linalg/direct_solve.hpp"
 #include "viennacl/linalg/gmres.hpp"
 #include "viennacl/linalg/ichol.hpp"
@@ -61,9 +63,14 @@
 #include "viennacl/linalg/norm_2.hpp"
 #include "viennacl/linalg/norm_inf.hpp"
 #include "viennacl/linalg/norm_frobenius.hpp"
+#include "viennacl/linalg/polynomial_precond.hpp"
 #include "viennacl/linalg/lanczos.hpp"
+#include "viennacl/linalg/lobpcg.hpp"
+#include "viennacl/linalg/subspace_iter.hpp"
 #include "viennacl/linalg/qr.hpp"
 #include "viennacl/linalg/qr-method.hpp"
+#include "viennacl/linalg/svd.hpp"
+#include "viennacl/linalg/randomized_svd.hpp"
 #include "viennacl/linalg/row_scaling.hpp"
 #include "viennacl/linalg/sum.hpp"
 #include "viennacl/linalg/tql2.hpp"
@@ -73,7 +80,6 @@
 #ifdef VIENNACL_WITH_OPENCL
   #include "viennacl/linalg/amg.hpp"
   #include "viennacl/linalg/spai.hpp"
-  #include "viennacl/linalg/svd.hpp"
   #include "viennacl/device_specific/execute.hpp"
 #endif
 
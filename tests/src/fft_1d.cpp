@@ -964,6 +964,98 @@ ScalarType convolve(std::vector<ScalarType>& in1, std::vector<ScalarType>& in2,
   return diff_max(res, ref);
 }
 
+int test_plan(unsigned int size, unsigned int batch_num);
+
+/* Compares the transforms using a precomputed plan against a reference DFT, for sizes covering all radices and Bluestein's algorithm */
+int test_plan(unsigned int size, unsigned int batch_num)
+{
+  std::vector<ScalarType> in(2 * size * batch_num);
+  for (std::size_t i = 0; i < in.size(); i++)
+    in[i] = ScalarType(rand()) / ScalarType(RAND_MAX) - ScalarType(0.5);
+
+  std::vector<ScalarType> ref(in.size());
+  for (std::size_t b = 0; b < batch_num; b++)
+    for (std::size_t k = 0; k < size; k++)
+    {
+      std::complex<double> f = 0;
+      for (std::size_t j = 0; j < size; j++)
+      {
+        double arg = -2.0 * M_PI * double((j * k) % size) / double(size);
+        f += std::complex<double>(in[2 * (b * size + j)], in[2 * (b * size + j) + 1]) * std::complex<double>(std::cos(arg), std::sin(arg));
+      }
+      ref[2 * (b * size + k)]     = ScalarType(f.real());
+      ref[2 * (b * size + k) + 1] = ScalarType(f.imag());
+    }
+
+  viennacl::fft_plan<ScalarType> plan(size);
+  viennacl::vector<ScalarType> input(in.size());
+  viennacl::vector<ScalarType> output(in.size());
+  viennacl::fast_copy(in, input);
+
+  viennacl::fft(input, output, plan, batch_num);
+  std::vector<ScalarType> res(in.size());
+  viennacl::fast_copy(output, res);
+  ScalarType df = diff(res, ref);
+
+  viennacl::inplace_ifft(output, plan, batch_num);
+  viennacl::fast_copy(output, res);
+  df = std::max(df, diff(res, in));
+
+  printf("%7s SIZE=%6d; BATCH=%3d; DIFF=%3.15f;\n", ((fabs(df) < EPS) ? "[Ok]" : "[Fail]"), size, batch_num, df);
+
+  if (df > EPS)
+    return EXIT_FAILURE;
+
+  return EXIT_SUCCESS;
+}
+
+int test_rfft(unsigned int size, unsigned int batch_num);
+
+/* Compares the real-to-complex transform against a reference DFT and checks the complex-to-real roundtrip, for even and odd sizes */
+int test_rfft(unsigned int size, unsigned int batch_num)
+{
+  std::size_t packed_size = size / 2 + 1;
+  std::vector<ScalarType> in(size * batch_num);
+  for (std::size_t i = 0; i < in.size(); i++)
+    in[i] = ScalarType(rand()) / ScalarType(RAND_MAX) - ScalarType(0.5);
+
+  std::vector<ScalarType> ref(2 * packed_size * batch_num);
+  for (std::size_t b = 0; b < batch_num; b++)
+    for (std::size_t k = 0; k < packed_size; k++)
+    {
+      std::complex<double> f = 0;
+      for (std::size_t j = 0; j < size; j++)
+      {
+        double arg = -2.0 * M_PI * double((j * k) % size) / double(size);
+        f += double(in[b * size + j]) * std::complex<double>(std::cos(arg), std::sin(arg));
+      }
+      ref[2 * (b * packed_size + k)]     = ScalarType(f.real());
+      ref[2 * (b * packed_size + k) + 1] = ScalarType(f.imag());
+    }
+
+  viennacl::rfft_plan<ScalarType> plan(size);
+  viennacl::vector<ScalarType> input(in.size());
+  viennacl::vector<ScalarType> spectrum(ref.size());
+  viennacl::fast_copy(in, input);
+
+  viennacl::rfft(input, spectrum, plan, batch_num);
+  std::vector<ScalarType> res(ref.size());
+  viennacl::fast_copy(spectrum, res);
+  ScalarType df = diff(res, ref);
+
+  viennacl::irfft(spectrum, input, plan, batch_num);
+  res.resize(in.size());
+  viennacl::fast_copy(input, res);
+  df = std::max(df, diff(res, in));
+
+  printf("%7s SIZE=%6d; BATCH=%3d; DIFF=%3.15f;\n", ((fabs(df) < EPS) ? "[Ok]" : "[Fail]"), size, batch_num, df);
+
+  if (df > EPS)
+    return EXIT_FAILURE;
+
+  return EXIT_SUCCESS;
+}
+
 int test_correctness(const std::string& log_tag, input_function_ptr input_function,
     test_function_ptr func);
 
@@ -1065,6 +1157,18 @@ int main()
       &fft_reverse_direct) == EXIT_FAILURE)
     return EXIT_FAILURE;
 
+  std::cout << std::endl;
+  std::cout << "*****************fft::plan***************************\n";
+  if (test_plan(512, 3) == EXIT_FAILURE || test_plan(360, 2) == EXIT_FAILURE
+   || test_plan(97, 4)  == EXIT_FAILURE || test_plan(1000, 1) == EXIT_FAILURE)
+    return EXIT_FAILURE;
+
+  std::cout << std::endl;
+  std::cout << "*****************fft::rfft***************************\n";
+  if (test_rfft(512, 3) == EXIT_FAILURE || test_rfft(360, 2) == EXIT_FAILURE
+   || test_rfft(97, 4)  == EXIT_FAILURE || test_rfft(1, 2)   == EXIT_FAILURE)
+    return EXIT_FAILURE;
+
   std::cout << std::endl;
   std::cout << "------- Test completed --------" << std::endl;
   std::cout << std::endl;
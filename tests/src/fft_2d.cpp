@@ -280,6 +280,75 @@ ScalarType fft_2d_2arg(std::vector<ScalarType>& in, std::vector<ScalarType>& out
   return diff_max(res, out);
 }
 
+int test_3d(unsigned int depth, unsigned int height, unsigned int width);
+
+/* Compares the 3D transform of a volume stored as slabs of a matrix against separable reference DFTs and checks the inverse roundtrip */
+int test_3d(unsigned int depth, unsigned int height, unsigned int width)
+{
+  std::size_t rows = depth * height;
+  std::vector<ScalarType> in(2 * rows * width);
+  for (std::size_t i = 0; i < in.size(); i++)
+    in[i] = ScalarType(rand()) / ScalarType(RAND_MAX) - ScalarType(0.5);
+
+  // reference: 1D DFTs along x, y and z, entry (z, y, x) located at (z * height + y) * width + x
+  std::vector<std::complex<double> > ref(rows * width);
+  for (std::size_t i = 0; i < ref.size(); i++)
+    ref[i] = std::complex<double>(in[2 * i], in[2 * i + 1]);
+
+  std::size_t n[3]       = {width, height, depth};
+  std::size_t stride[3]  = {1, width, height * width};
+  std::vector<std::complex<double> > tmp;
+  for (std::size_t d = 0; d < 3; d++)
+  {
+    tmp.resize(n[d]);
+    for (std::size_t start = 0; start < ref.size(); start++)
+    {
+      if ((start / stride[d]) % n[d] != 0)  // not the first entry of a sequence along dimension d
+        continue;
+      for (std::size_t k = 0; k < n[d]; k++)
+      {
+        tmp[k] = 0;
+        for (std::size_t j = 0; j < n[d]; j++)
+        {
+          double arg = -2.0 * M_PI * double((j * k) % n[d]) / double(n[d]);
+          tmp[k] += ref[start + j * stride[d]] * std::complex<double>(std::cos(arg), std::sin(arg));
+        }
+      }
+      for (std::size_t k = 0; k < n[d]; k++)
+        ref[start + k * stride[d]] = tmp[k];
+    }
+  }
+
+  std::vector<ScalarType> ref_data(in.size());
+  for (std::size_t i = 0; i < ref.size(); i++)
+  {
+    ref_data[2 * i]     = ScalarType(ref[i].real());
+    ref_data[2 * i + 1] = ScalarType(ref[i].imag());
+  }
+
+  viennacl::matrix<ScalarType> input(rows, 2 * width);
+  viennacl::matrix<ScalarType> output(rows, 2 * width);
+  copy_vector_to_matrix(input, in, static_cast<unsigned int>(rows), width);
+
+  viennacl::fft_3d(input, output, depth);
+
+  std::vector<ScalarType> res(in.size());
+  copy_matrix_to_vector(output, res, static_cast<unsigned int>(rows), width);
+  ScalarType df = diff_max(res, ref_data);
+
+  viennacl::inplace_fft_3d(output, depth, ScalarType(1));
+  output /= ScalarType(rows * width);
+  copy_matrix_to_vector(output, res, static_cast<unsigned int>(rows), width);
+  df = std::max(df, diff_max(res, in));
+
+  printf("%7s DEPTH=%4d HEIGHT=%4d WIDTH=%4d; DIFF=%3.15f;\n", ((fabs(df) < EPS) ? "[Ok]" : "[Fail]"), depth, height, width, df);
+
+  if (df > EPS)
+    return EXIT_FAILURE;
+
+  return EXIT_SUCCESS;
+}
+
 int test_correctness(const std::string& log_tag, input_function_ptr input_function,
     test_function_ptr func);
 
@@ -327,6 +396,11 @@ int main()
   if (test_correctness("fft::transpose", read_matrices_pair, &transpose) == EXIT_FAILURE)
       return EXIT_FAILURE;
 
+  std::cout << std::endl;
+  std::cout << "*****************fft:3d***************************\n";
+  if (test_3d(8, 16, 32) == EXIT_FAILURE || test_3d(5, 12, 9) == EXIT_FAILURE || test_3d(1, 20, 18) == EXIT_FAILURE)
+    return EXIT_FAILURE;
+
   std::cout << std::endl;
   std::cout << "------- Test completed --------" << std::endl;
   std::cout << std::endl;
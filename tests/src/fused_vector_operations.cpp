@@ -0,0 +1,367 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/fused_vector_operations.cpp  Tests vector expressions which are evaluated in a single fused loop on the host.
+*   \test  Tests vector expressions which are evaluated in a single fused loop on the host, including sparse matrix-vector products, aliasing and trailing reductions.
+**/
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <algorithm>
+
+#include "viennacl/scalar.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/vector_proxy.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/inner_prod.hpp"
+#include "viennacl/linalg/norm_1.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/norm_inf.hpp"
+#include "viennacl/linalg/sum.hpp"
+#include "viennacl/tools/random.hpp"
+
+
+template<typename NumericT>
+NumericT diff(NumericT s1, NumericT s2)
+{
+  if (std::fabs(s1 - s2) > 0)
+    return (s1 - s2) / std::max(std::fabs(s1), std::fabs(s2));
+  return 0;
+}
+
+template<typename NumericT>
+NumericT diff(std::vector<NumericT> const & v1, viennacl::vector_base<NumericT> const & v2)
+{
+  std::vector<NumericT> v2_cpu(v2.size());
+  viennacl::backend::finish();
+  viennacl::copy(v2.begin(), v2.end(), v2_cpu.begin());
+
+  NumericT inf_norm = 0;
+  for (std::size_t i=0; i<v1.size(); ++i)
+    if ( std::max( std::fabs(v2_cpu[i]), std::fabs(v1[i]) ) > 0 )
+      inf_norm = std::max<NumericT>(inf_norm, std::fabs(v2_cpu[i] - v1[i]) / std::max( std::fabs(v2_cpu[i]), std::fabs(v1[i]) ));
+
+  return inf_norm;
+}
+
+template<typename HostT, typename DeviceT, typename NumericT>
+void check(HostT const & host_value, DeviceT const & device_value, std::string current_stage, NumericT epsilon)
+{
+  current_stage.resize(40, ' ');
+  std::cout << "Testing operation: " << current_stage;
+  NumericT rel_error = std::fabs(diff(host_value, device_value));
+
+  if (rel_error > epsilon)
+  {
+    std::cout << std::endl;
+    std::cout << "# Error at operation: " << current_stage << std::endl;
+    std::cout << "  diff: " << rel_error << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  std::cout << "PASS" << std::endl;
+}
+
+
+template<typename NumericT>
+NumericT host_norm_2(std::vector<NumericT> const & v)
+{
+  NumericT result = 0;
+  for (std::size_t i=0; i<v.size(); ++i)
+    result += v[i] * v[i];
+  return std::sqrt(result);
+}
+
+template<typename NumericT>
+NumericT host_norm_inf(std::vector<NumericT> const & v)
+{
+  NumericT result = 0;
+  for (std::size_t i=0; i<v.size(); ++i)
+    result = std::max<NumericT>(result, std::fabs(v[i]));
+  return result;
+}
+
+/** @brief y = A * x for a sparse matrix stored row-wise */
+template<typename NumericT>
+std::vector<NumericT> host_prod(std::vector<std::map<unsigned int, NumericT> > const & A, std::vector<NumericT> const & x)
+{
+  std::vector<NumericT> y(A.size());
+  for (std::size_t i=0; i<A.size(); ++i)
+    for (typename std::map<unsigned int, NumericT>::const_iterator it = A[i].begin(); it != A[i].end(); ++it)
+      y[i] += it->second * x[it->first];
+  return y;
+}
+
+
+template<typename NumericT>
+int test(NumericT epsilon)
+{
+  // larger than VIENNACL_OPENMP_VECTOR_MIN_SIZE so that the parallel code paths are used with OpenMP:
+  std::size_t N = 6007;
+
+  viennacl::tools::uniform_random_numbers<NumericT> randomNumber;
+
+  std::vector<NumericT> std_x(N), std_y(N), std_z(N), std_w(N);
+  for (std::size_t i=0; i<N; ++i)
+  {
+    std_x[i] = randomNumber();
+    std_y[i] = randomNumber();
+    std_z[i] = randomNumber();
+    std_w[i] = NumericT(1) + randomNumber();
+  }
+
+  std::vector<std::map<unsigned int, NumericT> > std_A(N);
+  for (std::size_t i=0; i<N; ++i)
+  {
+    std_A[i][static_cast<unsigned int>(i)] = NumericT(4);
+    std_A[i][static_cast<unsigned int>((i + 1) % N)] = NumericT(-1);
+    std_A[i][static_cast<unsigned int>((i * 7 + 3) % N)] = randomNumber();
+  }
+
+  viennacl::vector<NumericT> vcl_x(N), vcl_y(N), vcl_z(N), vcl_w(N);
+  viennacl::copy(std_x, vcl_x);
+  viennacl::copy(std_y, vcl_y);
+  viennacl::copy(std_z, vcl_z);
+  viennacl::copy(std_w, vcl_w);
+
+  viennacl::compressed_matrix<NumericT> vcl_A(N, N);
+  viennacl::copy(std_A, vcl_A);
+
+  NumericT alpha = NumericT(2.5);
+  NumericT beta  = NumericT(-1.5);
+  NumericT gamma = NumericT(0.75);
+  viennacl::scalar<NumericT> gpu_alpha(alpha);
+  viennacl::scalar<NumericT> gpu_beta(beta);
+
+  std::vector<NumericT> std_Az = host_prod(std_A, std_z);
+
+  //
+  // element-wise combinations
+  //
+  for (std::size_t i=0; i<N; ++i)
+    std_x[i] = alpha * std_y[i] + beta * std_z[i] - gamma * std_w[i];
+  vcl_x = alpha * vcl_y + beta * vcl_z - gamma * vcl_w;
+  check(std_x, vcl_x, "x = a*y + b*z - c*w", epsilon);
+
+  for (std::size_t i=0; i<N; ++i)
+    std_x[i] += alpha * std_y[i] - std_z[i] / beta + std_w[i];
+  vcl_x += gpu_alpha * vcl_y - vcl_z / gpu_beta + vcl_w;
+  check(std_x, vcl_x, "x += a*y - z/b + w", epsilon);
+
+  for (std::size_t i=0; i<N; ++i)
+    std_x[i] -= (std_y[i] + std_z[i]) * alpha;
+  vcl_x -= (vcl_y + vcl_z) * alpha;
+  check(std_x, vcl_x, "x -= (y + z) * a", epsilon);
+
+  for (std::size_t i=0; i<N; ++i)
+    std_x[i] = std_y[i] * (std_z[i] + std_w[i]) - std_z[i] / std_w[i];
+  vcl_x = viennacl::linalg::element_prod(vcl_y, vcl_z + vcl_w) - viennacl::linalg::element_div(vcl_z, vcl_w);
+  check(std_x, vcl_x, "x = y.*(z + w) - z./w", epsilon);
+
+  for (std::size_t i=0; i<N; ++i)
+    std_x[i] += std::exp(std_y[i] - std_z[i]) + std::sqrt(std_w[i]);
+  vcl_x += viennacl::linalg::element_exp(vcl_y - vcl_z) + viennacl::linalg::element_sqrt(vcl_w);
+  check(std_x, vcl_x, "x += exp(y - z) + sqrt(w)", epsilon);
+
+  //
+  // sparse matrix-vector products
+  //
+  for (std::size_t i=0; i<N; ++i)
+    std_x[i] = std_y[i] - std_Az[i];
+  vcl_x = vcl_y - viennacl::linalg::prod(vcl_A, vcl_z);
+  check(std_x, vcl_x, "x = y - A*z", epsilon);
+
+  for (std::size_t i=0; i<N; ++i)
+    std_x[i] += alpha * std_Az[i] - std_w[i];
+  vcl_x += alpha * viennacl::linalg::prod(vcl_A, vcl_z) - vcl_w;
+  check(std_x, vcl_x, "x += a*A*z - w", epsilon);
+
+  for (std::size_t i=0; i<N; ++i)
+    std_x[i] -= std_Az[i];
+  vcl_x -= viennacl::linalg::prod(vcl_A, vcl_z);
+  check(std_x, vcl_x, "x -= A*z", epsilon);
+
+  //
+  // aliasing
+  //
+  for (std::size_t i=0; i<N; ++i)
+    std_x[i] = NumericT(2) * std_x[i] + std_y[i] - std_x[i] * alpha;
+  vcl_x = NumericT(2) * vcl_x + vcl_y - vcl_x * alpha;
+  check(std_x, vcl_x, "x = 2*x + y - x*a", epsilon);
+
+  std::vector<NumericT> std_Ax = host_prod(std_A, std_x);
+  for (std::size_t i=0; i<N; ++i)
+    std_x[i] = std_x[i] + std_y[i] - std_Ax[i];
+  vcl_x = vcl_x + vcl_y - viennacl::linalg::prod(vcl_A, vcl_x);
+  check(std_x, vcl_x, "x = x + y - A*x", epsilon);
+
+  viennacl::range r_head(0, N - 1);
+  viennacl::range r_tail(1, N);
+  viennacl::vector_range<viennacl::vector<NumericT> > vcl_x_head(vcl_x, r_head);
+  viennacl::vector_range<viennacl::vector<NumericT> > vcl_x_tail(vcl_x, r_tail);
+  viennacl::vector_range<viennacl::vector<NumericT> > vcl_y_head(vcl_y, r_head);
+  viennacl::vector_range<viennacl::vector<NumericT> > vcl_z_head(vcl_z, r_head);
+  for (std::size_t i=0; i<N-1; ++i)
+    std_x[i] = std_x[i+1] + alpha * std_y[i] - std_z[i];
+  vcl_x_head = vcl_x_tail + alpha * vcl_y_head - vcl_z_head;
+  check(std_x, vcl_x, "x[0:N-1] = x[1:N] + a*y - z", epsilon);
+
+  //
+  // reductions
+  //
+  std::vector<NumericT> std_r(N);
+  for (std::size_t i=0; i<N; ++i)
+    std_r[i] = std_y[i] - std_Az[i];
+
+  NumericT cpu_result = viennacl::linalg::norm_2(vcl_y - viennacl::linalg::prod(vcl_A, vcl_z));
+  check(host_norm_2(std_r), cpu_result, "norm_2(y - A*z)", epsilon);
+
+  viennacl::scalar<NumericT> gpu_result = viennacl::linalg::norm_inf(vcl_y - viennacl::linalg::prod(vcl_A, vcl_z));
+  check(host_norm_inf(std_r), NumericT(gpu_result), "norm_inf(y - A*z)", epsilon);
+
+  NumericT ref = 0;
+  for (std::size_t i=0; i<N; ++i)
+    ref += std::fabs(std_y[i] + alpha * std_z[i]);
+  cpu_result = viennacl::linalg::norm_1(vcl_y + alpha * vcl_z);
+  check(ref, cpu_result, "norm_1(y + a*z)", epsilon);
+
+  ref = 0;
+  for (std::size_t i=0; i<N; ++i)
+    ref += (std_y[i] + std_z[i]) * (std_w[i] - std_y[i]);
+  cpu_result = viennacl::linalg::inner_prod(vcl_y + vcl_z, vcl_w - vcl_y);
+  check(ref, cpu_result, "inner_prod(y + z, w - y)", epsilon);
+
+  ref = 0;
+  for (std::size_t i=0; i<N; ++i)
+    ref += std_w[i] * std_r[i];
+  gpu_result = viennacl::linalg::inner_prod(vcl_w, vcl_y - viennacl::linalg::prod(vcl_A, vcl_z));
+  check(ref, NumericT(gpu_result), "inner_prod(w, y - A*z)", epsilon);
+
+  ref = 0;
+  for (std::size_t i=0; i<N; ++i)
+    ref += std_y[i] - std_w[i];
+  cpu_result = viennacl::linalg::sum(vcl_y - vcl_w);
+  check(ref, cpu_result, "sum(y - w)", epsilon);
+
+  //
+  // assignment with trailing reduction
+  //
+  viennacl::vector<NumericT> vcl_r(N);
+  cpu_result = viennacl::linalg::assign_norm_2(vcl_r, vcl_y - viennacl::linalg::prod(vcl_A, vcl_z));
+  check(std_r, vcl_r, "r = y - A*z", epsilon);
+  check(host_norm_2(std_r), cpu_result, "assign_norm_2(r, y - A*z)", epsilon);
+
+  cpu_result = viennacl::linalg::assign_norm_inf(vcl_r, vcl_y - viennacl::linalg::prod(vcl_A, vcl_z));
+  check(host_norm_inf(std_r), cpu_result, "assign_norm_inf(r, y - A*z)", epsilon);
+
+  for (std::size_t i=0; i<N; ++i)
+    std_x[i] = alpha * std_y[i] - std_w[i];
+  ref = 0;
+  for (std::size_t i=0; i<N; ++i)
+    ref += std::fabs(std_x[i]);
+  cpu_result = viennacl::linalg::assign_norm_1(vcl_x, alpha * vcl_y - vcl_w);
+  check(std_x, vcl_x, "x = a*y - w", epsilon);
+  check(ref, cpu_result, "assign_norm_1(x, a*y - w)", epsilon);
+
+  //
+  // reductions called from within a parallel region, where the runtime provides fewer threads than omp_get_max_threads()
+  //
+  ref = 0;
+  for (std::size_t i=0; i<N; ++i)
+    ref += (std_y[i] + std_z[i]) * (std_y[i] + std_z[i]);
+  ref = std::sqrt(ref);
+  NumericT outer_result = viennacl::linalg::norm_2(vcl_y + vcl_z);
+  NumericT nested_result = 0;
+  NumericT nested_assign_result = 0;
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel
+  {
+    #pragma omp single
+#endif
+    {
+      nested_result        = viennacl::linalg::norm_2(vcl_y + vcl_z);
+      nested_assign_result = viennacl::linalg::assign_norm_2(vcl_r, vcl_y + vcl_z);
+    }
+#ifdef VIENNACL_WITH_OPENMP
+  }
+#endif
+  check(ref, nested_result, "norm_2(y + z) in parallel region", epsilon);
+  check(ref, nested_assign_result, "assign_norm_2(r, y + z) in par. region", epsilon);
+  if (nested_result < outer_result || nested_result > outer_result)
+  {
+    std::cout << "# Error: Result of norm_2(y + z) depends on the number of threads" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: Fused Vector Operations" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  int retval = EXIT_SUCCESS;
+
+  {
+    typedef float NumericT;
+    NumericT epsilon = static_cast<NumericT>(1E-3);
+    std::cout << "# Testing setup:" << std::endl;
+    std::cout << "  eps:     " << epsilon << std::endl;
+    std::cout << "  numeric: float" << std::endl;
+    retval = test<NumericT>(epsilon);
+    if ( retval == EXIT_SUCCESS )
+      std::cout << "# Test passed" << std::endl;
+    else
+      return retval;
+  }
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+#ifdef VIENNACL_WITH_OPENCL
+  if ( viennacl::ocl::current_device().double_support() )
+#endif
+  {
+    typedef double NumericT;
+    NumericT epsilon = 1.0E-10;
+    std::cout << "# Testing setup:" << std::endl;
+    std::cout << "  eps:     " << epsilon << std::endl;
+    std::cout << "  numeric: double" << std::endl;
+    retval = test<NumericT>(epsilon);
+    if ( retval == EXIT_SUCCESS )
+      std::cout << "# Test passed" << std::endl;
+    else
+      return retval;
+  }
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return retval;
+}
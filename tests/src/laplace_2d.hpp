@@ -0,0 +1,41 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/laplace_2d.hpp  Five-point stencil of the 2D Laplacian used as test matrix by the preconditioner tests.
+**/
+
+#include <vector>
+#include <map>
+
+/** @brief Five-point stencil of the 2D Laplacian on an n x n grid plus 'shift' on the diagonal. With convection != 0 the matrix is nonsymmetric. */
+template<typename NumericT>
+std::vector<std::map<unsigned int, NumericT> > laplace_2d(unsigned int n, NumericT convection = NumericT(0), NumericT shift = NumericT(0))
+{
+  std::vector<std::map<unsigned int, NumericT> > A(n * n);
+  for (unsigned int i=0; i<n; ++i)
+    for (unsigned int j=0; j<n; ++j)
+    {
+      unsigned int row = i * n + j;
+      A[row][row] = NumericT(4) + shift;
+      if (i > 0)     A[row][row - n] = NumericT(-1) - convection;
+      if (i < n - 1) A[row][row + n] = NumericT(-1) + convection;
+      if (j > 0)     A[row][row - 1] = NumericT(-1);
+      if (j < n - 1) A[row][row + 1] = NumericT(-1);
+    }
+  return A;
+}
@@ -0,0 +1,142 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/lobpcg.cpp  Tests the LOBPCG and the thick-restart Lanczos eigensolvers.
+*   \test  Tests the LOBPCG and the thick-restart Lanczos eigensolvers.
+**/
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "viennacl/matrix.hpp"
+#include "viennacl/matrix_proxy.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/jacobi_precond.hpp"
+#include "viennacl/linalg/lanczos.hpp"
+#include "viennacl/linalg/lobpcg.hpp"
+
+#include "check_eigenpairs.hpp"
+
+
+/** @brief Computes the smallest eigenvalues of the 5-point Laplacian on an N-by-N grid with and without preconditioner. */
+template<typename NumericT>
+int test_lobpcg(std::size_t N, std::size_t num_eigenvalues, double tolerance, NumericT eps)
+{
+  std::size_t n = N * N;
+  std::vector<std::map<unsigned int, NumericT> > host_A(n);
+  for (std::size_t i=0; i<N; ++i)
+    for (std::size_t j=0; j<N; ++j)
+    {
+      std::size_t row = i * N + j;
+      host_A[row][static_cast<unsigned int>(row)] = NumericT(4);
+      if (i > 0)     host_A[row][static_cast<unsigned int>(row - N)] = NumericT(-1);
+      if (i + 1 < N) host_A[row][static_cast<unsigned int>(row + N)] = NumericT(-1);
+      if (j > 0)     host_A[row][static_cast<unsigned int>(row - 1)] = NumericT(-1);
+      if (j + 1 < N) host_A[row][static_cast<unsigned int>(row + 1)] = NumericT(-1);
+    }
+
+  viennacl::compressed_matrix<NumericT> A;
+  viennacl::copy(host_A, A);
+
+  std::vector<NumericT> reference;
+  for (std::size_t i=1; i<=N; ++i)
+    for (std::size_t j=1; j<=N; ++j)
+      reference.push_back(NumericT(4.0 - 2.0 * std::cos(M_PI * double(i) / double(N + 1)) - 2.0 * std::cos(M_PI * double(j) / double(N + 1))));
+  std::sort(reference.begin(), reference.end());
+  reference.resize(num_eigenvalues);
+
+  viennacl::linalg::lobpcg_tag tag(num_eigenvalues, tolerance, 1000);
+  viennacl::matrix<NumericT> eigenvectors(n, num_eigenvalues);
+
+  std::vector<NumericT> eigenvalues = viennacl::linalg::eig(A, eigenvectors, tag);
+  if (check_eigenpairs(A, eigenvectors, eigenvalues, reference, eps, "LOBPCG") != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+  viennacl::linalg::jacobi_precond< viennacl::compressed_matrix<NumericT> > jacobi(A, viennacl::linalg::jacobi_tag());
+  eigenvalues = viennacl::linalg::eig(A, eigenvectors, tag, jacobi);
+  if (check_eigenpairs(A, eigenvectors, eigenvalues, reference, eps, "LOBPCG with Jacobi preconditioner") != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+  return EXIT_SUCCESS;
+}
+
+/** @brief Computes the largest eigenvalues of the tridiagonal 1D Laplacian with thick-restart Lanczos. */
+template<typename NumericT>
+int test_thick_restart(std::size_t n, std::size_t num_eigenvalues, std::size_t krylov_size, double tolerance, NumericT eps)
+{
+  std::vector<std::map<unsigned int, NumericT> > host_A(n);
+  for (std::size_t i=0; i<n; ++i)
+  {
+    host_A[i][static_cast<unsigned int>(i)] = NumericT(2);
+    if (i > 0)     host_A[i][static_cast<unsigned int>(i - 1)] = NumericT(-1);
+    if (i + 1 < n) host_A[i][static_cast<unsigned int>(i + 1)] = NumericT(-1);
+  }
+
+  viennacl::compressed_matrix<NumericT> A;
+  viennacl::copy(host_A, A);
+
+  std::vector<NumericT> reference(num_eigenvalues);
+  for (std::size_t i=0; i<num_eigenvalues; ++i)
+    reference[i] = NumericT(2.0 - 2.0 * std::cos(M_PI * double(n - i) / double(n + 1)));
+
+  viennacl::linalg::lanczos_tag tag(0.75, num_eigenvalues, viennacl::linalg::lanczos_tag::thick_restart, krylov_size);
+  tag.tolerance(tolerance);
+  tag.max_restarts(1000);
+  viennacl::matrix<NumericT> eigenvectors(n, num_eigenvalues);
+
+  std::vector<NumericT> eigenvalues = viennacl::linalg::eig(A, eigenvectors, tag);
+  return check_eigenpairs(A, eigenvectors, eigenvalues, reference, eps, "Thick-restart Lanczos");
+}
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: LOBPCG and Thick-Restart Lanczos" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "# Testing setup: float" << std::endl;
+  if (test_lobpcg<float>(20, 4, 1e-5, 1e-3f) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+  if (test_thick_restart<float>(200, 4, 30, 1e-5, 1e-3f) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+#ifdef VIENNACL_WITH_OPENCL
+  if ( viennacl::ocl::current_device().double_support() )
+#endif
+  {
+    std::cout << "# Testing setup: double" << std::endl;
+    if (test_lobpcg<double>(30, 6, 1e-10, 1e-8) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+    if (test_thick_restart<double>(500, 6, 40, 1e-10, 1e-8) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+  }
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1 @@
+lobpcg.cpp
\ No newline at end of file
@@ -1243,6 +1243,30 @@ int test(Epsilon const& epsilon)
       retval = EXIT_FAILURE;
    }
 
+   //full solver with partial pivoting (rows shifted cyclically, so that the dominant entries are off the diagonal):
+   std::cout << "Full solver with pivoting" << std::endl;
+   std::vector<std::vector<NumericT> > shifted_matrix(lu_dim);
+   std::vector<NumericT> shifted_rhs(lu_dim);
+   for (std::size_t i=0; i<lu_dim; ++i)
+   {
+     shifted_matrix[i] = square_matrix[(i + 1) % lu_dim];
+     shifted_rhs[i]    = lu_rhs[(i + 1) % lu_dim];
+   }
+
+   viennacl::copy(shifted_matrix, vcl_square_matrix);
+   viennacl::copy(shifted_rhs, vcl_lu_rhs);
+
+   std::vector<viennacl::vcl_size_t> lu_pivots;
+   viennacl::linalg::lu_factorize(vcl_square_matrix, lu_pivots);
+   viennacl::linalg::lu_substitute(vcl_square_matrix, lu_pivots, vcl_lu_rhs);
+
+   if ( std::fabs(diff(lu_result, vcl_lu_rhs)) > epsilon )
+   {
+      std::cout << "# Error at operation: dense solver with pivoting" << std::endl;
+      std::cout << "  diff: " << std::fabs(diff(lu_result, vcl_lu_rhs)) << std::endl;
+      retval = EXIT_FAILURE;
+   }
+
 
 
    return retval;
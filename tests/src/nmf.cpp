@@ -22,7 +22,10 @@
 
 #include <ctime>
 #include <cmath>
+#include <map>
+#include <vector>
 
+#include "viennacl/compressed_matrix.hpp"
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/linalg/nmf.hpp"
 
@@ -59,9 +62,12 @@ void fill_random(viennacl::matrix_base<ScalarType>& v)
   }
 }
 
-void test_nmf(std::size_t m, std::size_t k, std::size_t n);
+void test_nmf(std::size_t m, std::size_t k, std::size_t n,
+              viennacl::linalg::nmf_config::solver_type solver = viennacl::linalg::nmf_config::multiplicative_update,
+              bool sparse_input = false);
 
-void test_nmf(std::size_t m, std::size_t k, std::size_t n)
+void test_nmf(std::size_t m, std::size_t k, std::size_t n,
+              viennacl::linalg::nmf_config::solver_type solver, bool sparse_input)
 {
   viennacl::matrix<ScalarType> v_ref(m, n);
   viennacl::matrix<ScalarType> w_ref(m, k);
@@ -70,6 +76,18 @@ void test_nmf(std::size_t m, std::size_t k, std::size_t n)
   fill_random(w_ref);
   fill_random(h_ref);
 
+  if (sparse_input) // introduce zeros in the factors, so that V = W * H is sparse
+  {
+    for (std::size_t i = 0; i < m; i++)
+      for (std::size_t j = 0; j < k; ++j)
+        if ((i + j) % 3 != 0)
+          w_ref(i, j) = 0;
+    for (std::size_t i = 0; i < k; i++)
+      for (std::size_t j = 0; j < n; ++j)
+        if ((i * j) % 2 != 0)
+          h_ref(i, j) = 0;
+  }
+
   v_ref = viennacl::linalg::prod(w_ref, h_ref);  //reference result
 
   viennacl::matrix<ScalarType> w_nmf(m, k);
@@ -81,8 +99,22 @@ void test_nmf(std::size_t m, std::size_t k, std::size_t n)
   viennacl::linalg::nmf_config conf;
   conf.print_relative_error(true);
   conf.max_iterations(3000); //3000 iterations are enough for the test
+  conf.solver(solver);
 
-  viennacl::linalg::nmf(v_ref, w_nmf, h_nmf, conf);
+  if (sparse_input)
+  {
+    std::vector<std::map<unsigned int, ScalarType> > v_host(m);
+    for (std::size_t i = 0; i < m; i++)
+      for (std::size_t j = 0; j < n; ++j)
+        if (v_ref(i, j) > 0)
+          v_host[i][static_cast<unsigned int>(j)] = v_ref(i, j);
+
+    viennacl::compressed_matrix<ScalarType> v_sparse(m, n);
+    viennacl::copy(v_host, v_sparse);
+    viennacl::linalg::nmf(v_sparse, w_nmf, h_nmf, conf);
+  }
+  else
+    viennacl::linalg::nmf(v_ref, w_nmf, h_nmf, conf);
 
   viennacl::matrix<ScalarType> v_nmf = viennacl::linalg::prod(w_nmf, h_nmf);
 
@@ -109,6 +141,18 @@ int main()
   test_nmf(16, 7, 12);
   test_nmf(140, 86, 113);
 
+  std::cout << std::endl << "------- HALS --------" << std::endl;
+  test_nmf(16, 7, 12, viennacl::linalg::nmf_config::hals);
+  test_nmf(70, 20, 60, viennacl::linalg::nmf_config::hals);
+
+  std::cout << std::endl << "------- ANLS --------" << std::endl;
+  test_nmf(16, 7, 12, viennacl::linalg::nmf_config::anls);
+  test_nmf(70, 20, 60, viennacl::linalg::nmf_config::anls);
+
+  std::cout << std::endl << "------- Sparse input --------" << std::endl;
+  test_nmf(60, 5, 50, viennacl::linalg::nmf_config::multiplicative_update, true);
+  test_nmf(60, 5, 50, viennacl::linalg::nmf_config::hals, true);
+
   std::cout << std::endl;
   std::cout << "------- Test completed --------" << std::endl;
   std::cout << std::endl;
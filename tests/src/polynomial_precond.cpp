@@ -0,0 +1,135 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/polynomial_precond.cpp  Tests the Chebyshev, least-squares and Neumann polynomial preconditioners.
+*   \test  Tests the Chebyshev, least-squares and Neumann polynomial preconditioners with the conjugate gradient solver.
+**/
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include "viennacl/vector.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/coordinate_matrix.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/norm_inf.hpp"
+#include "viennacl/linalg/cg.hpp"
+#include "viennacl/linalg/polynomial_precond.hpp"
+
+#include "laplace_2d.hpp"
+
+
+void check(bool condition, std::string const & message)
+{
+  if (!condition)
+  {
+    std::cout << "# Error: " << message << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+
+/** @brief Solves A x = A * ones with preconditioned CG and compares against the unpreconditioned solver */
+template<typename NumericT, typename MatrixT>
+void test_polynomial(MatrixT const & A, viennacl::linalg::polynomial_tag const & tag, NumericT eps, NumericT solver_tol, std::string const & name)
+{
+  viennacl::vector<NumericT> x_exact = viennacl::scalar_vector<NumericT>(A.size1(), NumericT(1), viennacl::traits::context(A));
+  viennacl::vector<NumericT> rhs = viennacl::linalg::prod(A, x_exact);
+
+  viennacl::linalg::cg_tag unprecond_tag(solver_tol, 1000);
+  viennacl::vector<NumericT> result = viennacl::linalg::solve(A, rhs, unprecond_tag);
+
+  viennacl::linalg::polynomial_precond<MatrixT> precond(A, tag);
+  viennacl::linalg::cg_tag precond_tag(solver_tol, 1000);
+  result = viennacl::linalg::solve(A, rhs, precond_tag, precond);
+
+  viennacl::vector<NumericT> residual = rhs - viennacl::linalg::prod(A, result);
+  NumericT rel_residual = viennacl::linalg::norm_2(residual) / viennacl::linalg::norm_2(rhs);
+  NumericT error = viennacl::linalg::norm_inf(result - x_exact);
+
+  std::cout << "* " << name << ": " << precond_tag.iters() << " iterations (unpreconditioned: " << unprecond_tag.iters() << "), "
+            << "rel. residual " << rel_residual << ", error " << error << std::endl;
+  check(rel_residual < 10 * solver_tol, "Residual too large with " + name);
+  check(error < eps, "Solution not accurate with " + name);
+  check(precond_tag.iters() < unprecond_tag.iters(), "Preconditioner does not reduce the number of iterations for " + name);
+}
+
+
+template<typename NumericT, typename MatrixT>
+void test_matrix(MatrixT const & A, NumericT eps, NumericT solver_tol, std::string const & format)
+{
+  test_polynomial<NumericT>(A, viennacl::linalg::polynomial_tag(viennacl::linalg::chebyshev_polynomial, 4), eps, solver_tol, "Chebyshev, " + format);
+  test_polynomial<NumericT>(A, viennacl::linalg::polynomial_tag(viennacl::linalg::least_squares_polynomial, 4), eps, solver_tol, "least squares, " + format);
+  test_polynomial<NumericT>(A, viennacl::linalg::polynomial_tag(viennacl::linalg::neumann_polynomial, 4), eps, solver_tol, "Neumann, " + format);
+
+  // spectral interval provided by the user: eigenvalues of the 2D Laplacian on the 30 x 30 grid are in [8 sin^2(pi/62), 8)
+  test_polynomial<NumericT>(A, viennacl::linalg::polynomial_tag(viennacl::linalg::chebyshev_polynomial, 4, 0.02, 8.0), eps, solver_tol, "Chebyshev with given interval, " + format);
+}
+
+template<typename NumericT>
+void test(NumericT eps, NumericT solver_tol)
+{
+  std::vector<std::map<unsigned int, NumericT> > std_A = laplace_2d<NumericT>(30);
+
+  viennacl::compressed_matrix<NumericT> A(std_A.size(), std_A.size());
+  viennacl::copy(std_A, A);
+  test_matrix(A, eps, solver_tol, "compressed_matrix");
+
+  viennacl::coordinate_matrix<NumericT> A_coo(std_A.size(), std_A.size());
+  viennacl::copy(std_A, A_coo);
+  test_matrix(A_coo, eps, solver_tol, "coordinate_matrix");
+}
+
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: Polynomial Preconditioners" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "# Testing setup:" << std::endl;
+  std::cout << "  numeric: float" << std::endl;
+  test<float>(1e-2f, 1e-5f);
+  std::cout << "# Test passed" << std::endl;
+  std::cout << std::endl;
+
+#ifdef VIENNACL_WITH_OPENCL
+  if ( viennacl::ocl::current_device().double_support() )
+#endif
+  {
+    std::cout << "# Testing setup:" << std::endl;
+    std::cout << "  numeric: double" << std::endl;
+    test<double>(1e-6, 1e-10);
+    std::cout << "# Test passed" << std::endl;
+  }
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}
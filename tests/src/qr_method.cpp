@@ -315,6 +315,11 @@ int main()
     std::cout << std::endl;
     test_eigen<double, viennacl::row_major   >("../examples/testdata/eigen/symm5.example", true, epsilon2);
     test_eigen<double, viennacl::column_major>("../examples/testdata/eigen/symm5.example", true, epsilon2);
+
+#if !defined(VIENNACL_WITH_OPENCL) && !defined(VIENNACL_WITH_CUDA)
+    // sufficiently fast with the divide-and-conquer eigensolver in host memory:
+    test_eigen<double, viennacl::row_major   >("../examples/testdata/eigen/symm3.example", true, epsilon2);
+#endif
   }
 
   //test_eigen<viennacl::row_major>("../../examples/testdata/eigen/symm3.example", true);  // Computation of this matrix takes very long
@@ -0,0 +1,263 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/reduce_many.cpp  Tests the evaluation of several reductions in a single pass via reduce_many().
+*   \test  Tests the evaluation of several inner products, norms, maxima, minima and sums in a single pass via reduce_many(), including ranges and slices.
+**/
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <algorithm>
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+#include "viennacl/scalar.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/vector_proxy.hpp"
+#include "viennacl/linalg/inner_prod.hpp"
+#include "viennacl/linalg/norm_1.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/norm_inf.hpp"
+#include "viennacl/linalg/maxmin.hpp"
+#include "viennacl/linalg/sum.hpp"
+#include "viennacl/tools/random.hpp"
+
+
+template<typename NumericT>
+void check(NumericT host_value, NumericT device_value, std::string current_stage, NumericT epsilon)
+{
+  current_stage.resize(40, ' ');
+  std::cout << "Testing operation: " << current_stage;
+  NumericT rel_error = 0;
+  if (std::fabs(host_value - device_value) > 0)
+    rel_error = std::fabs(host_value - device_value) / std::max(std::fabs(host_value), std::fabs(device_value));
+
+  if (rel_error > epsilon)
+  {
+    std::cout << std::endl;
+    std::cout << "# Error at operation: " << current_stage << std::endl;
+    std::cout << "  expected: " << host_value << ", obtained: " << device_value << ", diff: " << rel_error << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  std::cout << "PASS" << std::endl;
+}
+
+
+template<typename NumericT, typename VectorT>
+int test(NumericT epsilon, std::vector<VectorT *> const & vcl_vecs, std::vector<std::vector<NumericT> > const & std_vecs)
+{
+  VectorT & x = *vcl_vecs[0];
+  VectorT & y = *vcl_vecs[1];
+  VectorT & z = *vcl_vecs[2];
+  VectorT & w = *vcl_vecs[3];
+
+  std::vector<NumericT> const & std_x = std_vecs[0];
+  std::vector<NumericT> const & std_y = std_vecs[1];
+  std::vector<NumericT> const & std_z = std_vecs[2];
+  std::vector<NumericT> const & std_w = std_vecs[3];
+
+  NumericT dot_xy = 0, norm_1_y = 0, norm_2_z = 0, norm_inf_w = 0, sum_x = 0, dot_zz = 0;
+  NumericT max_y = std_y[0], min_w = std_w[0];
+  for (std::size_t i=0; i<std_x.size(); ++i)
+  {
+    dot_xy    += std_x[i] * std_y[i];
+    norm_1_y  += std::fabs(std_y[i]);
+    norm_2_z  += std_z[i] * std_z[i];
+    dot_zz    += std_z[i] * std_z[i];
+    norm_inf_w = std::max<NumericT>(norm_inf_w, std::fabs(std_w[i]));
+    max_y      = std::max<NumericT>(max_y, std_y[i]);
+    min_w      = std::min<NumericT>(min_w, std_w[i]);
+    sum_x     += std_x[i];
+  }
+  norm_2_z = std::sqrt(norm_2_z);
+
+  std::vector<NumericT> results = viennacl::linalg::reduce_many(viennacl::reduction_list<NumericT>().inner_prod(x, y)
+                                                                                                      .norm_1(y)
+                                                                                                      .norm_2(z)
+                                                                                                      .norm_inf(w)
+                                                                                                      .max(y)
+                                                                                                      .min(w)
+                                                                                                      .sum(x)
+                                                                                                      .inner_prod(z, z));
+  if (results.size() != 8)
+  {
+    std::cout << "# Error: Wrong number of results: " << results.size() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  check(dot_xy,     results[0], "inner_prod(x, y)", epsilon);
+  check(norm_1_y,   results[1], "norm_1(y)", epsilon);
+  check(norm_2_z,   results[2], "norm_2(z)", epsilon);
+  check(norm_inf_w, results[3], "norm_inf(w)", epsilon);
+  check(max_y,      results[4], "max(y)", epsilon);
+  check(min_w,      results[5], "min(w)", epsilon);
+  check(sum_x,      results[6], "sum(x)", epsilon);
+  check(dot_zz,     results[7], "inner_prod(z, z)", epsilon);
+
+  // results must agree with the individual reductions:
+  check(NumericT(viennacl::linalg::norm_2(z)),   results[2], "norm_2(z) vs. individual", epsilon);
+  check(NumericT(viennacl::linalg::max(y)),      results[4], "max(y) vs. individual", epsilon);
+  check(NumericT(viennacl::linalg::inner_prod(x, y)), results[0], "inner_prod(x, y) vs. individual", epsilon);
+
+  // the results must not depend on the order of the reductions in the list:
+  std::vector<NumericT> results2 = viennacl::linalg::reduce_many(viennacl::reduction_list<NumericT>().sum(x).inner_prod(x, y));
+  if (results2[0] < results[6] || results2[0] > results[6] || results2[1] < results[0] || results2[1] > results[0])
+  {
+    std::cout << "# Error: Results depend on the order of the reductions" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+#ifdef VIENNACL_WITH_OPENMP
+  // the results must not depend on the number of threads:
+  int num_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  std::vector<NumericT> results_serial = viennacl::linalg::reduce_many(viennacl::reduction_list<NumericT>().sum(x).inner_prod(x, y));
+  omp_set_num_threads(num_threads);
+  if (results_serial[0] < results2[0] || results_serial[0] > results2[0] || results_serial[1] < results2[1] || results_serial[1] > results2[1])
+  {
+    std::cout << "# Error: Results depend on the number of threads" << std::endl;
+    return EXIT_FAILURE;
+  }
+#endif
+
+  // empty list:
+  if (viennacl::linalg::reduce_many(viennacl::reduction_list<NumericT>()).size() != 0)
+  {
+    std::cout << "# Error: Empty reduction list does not yield empty result" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+
+template<typename NumericT>
+int test(NumericT epsilon)
+{
+  // larger than VIENNACL_OPENMP_VECTOR_MIN_SIZE and not a multiple of the chunk size so that all code paths are used:
+  std::size_t N = 10007;
+
+  viennacl::tools::uniform_random_numbers<NumericT> randomNumber;
+
+  std::vector<std::vector<NumericT> > std_vecs(4, std::vector<NumericT>(N));
+  std::vector<std::vector<NumericT> > std_full(4, std::vector<NumericT>(3 * N));
+  for (std::size_t j=0; j<4; ++j)
+    for (std::size_t i=0; i<3*N; ++i)
+      std_full[j][i] = randomNumber() - NumericT(0.5);
+
+  std::vector<viennacl::vector<NumericT> > vcl_full(4, viennacl::vector<NumericT>(3 * N));
+  for (std::size_t j=0; j<4; ++j)
+    viennacl::copy(std_full[j], vcl_full[j]);
+
+  std::cout << "* vectors" << std::endl;
+  std::vector<viennacl::vector<NumericT> > vcl_vecs(4, viennacl::vector<NumericT>(N));
+  std::vector<viennacl::vector<NumericT> *> vcl_vec_ptrs(4);
+  for (std::size_t j=0; j<4; ++j)
+  {
+    std::copy(std_full[j].begin(), std_full[j].begin() + long(N), std_vecs[j].begin());
+    viennacl::copy(std_vecs[j], vcl_vecs[j]);
+    vcl_vec_ptrs[j] = &vcl_vecs[j];
+  }
+  if (test(epsilon, vcl_vec_ptrs, std_vecs) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+  std::cout << "* ranges" << std::endl;
+  std::vector<viennacl::vector_range<viennacl::vector<NumericT> > > vcl_ranges;
+  for (std::size_t j=0; j<4; ++j)
+  {
+    std::copy(std_full[j].begin() + long(N), std_full[j].begin() + long(2*N), std_vecs[j].begin());
+    vcl_ranges.push_back(viennacl::vector_range<viennacl::vector<NumericT> >(vcl_full[j], viennacl::range(N, 2*N)));
+  }
+  std::vector<viennacl::vector_range<viennacl::vector<NumericT> > *> vcl_range_ptrs(4);
+  for (std::size_t j=0; j<4; ++j)
+    vcl_range_ptrs[j] = &vcl_ranges[j];
+  if (test(epsilon, vcl_range_ptrs, std_vecs) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+  std::cout << "* slices" << std::endl;
+  std::vector<viennacl::vector_slice<viennacl::vector<NumericT> > > vcl_slices;
+  for (std::size_t j=0; j<4; ++j)
+  {
+    for (std::size_t i=0; i<N; ++i)
+      std_vecs[j][i] = std_full[j][1 + 2*i];
+    vcl_slices.push_back(viennacl::vector_slice<viennacl::vector<NumericT> >(vcl_full[j], viennacl::slice(1, 2, N)));
+  }
+  std::vector<viennacl::vector_slice<viennacl::vector<NumericT> > *> vcl_slice_ptrs(4);
+  for (std::size_t j=0; j<4; ++j)
+    vcl_slice_ptrs[j] = &vcl_slices[j];
+  if (test(epsilon, vcl_slice_ptrs, std_vecs) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+  return EXIT_SUCCESS;
+}
+
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: Multiple Reductions" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  int retval = EXIT_SUCCESS;
+
+  {
+    typedef float NumericT;
+    NumericT epsilon = static_cast<NumericT>(1E-3);
+    std::cout << "# Testing setup:" << std::endl;
+    std::cout << "  eps:     " << epsilon << std::endl;
+    std::cout << "  numeric: float" << std::endl;
+    retval = test<NumericT>(epsilon);
+    if ( retval == EXIT_SUCCESS )
+      std::cout << "# Test passed" << std::endl;
+    else
+      return retval;
+  }
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+#ifdef VIENNACL_WITH_OPENCL
+  if ( viennacl::ocl::current_device().double_support() )
+#endif
+  {
+    typedef double NumericT;
+    NumericT epsilon = 1.0E-10;
+    std::cout << "# Testing setup:" << std::endl;
+    std::cout << "  eps:     " << epsilon << std::endl;
+    std::cout << "  numeric: double" << std::endl;
+    retval = test<NumericT>(epsilon);
+    if ( retval == EXIT_SUCCESS )
+      std::cout << "# Test passed" << std::endl;
+    else
+      return retval;
+  }
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return retval;
+}
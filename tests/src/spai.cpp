@@ -0,0 +1,205 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/spai.cpp  Tests the static-pattern SPAI and FSPAI setup on the host.
+*   \test  Tests the static-pattern SPAI and FSPAI setup on the host: optimality conditions of the least squares problems and convergence of preconditioned solvers.
+**/
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include "viennacl/vector.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/cg.hpp"
+#include "viennacl/linalg/bicgstab.hpp"
+#include "viennacl/linalg/spai.hpp"
+
+#include "laplace_2d.hpp"
+
+
+typedef std::vector<std::map<unsigned int, double> >   HostMatrixType;
+
+HostMatrixType prod(HostMatrixType const & A, HostMatrixType const & B)
+{
+  HostMatrixType C(A.size());
+  for (std::size_t i=0; i<A.size(); ++i)
+    for (std::map<unsigned int, double>::const_iterator it = A[i].begin(); it != A[i].end(); ++it)
+      for (std::map<unsigned int, double>::const_iterator it2 = B[it->first].begin(); it2 != B[it->first].end(); ++it2)
+        C[i][it2->first] += it->second * it2->second;
+  return C;
+}
+
+HostMatrixType trans(HostMatrixType const & A)
+{
+  HostMatrixType At(A.size());
+  for (std::size_t i=0; i<A.size(); ++i)
+    for (std::map<unsigned int, double>::const_iterator it = A[i].begin(); it != A[i].end(); ++it)
+      At[it->first][static_cast<unsigned int>(i)] = it->second;
+  return At;
+}
+
+double entry(HostMatrixType const & A, std::size_t i, std::size_t j)
+{
+  std::map<unsigned int, double>::const_iterator it = A[i].find(static_cast<unsigned int>(j));
+  return (it != A[i].end()) ? it->second : 0.0;
+}
+
+void check(bool condition, std::string const & message)
+{
+  if (!condition)
+  {
+    std::cout << "# Error: " << message << std::endl;
+    exit(EXIT_FAILURE);
+  }
+}
+
+
+/** @brief Row i of the SPAI minimizes || m_i A - e_i || over the pattern J_i of row i of A, hence the residual (M A - I) is orthogonal to the rows A(j,:), j in J_i */
+void test_spai_setup(HostMatrixType const & std_A, std::string const & name)
+{
+  std::cout << "* SPAI setup: " << name << std::endl;
+
+  viennacl::compressed_matrix<double> A(std_A.size(), std_A.size(), viennacl::context(viennacl::MAIN_MEMORY));
+  viennacl::compressed_matrix<double> M(0, 0, 0, viennacl::context(viennacl::MAIN_MEMORY));
+  viennacl::copy(std_A, A);
+  viennacl::linalg::host_based::spai_static_setup(A, M);
+
+  HostMatrixType std_M(std_A.size());
+  viennacl::copy(M, std_M);
+
+  HostMatrixType R = prod(std_M, std_A);
+  for (std::size_t i=0; i<R.size(); ++i)
+    R[i][static_cast<unsigned int>(i)] -= 1.0;
+  HostMatrixType RAt = prod(R, trans(std_A));
+
+  for (std::size_t i=0; i<std_A.size(); ++i)
+  {
+    check(std_M[i].size() == std_A[i].size(), "Pattern of M differs from pattern of A");
+    for (std::map<unsigned int, double>::const_iterator it = std_A[i].begin(); it != std_A[i].end(); ++it)
+      check(std::fabs(entry(RAt, i, it->first)) < 1e-10, "Least squares residual not orthogonal in row " + name);
+  }
+}
+
+/** @brief Row i of the FSPAI factor G satisfies (G A)(i,j) = 0 for all j < i in the lower pattern of A, and G A G^T has unit diagonal */
+void test_fspai_setup(HostMatrixType const & std_A, std::string const & name)
+{
+  std::cout << "* FSPAI setup: " << name << std::endl;
+
+  viennacl::compressed_matrix<double> A(std_A.size(), std_A.size(), viennacl::context(viennacl::MAIN_MEMORY));
+  viennacl::compressed_matrix<double> G(0, 0, 0, viennacl::context(viennacl::MAIN_MEMORY));
+  viennacl::copy(std_A, A);
+  viennacl::linalg::host_based::fspai_static_setup(A, G);
+
+  HostMatrixType std_G(std_A.size());
+  viennacl::copy(G, std_G);
+
+  HostMatrixType GA   = prod(std_G, std_A);
+  HostMatrixType GAGt = prod(GA, trans(std_G));
+
+  for (std::size_t i=0; i<std_A.size(); ++i)
+  {
+    for (std::map<unsigned int, double>::const_iterator it = std_A[i].begin(); it != std_A[i].end() && it->first < i; ++it)
+      check(std::fabs(entry(GA, i, it->first)) < 1e-10, "G A does not vanish on the lower pattern in " + name);
+    check(std::fabs(entry(GAGt, i, i) - 1.0) < 1e-10, "Diagonal of G A G^T is not one in " + name);
+  }
+}
+
+
+template<typename SolverTagT, typename PrecondT>
+void test_solver(viennacl::compressed_matrix<double> const & A, SolverTagT const & unprecond_tag, SolverTagT const & precond_tag, PrecondT const & precond, std::string const & name)
+{
+  viennacl::vector<double> rhs = viennacl::scalar_vector<double>(A.size1(), 1.0, viennacl::traits::context(A));
+
+  viennacl::vector<double> result = viennacl::linalg::solve(A, rhs, precond_tag, precond);
+  viennacl::vector<double> residual = rhs - viennacl::linalg::prod(A, result);
+  double rel_residual = viennacl::linalg::norm_2(residual) / viennacl::linalg::norm_2(rhs);
+
+  std::cout << "* " << name << ": " << precond_tag.iters() << " iterations (unpreconditioned: " << unprecond_tag.iters() << "), rel. residual " << rel_residual << std::endl;
+  check(rel_residual < 1e-6, "Solution not accurate with " + name);
+  check(precond_tag.iters() < unprecond_tag.iters(), "Preconditioner does not reduce the number of iterations for " + name);
+}
+
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: SPAI and FSPAI on the host" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  // small tridiagonal matrix: the gathered index set of each row contains duplicates
+  HostMatrixType tridiag(5);
+  for (unsigned int i=0; i<5; ++i)
+  {
+    tridiag[i][i] = 2.0;
+    if (i > 0) tridiag[i][i-1] = -1.0;
+    if (i < 4) tridiag[i][i+1] = -1.0;
+  }
+  test_spai_setup(tridiag, "5x5 tridiagonal");
+  test_fspai_setup(tridiag, "5x5 tridiagonal");
+
+  // more than VIENNACL_OPENMP_SPAI_MIN_SIZE rows, so that the setup runs in parallel with OpenMP:
+  HostMatrixType laplace = laplace_2d<double>(25);
+  HostMatrixType convection = laplace_2d<double>(25, 0.5);
+  test_spai_setup(laplace, "2D Laplace");
+  test_spai_setup(convection, "2D convection-diffusion");
+  test_fspai_setup(laplace, "2D Laplace");
+
+  // preconditioned solvers:
+  viennacl::compressed_matrix<double> A(laplace.size(), laplace.size());
+  viennacl::copy(laplace, A);
+  viennacl::compressed_matrix<double> A_conv(convection.size(), convection.size());
+  viennacl::copy(convection, A_conv);
+
+  viennacl::vector<double> rhs = viennacl::scalar_vector<double>(A.size1(), 1.0);
+
+  viennacl::linalg::cg_tag cg_unprecond(1e-8, 1000);
+  viennacl::linalg::solve(A, rhs, cg_unprecond);
+
+  viennacl::linalg::bicgstab_tag bicgstab_unprecond(1e-8, 1000);
+  viennacl::linalg::solve(A_conv, rhs, bicgstab_unprecond);
+
+  viennacl::linalg::bicgstab_tag bicgstab_tag(1e-8, 1000);
+  viennacl::linalg::spai_precond<viennacl::compressed_matrix<double> > spai(A_conv, viennacl::linalg::spai_tag());
+  test_solver(A_conv, bicgstab_unprecond, bicgstab_tag, spai, "BiCGStab with SPAI");
+
+  viennacl::linalg::bicgstab_tag bicgstab_tag_right(1e-8, 1000);
+  viennacl::linalg::spai_tag right_tag;
+  right_tag.setIsRight(true);
+  viennacl::linalg::spai_precond<viennacl::compressed_matrix<double> > spai_right(A_conv, right_tag);
+  test_solver(A_conv, bicgstab_unprecond, bicgstab_tag_right, spai_right, "BiCGStab with right SPAI");
+
+  viennacl::linalg::cg_tag cg_tag(1e-8, 1000);
+  viennacl::linalg::fspai_precond<viennacl::compressed_matrix<double> > fspai(A, viennacl::linalg::fspai_tag(1e-3, 5, true));
+  test_solver(A, cg_unprecond, cg_tag, fspai, "CG with FSPAI");
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}
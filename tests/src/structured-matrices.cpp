@@ -36,6 +36,11 @@
 #include "viennacl/vandermonde_matrix.hpp"
 #include "viennacl/hankel_matrix.hpp"
 #include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/norm_frobenius.hpp"
+#include "viennacl/linalg/levinson.hpp"
+#include "viennacl/linalg/circulant_precond.hpp"
+#include "viennacl/linalg/cg.hpp"
 
 #include "viennacl/fft.hpp"
 
@@ -166,6 +171,47 @@ void transpose_test()
 
 
 
+/* Checks the product with all columns of a dense matrix against the dense reference. Since the matrix has been modified after a previous product, this also checks that cached data is updated. */
+template<typename StructuredMatrixT, typename ScalarType>
+int matrix_product_test(StructuredMatrixT const & vcl_A, dense_matrix<ScalarType> const & A, ScalarType epsilon)
+{
+    std::size_t num_cols = 3;
+    dense_matrix<ScalarType> B(A.size2(), num_cols);
+    dense_matrix<ScalarType> C_ref(A.size1(), num_cols);
+    dense_matrix<ScalarType> C(A.size1(), num_cols);
+
+    for (std::size_t i = 0; i < B.size1(); i++)
+      for (std::size_t j = 0; j < B.size2(); j++)
+        B(i,j) = ScalarType(i % 7) - ScalarType(j);
+
+    for (std::size_t i = 0; i < A.size1(); i++)     //reference calculation
+      for (std::size_t j = 0; j < num_cols; j++)
+      {
+        ScalarType entry = 0;
+        for (std::size_t k = 0; k < A.size2(); k++)
+          entry += A(i,k) * B(k,j);
+        C_ref(i,j) = entry;
+      }
+
+    viennacl::matrix<ScalarType, viennacl::row_major>    vcl_B(B.size1(), B.size2());
+    viennacl::matrix<ScalarType, viennacl::column_major> vcl_C(C.size1(), C.size2());
+    viennacl::copy(B, vcl_B);
+
+    vcl_C = viennacl::linalg::prod(vcl_A, vcl_B);
+
+    viennacl::copy(vcl_C, C);
+    std::cout << "Matrix-Matrix Product: " << diff(C, C_ref);
+    if (diff(C, C_ref) < epsilon)
+      std::cout << " [OK]" << std::endl;
+    else
+    {
+      std::cout << " [FAILED]" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
 template<typename ScalarType>
 int toeplitz_test(ScalarType epsilon)
 {
@@ -264,6 +310,12 @@ int toeplitz_test(ScalarType epsilon)
       return EXIT_FAILURE;
     }
 
+    //
+    // Matrix-Matrix product:
+    //
+    if (matrix_product_test(vcl_toeplitz1, m1, epsilon) == EXIT_FAILURE)
+      return EXIT_FAILURE;
+
     return EXIT_SUCCESS;
 }
 
@@ -366,6 +418,12 @@ int circulant_test(ScalarType epsilon)
       return EXIT_FAILURE;
     }
 
+    //
+    // Matrix-Matrix product:
+    //
+    if (matrix_product_test(vcl_circulant1, m1, epsilon) == EXIT_FAILURE)
+      return EXIT_FAILURE;
+
     return EXIT_SUCCESS;
 }
 
@@ -453,6 +511,12 @@ int vandermonde_test(ScalarType epsilon)
       return EXIT_FAILURE;
     }
 
+    //
+    // Matrix-Matrix product:
+    //
+    if (matrix_product_test(vcl_vandermonde1, m1, epsilon) == EXIT_FAILURE)
+      return EXIT_FAILURE;
+
     return EXIT_SUCCESS;
 }
 
@@ -555,6 +619,112 @@ int hankel_test(ScalarType epsilon)
       return EXIT_FAILURE;
     }
 
+    //
+    // Matrix-Matrix product:
+    //
+    if (matrix_product_test(vcl_hankel1, m1, epsilon) == EXIT_FAILURE)
+      return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
+
+template<typename ScalarType>
+int solver_test(ScalarType epsilon)
+{
+    std::size_t n = 200;
+
+    // symmetric positive definite Toeplitz matrix with slowly decaying diagonals:
+    std::vector<ScalarType> t(2 * n - 1);
+    for (std::size_t k = 0; k < n; k++)
+    {
+      t[n - 1 + k] = ScalarType(1) / ScalarType(k + 1);
+      t[n - 1 - k] = t[n - 1 + k];
+    }
+    viennacl::toeplitz_matrix<ScalarType> vcl_T(n, n);
+    viennacl::copy(t, vcl_T);
+
+    std::vector<ScalarType> b(n);
+    for (std::size_t i = 0; i < n; i++)
+      b[i] = ScalarType(1) + ScalarType(i % 5);
+    viennacl::vector<ScalarType> vcl_b(n);
+    viennacl::copy(b, vcl_b);
+    ScalarType norm_b = viennacl::linalg::norm_2(vcl_b);
+
+    viennacl::vector<ScalarType> vcl_x = viennacl::linalg::solve(vcl_T, vcl_b, viennacl::linalg::levinson_tag());
+    viennacl::vector<ScalarType> vcl_r = viennacl::linalg::prod(vcl_T, vcl_x);
+    vcl_r -= vcl_b;
+    std::cout << "Levinson solver residual: " << viennacl::linalg::norm_2(vcl_r) / norm_b;
+    if (viennacl::linalg::norm_2(vcl_r) / norm_b < epsilon)
+      std::cout << " [OK]" << std::endl;
+    else
+    {
+      std::cout << " [FAILED]" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // diagonally dominant circulant matrix:
+    std::vector<ScalarType> c(n);
+    for (std::size_t k = 0; k < n; k++)
+      c[k] = (k == 0) ? ScalarType(n) : ScalarType(k % 7) - ScalarType(3);
+    viennacl::circulant_matrix<ScalarType> vcl_C(n, n);
+    viennacl::copy(c, vcl_C);
+
+    vcl_x = viennacl::linalg::solve(vcl_C, vcl_b);
+    vcl_r = viennacl::linalg::prod(vcl_C, vcl_x);
+    vcl_r -= vcl_b;
+    std::cout << "Circulant solver residual: " << viennacl::linalg::norm_2(vcl_r) / norm_b;
+    if (viennacl::linalg::norm_2(vcl_r) / norm_b < epsilon)
+      std::cout << " [OK]" << std::endl;
+    else
+    {
+      std::cout << " [FAILED]" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    dense_matrix<ScalarType> B(n, 3);
+    for (std::size_t i = 0; i < n; i++)
+      for (std::size_t j = 0; j < 3; j++)
+        B(i,j) = ScalarType(j + 1) * b[i];
+    viennacl::matrix<ScalarType> vcl_B(n, 3), vcl_X(n, 3);
+    viennacl::copy(B, vcl_B);
+    vcl_X = vcl_B;
+    viennacl::linalg::inplace_solve(vcl_C, vcl_X);
+    viennacl::matrix<ScalarType> vcl_R = viennacl::linalg::prod(vcl_C, vcl_X);
+    vcl_R -= vcl_B;
+    std::cout << "Circulant solver residual (multiple right hand sides): " << viennacl::linalg::norm_frobenius(vcl_R) / viennacl::linalg::norm_frobenius(vcl_B);
+    if (viennacl::linalg::norm_frobenius(vcl_R) / viennacl::linalg::norm_frobenius(vcl_B) < epsilon)
+      std::cout << " [OK]" << std::endl;
+    else
+    {
+      std::cout << " [FAILED]" << std::endl;
+      return EXIT_FAILURE;
+    }
+
+    // preconditioned CG needs to converge in fewer iterations than plain CG:
+    double tolerance = epsilon * 1e-2;
+    viennacl::linalg::cg_tag plain_tag(tolerance, 1000);
+    vcl_x = viennacl::linalg::solve(vcl_T, vcl_b, plain_tag);
+
+    for (int type = 0; type < 2; type++)
+    {
+      viennacl::linalg::circulant_precond_tag precond_tag(type == 0 ? viennacl::linalg::circulant_precond_tag::strang
+                                                                    : viennacl::linalg::circulant_precond_tag::chan);
+      viennacl::linalg::circulant_precond< viennacl::toeplitz_matrix<ScalarType> > precond(vcl_T, precond_tag);
+      viennacl::linalg::cg_tag precond_cg_tag(tolerance, 1000);
+      vcl_x = viennacl::linalg::solve(vcl_T, vcl_b, precond_cg_tag, precond);
+      vcl_r = viennacl::linalg::prod(vcl_T, vcl_x);
+      vcl_r -= vcl_b;
+      std::cout << (type == 0 ? "CG with Strang" : "CG with T. Chan") << " preconditioner: " << precond_cg_tag.iters() << " iterations (no preconditioner: " << plain_tag.iters()
+                << "), residual: " << viennacl::linalg::norm_2(vcl_r) / norm_b;
+      if (viennacl::linalg::norm_2(vcl_r) / norm_b < epsilon && precond_cg_tag.iters() < plain_tag.iters())
+        std::cout << " [OK]" << std::endl;
+      else
+      {
+        std::cout << " [FAILED]" << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+
     return EXIT_SUCCESS;
 }
 
@@ -590,10 +760,16 @@ int main()
   if (hankel_test<float>(static_cast<float>(eps)) == EXIT_FAILURE)
     return EXIT_FAILURE;
 
+  std::cout << " -- Solvers -- " << std::endl;
+  if (solver_test<float>(static_cast<float>(eps)) == EXIT_FAILURE)
+    return EXIT_FAILURE;
+
 
   std::cout << std::endl;
 
+#ifdef VIENNACL_WITH_OPENCL
   if ( viennacl::ocl::current_device().double_support() )
+#endif
   {
     eps = 1e-10;
 
@@ -618,6 +794,10 @@ int main()
     std::cout << " -- Hankel matrix -- " << std::endl;
     if (hankel_test<double>(eps) == EXIT_FAILURE)
       return EXIT_FAILURE;
+
+    std::cout << " -- Solvers -- " << std::endl;
+    if (solver_test<double>(eps) == EXIT_FAILURE)
+      return EXIT_FAILURE;
   }
 
   std::cout << std::endl;
@@ -0,0 +1,105 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/subspace_iter.cpp  Tests subspace iteration with and without Chebyshev filtering.
+*   \test  Tests subspace iteration with and without Chebyshev filtering.
+**/
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "viennacl/matrix.hpp"
+#include "viennacl/matrix_proxy.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/subspace_iter.hpp"
+
+#include "check_eigenpairs.hpp"
+
+
+/** @brief Computes the dominant eigenvalues of the tridiagonal 1D Laplacian, as sparse and as dense matrix. */
+template<typename NumericT>
+int test_subspace_iteration(std::size_t n, std::size_t num_eigenvalues, std::size_t chebyshev_degree, double tolerance, NumericT eps)
+{
+  std::vector<std::map<unsigned int, NumericT> > host_A(n);
+  std::vector<std::vector<NumericT> > host_A_dense(n, std::vector<NumericT>(n));
+  for (std::size_t i=0; i<n; ++i)
+  {
+    host_A[i][static_cast<unsigned int>(i)] = host_A_dense[i][i] = NumericT(2);
+    if (i > 0)     host_A[i][static_cast<unsigned int>(i - 1)] = host_A_dense[i][i - 1] = NumericT(-1);
+    if (i + 1 < n) host_A[i][static_cast<unsigned int>(i + 1)] = host_A_dense[i][i + 1] = NumericT(-1);
+  }
+
+  viennacl::compressed_matrix<NumericT> A;
+  viennacl::matrix<NumericT> A_dense(n, n);
+  viennacl::copy(host_A, A);
+  viennacl::copy(host_A_dense, A_dense);
+
+  // all eigenvalues are positive, hence the dominant eigenvalues are the largest ones:
+  std::vector<NumericT> reference(num_eigenvalues);
+  for (std::size_t i=0; i<num_eigenvalues; ++i)
+    reference[i] = NumericT(2.0 - 2.0 * std::cos(M_PI * double(n - i) / double(n + 1)));
+
+  viennacl::linalg::subspace_iter_tag tag(num_eigenvalues, tolerance, 100000);
+  tag.chebyshev_degree(chebyshev_degree);
+  viennacl::matrix<NumericT> eigenvectors(n, num_eigenvalues);
+
+  std::vector<NumericT> eigenvalues = viennacl::linalg::eig(A, eigenvectors, tag);
+  if (check_eigenpairs(A, eigenvectors, eigenvalues, reference, eps, chebyshev_degree > 0 ? "Chebyshev-filtered subspace iteration" : "Subspace iteration") != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+  eigenvalues = viennacl::linalg::eig(A_dense, eigenvectors, tag);
+  return check_eigenpairs(A, eigenvectors, eigenvalues, reference, eps, chebyshev_degree > 0 ? "Chebyshev-filtered subspace iteration (dense)" : "Subspace iteration (dense)");
+}
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: Subspace Iteration" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "# Testing setup: float" << std::endl;
+  if (test_subspace_iteration<float>(100, 4, 0, 1e-5, 1e-3f) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+  if (test_subspace_iteration<float>(100, 4, 8, 1e-5, 1e-3f) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+#ifdef VIENNACL_WITH_OPENCL
+  if ( viennacl::ocl::current_device().double_support() )
+#endif
+  {
+    std::cout << "# Testing setup: double" << std::endl;
+    if (test_subspace_iteration<double>(200, 5, 0, 1e-10, 1e-8) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+    if (test_subspace_iteration<double>(200, 5, 10, 1e-10, 1e-8) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+  }
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}
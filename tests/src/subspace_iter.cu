@@ -0,0 +1 @@
+subspace_iter.cpp
\ No newline at end of file
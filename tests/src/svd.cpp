@@ -26,11 +26,16 @@
 #include <string>
 #include <vector>
 #include <cmath>
+#include <map>
+
+#include <boost/numeric/ublas/matrix.hpp>
 
 #include "viennacl/matrix.hpp"
+#include "viennacl/compressed_matrix.hpp"
 #include "viennacl/linalg/prod.hpp"
 
 #include "viennacl/linalg/svd.hpp"
+#include "viennacl/linalg/randomized_svd.hpp"
 
 #include "viennacl/tools/timer.hpp"
 
@@ -237,6 +242,96 @@ void time_svd(std::size_t sz1, std::size_t sz2)
 }
 
 
+template<typename ScalarType>
+void check_singular_triplets(viennacl::matrix<ScalarType> const & A_dense, viennacl::matrix<ScalarType> const & U, std::vector<ScalarType> const & sigma,
+                             viennacl::matrix<ScalarType> const & V, std::vector<ScalarType> const & reference, ScalarType EPS, std::string const & name)
+{
+  std::size_t k = U.size2();
+
+  ScalarType sigma_diff = 0;
+  for (std::size_t i = 0; i < k; i++)
+    sigma_diff = std::max(sigma_diff, std::abs(sigma[i] - reference[i]) / reference[0]);
+
+  // A v_i = sigma_i u_i:
+  viennacl::matrix<ScalarType> AV = viennacl::linalg::prod(A_dense, V);
+  ScalarType res_diff = 0;
+  for (std::size_t i = 0; i < A_dense.size1(); i++)
+    for (std::size_t j = 0; j < k; j++)
+      res_diff = std::max(res_diff, std::abs(ScalarType(AV(i, j)) - sigma[j] * ScalarType(U(i, j))) / sigma[0]);
+
+  bool ok = (sigma_diff < EPS) && (res_diff < std::sqrt(EPS));
+  printf("%6s randomized SVD (%s) [%dx%d] truncated to %d: sigma_diff = %.6f; res_diff = %.6f\n", ok?"[[OK]]":"[FAIL]", name.c_str(), (int)A_dense.size1(), (int)A_dense.size2(), (int)k, sigma_diff, res_diff);
+  if (!ok)
+    exit(EXIT_FAILURE);
+}
+
+
+template<typename ScalarType, typename MatrixType>
+void check_randomized_svd(MatrixType const & A, viennacl::matrix<ScalarType> const & A_dense, std::vector<ScalarType> const & reference,
+                          std::size_t k, viennacl::linalg::randomized_tag const & tag, ScalarType EPS, std::string const & name)
+{
+  viennacl::matrix<ScalarType> U(A_dense.size1(), k), V(A_dense.size2(), k);
+  std::vector<ScalarType> sigma;
+  viennacl::linalg::svd(A, U, sigma, V, tag);
+  check_singular_triplets(A_dense, U, sigma, V, reference, EPS, name);
+}
+
+
+template<typename ScalarType>
+void test_randomized_svd(std::size_t sz1, std::size_t sz2, std::size_t k, ScalarType EPS)
+{
+  // sparse matrix with one entry per column in scattered rows, hence the singular values are the magnitudes of the entries:
+  std::vector<std::map<unsigned int, ScalarType> > host_A(sz1);
+  std::vector<ScalarType> reference;
+  for (std::size_t j = 0; j < sz2; j++)
+  {
+    ScalarType value = ScalarType(std::pow(0.7, double(j))) * ((j % 3) ? ScalarType(1) : ScalarType(-1));
+    host_A[(j * 7) % sz1][static_cast<unsigned int>(j)] = value;
+    reference.push_back(std::abs(value));
+  }
+
+  viennacl::compressed_matrix<ScalarType> A(sz1, sz2);
+  viennacl::copy(host_A, A);
+  viennacl::matrix<ScalarType> A_dense(sz1, sz2);
+  for (std::size_t i = 0; i < sz1; i++)
+    for (typename std::map<unsigned int, ScalarType>::const_iterator it = host_A[i].begin(); it != host_A[i].end(); ++it)
+      A_dense(i, it->first) = it->second;
+
+  viennacl::linalg::randomized_tag gaussian_tag(10, 2, viennacl::linalg::randomized_tag::gaussian_sketch);
+  viennacl::linalg::randomized_tag srft_tag(10, 2, viennacl::linalg::randomized_tag::srft_sketch);
+  check_randomized_svd(A,       A_dense, reference, k, gaussian_tag, EPS, "sparse, Gaussian");
+  check_randomized_svd(A,       A_dense, reference, k, srft_tag,     EPS, "sparse, SRFT");
+  check_randomized_svd(A_dense, A_dense, reference, k, gaussian_tag, EPS, "dense, Gaussian");
+  check_randomized_svd(A_dense, A_dense, reference, k, srft_tag,     EPS, "dense, SRFT");
+
+  // svd_truncated() is a shorthand for the Gaussian sketch:
+  viennacl::matrix<ScalarType> U(sz1, k), V(sz2, k);
+  std::vector<ScalarType> sigma;
+  viennacl::linalg::svd_truncated(A_dense, U, sigma, V);
+  check_singular_triplets(A_dense, U, sigma, V, reference, EPS, "svd_truncated()");
+
+  // symmetric matrix with eigenvalues of alternating sign:
+  std::vector<std::map<unsigned int, ScalarType> > host_S(sz2);
+  for (std::size_t j = 0; j < sz2; j++)
+    host_S[j][static_cast<unsigned int>(j)] = ScalarType(std::pow(0.7, double(j))) * ((j % 2) ? ScalarType(-1) : ScalarType(1));
+  viennacl::compressed_matrix<ScalarType> S(sz2, sz2);
+  viennacl::copy(host_S, S);
+
+  viennacl::matrix<ScalarType> X(sz2, k);
+  std::vector<ScalarType> lambda = viennacl::linalg::eig(S, X, gaussian_tag);
+  ScalarType eig_diff = 0;
+  for (std::size_t j = 0; j < k; j++)
+  {
+    eig_diff = std::max(eig_diff, std::abs(lambda[j] - host_S[j][static_cast<unsigned int>(j)]));
+    eig_diff = std::max(eig_diff, std::abs(std::abs(ScalarType(X(j, j))) - ScalarType(1)));
+  }
+  bool ok = (eig_diff < EPS);
+  printf("%6s randomized eigendecomposition [%dx%d] truncated to %d: eig_diff = %.6f\n", ok?"[[OK]]":"[FAIL]", (int)sz2, (int)sz2, (int)k, eig_diff);
+  if (!ok)
+    exit(EXIT_FAILURE);
+}
+
+
 template<typename ScalarType>
 int test(ScalarType epsilon)
 {
@@ -247,6 +342,8 @@ int test(ScalarType epsilon)
     test_svd<ScalarType>(std::string("../examples/testdata/svd/pysvd.example"), epsilon);
     test_svd<ScalarType>(std::string("../examples/testdata/svd/random.example"), epsilon);
 
+    test_randomized_svd<ScalarType>(500, 300, 6, epsilon);
+
     time_svd<ScalarType>(500, 500);
     time_svd<ScalarType>(1024, 1024);
     time_svd<ScalarType>(2048, 512);
@@ -289,7 +386,9 @@ int main()
    std::cout << std::endl;
    std::cout << "----------------------------------------------" << std::endl;
    std::cout << std::endl;
+   #ifdef VIENNACL_WITH_OPENCL
    if ( viennacl::ocl::current_device().double_support() )
+   #endif
    {
       {
         typedef double NumericT;
@@ -0,0 +1,151 @@
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** \file tests/src/tsqr.cpp  Tests the QR factorizations of tall and skinny matrices (TSQR and CholeskyQR2).
+*   \test  Tests the QR factorizations of tall and skinny matrices (TSQR and CholeskyQR2).
+**/
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "viennacl/matrix.hpp"
+#include "viennacl/matrix_proxy.hpp"
+#include "viennacl/linalg/tsqr.hpp"
+#include "viennacl/tools/random.hpp"
+
+
+/** @brief Factors a random m-by-n matrix and checks the residual |A - Q R|, the orthogonality |Q^T Q - I| and the triangular structure of R. */
+template<typename NumericT, typename LayoutA, typename LayoutR>
+int test_factorization(std::size_t m, std::size_t n, bool cholesky_qr, std::size_t block_rows, NumericT eps)
+{
+  viennacl::tools::uniform_random_numbers<NumericT> randomNumber;
+
+  std::vector<std::vector<NumericT> > A(m, std::vector<NumericT>(n));
+  for (std::size_t i=0; i<m; ++i)
+    for (std::size_t j=0; j<n; ++j)
+      A[i][j] = randomNumber() - NumericT(0.5);
+
+  // operate on submatrices in order to test offsets:
+  viennacl::matrix<NumericT, LayoutA> vcl_A_full(m + 2, n + 3);
+  viennacl::matrix<NumericT, LayoutR> vcl_R_full(n + 1, n + 1);
+  viennacl::matrix_range<viennacl::matrix<NumericT, LayoutA> > vcl_A(vcl_A_full, viennacl::range(1, m + 1), viennacl::range(2, n + 2));
+  viennacl::matrix_range<viennacl::matrix<NumericT, LayoutR> > vcl_R(vcl_R_full, viennacl::range(1, n + 1), viennacl::range(0, n));
+  viennacl::copy(A, vcl_A);
+
+  if (cholesky_qr)
+    viennacl::linalg::cholesky_qr2(vcl_A, vcl_R);
+  else
+    viennacl::linalg::tsqr(vcl_A, vcl_R, block_rows);
+
+  std::vector<std::vector<NumericT> > Q(m, std::vector<NumericT>(n));
+  std::vector<std::vector<NumericT> > R(n, std::vector<NumericT>(n));
+  viennacl::copy(vcl_A, Q);
+  viennacl::copy(vcl_R, R);
+
+  NumericT residual = 0, orthogonality = 0;
+  bool triangular = true;
+  for (std::size_t i=0; i<m; ++i)
+    for (std::size_t j=0; j<n; ++j)
+    {
+      NumericT qr = 0;
+      for (std::size_t k=0; k<=j; ++k)
+        qr += Q[i][k] * R[k][j];
+      residual = std::max(residual, std::fabs(qr - A[i][j]));
+    }
+  for (std::size_t a=0; a<n; ++a)
+  {
+    for (std::size_t b=0; b<n; ++b)
+    {
+      NumericT dot = 0;
+      for (std::size_t i=0; i<m; ++i)
+        dot += Q[i][a] * Q[i][b];
+      orthogonality = std::max(orthogonality, std::fabs(dot - NumericT(a == b ? 1 : 0)));
+      if (b < a && std::fabs(R[a][b]) > 0)
+        triangular = false;
+    }
+    if (R[a][a] < 0)
+      triangular = false;
+  }
+
+  if (residual > eps || orthogonality > eps || !triangular)
+  {
+    std::cout << "# Error: " << (cholesky_qr ? "CholeskyQR2" : "TSQR") << " with m = " << m << ", n = " << n << " failed. Residual: " << residual
+              << ", orthogonality: " << orthogonality << (triangular ? "" : ", R is not upper triangular with nonnegative diagonal") << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+template<typename NumericT, typename LayoutA, typename LayoutR>
+int test(NumericT eps)
+{
+  std::size_t rows[]    = {1, 20, 300, 1500};
+  std::size_t columns[] = {1, 7, 20};
+
+  for (std::size_t i=0; i<sizeof(rows) / sizeof(rows[0]); ++i)
+    for (std::size_t j=0; j<sizeof(columns) / sizeof(columns[0]); ++j)
+    {
+      if (columns[j] > rows[i])
+        continue;
+      if (test_factorization<NumericT, LayoutA, LayoutR>(rows[i], columns[j], false, 32, eps) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+      if (test_factorization<NumericT, LayoutA, LayoutR>(rows[i], columns[j], false, 256, eps) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+      if (test_factorization<NumericT, LayoutA, LayoutR>(rows[i], columns[j], true, 0, eps) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+    }
+
+  return EXIT_SUCCESS;
+}
+
+int main()
+{
+  std::cout << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << "## Test :: Tall and Skinny QR Factorizations" << std::endl;
+  std::cout << "----------------------------------------------" << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "# Testing setup: float, row-major A, row-major R" << std::endl;
+  if (test<float, viennacl::row_major, viennacl::row_major>(1e-4f) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+  std::cout << "# Testing setup: float, column-major A, row-major R" << std::endl;
+  if (test<float, viennacl::column_major, viennacl::row_major>(1e-4f) != EXIT_SUCCESS)
+    return EXIT_FAILURE;
+
+#ifdef VIENNACL_WITH_OPENCL
+  if ( viennacl::ocl::current_device().double_support() )
+#endif
+  {
+    std::cout << "# Testing setup: double, row-major A, column-major R" << std::endl;
+    if (test<double, viennacl::row_major, viennacl::column_major>(1e-10) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+    std::cout << "# Testing setup: double, column-major A, column-major R" << std::endl;
+    if (test<double, viennacl::column_major, viennacl::column_major>(1e-10) != EXIT_SUCCESS)
+      return EXIT_FAILURE;
+  }
+
+  std::cout << std::endl;
+  std::cout << "------- Test completed --------" << std::endl;
+  std::cout << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1 @@
+tsqr.cpp
\ No newline at end of file
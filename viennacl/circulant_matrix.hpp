@@ -24,7 +24,9 @@
 
 #include "viennacl/forwards.h"
 #include "viennacl/vector.hpp"
+#ifdef VIENNACL_WITH_OPENCL
 #include "viennacl/ocl/backend.hpp"
+#endif
 
 #include "viennacl/linalg/circulant_matrix_operations.hpp"
 
@@ -71,6 +73,7 @@ public:
   void resize(vcl_size_t sz, bool preserve = true)
   {
     elements_.resize(sz, preserve);
+    spectrum_.invalidate();
   }
 
   /** @brief Returns the OpenCL handle
@@ -83,9 +86,16 @@ public:
     * @brief Returns an internal viennacl::vector, which represents a circulant matrix elements
     *
     */
-  viennacl::vector<NumericT, AlignmentV> & elements() { return elements_; }
+  viennacl::vector<NumericT, AlignmentV> & elements() { spectrum_.invalidate(); return elements_; }
   viennacl::vector<NumericT, AlignmentV> const & elements() const { return elements_; }
 
+  /** @brief Returns the spectrum of the generator cached for matrix-vector products.
+   *
+   * The cache is invalidated by all non-const member functions, in particular by the non-const version of elements().
+   * Modifications of the entries through a reference obtained from elements() earlier thus require a call to spectrum().invalidate().
+   */
+  viennacl::detail::fft::spectrum_cache<NumericT> & spectrum() const { return spectrum_; }
+
   /**
     * @brief Returns the number of rows of the matrix
     */
@@ -112,6 +122,7 @@ public:
     */
   entry_proxy<NumericT> operator()(vcl_size_t row_index, vcl_size_t col_index)
   {
+    spectrum_.invalidate();
     long index = static_cast<long>(row_index) - static_cast<long>(col_index);
 
     assert(row_index < size1() && col_index < size2() && bool("Invalid access"));
@@ -130,6 +141,7 @@ public:
   circulant_matrix<NumericT, AlignmentV>& operator +=(circulant_matrix<NumericT, AlignmentV>& that)
   {
     elements_ += that.elements();
+    spectrum_.invalidate();
     return *this;
   }
 
@@ -138,6 +150,7 @@ private:
   circulant_matrix & operator=(circulant_matrix const & t);
 
   viennacl::vector<NumericT, AlignmentV> elements_;
+  mutable viennacl::detail::fft::spectrum_cache<NumericT> spectrum_;
 };
 
 /** @brief Copies a circulant matrix from the std::vector to the OpenCL device (either GPU or multi-core CPU)
@@ -350,6 +363,24 @@ namespace detail
     }
   };
 
+  // C = A * B
+  template<typename T, unsigned int A>
+  struct op_executor<matrix_base<T>, op_assign, matrix_expression<const circulant_matrix<T, A>, const matrix_base<T>, op_prod> >
+  {
+    static void apply(matrix_base<T> & lhs, matrix_expression<const circulant_matrix<T, A>, const matrix_base<T>, op_prod> const & rhs)
+    {
+      // check for the special case B = A * B
+      if (viennacl::traits::handle(lhs) == viennacl::traits::handle(rhs.rhs()))
+      {
+        viennacl::matrix<T> temp(lhs.size1(), lhs.size2(), viennacl::traits::context(lhs));
+        viennacl::linalg::prod_impl(rhs.lhs(), rhs.rhs(), temp);
+        lhs = temp;
+      }
+      else
+        viennacl::linalg::prod_impl(rhs.lhs(), rhs.rhs(), lhs);
+    }
+  };
+
 } // namespace detail
 } // namespace linalg
 
@@ -1149,6 +1149,9 @@ namespace detail
   {
     static void apply(vector_base<T> & lhs, vector_expression<const compressed_matrix<T, A>, const vector_base<T>, op_prod> const & rhs)
     {
+      if (fused_op<op_inplace_add>(lhs, rhs))
+        return;
+
       viennacl::vector<T> temp(lhs);
       viennacl::linalg::prod_impl(rhs.lhs(), rhs.rhs(), temp);
       lhs += temp;
@@ -1160,6 +1163,9 @@ namespace detail
   {
     static void apply(vector_base<T> & lhs, vector_expression<const compressed_matrix<T, A>, const vector_base<T>, op_prod> const & rhs)
     {
+      if (fused_op<op_inplace_sub>(lhs, rhs))
+        return;
+
       viennacl::vector<T> temp(lhs);
       viennacl::linalg::prod_impl(rhs.lhs(), rhs.rhs(), temp);
       lhs -= temp;
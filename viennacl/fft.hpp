@@ -45,6 +45,29 @@ namespace fft
 } //namespace fft
 } //namespace detail
 
+/**
+ * @brief A plan for repeated 1-D Fourier transformations of a fixed size.
+ *
+ * Holds the decomposition of the size into radix-2, -3, -4, -5 and -8 passes, the tables of twiddle factors, and the chirp for Bluestein's algorithm for all other sizes.
+ * Transformations of data in host memory using the plan pay the setup costs only once. Data in other memory domains is transformed without the plan.
+ */
+template<typename NumericT>
+class fft_plan
+{
+public:
+  /** @brief Sets up the plan for sequences of the given length (number of complex entries) */
+  explicit fft_plan(vcl_size_t size) : host_plan_(size) {}
+
+  /** @brief Returns the length of the sequences (number of complex entries) */
+  vcl_size_t size() const { return host_plan_.size(); }
+
+  /** @brief Returns the precomputed data for the transformation in host memory */
+  viennacl::linalg::host_based::detail::fft::plan<NumericT> const & host_plan() const { return host_plan_; }
+
+private:
+  viennacl::linalg::host_based::detail::fft::plan<NumericT> host_plan_;
+};
+
 /**
  * @brief Generic inplace version of 1-D Fourier transformation.
  *
@@ -58,6 +81,12 @@ void inplace_fft(viennacl::vector<NumericT, AlignmentV>& input, vcl_size_t batch
 {
   vcl_size_t size = (input.size() >> 1) / batch_num;
 
+  if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+  {
+    viennacl::linalg::host_based::execute_plan(viennacl::linalg::host_based::detail::fft::plan<NumericT>(size), input, batch_num, sign);
+    return;
+  }
+
   if (!viennacl::detail::fft::is_radix2(size))
   {
     viennacl::vector<NumericT, AlignmentV> output(input.size());
@@ -81,7 +110,12 @@ void fft(viennacl::vector<NumericT, AlignmentV>& input,
          viennacl::vector<NumericT, AlignmentV>& output, vcl_size_t batch_num = 1, NumericT sign = -1.0)
 {
   vcl_size_t size = (input.size() >> 1) / batch_num;
-  if (viennacl::detail::fft::is_radix2(size))
+  if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+  {
+    viennacl::copy(input, output);
+    viennacl::linalg::host_based::execute_plan(viennacl::linalg::host_based::detail::fft::plan<NumericT>(size), output, batch_num, sign);
+  }
+  else if (viennacl::detail::fft::is_radix2(size))
   {
     viennacl::copy(input, output);
     viennacl::linalg::radix2(output, size, size, batch_num, sign);
@@ -90,6 +124,222 @@ void fft(viennacl::vector<NumericT, AlignmentV>& input,
     viennacl::linalg::direct(input, output, size, size, batch_num, sign);
 }
 
+/**
+ * @brief Inplace version of 1-D Fourier transformation using a precomputed plan.
+ *
+ * @param input       Input vector holding batch_num sequences of length plan.size(), result will be stored here.
+ * @param plan        The plan for the length of the sequences
+ * @param batch_num   Number of items in batch
+ * @param sign        Sign of exponent, default is -1.0
+ */
+template<class NumericT, unsigned int AlignmentV>
+void inplace_fft(viennacl::vector<NumericT, AlignmentV>& input, viennacl::fft_plan<NumericT> const & plan,
+                 vcl_size_t batch_num = 1, NumericT sign = -1.0)
+{
+  assert(input.size() == 2 * plan.size() * batch_num && bool("Size of input does not match the plan"));
+
+  if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    viennacl::linalg::host_based::execute_plan(plan.host_plan(), input, batch_num, sign);
+  else
+    viennacl::inplace_fft(input, batch_num, sign);
+}
+
+/**
+ * @brief Version of 1-D Fourier transformation using a precomputed plan.
+ *
+ * @param input      Input vector holding batch_num sequences of length plan.size().
+ * @param output     Output vector.
+ * @param plan       The plan for the length of the sequences
+ * @param batch_num  Number of items in batch.
+ * @param sign       Sign of exponent, default is -1.0
+ */
+template<class NumericT, unsigned int AlignmentV>
+void fft(viennacl::vector<NumericT, AlignmentV>& input, viennacl::vector<NumericT, AlignmentV>& output,
+         viennacl::fft_plan<NumericT> const & plan, vcl_size_t batch_num = 1, NumericT sign = -1.0)
+{
+  assert(input.size() == 2 * plan.size() * batch_num && bool("Size of input does not match the plan"));
+
+  if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+  {
+    viennacl::copy(input, output);
+    viennacl::linalg::host_based::execute_plan(plan.host_plan(), output, batch_num, sign);
+  }
+  else
+    viennacl::fft(input, output, batch_num, sign);
+}
+
+/**
+ * @brief A plan for repeated real-to-complex and complex-to-real 1-D Fourier transformations of a fixed size.
+ *
+ * The spectrum of a real sequence of length n is Hermitian, hence only its first n/2 + 1 complex entries are stored (Hermitian-packed).
+ * Data in memory domains other than host memory is transformed in host memory.
+ */
+template<typename NumericT>
+class rfft_plan
+{
+public:
+  /** @brief Sets up the plan for real sequences of the given length */
+  explicit rfft_plan(vcl_size_t size = 0) : host_plan_(size) {}
+
+  /** @brief Returns the length of the real sequences */
+  vcl_size_t size() const { return host_plan_.size(); }
+
+  /** @brief Returns the number of complex entries of the Hermitian-packed spectrum */
+  vcl_size_t packed_size() const { return host_plan_.packed_size(); }
+
+  /** @brief Returns the precomputed data for the transformation in host memory */
+  viennacl::linalg::host_based::detail::fft::real_plan<NumericT> const & host_plan() const { return host_plan_; }
+
+private:
+  viennacl::linalg::host_based::detail::fft::real_plan<NumericT> host_plan_;
+};
+
+/**
+ * @brief Real-to-complex 1-D Fourier transformation using a precomputed plan.
+ *
+ * @param input      Input vector holding batch_num real sequences of length plan.size()
+ * @param output     Output vector holding batch_num Hermitian-packed spectra of plan.packed_size() interleaved complex entries
+ * @param plan       The plan for the length of the sequences
+ * @param batch_num  Number of items in batch
+ */
+template<class NumericT, unsigned int AlignmentV>
+void rfft(viennacl::vector<NumericT, AlignmentV> const & input, viennacl::vector<NumericT, AlignmentV> & output,
+          viennacl::rfft_plan<NumericT> const & plan, vcl_size_t batch_num = 1)
+{
+  assert(input.size() == plan.size() * batch_num && bool("Size of input does not match the plan"));
+  assert(output.size() == 2 * plan.packed_size() * batch_num && bool("Size of output does not match the plan"));
+
+  if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    viennacl::linalg::host_based::rfft(plan.host_plan(), input, output, batch_num);
+  else
+  {
+    viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+    viennacl::vector<NumericT, AlignmentV> input_host(input);
+    input_host.switch_memory_context(host_ctx);
+    viennacl::vector<NumericT, AlignmentV> output_host(output.size(), host_ctx);
+
+    viennacl::linalg::host_based::rfft(plan.host_plan(), input_host, output_host, batch_num);
+
+    output_host.switch_memory_context(viennacl::traits::context(output));
+    output = output_host;
+  }
+}
+
+/**
+ * @brief Real-to-complex 1-D Fourier transformation.
+ *
+ * @param input      Input vector holding batch_num real sequences
+ * @param output     Output vector holding batch_num Hermitian-packed spectra of n/2 + 1 interleaved complex entries each, where n is the length of the sequences
+ * @param batch_num  Number of items in batch
+ */
+template<class NumericT, unsigned int AlignmentV>
+void rfft(viennacl::vector<NumericT, AlignmentV> const & input, viennacl::vector<NumericT, AlignmentV> & output, vcl_size_t batch_num = 1)
+{
+  viennacl::rfft(input, output, viennacl::rfft_plan<NumericT>(input.size() / batch_num), batch_num);
+}
+
+/**
+ * @brief Complex-to-real inverse 1-D Fourier transformation using a precomputed plan. The result is normalized.
+ *
+ * @param input      Input vector holding batch_num Hermitian-packed spectra of plan.packed_size() interleaved complex entries
+ * @param output     Output vector holding batch_num real sequences of length plan.size()
+ * @param plan       The plan for the length of the sequences
+ * @param batch_num  Number of items in batch
+ */
+template<class NumericT, unsigned int AlignmentV>
+void irfft(viennacl::vector<NumericT, AlignmentV> const & input, viennacl::vector<NumericT, AlignmentV> & output,
+           viennacl::rfft_plan<NumericT> const & plan, vcl_size_t batch_num = 1)
+{
+  assert(input.size() == 2 * plan.packed_size() * batch_num && bool("Size of input does not match the plan"));
+  assert(output.size() == plan.size() * batch_num && bool("Size of output does not match the plan"));
+
+  if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    viennacl::linalg::host_based::irfft(plan.host_plan(), input, output, batch_num);
+  else
+  {
+    viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+    viennacl::vector<NumericT, AlignmentV> input_host(input);
+    input_host.switch_memory_context(host_ctx);
+    viennacl::vector<NumericT, AlignmentV> output_host(output.size(), host_ctx);
+
+    viennacl::linalg::host_based::irfft(plan.host_plan(), input_host, output_host, batch_num);
+
+    output_host.switch_memory_context(viennacl::traits::context(output));
+    output = output_host;
+  }
+  output /= NumericT(plan.size());
+}
+
+/**
+ * @brief Complex-to-real inverse 1-D Fourier transformation. The result is normalized.
+ *
+ * @param input      Input vector holding batch_num Hermitian-packed spectra
+ * @param output     Output vector holding batch_num real sequences, its size determines the length of the sequences
+ * @param batch_num  Number of items in batch
+ */
+template<class NumericT, unsigned int AlignmentV>
+void irfft(viennacl::vector<NumericT, AlignmentV> const & input, viennacl::vector<NumericT, AlignmentV> & output, vcl_size_t batch_num = 1)
+{
+  viennacl::irfft(input, output, viennacl::rfft_plan<NumericT>(output.size() / batch_num), batch_num);
+}
+
+/**
+ * @brief Real-to-complex 2-D Fourier transformation.
+ *
+ * @param input      Real input matrix
+ * @param output     Hermitian-packed spectrum with input.size1() rows and input.size2()/2 + 1 interleaved complex entries per row
+ */
+template<class NumericT, unsigned int AlignmentV>
+void rfft(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> const & input,
+          viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>       & output)
+{
+  assert(output.size1() == input.size1() && output.size2() == 2 * (input.size2() / 2 + 1) && bool("Size of output does not match the size of input"));
+
+  if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    viennacl::linalg::host_based::rfft(input, output);
+  else
+  {
+    viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+    viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> input_host(input);
+    input_host.switch_memory_context(host_ctx);
+    viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> output_host(output.size1(), output.size2(), host_ctx);
+
+    viennacl::linalg::host_based::rfft(input_host, output_host);
+
+    output_host.switch_memory_context(viennacl::traits::context(output));
+    output = output_host;
+  }
+}
+
+/**
+ * @brief Complex-to-real inverse 2-D Fourier transformation. The result is normalized.
+ *
+ * @param input      Hermitian-packed spectrum as computed by rfft()
+ * @param output     Real output matrix, its number of columns determines the length of the rows
+ */
+template<class NumericT, unsigned int AlignmentV>
+void irfft(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> const & input,
+           viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>       & output)
+{
+  assert(input.size1() == output.size1() && input.size2() == 2 * (output.size2() / 2 + 1) && bool("Size of input does not match the size of output"));
+
+  if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    viennacl::linalg::host_based::irfft(input, output);
+  else
+  {
+    viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+    viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> input_host(input);
+    input_host.switch_memory_context(host_ctx);
+    viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> output_host(output.size1(), output.size2(), host_ctx);
+
+    viennacl::linalg::host_based::irfft(input_host, output_host);
+
+    output_host.switch_memory_context(viennacl::traits::context(output));
+    output = output_host;
+  }
+  output /= NumericT(output.size1() * output.size2());
+}
+
 /**
  * @brief Generic inplace version of 2-D Fourier transformation.
  *
@@ -100,6 +350,12 @@ template<class NumericT, unsigned int AlignmentV>
 void inplace_fft(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>& input,
                  NumericT sign = -1.0)
 {
+  if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+  {
+    viennacl::linalg::host_based::fft_2d(input, sign);
+    return;
+  }
+
   vcl_size_t rows_num = input.size1();
   vcl_size_t cols_num = input.size2() >> 1;
 
@@ -148,6 +404,12 @@ template<class NumericT, unsigned int AlignmentV>
 void fft(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>& input, //TODO
          viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>& output, NumericT sign = -1.0)
 {
+  if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+  {
+    output = input;
+    viennacl::linalg::host_based::fft_2d(output, sign);
+    return;
+  }
 
   vcl_size_t rows_num = input.size1();
   vcl_size_t cols_num = input.size2() >> 1;
@@ -183,6 +445,49 @@ void fft(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>& input, //T
   }
 }
 
+/**
+ * @brief Inplace version of 3-D Fourier transformation.
+ *
+ * The volume is stored as depth slabs of input.size1()/depth consecutive rows each, i.e. entry (z, y, x) is the complex entry x of row z * input.size1()/depth + y.
+ *
+ * @param input       Input matrix, result will be stored here.
+ * @param depth       Number of slabs
+ * @param sign        Sign of exponent, default is -1.0
+ */
+template<class NumericT, unsigned int AlignmentV>
+void inplace_fft_3d(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>& input, vcl_size_t depth,
+                    NumericT sign = -1.0)
+{
+  if (viennacl::traits::handle(input).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    viennacl::linalg::host_based::fft_3d(input, depth, sign);
+  else
+  {
+    viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> input_host(input);
+    input_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+
+    viennacl::linalg::host_based::fft_3d(input_host, depth, sign);
+
+    input_host.switch_memory_context(viennacl::traits::context(input));
+    input = input_host;
+  }
+}
+
+/**
+ * @brief 3-D Fourier transformation of a volume stored as depth slabs of consecutive rows, see inplace_fft_3d().
+ *
+ * @param input      Input matrix.
+ * @param output     Output matrix.
+ * @param depth      Number of slabs
+ * @param sign       Sign of exponent, default is -1.0
+ */
+template<class NumericT, unsigned int AlignmentV>
+void fft_3d(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> const & input,
+            viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>& output, vcl_size_t depth, NumericT sign = -1.0)
+{
+  output = input;
+  viennacl::inplace_fft_3d(output, depth, sign);
+}
+
 /**
  * @brief Generic inplace version of inverse 1-D Fourier transformation.
  *
@@ -217,6 +522,36 @@ void ifft(viennacl::vector<NumericT, AlignmentV>& input,
   viennacl::linalg::normalize(output);
 }
 
+/**
+ * @brief Inplace version of inverse 1-D Fourier transformation using a precomputed plan.
+ *
+ * @param input      Input vector, result will be stored here.
+ * @param plan       The plan for the length of the sequences
+ * @param batch_num  Number of items in batch.
+ */
+template<class NumericT, unsigned int AlignmentV>
+void inplace_ifft(viennacl::vector<NumericT, AlignmentV>& input, viennacl::fft_plan<NumericT> const & plan, vcl_size_t batch_num = 1)
+{
+  viennacl::inplace_fft(input, plan, batch_num, NumericT(1.0));
+  input /= NumericT(plan.size());
+}
+
+/**
+ * @brief Version of inverse 1-D Fourier transformation using a precomputed plan.
+ *
+ * @param input      Input vector.
+ * @param output     Output vector.
+ * @param plan       The plan for the length of the sequences
+ * @param batch_num  Number of items in batch.
+ */
+template<class NumericT, unsigned int AlignmentV>
+void ifft(viennacl::vector<NumericT, AlignmentV>& input, viennacl::vector<NumericT, AlignmentV>& output,
+          viennacl::fft_plan<NumericT> const & plan, vcl_size_t batch_num = 1)
+{
+  viennacl::fft(input, output, plan, batch_num, NumericT(1.0));
+  output /= NumericT(plan.size());
+}
+
 namespace linalg
 {
   /**
@@ -240,6 +575,17 @@ namespace linalg
     viennacl::vector<NumericT, AlignmentV> tmp2(input2.size());
     viennacl::vector<NumericT, AlignmentV> tmp3(output.size());
 
+    if (viennacl::traits::handle(input1).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    {
+      // set up the twiddle factors for all three transforms only once:
+      viennacl::fft_plan<NumericT> plan(input1.size() / 2);
+      viennacl::fft(input1, tmp1, plan);
+      viennacl::fft(input2, tmp2, plan);
+      viennacl::linalg::multiply_complex(tmp1, tmp2, tmp3);
+      viennacl::ifft(tmp3, output, plan);
+      return;
+    }
+
     // align input arrays to equal size
     // FFT of input data
     viennacl::fft(input1, tmp1);
@@ -268,6 +614,16 @@ namespace linalg
     assert(input1.size() == input2.size());
     assert(input1.size() == output.size());
 
+    if (viennacl::traits::handle(input1).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    {
+      viennacl::fft_plan<NumericT> plan(input1.size() / 2);
+      viennacl::inplace_fft(input1, plan);
+      viennacl::inplace_fft(input2, plan);
+      viennacl::linalg::multiply_complex(input1, input2, output);
+      viennacl::inplace_ifft(output, plan);
+      return;
+    }
+
     viennacl::inplace_fft(input1);
     viennacl::inplace_fft(input2);
 
@@ -276,6 +632,244 @@ namespace linalg
     viennacl::inplace_ifft(output);
   }
 }      //namespace linalg
+
+namespace detail
+{
+namespace fft
+{
+  /** @brief Offset and distances of rows and columns of a dense matrix in its buffer, in units of entries */
+  template<typename NumericT>
+  struct matrix_strides
+  {
+    explicit matrix_strides(viennacl::matrix_base<NumericT> const & A)
+    {
+      if (A.row_major())
+      {
+        offset = viennacl::traits::start1(A) * A.internal_size2() + viennacl::traits::start2(A);
+        row_inc = viennacl::traits::stride1(A) * A.internal_size2();
+        col_inc = viennacl::traits::stride2(A);
+      }
+      else
+      {
+        offset = viennacl::traits::start1(A) + viennacl::traits::start2(A) * A.internal_size1();
+        row_inc = viennacl::traits::stride1(A);
+        col_inc = viennacl::traits::stride2(A) * A.internal_size1();
+      }
+    }
+
+    vcl_size_t offset;
+    vcl_size_t row_inc;
+    vcl_size_t col_inc;
+  };
+
+  /** @brief Spectrum of the generator of a circulant matrix (or of the circulant embedding of a Toeplitz matrix), cached for repeated products.
+   *
+   * The product with a vector of length n is given by the first n entries of the circular convolution of the zero-padded vector with the generator.
+   * The spectrum is computed with the first product and reused until invalidate() is called, the buffers for the transforms of the vectors are kept between products.
+   * Products with the columns of a dense matrix share the spectrum and, in host memory, are transformed as one batch.
+   * Systems with a circulant matrix are solved by a convolution with the inverted spectrum, which is cached alike.
+   */
+  template<typename NumericT>
+  class spectrum_cache
+  {
+  public:
+    spectrum_cache() : valid_(false), inverse_valid_(false), memory_(viennacl::MEMORY_NOT_INITIALIZED), size_(0) {}
+
+    // a copy has to recompute the spectrum of its own generator:
+    spectrum_cache(spectrum_cache const &) : valid_(false), inverse_valid_(false), memory_(viennacl::MEMORY_NOT_INITIALIZED), size_(0) {}
+    spectrum_cache & operator=(spectrum_cache const &) { invalidate(); return *this; }
+
+    /** @brief Marks the cached spectrum as outdated, to be called whenever the generator is modified */
+    void invalidate() { valid_ = false; inverse_valid_ = false; }
+
+    /** @brief Computes y = A x, where A is given by the generator */
+    template<unsigned int AlignmentV>
+    void prod(viennacl::vector<NumericT, AlignmentV> const & generator,
+              viennacl::vector_base<NumericT> const & x, viennacl::vector_base<NumericT> & y)
+    {
+      update(generator);
+      apply(host_spectrum_, spectrum_, x, y);
+    }
+
+    /** @brief Computes Y = A X, where A is given by the generator */
+    template<unsigned int AlignmentV>
+    void prod(viennacl::vector<NumericT, AlignmentV> const & generator,
+              viennacl::matrix_base<NumericT> const & X, viennacl::matrix_base<NumericT> & Y)
+    {
+      update(generator);
+      apply(host_spectrum_, spectrum_, X, Y);
+    }
+
+    /** @brief Computes x = A^{-1} b for the circulant matrix A given by the generator. Throws a zero_on_diagonal_exception if A is singular. */
+    template<unsigned int AlignmentV>
+    void solve(viennacl::vector<NumericT, AlignmentV> const & generator,
+               viennacl::vector_base<NumericT> const & b, viennacl::vector_base<NumericT> & x)
+    {
+      assert(generator.size() == b.size() && bool("Size mismatch"));
+      update(generator);
+      update_inverse();
+      apply(host_inverse_spectrum_, inverse_spectrum_, b, x);
+    }
+
+    /** @brief Computes X = A^{-1} B for the circulant matrix A given by the generator. Throws a zero_on_diagonal_exception if A is singular. */
+    template<unsigned int AlignmentV>
+    void solve(viennacl::vector<NumericT, AlignmentV> const & generator,
+               viennacl::matrix_base<NumericT> const & B, viennacl::matrix_base<NumericT> & X)
+    {
+      assert(generator.size() == B.size1() && bool("Size mismatch"));
+      update(generator);
+      update_inverse();
+      apply(host_inverse_spectrum_, inverse_spectrum_, B, X);
+    }
+
+  private:
+    template<unsigned int AlignmentV>
+    void update(viennacl::vector<NumericT, AlignmentV> const & generator)
+    {
+      viennacl::memory_types memory = viennacl::traits::handle(generator).get_active_handle_id();
+      vcl_size_t size = generator.size();
+      if (valid_ && memory == memory_ && size == size_)
+        return;
+
+      size_   = size;
+      memory_ = memory;
+      inverse_valid_ = false;
+      if (memory_ == viennacl::MAIN_MEMORY)
+      {
+        host_plan_ = viennacl::rfft_plan<NumericT>(size_);
+        viennacl::vector<NumericT> spectrum(2 * host_plan_.packed_size(), viennacl::traits::context(generator));
+        viennacl::rfft(generator, spectrum, host_plan_);
+        spectrum /= NumericT(size_);  // normalization of the inverse transform
+        host_spectrum_.resize(spectrum.size());
+        viennacl::fast_copy(spectrum, host_spectrum_);
+      }
+      else
+      {
+        viennacl::context ctx = viennacl::traits::context(generator);
+        spectrum_.resize(2 * size_, ctx, false);
+        buffer_.resize(size_, ctx, false);
+        buffer_hat_.resize(2 * size_, ctx, false);
+        buffer_prod_.resize(2 * size_, ctx, false);
+        viennacl::linalg::real_to_complex(generator, spectrum_, size_);
+        viennacl::inplace_fft(spectrum_);
+      }
+      valid_ = true;
+    }
+
+    /** @brief Replaces the entries of an interleaved complex spectrum by their reciprocals times 'scale' */
+    static void invert(std::vector<NumericT> & spectrum, NumericT scale)
+    {
+      for (vcl_size_t k = 0; k < spectrum.size() / 2; ++k)
+      {
+        NumericT re = spectrum[2 * k];
+        NumericT im = spectrum[2 * k + 1];
+        NumericT abs_squared = re * re + im * im;
+        if (abs_squared <= 0)
+          throw zero_on_diagonal_exception("ViennaCL: Singular circulant matrix encountered in solve()!");
+        spectrum[2 * k]     =  scale * re / abs_squared;
+        spectrum[2 * k + 1] = -scale * im / abs_squared;
+      }
+    }
+
+    void update_inverse()
+    {
+      if (inverse_valid_)
+        return;
+
+      if (memory_ == viennacl::MAIN_MEMORY)
+      {
+        // the host spectrum is scaled by 1/size_ for the unnormalized backward transform, so its reciprocal needs a factor 1/size_^2:
+        host_inverse_spectrum_ = host_spectrum_;
+        invert(host_inverse_spectrum_, NumericT(1) / (NumericT(size_) * NumericT(size_)));
+      }
+      else
+      {
+        std::vector<NumericT> host_spectrum(spectrum_.size());
+        viennacl::fast_copy(spectrum_, host_spectrum);
+        invert(host_spectrum, NumericT(1));
+        inverse_spectrum_.resize(spectrum_.size(), viennacl::traits::context(spectrum_), false);
+        viennacl::fast_copy(host_spectrum, inverse_spectrum_);
+      }
+      inverse_valid_ = true;
+    }
+
+    void apply(std::vector<NumericT> const & host_spectrum, viennacl::vector<NumericT> const & spectrum,
+               viennacl::vector_base<NumericT> const & x, viennacl::vector_base<NumericT> & y)
+    {
+      if (memory_ == viennacl::MAIN_MEMORY)
+      {
+        NumericT const * data_x = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(x) + viennacl::traits::start(x);
+        NumericT       * data_y = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(y) + viennacl::traits::start(y);
+        viennacl::linalg::host_based::circular_convolution(host_plan_.host_plan(), &host_spectrum[0],
+                                                           data_x, viennacl::traits::stride(x), 0,
+                                                           data_y, viennacl::traits::stride(y), 0,
+                                                           y.size(), 1, host_buffer_, host_buffer_hat_);
+      }
+      else
+        device_apply(spectrum, x, y);
+    }
+
+    void apply(std::vector<NumericT> const & host_spectrum, viennacl::vector<NumericT> const & spectrum,
+               viennacl::matrix_base<NumericT> const & X, viennacl::matrix_base<NumericT> & Y)
+    {
+      matrix_strides<NumericT> sx(X);
+      matrix_strides<NumericT> sy(Y);
+      if (memory_ == viennacl::MAIN_MEMORY)
+      {
+        NumericT const * data_x = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(X) + sx.offset;
+        NumericT       * data_y = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(Y) + sy.offset;
+        viennacl::linalg::host_based::circular_convolution(host_plan_.host_plan(), &host_spectrum[0],
+                                                           data_x, sx.row_inc, sx.col_inc,
+                                                           data_y, sy.row_inc, sy.col_inc,
+                                                           Y.size1(), Y.size2(), host_buffer_, host_buffer_hat_);
+        return;
+      }
+
+      viennacl::vector<NumericT> x(X.size1(), viennacl::traits::context(X));
+      viennacl::vector<NumericT> y(Y.size1(), viennacl::traits::context(Y));
+      for (vcl_size_t j = 0; j < X.size2(); ++j)
+      {
+        viennacl::vector_base<NumericT> x_j(const_cast<viennacl::backend::mem_handle &>(X.handle()), X.size1(), sx.offset + j * sx.col_inc, sx.row_inc);
+        viennacl::vector_base<NumericT> y_j(Y.handle(), Y.size1(), sy.offset + j * sy.col_inc, sy.row_inc);
+        x = x_j;
+        device_apply(spectrum, x, y);
+        y_j = y;
+      }
+    }
+
+    void device_apply(viennacl::vector<NumericT> const & spectrum, viennacl::vector_base<NumericT> const & x, viennacl::vector_base<NumericT> & y)
+    {
+      buffer_.clear();
+      viennacl::copy(x.begin(), x.end(), buffer_.begin());
+      viennacl::linalg::real_to_complex(buffer_, buffer_hat_, size_);
+      viennacl::inplace_fft(buffer_hat_);
+      viennacl::linalg::multiply_complex(spectrum, buffer_hat_, buffer_prod_);
+      viennacl::inplace_ifft(buffer_prod_);
+      viennacl::linalg::complex_to_real(buffer_prod_, buffer_, size_);
+      viennacl::copy(buffer_.begin(), buffer_.begin() + static_cast<vcl_ptrdiff_t>(y.size()), y.begin());
+    }
+
+    bool valid_;
+    bool inverse_valid_;
+    viennacl::memory_types memory_;
+    vcl_size_t size_;
+
+    // host memory:
+    viennacl::rfft_plan<NumericT> host_plan_;
+    std::vector<NumericT> host_spectrum_;
+    std::vector<NumericT> host_inverse_spectrum_;
+    std::vector<NumericT> host_buffer_;
+    std::vector<NumericT> host_buffer_hat_;
+
+    // other memory domains:
+    viennacl::vector<NumericT> spectrum_;
+    viennacl::vector<NumericT> inverse_spectrum_;
+    viennacl::vector<NumericT> buffer_;
+    viennacl::vector<NumericT> buffer_hat_;
+    viennacl::vector<NumericT> buffer_prod_;
+  };
+} //namespace fft
+} //namespace detail
 }      //namespace viennacl
 
 /// @endcond
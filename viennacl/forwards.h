@@ -268,6 +268,9 @@ namespace viennacl
   template<typename ScalarT>
   class vector_tuple;
 
+  template<typename ScalarT>
+  class reduction_list;
+
   //the following forwards are needed for GMRES
   template<typename SCALARTYPE, unsigned int ALIGNMENT, typename CPU_ITERATOR>
   void copy(CPU_ITERATOR const & cpu_begin,
@@ -351,6 +354,18 @@ namespace viennacl
     , HSA_MEMORY
   };
 
+  /** @brief The reductions which can be collected in a reduction_list */
+  enum reduction_types
+  {
+    REDUCTION_INNER_PROD
+    , REDUCTION_NORM_1
+    , REDUCTION_NORM_2
+    , REDUCTION_NORM_INF
+    , REDUCTION_MAX
+    , REDUCTION_MIN
+    , REDUCTION_SUM
+  };
+
   namespace backend
   {
     class mem_handle;
@@ -393,6 +408,9 @@ namespace viennacl
   template<class SCALARTYPE>
   class compressed_compressed_matrix;
 
+  template<typename NumericT, unsigned int AlignmentV = 1>
+  class permuted_matrix;
+
 
   template<class SCALARTYPE, unsigned int ALIGNMENT = 128>
   class coordinate_matrix;
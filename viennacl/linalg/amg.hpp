@@ -323,9 +323,7 @@ public:
                                                    static_cast<NumericT>(tag_.get_jacobi_weight()));
 
       // Compute residual.
-      //residual[level] = rhs_[level] - viennacl::linalg::prod(A_[level], result_[level]);
-      residual_list_[level] = viennacl::linalg::prod(A_list_[level], result_list_[level]);
-      residual_list_[level] = rhs_list_[level] - residual_list_[level];
+      residual_list_[level] = rhs_list_[level] - viennacl::linalg::prod(A_list_[level], result_list_[level]);
 
       // Restrict to coarse level. Result is RHS of coarse level equation.
       //residual_coarse[level] = viennacl::linalg::prod(R[level],residual[level]);
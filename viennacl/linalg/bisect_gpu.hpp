@@ -40,6 +40,7 @@
 #include "viennacl/linalg/detail/bisect/gerschgorin.hpp"
 #include "viennacl/linalg/detail/bisect/bisect_large.hpp"
 #include "viennacl/linalg/detail/bisect/bisect_small.hpp"
+#include "viennacl/linalg/host_based/bisect_operations.hpp"
 
 
 namespace viennacl
@@ -62,6 +63,13 @@ bisect(const std::vector<NumericT> & diagonal, const std::vector<NumericT> & sup
   assert(diagonal.size() == superdiagonal.size() &&
          diagonal.size() == eigenvalues.size()   &&
          bool("Input vectors do not have the same sizes!"));
+  // parallel multisection on the host if no compute device is used:
+  if (viennacl::context().memory_type() == viennacl::MAIN_MEMORY)
+  {
+    viennacl::linalg::host_based::bisect(diagonal, superdiagonal, eigenvalues);
+    return true;
+  }
+
   bool bResult = false;
   // flag if the matrix size is due to explicit user request
   // desired precision of eigenvalues
@@ -124,6 +132,19 @@ bisect(const viennacl::vector<NumericT> & diagonal, const viennacl::vector<Numer
   assert(diagonal.size() == superdiagonal.size() &&
          diagonal.size() == eigenvalues.size()   &&
          bool("Input vectors do not have the same sizes!"));
+  // parallel multisection on the host for vectors in host memory:
+  if (viennacl::traits::active_handle_id(diagonal) == viennacl::MAIN_MEMORY)
+  {
+    std::vector<NumericT> std_diagonal(diagonal.size());
+    std::vector<NumericT> std_superdiagonal(superdiagonal.size());
+    std::vector<NumericT> std_eigenvalues(eigenvalues.size());
+    viennacl::copy(diagonal, std_diagonal);
+    viennacl::copy(superdiagonal, std_superdiagonal);
+    viennacl::linalg::host_based::bisect(std_diagonal, std_superdiagonal, std_eigenvalues);
+    viennacl::copy(std_eigenvalues, eigenvalues);
+    return true;
+  }
+
   bool bResult = false;
   // flag if the matrix size is due to explicit user request
   // desired precision of eigenvalues
@@ -168,6 +189,69 @@ bisect(const viennacl::vector<NumericT> & diagonal, const viennacl::vector<Numer
   }
   return bResult;
 }
+
+
+///////////////////////////////////////////////////////////////////////////
+//! @brief bisect           Computes the eigenvalues and eigenvectors
+//!                         of a symmetric tridiagonal matrix. The eigenvectors
+//!                         are computed by inverse iteration in host memory.
+//! @param diagonal         diagonal elements of the matrix
+//! @param superdiagonal    superdiagonal elements of the matrix
+//! @param eigenvalues      Vectors with the eigenvalues in ascending order
+//! @param eigenvectors     Matrix receiving the orthonormal eigenvectors as columns
+//! @return                 return false if any errors occured
+///
+//! overloaded function template: std::vectors as parameters
+template<typename NumericT>
+bool
+bisect(const std::vector<NumericT> & diagonal, const std::vector<NumericT> & superdiagonal, std::vector<NumericT> & eigenvalues,
+       viennacl::matrix_base<NumericT> & eigenvectors)
+{
+  assert(eigenvectors.size1() == diagonal.size() && eigenvectors.size2() == diagonal.size() && bool("Size mismatch of eigenvector matrix!"));
+
+  bool bResult = bisect(diagonal, superdiagonal, eigenvalues);
+
+  if (viennacl::traits::active_handle_id(eigenvectors) == viennacl::MAIN_MEMORY)
+    viennacl::linalg::host_based::bisect_eigenvectors(diagonal, superdiagonal, eigenvalues, eigenvectors);
+  else
+  {
+    viennacl::matrix_base<NumericT> eigenvectors_host(eigenvectors);
+    eigenvectors_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+    viennacl::linalg::host_based::bisect_eigenvectors(diagonal, superdiagonal, eigenvalues, eigenvectors_host);
+    eigenvectors_host.switch_memory_context(viennacl::traits::context(eigenvectors));
+    eigenvectors = eigenvectors_host;
+  }
+  return bResult;
+}
+
+///////////////////////////////////////////////////////////////////////////
+//! overloaded function template: viennacl::vectors as parameters
+template<typename NumericT>
+bool
+bisect(const viennacl::vector<NumericT> & diagonal, const viennacl::vector<NumericT> & superdiagonal, viennacl::vector<NumericT> & eigenvalues,
+       viennacl::matrix_base<NumericT> & eigenvectors)
+{
+  std::vector<NumericT> std_diagonal(diagonal.size());
+  std::vector<NumericT> std_superdiagonal(superdiagonal.size());
+  std::vector<NumericT> std_eigenvalues(eigenvalues.size());
+  viennacl::copy(diagonal, std_diagonal);
+  viennacl::copy(superdiagonal, std_superdiagonal);
+
+  bool bResult = bisect(diagonal, superdiagonal, eigenvalues);
+  viennacl::copy(eigenvalues, std_eigenvalues);
+
+  if (viennacl::traits::active_handle_id(eigenvectors) == viennacl::MAIN_MEMORY)
+    viennacl::linalg::host_based::bisect_eigenvectors(std_diagonal, std_superdiagonal, std_eigenvalues, eigenvectors);
+  else
+  {
+    viennacl::matrix_base<NumericT> eigenvectors_host(eigenvectors);
+    eigenvectors_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+    viennacl::linalg::host_based::bisect_eigenvectors(std_diagonal, std_superdiagonal, std_eigenvalues, eigenvectors_host);
+    eigenvectors_host.switch_memory_context(viennacl::traits::context(eigenvectors));
+    eigenvectors = eigenvectors_host;
+  }
+  return bResult;
+}
 } // namespace linalg
 } // namespace viennacl
 #endif
@@ -0,0 +1,210 @@
+#ifndef VIENNACL_LINALG_CHOLESKY_HPP
+#define VIENNACL_LINALG_CHOLESKY_HPP
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/cholesky.hpp
+    @brief Implementations of dense Cholesky (A = L L^T) and symmetric indefinite (P A P^T = L D L^T) factorizations.
+
+    The factorizations are computed in host memory. Matrices in OpenCL or CUDA memory are transferred to the host and back.
+*/
+
+#include <vector>
+
+#include "viennacl/forwards.h"
+#include "viennacl/matrix.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/linalg/direct_solve.hpp"
+#include "viennacl/linalg/host_based/cholesky_operations.hpp"
+
+namespace viennacl
+{
+namespace linalg
+{
+
+/** @brief A tag for the dense Cholesky and LDL^T factorizations. */
+class cholesky_tag
+{
+public:
+  /** @brief The constructor
+  *
+  * @param block_size    Tile size (Cholesky) or panel width (LDL^T) of the blocked factorizations
+  * @param left_looking  If true, the Cholesky factorization uses the left-looking variant. Otherwise, the right-looking tiled variant is used.
+  */
+  cholesky_tag(vcl_size_t block_size = VIENNACL_HOST_CHOLESKY_BLOCK_SIZE, bool left_looking = false) : block_size_(block_size), left_looking_(left_looking) {}
+
+  /** @brief Returns the tile size of the blocked factorizations */
+  vcl_size_t block_size() const { return block_size_; }
+  /** @brief Sets the tile size of the blocked factorizations */
+  void block_size(vcl_size_t new_size) { block_size_ = new_size; }
+
+  /** @brief Returns true if the left-looking variant of the Cholesky factorization is used */
+  bool left_looking() const { return left_looking_; }
+  /** @brief Selects the left-looking (true) or the right-looking (false) variant of the Cholesky factorization */
+  void left_looking(bool b) { left_looking_ = b; }
+
+private:
+  vcl_size_t block_size_;
+  bool left_looking_;
+};
+
+
+/** @brief Cholesky factorization A = L L^T of a symmetric positive definite dense matrix.
+*
+* Only the lower triangle of A is referenced and overwritten with L. The strict upper triangle is not modified.
+* Throws a zero_on_diagonal_exception if A is not positive definite.
+*
+* @param A    The system matrix
+* @param tag  Selects the variant and the tile size
+*/
+template<typename NumericT>
+void cholesky_factorize(matrix_base<NumericT> & A, cholesky_tag const & tag = cholesky_tag())
+{
+  switch (viennacl::traits::handle(A).get_active_handle_id())
+  {
+    case viennacl::MAIN_MEMORY:
+      viennacl::linalg::host_based::cholesky_factorize(A, tag.block_size(), tag.left_looking());
+      break;
+    case viennacl::MEMORY_NOT_INITIALIZED:
+      throw memory_exception("not initialised!");
+    default:
+    {
+      viennacl::matrix_base<NumericT> A_host(A);
+      A_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+      viennacl::linalg::host_based::cholesky_factorize(A_host, tag.block_size(), tag.left_looking());
+      A_host.switch_memory_context(viennacl::traits::context(A));
+      A = A_host;
+    }
+  }
+}
+
+/** @brief Solves A X = B in place using the Cholesky factor L computed by cholesky_factorize().
+*
+* @param A    The Cholesky factor L in the lower triangle
+* @param B    The matrix of load vectors, where the solution is directly written to
+*/
+template<typename NumericT>
+void cholesky_substitute(matrix_base<NumericT> const & A, matrix_base<NumericT> & B)
+{
+  assert(A.size1() == A.size2() && bool("Matrix must be square"));
+  assert(A.size1() == B.size1() && bool("Size mismatch of system matrix and load vectors"));
+  inplace_solve(A, B, lower_tag());
+  inplace_solve(trans(A), B, upper_tag());
+}
+
+/** @brief Solves A x = b in place using the Cholesky factor L computed by cholesky_factorize().
+*
+* @param A    The Cholesky factor L in the lower triangle
+* @param vec  The load vector, where the solution is directly written to
+*/
+template<typename NumericT>
+void cholesky_substitute(matrix_base<NumericT> const & A, vector_base<NumericT> & vec)
+{
+  assert(A.size1() == A.size2() && bool("Matrix must be square"));
+  inplace_solve(A, vec, lower_tag());
+  inplace_solve(trans(A), vec, upper_tag());
+}
+
+
+/** @brief Factorization P A P^T = L D L^T of a symmetric (possibly indefinite) dense matrix with Bunch-Kaufman pivoting.
+*
+* Only the lower triangle of A is referenced and overwritten with the unit lower triangular factor L and the block diagonal D with 1x1 and 2x2 blocks.
+*
+* @param A       The system matrix
+* @param pivots  The interchanges: If pivots[k] >= 0, D(k,k) is a 1x1 block and rows/columns k and pivots[k] were interchanged.
+*                If pivots[k] = pivots[k+1] < 0, D(k:k+1, k:k+1) is a 2x2 block and rows/columns k+1 and -pivots[k]-1 were interchanged.
+* @param tag     The panel width is taken from the block size of the tag
+* @return        False if D is exactly singular, in which case ldlt_substitute() must not be used.
+*/
+template<typename NumericT>
+bool ldlt_factorize(matrix_base<NumericT> & A, std::vector<vcl_ptrdiff_t> & pivots, cholesky_tag const & tag = cholesky_tag())
+{
+  switch (viennacl::traits::handle(A).get_active_handle_id())
+  {
+    case viennacl::MAIN_MEMORY:
+      return viennacl::linalg::host_based::ldlt_factorize(A, pivots, tag.block_size());
+    case viennacl::MEMORY_NOT_INITIALIZED:
+      throw memory_exception("not initialised!");
+    default:
+    {
+      viennacl::matrix_base<NumericT> A_host(A);
+      A_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+      bool nonsingular = viennacl::linalg::host_based::ldlt_factorize(A_host, pivots, tag.block_size());
+      A_host.switch_memory_context(viennacl::traits::context(A));
+      A = A_host;
+      return nonsingular;
+    }
+  }
+}
+
+/** @brief Solves A X = B in place using the factors computed by ldlt_factorize().
+*
+* @param A       The factors L and D
+* @param pivots  The interchanges computed by ldlt_factorize()
+* @param B       The matrix of load vectors, where the solution is directly written to
+*/
+template<typename NumericT>
+void ldlt_substitute(matrix_base<NumericT> const & A, std::vector<vcl_ptrdiff_t> const & pivots, matrix_base<NumericT> & B)
+{
+  assert(A.size1() == A.size2() && bool("Matrix must be square"));
+  assert(A.size1() == B.size1() && bool("Size mismatch of system matrix and load vectors"));
+
+  if (viennacl::traits::handle(A).get_active_handle_id() == viennacl::MAIN_MEMORY && viennacl::traits::handle(B).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    viennacl::linalg::host_based::ldlt_substitute(A, pivots, B);
+  else
+  {
+    viennacl::matrix_base<NumericT> A_host(A);
+    viennacl::matrix_base<NumericT> B_host(B);
+    A_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+    B_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+    viennacl::linalg::host_based::ldlt_substitute(A_host, pivots, B_host);
+    B_host.switch_memory_context(viennacl::traits::context(B));
+    B = B_host;
+  }
+}
+
+/** @brief Solves A x = b in place using the factors computed by ldlt_factorize().
+*
+* @param A       The factors L and D
+* @param pivots  The interchanges computed by ldlt_factorize()
+* @param vec     The load vector, where the solution is directly written to
+*/
+template<typename NumericT>
+void ldlt_substitute(matrix_base<NumericT> const & A, std::vector<vcl_ptrdiff_t> const & pivots, vector_base<NumericT> & vec)
+{
+  assert(A.size1() == A.size2() && bool("Matrix must be square"));
+  assert(A.size1() == vec.size() && bool("Size mismatch of system matrix and load vector"));
+
+  if (viennacl::traits::handle(A).get_active_handle_id() == viennacl::MAIN_MEMORY && viennacl::traits::handle(vec).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    viennacl::linalg::host_based::ldlt_substitute(A, pivots, vec);
+  else
+  {
+    viennacl::matrix_base<NumericT> A_host(A);
+    viennacl::vector<NumericT> vec_host(vec);
+    A_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+    vec_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+    viennacl::linalg::host_based::ldlt_substitute(A_host, pivots, vec_host);
+    vec_host.switch_memory_context(viennacl::traits::context(vec));
+    vec = vec_host;
+  }
+}
+
+}
+}
+
+#endif
@@ -23,7 +23,9 @@
 */
 
 #include "viennacl/forwards.h"
+#ifdef VIENNACL_WITH_OPENCL
 #include "viennacl/ocl/backend.hpp"
+#endif
 #include "viennacl/scalar.hpp"
 #include "viennacl/vector.hpp"
 #include "viennacl/tools/tools.hpp"
@@ -52,20 +54,73 @@ void prod_impl(viennacl::circulant_matrix<NumericT, AlignmentV> const & mat,
 {
   assert(mat.size1() == result.size() && bool("Dimension mismatch"));
   assert(mat.size2() == vec.size() && bool("Dimension mismatch"));
-  //result.clear();
 
-  //std::cout << "prod(circulant_matrix" << ALIGNMENT << ", vector) called with internal_nnz=" << mat.internal_nnz() << std::endl;
+  mat.spectrum().prod(mat.elements(), vec, result);
+}
 
-  viennacl::vector<NumericT> circ(mat.elements().size() * 2);
-  viennacl::linalg::real_to_complex(mat.elements(), circ, mat.elements().size());
+/** @brief Carries out the product of a circulant_matrix with all columns of a dense matrix
+*
+* Implementation of the convenience expression result = prod(mat, B). The spectrum of the matrix is shared by all columns.
+*
+* @param mat    The matrix
+* @param B      The dense matrix
+* @param result The result matrix
+*/
+template<typename NumericT, unsigned int AlignmentV>
+void prod_impl(viennacl::circulant_matrix<NumericT, AlignmentV> const & mat,
+               viennacl::matrix_base<NumericT> const & B,
+               viennacl::matrix_base<NumericT>       & result)
+{
+  assert(mat.size1() == result.size1() && bool("Dimension mismatch"));
+  assert(mat.size2() == B.size1() && B.size2() == result.size2() && bool("Dimension mismatch"));
 
-  viennacl::vector<NumericT> tmp(vec.size() * 2);
-  viennacl::vector<NumericT> tmp2(vec.size() * 2);
+  mat.spectrum().prod(mat.elements(), B, result);
+}
 
-  viennacl::linalg::real_to_complex(vec, tmp, vec.size());
-  viennacl::linalg::convolve(circ, tmp, tmp2);
-  viennacl::linalg::complex_to_real(tmp2, result, vec.size());
+/** @brief Solves a system with a circulant_matrix in-place using its diagonalization by the FFT in O(n log n) operations
+*
+* The inverted spectrum of the matrix is cached alongside the spectrum used for products.
+* Throws a zero_on_diagonal_exception if the matrix is singular.
+*
+* @param mat    The matrix
+* @param vec    The right hand side vector, overwritten by the solution
+*/
+template<typename NumericT, unsigned int AlignmentV>
+void inplace_solve(viennacl::circulant_matrix<NumericT, AlignmentV> const & mat,
+                   viennacl::vector_base<NumericT> & vec)
+{
+  assert(mat.size1() == vec.size() && bool("Dimension mismatch"));
 
+  mat.spectrum().solve(mat.elements(), vec, vec);
+}
+
+/** @brief Solves a system with a circulant_matrix in-place for all columns of a dense matrix. The inverted spectrum is shared by all columns.
+*
+* @param mat    The matrix
+* @param B      The dense matrix of right hand sides, overwritten by the solutions
+*/
+template<typename NumericT, unsigned int AlignmentV>
+void inplace_solve(viennacl::circulant_matrix<NumericT, AlignmentV> const & mat,
+                   viennacl::matrix_base<NumericT> & B)
+{
+  assert(mat.size1() == B.size1() && bool("Dimension mismatch"));
+
+  mat.spectrum().solve(mat.elements(), B, B);
+}
+
+/** @brief Solves a system with a circulant_matrix using its diagonalization by the FFT in O(n log n) operations
+*
+* @param mat    The matrix
+* @param vec    The right hand side vector
+* @return The result vector
+*/
+template<typename NumericT, unsigned int AlignmentV>
+viennacl::vector<NumericT> solve(viennacl::circulant_matrix<NumericT, AlignmentV> const & mat,
+                                 viennacl::vector_base<NumericT> const & vec)
+{
+  viennacl::vector<NumericT> result(vec);
+  inplace_solve(mat, result);
+  return result;
 }
 
 } //namespace linalg
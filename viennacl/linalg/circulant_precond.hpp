@@ -0,0 +1,125 @@
+#ifndef VIENNACL_LINALG_CIRCULANT_PRECOND_HPP_
+#define VIENNACL_LINALG_CIRCULANT_PRECOND_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/circulant_precond.hpp
+    @brief Implementation of circulant preconditioners (Strang, T. Chan) for Toeplitz systems. Experimental.
+*/
+
+#include <vector>
+
+#include "viennacl/forwards.h"
+#include "viennacl/vector.hpp"
+#include "viennacl/circulant_matrix.hpp"
+#include "viennacl/toeplitz_matrix.hpp"
+
+namespace viennacl
+{
+namespace linalg
+{
+
+/** @brief A tag for a circulant preconditioner for Toeplitz matrices
+*/
+class circulant_precond_tag
+{
+public:
+  /** @brief The circulant approximation of the Toeplitz matrix */
+  enum circulant_type
+  {
+    /** @brief Strang's preconditioner: copies the central diagonals of the Toeplitz matrix */
+    strang = 0,
+    /** @brief T. Chan's optimal preconditioner: minimizes the Frobenius norm of the difference to the Toeplitz matrix */
+    chan
+  };
+
+  /** @brief The constructor
+  *
+  * @param type    The circulant approximation to be used
+  */
+  circulant_precond_tag(circulant_type type = chan) : type_(type) {}
+
+  /** @brief Returns the circulant approximation */
+  circulant_type type() const { return type_; }
+
+private:
+  circulant_type type_;
+};
+
+
+/** @brief Circulant preconditioner class for Toeplitz matrices, can be supplied to solve()-routines.
+*
+* The preconditioner is applied by a circulant solve in O(n log n) operations.
+*/
+template<typename MatrixT>
+class circulant_precond;
+
+/** @brief Circulant preconditioner class for toeplitz_matrix, can be supplied to solve()-routines.
+*/
+template<typename NumericT, unsigned int AlignmentV>
+class circulant_precond< viennacl::toeplitz_matrix<NumericT, AlignmentV> >
+{
+public:
+  circulant_precond(viennacl::toeplitz_matrix<NumericT, AlignmentV> const & mat, circulant_precond_tag const & tag)
+    : tag_(tag), circ_(mat.size1(), mat.size1())
+  {
+    assert(mat.size1() == mat.size2() && bool("Circulant preconditioner requires a square matrix"));
+    init(mat);
+  }
+
+  /** @brief Sets up the circulant approximation of the Toeplitz matrix */
+  void init(viennacl::toeplitz_matrix<NumericT, AlignmentV> const & mat)
+  {
+    vcl_size_t n = mat.size1();
+
+    // the generator holds t_k for k >= 0 in its first n entries and t_{k-n} for 0 < k < n in the entries n+k:
+    std::vector<NumericT> t(mat.elements().size());
+    viennacl::fast_copy(mat.elements(), t);
+
+    std::vector<NumericT> c(n);
+    c[0] = t[0];
+    for (vcl_size_t k = 1; k < n; ++k)
+    {
+      if (tag_.type() == circulant_precond_tag::strang)
+        c[k] = (2 * k <= n) ? t[k] : t[n + k];
+      else
+        c[k] = (NumericT(n - k) * t[k] + NumericT(k) * t[n + k]) / NumericT(n);
+    }
+
+    circ_.elements().switch_memory_context(viennacl::traits::context(mat.elements()));
+    viennacl::copy(c, circ_);
+  }
+
+  /** @brief Applies the inverse of the circulant approximation to the vector */
+  void apply(viennacl::vector_base<NumericT> & vec) const
+  {
+    viennacl::linalg::inplace_solve(circ_, vec);
+  }
+
+  /** @brief Returns the circulant approximation */
+  viennacl::circulant_matrix<NumericT, AlignmentV> const & circulant() const { return circ_; }
+
+private:
+  circulant_precond_tag tag_;
+  viennacl::circulant_matrix<NumericT, AlignmentV> circ_;
+};
+
+}
+}
+
+#endif
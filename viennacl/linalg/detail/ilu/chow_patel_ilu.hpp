@@ -49,7 +49,7 @@ public:
     * @param num_sweeps        Number of sweeps in setup phase
     * @param num_jacobi_iters  Number of Jacobi iterations for each triangular 'solve' when applying the preconditioner to a vector
     */
-  chow_patel_tag(vcl_size_t num_sweeps = 3, vcl_size_t num_jacobi_iters = 2) : sweeps_(num_sweeps), jacobi_iters_(num_jacobi_iters) {}
+  chow_patel_tag(vcl_size_t num_sweeps = 3, vcl_size_t num_jacobi_iters = 2) : sweeps_(num_sweeps), jacobi_iters_(num_jacobi_iters), async_(false), sweep_tol_(0) {}
 
   /** @brief Returns the number of sweeps (i.e. number of nonlinear iterations) in the solver setup stage */
   vcl_size_t sweeps() const { return sweeps_; }
@@ -61,24 +61,102 @@ public:
   /** @brief Sets the number of Jacobi iterations for each triangular 'solve' when applying the preconditioner to a vector. */
   void       jacobi_iters(vcl_size_t num) { jacobi_iters_ = num; }
 
+  /** @brief Returns true if asynchronous (in-place, Gauss-Seidel-like) sweeps are used for data in host memory. */
+  bool async_sweeps() const { return async_; }
+  /** @brief Enables or disables asynchronous (in-place, Gauss-Seidel-like) sweeps for data in host memory. Synchronous sweeps are used for all other backends. */
+  void async_sweeps(bool b) { async_ = b; }
+
+  /** @brief Returns the relative tolerance for the change of the nonlinear residual estimate below which the sweeps are considered stagnated. */
+  double sweep_tolerance() const { return sweep_tol_; }
+  /** @brief Sets the relative tolerance for the change of the nonlinear residual estimate. Sweeps stop early once |r_k - r_{k-1}| <= tol * r_{k-1}. Only used with asynchronous sweeps. */
+  void   sweep_tolerance(double tol) { if (tol >= 0) sweep_tol_ = tol; }
+
 private:
   vcl_size_t sweeps_;
   vcl_size_t jacobi_iters_;
+  bool       async_;
+  double     sweep_tol_;
 };
 
 namespace detail
 {
+  /** @brief Returns true if the sweeps for the factor L should be run asynchronously on the host. */
+  template<typename NumericT>
+  bool use_async_sweeps(viennacl::compressed_matrix<NumericT> const & L, chow_patel_tag const & tag)
+  {
+    return tag.async_sweeps() && viennacl::traits::handle(L).get_active_handle_id() == viennacl::MAIN_MEMORY;
+  }
+
+  /** @brief Returns true if the nonlinear residual estimates of two consecutive asynchronous sweeps indicate stagnation. */
+  template<typename NumericT>
+  bool sweeps_stagnated(NumericT residual, NumericT previous_residual, chow_patel_tag const & tag)
+  {
+    return std::fabs(previous_residual - residual) <= NumericT(tag.sweep_tolerance()) * previous_residual;
+  }
+
+  /** @brief Runs the nonlinear sweeps of the parallel ICC0 factorization on L, starting with the current values in L. Returns the number of sweeps performed. */
+  template<typename NumericT>
+  vcl_size_t icc_sweeps(viennacl::compressed_matrix<NumericT> & L,
+                  viennacl::vector<NumericT>            & aij_L,
+                  chow_patel_tag const & tag)
+  {
+    if (use_async_sweeps(L, tag))
+    {
+      NumericT previous_residual = 0;
+      for (vcl_size_t i=0; i<tag.sweeps(); ++i)
+      {
+        NumericT residual = viennacl::linalg::icc_chow_patel_sweep_async(L, aij_L);
+        if (i > 0 && sweeps_stagnated(residual, previous_residual, tag))
+          return i + 1;
+        previous_residual = residual;
+      }
+    }
+    else
+    {
+      for (vcl_size_t i=0; i<tag.sweeps(); ++i)
+        viennacl::linalg::icc_chow_patel_sweep(L, aij_L);
+    }
+    return tag.sweeps();
+  }
+
+  /** @brief Runs the nonlinear sweeps of the parallel ILU0 factorization on L and U_trans, starting with the current values in L and U_trans. Returns the number of sweeps performed. */
+  template<typename NumericT>
+  vcl_size_t ilu_sweeps(viennacl::compressed_matrix<NumericT>       & L,
+                  viennacl::vector<NumericT>            const & aij_L,
+                  viennacl::compressed_matrix<NumericT>       & U_trans,
+                  viennacl::vector<NumericT>            const & aij_U_trans,
+                  chow_patel_tag const & tag)
+  {
+    if (use_async_sweeps(L, tag))
+    {
+      NumericT previous_residual = 0;
+      for (vcl_size_t i=0; i<tag.sweeps(); ++i)
+      {
+        NumericT residual = viennacl::linalg::ilu_chow_patel_sweep_async(L, aij_L, U_trans, aij_U_trans);
+        if (i > 0 && sweeps_stagnated(residual, previous_residual, tag))
+          return i + 1;
+        previous_residual = residual;
+      }
+    }
+    else
+    {
+      for (vcl_size_t i=0; i<tag.sweeps(); ++i)
+        viennacl::linalg::ilu_chow_patel_sweep(L, aij_L, U_trans, aij_U_trans);
+    }
+    return tag.sweeps();
+  }
+
   /** @brief Implementation of the parallel ICC0 factorization, Algorithm 3 in Chow-Patel paper.
    *
    *  Rather than dealing with a column-major upper triangular matrix U, we use the lower-triangular matrix L such that A is approximately given by LL^T.
    *  The advantage is that L is readily available in row-major format.
    */
   template<typename NumericT>
-  void precondition(viennacl::compressed_matrix<NumericT> const & A,
-                    viennacl::compressed_matrix<NumericT>       & L,
-                    viennacl::vector<NumericT>                  & diag_L,
-                    viennacl::compressed_matrix<NumericT>       & L_trans,
-                    chow_patel_tag const & tag)
+  vcl_size_t precondition(viennacl::compressed_matrix<NumericT> const & A,
+                          viennacl::compressed_matrix<NumericT>       & L,
+                          viennacl::vector<NumericT>                  & diag_L,
+                          viennacl::compressed_matrix<NumericT>       & L_trans,
+                          chow_patel_tag const & tag)
   {
     // make sure L and U have correct dimensions:
     L.resize(A.size1(), A.size2(), false);
@@ -93,8 +171,7 @@ namespace detail
     viennacl::backend::memory_copy(L.handle(), aij_L.handle(), 0, 0, sizeof(NumericT) * L.nnz());
 
     // run sweeps:
-    for (vcl_size_t i=0; i<tag.sweeps(); ++i)
-      viennacl::linalg::icc_chow_patel_sweep(L, aij_L);
+    vcl_size_t sweeps = icc_sweeps(L, aij_L, tag);
 
     // transpose L to obtain L_trans:
     viennacl::linalg::ilu_transpose(L, L_trans);
@@ -102,17 +179,50 @@ namespace detail
     // form (I - D_L^{-1}L) and (I - D_U^{-1} U), with U := L_trans
     viennacl::linalg::ilu_form_neumann_matrix(L,       diag_L);
     viennacl::linalg::ilu_form_neumann_matrix(L_trans, diag_L);
+
+    return sweeps;
+  }
+
+  /** @brief Recomputes the parallel ICC0 factorization for new values in A (same sparsity pattern), using the previous factor as initial guess. */
+  template<typename NumericT>
+  vcl_size_t precondition_warm_start(viennacl::compressed_matrix<NumericT> const & A,
+                                     viennacl::compressed_matrix<NumericT>       & L,
+                                     viennacl::vector<NumericT>                  & diag_L,
+                                     viennacl::compressed_matrix<NumericT>       & L_trans,
+                                     chow_patel_tag const & tag)
+  {
+    // extract new values of A into the pattern of L:
+    viennacl::compressed_matrix<NumericT> L_A(A.size1(), A.size2(), 0, viennacl::traits::context(A));
+    viennacl::linalg::extract_L(A, L_A);
+    viennacl::linalg::icc_scale(A, L_A);
+
+    assert(L_A.nnz() == L.nnz() && bool("Sparsity pattern of system matrix changed, cannot warm-start Chow-Patel ICC!"));
+
+    viennacl::vector<NumericT> aij_L(L_A.nnz(), viennacl::traits::context(A));
+    viennacl::backend::memory_copy(L_A.handle(), aij_L.handle(), 0, 0, sizeof(NumericT) * L_A.nnz());
+
+    // recover previous factor L from (I - D_L^{-1}L) and use it as initial guess:
+    viennacl::linalg::ilu_restore_from_neumann_matrix(L, diag_L);
+
+    vcl_size_t sweeps = icc_sweeps(L, aij_L, tag);
+
+    viennacl::linalg::ilu_transpose(L, L_trans);
+
+    viennacl::linalg::ilu_form_neumann_matrix(L,       diag_L);
+    viennacl::linalg::ilu_form_neumann_matrix(L_trans, diag_L);
+
+    return sweeps;
   }
 
 
   /** @brief Implementation of the parallel ILU0 factorization, Algorithm 2 in Chow-Patel paper. */
   template<typename NumericT>
-  void precondition(viennacl::compressed_matrix<NumericT> const & A,
-                    viennacl::compressed_matrix<NumericT>       & L,
-                    viennacl::vector<NumericT>                  & diag_L,
-                    viennacl::compressed_matrix<NumericT>       & U,
-                    viennacl::vector<NumericT>                  & diag_U,
-                    chow_patel_tag const & tag)
+  vcl_size_t precondition(viennacl::compressed_matrix<NumericT> const & A,
+                          viennacl::compressed_matrix<NumericT>       & L,
+                          viennacl::vector<NumericT>                  & diag_L,
+                          viennacl::compressed_matrix<NumericT>       & U,
+                          viennacl::vector<NumericT>                  & diag_U,
+                          chow_patel_tag const & tag)
   {
     // make sure L and U have correct dimensions:
     L.resize(A.size1(), A.size2(), false);
@@ -136,8 +246,7 @@ namespace detail
     viennacl::backend::memory_copy(U_trans.handle(), aij_U_trans.handle(), 0, 0, sizeof(NumericT) * U_trans.nnz());
 
     // run sweeps:
-    for (vcl_size_t i=0; i<tag.sweeps(); ++i)
-      viennacl::linalg::ilu_chow_patel_sweep(L, aij_L, U_trans, aij_U_trans);
+    vcl_size_t sweeps = ilu_sweeps(L, aij_L, U_trans, aij_U_trans, tag);
 
     // transpose U_trans back:
     viennacl::linalg::ilu_transpose(U_trans, U);
@@ -145,6 +254,51 @@ namespace detail
     // form (I - D_L^{-1}L) and (I - D_U^{-1} U)
     viennacl::linalg::ilu_form_neumann_matrix(L, diag_L);
     viennacl::linalg::ilu_form_neumann_matrix(U, diag_U);
+
+    return sweeps;
+  }
+
+  /** @brief Recomputes the parallel ILU0 factorization for new values in A (same sparsity pattern), using the previous factors as initial guess. */
+  template<typename NumericT>
+  vcl_size_t precondition_warm_start(viennacl::compressed_matrix<NumericT> const & A,
+                                     viennacl::compressed_matrix<NumericT>       & L,
+                                     viennacl::vector<NumericT>                  & diag_L,
+                                     viennacl::compressed_matrix<NumericT>       & U,
+                                     viennacl::vector<NumericT>                  & diag_U,
+                                     chow_patel_tag const & tag)
+  {
+    // extract new values of A:
+    viennacl::compressed_matrix<NumericT> L_A(A.size1(), A.size2(), 0, viennacl::traits::context(A));
+    viennacl::compressed_matrix<NumericT> U_A(A.size1(), A.size2(), 0, viennacl::traits::context(A));
+    viennacl::linalg::extract_LU(A, L_A, U_A);
+    viennacl::linalg::ilu_scale(A, L_A, U_A);
+
+    assert(L_A.nnz() == L.nnz() && U_A.nnz() == U.nnz() && bool("Sparsity pattern of system matrix changed, cannot warm-start Chow-Patel ILU!"));
+
+    viennacl::compressed_matrix<NumericT> U_A_trans;
+    viennacl::linalg::ilu_transpose(U_A, U_A_trans);
+
+    viennacl::vector<NumericT> aij_L      (L_A.nnz(),       viennacl::traits::context(A));
+    viennacl::vector<NumericT> aij_U_trans(U_A_trans.nnz(), viennacl::traits::context(A));
+
+    viennacl::backend::memory_copy(      L_A.handle(), aij_L.handle(),       0, 0, sizeof(NumericT) * L_A.nnz());
+    viennacl::backend::memory_copy(U_A_trans.handle(), aij_U_trans.handle(), 0, 0, sizeof(NumericT) * U_A_trans.nnz());
+
+    // recover previous factors from (I - D_L^{-1}L) and (I - D_U^{-1} U) and use them as initial guess:
+    viennacl::linalg::ilu_restore_from_neumann_matrix(L, diag_L);
+    viennacl::linalg::ilu_restore_from_neumann_matrix(U, diag_U);
+
+    viennacl::compressed_matrix<NumericT> U_trans;
+    viennacl::linalg::ilu_transpose(U, U_trans);
+
+    vcl_size_t sweeps = ilu_sweeps(L, aij_L, U_trans, aij_U_trans, tag);
+
+    viennacl::linalg::ilu_transpose(U_trans, U);
+
+    viennacl::linalg::ilu_form_neumann_matrix(L, diag_L);
+    viennacl::linalg::ilu_form_neumann_matrix(U, diag_U);
+
+    return sweeps;
   }
 
 }
@@ -179,9 +333,22 @@ public:
       x_k_(A.size1(), viennacl::traits::context(A)),
       b_(A.size1(), viennacl::traits::context(A))
   {
-    viennacl::linalg::detail::precondition(A, L_, diag_L_, L_trans_, tag_);
+    sweeps_performed_ = viennacl::linalg::detail::precondition(A, L_, diag_L_, L_trans_, tag_);
+  }
+
+  /** @brief Recomputes the factorization after the values (but not the sparsity pattern) of A have changed.
+    *
+    * The previous factor is used as initial guess for the nonlinear sweeps. Combined with asynchronous sweeps and a sweep tolerance
+    * (see chow_patel_tag), typically only one or two sweeps are required for slowly varying matrices.
+    */
+  void update(viennacl::compressed_matrix<NumericT, AlignmentV> const & A)
+  {
+    sweeps_performed_ = viennacl::linalg::detail::precondition_warm_start(A, L_, diag_L_, L_trans_, tag_);
   }
 
+  /** @brief Returns the number of nonlinear sweeps performed in the last (re-)computation of the factorization. Less than chow_patel_tag::sweeps() if the sweeps stagnated early. */
+  vcl_size_t sweeps_performed() const { return sweeps_performed_; }
+
   /** @brief Preconditioner application: LL^Tx = b, computed via Ly = b, L^Tx = y using Jacobi iterations.
     *
     * L contains (I - D_L^{-1}L), L_trans contains (I - D_L^{-1}L^T) where D denotes the respective diagonal matrix
@@ -220,6 +387,7 @@ private:
   viennacl::compressed_matrix<NumericT>   L_;
   viennacl::vector<NumericT>              diag_L_;
   viennacl::compressed_matrix<NumericT>   L_trans_;
+  vcl_size_t                              sweeps_performed_;
 
   mutable viennacl::vector<NumericT>      x_k_;
   mutable viennacl::vector<NumericT>      b_;
@@ -258,9 +426,22 @@ public:
       x_k_(A.size1(), viennacl::traits::context(A)),
       b_(A.size1(), viennacl::traits::context(A))
   {
-    viennacl::linalg::detail::precondition(A, L_, diag_L_, U_, diag_U_, tag_);
+    sweeps_performed_ = viennacl::linalg::detail::precondition(A, L_, diag_L_, U_, diag_U_, tag_);
   }
 
+  /** @brief Recomputes the factorization after the values (but not the sparsity pattern) of A have changed.
+    *
+    * The previous factors are used as initial guess for the nonlinear sweeps. Combined with asynchronous sweeps and a sweep tolerance
+    * (see chow_patel_tag), typically only one or two sweeps are required for slowly varying matrices.
+    */
+  void update(viennacl::compressed_matrix<NumericT, AlignmentV> const & A)
+  {
+    sweeps_performed_ = viennacl::linalg::detail::precondition_warm_start(A, L_, diag_L_, U_, diag_U_, tag_);
+  }
+
+  /** @brief Returns the number of nonlinear sweeps performed in the last (re-)computation of the factorization. Less than chow_patel_tag::sweeps() if the sweeps stagnated early. */
+  vcl_size_t sweeps_performed() const { return sweeps_performed_; }
+
   /** @brief Preconditioner application: LUx = b, computed via Ly = b, Ux = y using Jacobi iterations.
     *
     * L_ contains (I - D_L^{-1}L), U_ contains (I - D_U^{-1}U) where D denotes the respective diagonal matrix
@@ -300,6 +481,7 @@ private:
   viennacl::vector<NumericT>              diag_L_;
   viennacl::compressed_matrix<NumericT>   U_;
   viennacl::vector<NumericT>              diag_U_;
+  vcl_size_t                              sweeps_performed_;
 
   mutable viennacl::vector<NumericT>      x_k_;
   mutable viennacl::vector<NumericT>      b_;
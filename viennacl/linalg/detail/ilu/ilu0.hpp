@@ -45,6 +45,8 @@
 #include "viennacl/backend/memory.hpp"
 
 #include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/coloring_operations.hpp"
+#include "viennacl/linalg/host_based/reorder_operations.hpp"
 
 #include <map>
 
@@ -58,36 +60,31 @@ namespace linalg
 class ilu0_tag
 {
 public:
-  ilu0_tag(bool with_level_scheduling = false) : use_level_scheduling_(with_level_scheduling) {}
+  ilu0_tag(bool with_level_scheduling = false, bool with_multicoloring = false)
+    : use_level_scheduling_(with_level_scheduling), use_multicoloring_(with_multicoloring) {}
 
   bool use_level_scheduling() const { return use_level_scheduling_; }
   void use_level_scheduling(bool b) { use_level_scheduling_ = b; }
 
+  /** @brief Returns true if the unknowns are numbered color by color before the factorization (compressed_matrix only).
+    *
+    * In the multicolor ordering, the factorization and the triangular solves process all unknowns of one color in parallel.
+    * Since the ordering differs from the original one, the preconditioner usually requires somewhat more iterations.
+    */
+  bool use_multicoloring() const { return use_multicoloring_; }
+  void use_multicoloring(bool b) { use_multicoloring_ = b; }
+
 private:
   bool use_level_scheduling_;
+  bool use_multicoloring_;
 };
 
 
-/** @brief Implementation of a ILU-preconditioner with static pattern. Optimized version for CSR matrices.
-  *
-  * refer to the Algorithm in Saad's book (1996 edition)
-  *
-  *  @param A       The sparse matrix matrix. The result is directly written to A.
-  */
-template<typename NumericT>
-void precondition(viennacl::compressed_matrix<NumericT> & A, ilu0_tag const & /* tag */)
+namespace detail
 {
-  assert( (A.handle1().get_active_handle_id() == viennacl::MAIN_MEMORY) && bool("System matrix must reside in main memory for ILU0") );
-  assert( (A.handle2().get_active_handle_id() == viennacl::MAIN_MEMORY) && bool("System matrix must reside in main memory for ILU0") );
-  assert( (A.handle().get_active_handle_id()  == viennacl::MAIN_MEMORY) && bool("System matrix must reside in main memory for ILU0") );
-
-  NumericT           * elements   = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(A.handle());
-  unsigned int const * row_buffer = viennacl::linalg::host_based::detail::extract_raw_pointer<unsigned int>(A.handle1());
-  unsigned int const * col_buffer = viennacl::linalg::host_based::detail::extract_raw_pointer<unsigned int>(A.handle2());
-
-  // Note: Line numbers in the following refer to the algorithm in Saad's book
-
-  for (vcl_size_t i=1; i<A.size1(); ++i)  // Line 1
+  /** @brief Performs the ILU0 elimination steps for row i of a CSR matrix, which requires rows k < i with nonzeros a_ik to be processed already. */
+  template<typename NumericT>
+  void ilu0_eliminate_row(NumericT * elements, unsigned int const * row_buffer, unsigned int const * col_buffer, vcl_size_t i)
   {
     unsigned int row_i_begin = row_buffer[i];
     unsigned int row_i_end   = row_buffer[i+1];
@@ -136,9 +133,61 @@ void precondition(viennacl::compressed_matrix<NumericT> & A, ilu0_tag const & /*
       }
     }
   }
+}
 
+/** @brief Implementation of a ILU-preconditioner with static pattern. Optimized version for CSR matrices.
+  *
+  * refer to the Algorithm in Saad's book (1996 edition)
+  *
+  *  @param A       The sparse matrix matrix. The result is directly written to A.
+  */
+template<typename NumericT>
+void precondition(viennacl::compressed_matrix<NumericT> & A, ilu0_tag const & /* tag */)
+{
+  assert( (A.handle1().get_active_handle_id() == viennacl::MAIN_MEMORY) && bool("System matrix must reside in main memory for ILU0") );
+  assert( (A.handle2().get_active_handle_id() == viennacl::MAIN_MEMORY) && bool("System matrix must reside in main memory for ILU0") );
+  assert( (A.handle().get_active_handle_id()  == viennacl::MAIN_MEMORY) && bool("System matrix must reside in main memory for ILU0") );
+
+  NumericT           * elements   = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(A.handle());
+  unsigned int const * row_buffer = viennacl::linalg::host_based::detail::extract_raw_pointer<unsigned int>(A.handle1());
+  unsigned int const * col_buffer = viennacl::linalg::host_based::detail::extract_raw_pointer<unsigned int>(A.handle2());
+
+  // Note: Line numbers in the following refer to the algorithm in Saad's book
+
+  for (vcl_size_t i=1; i<A.size1(); ++i)  // Line 1
+    detail::ilu0_eliminate_row(elements, row_buffer, col_buffer, i);
 }
 
+/** @brief Implementation of a ILU-preconditioner with static pattern for CSR matrices in multicolor ordering.
+  *
+  * The rows color_ptr[c], ..., color_ptr[c+1] - 1 of each color are not coupled, hence they are eliminated in parallel.
+  *
+  *  @param A           The sparse matrix matrix. The result is directly written to A.
+  *  @param color_ptr   Offsets of the colors in the numbering of A
+  */
+template<typename NumericT>
+void precondition(viennacl::compressed_matrix<NumericT> & A, ilu0_tag const & /* tag */, std::vector<unsigned int> const & color_ptr)
+{
+  assert( (A.handle1().get_active_handle_id() == viennacl::MAIN_MEMORY) && bool("System matrix must reside in main memory for ILU0") );
+  assert( (A.handle2().get_active_handle_id() == viennacl::MAIN_MEMORY) && bool("System matrix must reside in main memory for ILU0") );
+  assert( (A.handle().get_active_handle_id()  == viennacl::MAIN_MEMORY) && bool("System matrix must reside in main memory for ILU0") );
+
+  NumericT           * elements   = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(A.handle());
+  unsigned int const * row_buffer = viennacl::linalg::host_based::detail::extract_raw_pointer<unsigned int>(A.handle1());
+  unsigned int const * col_buffer = viennacl::linalg::host_based::detail::extract_raw_pointer<unsigned int>(A.handle2());
+
+  for (vcl_size_t c=0; c+1<color_ptr.size(); ++c)
+  {
+    long block_begin = long(color_ptr[c]);
+    long block_end   = long(color_ptr[c+1]);
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (block_end - block_begin > VIENNACL_OPENMP_COLORING_MIN_SIZE)
+#endif
+    for (long i=block_begin; i<block_end; ++i)
+      detail::ilu0_eliminate_row(elements, row_buffer, col_buffer, vcl_size_t(i));
+  }
+}
 
 /** @brief ILU0 preconditioner class, can be supplied to solve()-routines
 */
@@ -205,7 +254,19 @@ public:
   void apply(viennacl::vector<NumericT> & vec) const
   {
     viennacl::context host_context(viennacl::MAIN_MEMORY);
-    if (vec.handle().get_active_handle_id() != viennacl::MAIN_MEMORY)
+    if (tag_.use_multicoloring())
+    {
+      if (vec.handle().get_active_handle_id() != viennacl::MAIN_MEMORY)
+      {
+        viennacl::context old_context = viennacl::traits::context(vec);
+        viennacl::switch_memory_context(vec, host_context);
+        apply_multicolor(vec);
+        viennacl::switch_memory_context(vec, old_context);
+      }
+      else
+        apply_multicolor(vec);
+    }
+    else if (vec.handle().get_active_handle_id() != viennacl::MAIN_MEMORY)
     {
       if (tag_.use_level_scheduling())
       {
@@ -267,14 +328,53 @@ public:
   vcl_size_t levels() const { return multifrontal_L_row_index_arrays_.size(); }
 
 private:
+  /** @brief Applies the factorization in multicolor ordering to a vector in host memory */
+  void apply_multicolor(viennacl::vector<NumericT> & vec) const
+  {
+    viennacl::linalg::host_based::permute(vec, permutation_, permuted_vec_);
+
+    detail::level_scheduling_substitute(permuted_vec_,
+                                        multifrontal_L_row_index_arrays_,
+                                        multifrontal_L_row_buffers_,
+                                        multifrontal_L_col_buffers_,
+                                        multifrontal_L_element_buffers_,
+                                        multifrontal_L_row_elimination_num_list_);
+
+    permuted_vec_ = viennacl::linalg::element_div(permuted_vec_, multifrontal_U_diagonal_);
+
+    detail::level_scheduling_substitute(permuted_vec_,
+                                        multifrontal_U_row_index_arrays_,
+                                        multifrontal_U_row_buffers_,
+                                        multifrontal_U_col_buffers_,
+                                        multifrontal_U_element_buffers_,
+                                        multifrontal_U_row_elimination_num_list_);
+
+    viennacl::linalg::host_based::inverse_permute(permuted_vec_, permutation_, vec);
+  }
+
   void init(MatrixType const & mat)
   {
     viennacl::context host_context(viennacl::MAIN_MEMORY);
     viennacl::switch_memory_context(LU_, host_context);
     LU_ = mat;
-    viennacl::linalg::precondition(LU_, tag_);
 
-    if (!tag_.use_level_scheduling())
+    if (tag_.use_multicoloring())
+    {
+      // number the unknowns color by color, then each color is eliminated and substituted in parallel:
+      std::vector<unsigned int> color_ptr;
+      permutation_ = viennacl::linalg::host_based::multicolor_permutation(viennacl::linalg::host_based::jones_plassmann_coloring(LU_, 1), color_ptr);
+
+      viennacl::compressed_matrix<NumericT> LU_colored(0, 0, 0, host_context);
+      viennacl::linalg::host_based::permute(LU_, permutation_, LU_colored);
+      LU_ = LU_colored;
+      viennacl::linalg::precondition(LU_, tag_, color_ptr);
+
+      permuted_vec_ = viennacl::vector<NumericT>(LU_.size1(), host_context);
+    }
+    else
+      viennacl::linalg::precondition(LU_, tag_);
+
+    if (!tag_.use_level_scheduling() && !tag_.use_multicoloring())
       return;
 
     // multifrontal part:
@@ -299,6 +399,9 @@ private:
                                      multifrontal_U_element_buffers_,
                                      multifrontal_U_row_elimination_num_list_);
 
+    if (tag_.use_multicoloring())  // applied in host memory
+      return;
+
     //
     // Bring to device if necessary:
     //
@@ -367,6 +470,8 @@ private:
   std::list<viennacl::backend::mem_handle> multifrontal_U_element_buffers_;
   std::list<vcl_size_t>                    multifrontal_U_row_elimination_num_list_;
 
+  std::vector<unsigned int>                permutation_;
+  mutable viennacl::vector<NumericT>       permuted_vec_;
 };
 
 } // namespace linalg
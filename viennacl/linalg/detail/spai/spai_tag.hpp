@@ -35,7 +35,6 @@
 #include <math.h>
 #include <cmath>
 #include <sstream>
-#include "viennacl/ocl/backend.hpp"
 #include "boost/numeric/ublas/vector.hpp"
 #include "boost/numeric/ublas/matrix.hpp"
 #include "boost/numeric/ublas/matrix_proxy.hpp"
@@ -44,8 +43,11 @@
 #include "boost/numeric/ublas/matrix_expression.hpp"
 #include "boost/numeric/ublas/detail/matrix_assign.hpp"
 
+#ifdef VIENNACL_WITH_OPENCL
+#include "viennacl/ocl/backend.hpp"
 #include "viennacl/linalg/detail/spai/block_matrix.hpp"
 #include "viennacl/linalg/detail/spai/block_vector.hpp"
+#endif
 
 namespace viennacl
 {
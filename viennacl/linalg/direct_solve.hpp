@@ -139,6 +139,13 @@ break;
   {
     typedef typename viennacl::result_of::cpu_value_type<MatrixT1>::type  NumericType;
 
+    // the host backend blocks recursively on its own:
+    if (viennacl::traits::handle(A).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    {
+      inplace_solve_kernel(A, B, SolverTagT());
+      return;
+    }
+
     vcl_size_t blockSize = VIENNACL_DIRECT_SOLVE_BLOCKSIZE;
     if (A.size1() <= blockSize)
       inplace_solve_kernel(A, B, SolverTagT());
@@ -181,6 +188,13 @@ break;
   {
     typedef typename viennacl::result_of::cpu_value_type<MatrixT1>::type  NumericType;
 
+    // the host backend blocks recursively on its own:
+    if (viennacl::traits::handle(A).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    {
+      inplace_solve_kernel(A, B, SolverTagT());
+      return;
+    }
+
     int blockSize = VIENNACL_DIRECT_SOLVE_BLOCKSIZE;
     if (static_cast<int>(A.size1()) <= blockSize)
       inplace_solve_kernel(A, B, SolverTagT());
@@ -24,6 +24,8 @@
 
 #include "viennacl/linalg/bisect.hpp"
 #include "viennacl/linalg/lanczos.hpp"
+#include "viennacl/linalg/lobpcg.hpp"
 #include "viennacl/linalg/power_iter.hpp"
+#include "viennacl/linalg/subspace_iter.hpp"
 
 #endif
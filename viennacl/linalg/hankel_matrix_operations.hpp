@@ -23,7 +23,9 @@
 */
 
 #include "viennacl/forwards.h"
+#ifdef VIENNACL_WITH_OPENCL
 #include "viennacl/ocl/backend.hpp"
+#endif
 #include "viennacl/scalar.hpp"
 #include "viennacl/vector.hpp"
 #include "viennacl/tools/tools.hpp"
@@ -57,6 +59,40 @@ void prod_impl(viennacl::hankel_matrix<NumericT, AlignmentV> const & A,
   viennacl::linalg::reverse(result);
 }
 
+/** @brief Carries out the product of a hankel_matrix with all columns of a dense matrix
+*
+* Implementation of the convenience expression result = prod(A, B). The spectrum of the underlying Toeplitz matrix is shared by all columns.
+*
+* @param A      The matrix
+* @param B      The dense matrix
+* @param result The result matrix
+*/
+template<typename NumericT, unsigned int AlignmentV>
+void prod_impl(viennacl::hankel_matrix<NumericT, AlignmentV> const & A,
+               viennacl::matrix_base<NumericT> const & B,
+               viennacl::matrix_base<NumericT>       & result)
+{
+  assert(A.size1() == result.size1() && bool("Dimension mismatch"));
+  assert(A.size2() == B.size1() && B.size2() == result.size2() && bool("Dimension mismatch"));
+
+  prod_impl(A.elements(), B, result);
+
+  // reverse the order of the rows:
+  viennacl::detail::fft::matrix_strides<NumericT> s(result);
+  for (vcl_size_t j = 0; j < result.size2(); ++j)
+  {
+    viennacl::vector_base<NumericT> result_j(result.handle(), result.size1(), s.offset + j * s.col_inc, s.row_inc);
+    if (viennacl::traits::handle(result).get_active_handle_id() == viennacl::MAIN_MEMORY)
+      viennacl::linalg::reverse(result_j);
+    else
+    {
+      viennacl::vector<NumericT> tmp(result_j);  // kernels for other memory domains require unit stride
+      viennacl::linalg::reverse(tmp);
+      result_j = tmp;
+    }
+  }
+}
+
 } //namespace linalg
 
 
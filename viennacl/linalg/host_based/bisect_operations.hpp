@@ -0,0 +1,443 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_BISECT_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_BISECT_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/bisect_operations.hpp
+    @brief Implementation of the bisection algorithm for the eigenvalues of symmetric tridiagonal matrices using a plain single-threaded or OpenMP-enabled execution on CPU.
+
+    Starting from the Gerschgorin interval, each interval is split into VIENNACL_HOST_BISECT_SIMD_WIDTH + 1 subintervals (multisection),
+    for which the Sturm counts are evaluated simultaneously in a loop over the shifts that is vectorized by the compiler.
+    Subintervals containing eigenvalues are processed as OpenMP tasks, which are distributed over the threads by the work-stealing scheduler of the OpenMP runtime.
+    Eigenvectors are optionally computed by inverse iteration, where clusters of close eigenvalues are processed in parallel.
+*/
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "viennacl/forwards.h"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/start.hpp"
+#include "viennacl/traits/stride.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/detail/bisect/gerschgorin.hpp"
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+/** @brief Number of shifts for which the Sturm counts are evaluated simultaneously. Each interval is split into this number plus one subintervals. */
+#ifndef VIENNACL_HOST_BISECT_SIMD_WIDTH
+  #define VIENNACL_HOST_BISECT_SIMD_WIDTH  8
+#endif
+
+#ifndef VIENNACL_OPENMP_BISECT_MIN_SIZE
+  #define VIENNACL_OPENMP_BISECT_MIN_SIZE  256
+#endif
+
+#if defined(VIENNACL_WITH_OPENMP) && defined(_OPENMP) && (_OPENMP >= 200805)
+  #define VIENNACL_BISECT_OPENMP_TASKS
+#endif
+
+#if defined(VIENNACL_WITH_OPENMP) && defined(_OPENMP) && (_OPENMP >= 201307)
+  #define VIENNACL_BISECT_OPENMP_SIMD
+#endif
+
+namespace viennacl
+{
+namespace linalg
+{
+namespace host_based
+{
+namespace detail
+{
+  /** @brief Data of the symmetric tridiagonal matrix shared by all intervals of the bisection. */
+  template<typename NumericT>
+  struct bisect_data
+  {
+    NumericT const * d;       // diagonal
+    NumericT const * e2;      // squares of the off-diagonal entries, e2[i] couples rows i-1 and i
+    vcl_size_t       n;
+    NumericT         pivmin;  // smallest admissible pivot of the Sturm sequence
+    NumericT         abs_tol; // absolute tolerance of the eigenvalues
+    NumericT       * eigenvalues;
+    bool             use_tasks;
+  };
+
+  /** @brief Computes the number of eigenvalues smaller than x[k] for all VIENNACL_HOST_BISECT_SIMD_WIDTH shifts x[k] simultaneously.
+    *
+    * The loop over the shifts is free of branches, so that the compiler evaluates the Sturm sequences of several shifts in SIMD registers (explicitly requested via 'omp simd' if OpenMP 4.0 is available).
+    */
+  template<typename NumericT>
+  void bisect_sturm_counts(bisect_data<NumericT> const & data, NumericT const * x, vcl_size_t * counts)
+  {
+    NumericT q[VIENNACL_HOST_BISECT_SIMD_WIDTH];
+    NumericT c[VIENNACL_HOST_BISECT_SIMD_WIDTH];
+    NumericT pivmin = data.pivmin;
+
+    for (vcl_size_t k = 0; k < VIENNACL_HOST_BISECT_SIMD_WIDTH; ++k)
+    {
+      NumericT q_k = data.d[0] - x[k];
+      q_k = (std::fabs(q_k) < pivmin) ? -pivmin : q_k;
+      c[k] = (q_k < 0) ? NumericT(1) : NumericT(0);
+      q[k] = q_k;
+    }
+
+    for (vcl_size_t i = 1; i < data.n; ++i)
+    {
+      NumericT d_i  = data.d[i];
+      NumericT e2_i = data.e2[i];
+#ifdef VIENNACL_BISECT_OPENMP_SIMD
+      #pragma omp simd
+#endif
+      for (vcl_size_t k = 0; k < VIENNACL_HOST_BISECT_SIMD_WIDTH; ++k)
+      {
+        NumericT q_k = d_i - x[k] - e2_i / q[k];
+        q_k = (std::fabs(q_k) < pivmin) ? -pivmin : q_k;
+        c[k] += (q_k < 0) ? NumericT(1) : NumericT(0);
+        q[k] = q_k;
+      }
+    }
+
+    for (vcl_size_t k = 0; k < VIENNACL_HOST_BISECT_SIMD_WIDTH; ++k)
+      counts[k] = static_cast<vcl_size_t>(c[k]);
+  }
+
+  /** @brief Refines the interval [lo, hi) containing the eigenvalues with indices count_lo, ..., count_hi - 1 until all of them are resolved. */
+  template<typename NumericT>
+  void bisect_interval(bisect_data<NumericT> const & data, NumericT lo, NumericT hi, vcl_size_t count_lo, vcl_size_t count_hi)
+  {
+    NumericT eps = std::numeric_limits<NumericT>::epsilon();
+    NumericT x[VIENNACL_HOST_BISECT_SIMD_WIDTH];
+    vcl_size_t counts[VIENNACL_HOST_BISECT_SIMD_WIDTH];
+
+    while (count_hi > count_lo)
+    {
+      NumericT tol = std::max(data.abs_tol, eps * std::max(std::fabs(lo), std::fabs(hi)));
+      if (hi - lo <= 2 * tol)
+      {
+        for (vcl_size_t i = count_lo; i < count_hi; ++i)
+          data.eigenvalues[i] = (lo + hi) / 2;
+        return;
+      }
+
+      NumericT h = (hi - lo) / NumericT(VIENNACL_HOST_BISECT_SIMD_WIDTH + 1);
+      for (vcl_size_t k = 0; k < VIENNACL_HOST_BISECT_SIMD_WIDTH; ++k)
+        x[k] = std::min(lo + NumericT(k + 1) * h, hi);
+
+      bisect_sturm_counts(data, x, counts);
+
+      // guard against non-monotonic counts due to round-off:
+      vcl_size_t previous = count_lo;
+      for (vcl_size_t k = 0; k < VIENNACL_HOST_BISECT_SIMD_WIDTH; ++k)
+      {
+        counts[k] = std::max(previous, std::min(counts[k], count_hi));
+        previous = counts[k];
+      }
+
+      // continue with the first nonempty subinterval, spawn tasks for all others:
+      bool found = false;
+      NumericT next_lo = lo, next_hi = hi;
+      vcl_size_t next_count_lo = count_lo, next_count_hi = count_hi;
+      for (vcl_size_t k = 0; k <= VIENNACL_HOST_BISECT_SIMD_WIDTH; ++k)
+      {
+        NumericT   a  = (k == 0) ? lo : x[k-1];
+        NumericT   b  = (k == VIENNACL_HOST_BISECT_SIMD_WIDTH) ? hi : x[k];
+        vcl_size_t ca = (k == 0) ? count_lo : counts[k-1];
+        vcl_size_t cb = (k == VIENNACL_HOST_BISECT_SIMD_WIDTH) ? count_hi : counts[k];
+        if (cb <= ca)
+          continue;
+
+        if (!found)
+        {
+          found = true;
+          next_lo = a; next_hi = b;
+          next_count_lo = ca; next_count_hi = cb;
+        }
+        else
+        {
+#ifdef VIENNACL_BISECT_OPENMP_TASKS
+          #pragma omp task firstprivate(a, b, ca, cb) if (data.use_tasks)
+#endif
+          bisect_interval(data, a, b, ca, cb);
+        }
+      }
+
+      lo = next_lo; hi = next_hi;
+      count_lo = next_count_lo; count_hi = next_count_hi;
+    }
+  }
+
+  /** @brief LU factorization with partial pivoting of the tridiagonal matrix T - lambda I (LAPACK's xGTTRF). Zero pivots are replaced by tol. */
+  template<typename NumericT>
+  void bisect_tridiag_lu(NumericT const * d, NumericT const * s, vcl_size_t n, NumericT lambda, NumericT tol,
+                         NumericT * dl, NumericT * dd, NumericT * du, NumericT * du2, char * swapped)
+  {
+    for (vcl_size_t i = 0; i < n; ++i)
+    {
+      dd[i] = d[i] - lambda;
+      swapped[i] = 0;
+      if (i + 1 < n)
+      {
+        dl[i] = s[i+1];
+        du[i] = s[i+1];
+      }
+      du2[i] = 0;
+    }
+
+    for (vcl_size_t i = 0; i + 1 < n; ++i)
+    {
+      if (std::fabs(dd[i]) >= std::fabs(dl[i]))
+      {
+        if (std::fabs(dd[i]) <= 0)
+          dd[i] = tol;
+        NumericT factor = dl[i] / dd[i];
+        dl[i] = factor;
+        dd[i+1] -= factor * du[i];
+      }
+      else
+      {
+        NumericT factor = dd[i] / dl[i];
+        dd[i] = dl[i];
+        dl[i] = factor;
+        NumericT temp = du[i];
+        du[i] = dd[i+1];
+        dd[i+1] = temp - factor * dd[i+1];
+        if (i + 2 < n)
+        {
+          du2[i] = du[i+1];
+          du[i+1] = -factor * du[i+1];
+        }
+        swapped[i] = 1;
+      }
+    }
+
+    for (vcl_size_t i = 0; i < n; ++i)
+      if (std::fabs(dd[i]) < tol)
+        dd[i] = (dd[i] < 0) ? -tol : tol;
+  }
+
+  /** @brief Solves (T - lambda I) x = b in place using the factors computed by bisect_tridiag_lu() (LAPACK's xGTTS2). */
+  template<typename NumericT>
+  void bisect_tridiag_solve(vcl_size_t n, NumericT const * dl, NumericT const * dd, NumericT const * du, NumericT const * du2, char const * swapped, NumericT * b)
+  {
+    for (vcl_size_t i = 0; i + 1 < n; ++i)
+    {
+      if (swapped[i])
+      {
+        NumericT temp = b[i];
+        b[i] = b[i+1];
+        b[i+1] = temp - dl[i] * b[i];
+      }
+      else
+        b[i+1] -= dl[i] * b[i];
+    }
+
+    b[n-1] /= dd[n-1];
+    if (n > 1)
+    {
+      b[n-2] = (b[n-2] - du[n-2] * b[n-1]) / dd[n-2];
+      for (vcl_size_t i = n - 2; i-- > 0;)
+        b[i] = (b[i] - du[i] * b[i+1] - du2[i] * b[i+2]) / dd[i];
+    }
+  }
+
+  /** @brief Computes the eigenvectors of the symmetric tridiagonal matrix for the eigenvalues with indices first, ..., last - 1 (a cluster) by inverse iteration.
+    *
+    * Each eigenvector is orthogonalized against the previous eigenvectors of the cluster. Z is a column-major n-by-n array.
+    */
+  template<typename NumericT>
+  void bisect_inverse_iteration(NumericT const * d, NumericT const * s, vcl_size_t n, NumericT norm_T,
+                                NumericT const * eigenvalues, vcl_size_t first, vcl_size_t last, NumericT * Z)
+  {
+    NumericT eps = std::numeric_limits<NumericT>::epsilon();
+    NumericT tol = eps * std::max(norm_T, std::numeric_limits<NumericT>::min());
+
+    std::vector<NumericT> dl(n), dd(n), du(n), du2(n);
+    std::vector<char>     swapped(n);
+
+    NumericT lambda_previous = 0;
+    for (vcl_size_t j = first; j < last; ++j)
+    {
+      // separate (numerically) multiple eigenvalues slightly:
+      NumericT lambda = eigenvalues[j];
+      if (j > first && lambda - lambda_previous < 10 * tol)
+        lambda = lambda_previous + 10 * tol;
+      lambda_previous = lambda;
+
+      bisect_tridiag_lu(d, s, n, lambda, tol, &dl[0], &dd[0], &du[0], &du2[0], &swapped[0]);
+
+      // deterministic pseudo-random start vector:
+      NumericT * z = Z + j * n;
+      unsigned int state = static_cast<unsigned int>(2654435761u * (j + 1));
+      for (vcl_size_t i = 0; i < n; ++i)
+      {
+        state = state * 1664525u + 1013904223u;
+        z[i] = NumericT(0.5) + NumericT(state >> 8) / NumericT(1 << 24);
+      }
+
+      for (vcl_size_t it = 0; it < 3; ++it)
+      {
+        bisect_tridiag_solve(n, &dl[0], &dd[0], &du[0], &du2[0], &swapped[0], z);
+
+        // modified Gram-Schmidt against the previous eigenvectors of the cluster:
+        for (vcl_size_t k = first; k < j; ++k)
+        {
+          NumericT const * z_k = Z + k * n;
+          NumericT dot = 0;
+          for (vcl_size_t i = 0; i < n; ++i)
+            dot += z_k[i] * z[i];
+          for (vcl_size_t i = 0; i < n; ++i)
+            z[i] -= dot * z_k[i];
+        }
+
+        NumericT norm = 0;
+        for (vcl_size_t i = 0; i < n; ++i)
+          norm += z[i] * z[i];
+        norm = std::sqrt(norm);
+        for (vcl_size_t i = 0; i < n; ++i)
+          z[i] /= norm;
+      }
+    }
+  }
+
+} // namespace detail
+
+
+/** @brief Computes all eigenvalues of a symmetric tridiagonal matrix by parallel multisection of the Gerschgorin interval.
+  *
+  * @param diagonal       Diagonal entries of the matrix
+  * @param superdiagonal  Off-diagonal entries of the matrix, where superdiagonal[i] couples rows i-1 and i. superdiagonal[0] is not referenced.
+  * @param eigenvalues    The eigenvalues in ascending order
+  */
+template<typename NumericT>
+void bisect(std::vector<NumericT> const & diagonal, std::vector<NumericT> const & superdiagonal, std::vector<NumericT> & eigenvalues)
+{
+  vcl_size_t n = diagonal.size();
+  eigenvalues.resize(n);
+  if (n == 0)
+    return;
+  if (n == 1)
+  {
+    eigenvalues[0] = diagonal[0];
+    return;
+  }
+
+  std::vector<NumericT> d(diagonal.begin(), diagonal.end());
+  std::vector<NumericT> s(superdiagonal.begin(), superdiagonal.begin() + static_cast<long>(n));
+  s[0] = 0;
+
+  std::vector<NumericT> e2(n);
+  NumericT e2_max = 0;
+  for (vcl_size_t i = 1; i < n; ++i)
+  {
+    e2[i] = s[i] * s[i];
+    e2_max = std::max(e2_max, e2[i]);
+  }
+
+  NumericT lg =  std::numeric_limits<NumericT>::max();
+  NumericT ug = -std::numeric_limits<NumericT>::max();
+  viennacl::linalg::detail::computeGerschgorin(d, s, static_cast<unsigned int>(n), lg, ug);
+
+  detail::bisect_data<NumericT> data;
+  data.d           = &d[0];
+  data.e2          = &e2[0];
+  data.n           = n;
+  data.pivmin      = std::numeric_limits<NumericT>::min() * std::max(NumericT(1), e2_max);
+  data.abs_tol     = std::numeric_limits<NumericT>::epsilon() * std::max(std::fabs(lg), std::fabs(ug));
+  data.eigenvalues = &eigenvalues[0];
+  data.use_tasks   = (n > VIENNACL_OPENMP_BISECT_MIN_SIZE);
+
+#ifdef VIENNACL_BISECT_OPENMP_TASKS
+  #pragma omp parallel if (data.use_tasks)
+  {
+    #pragma omp single nowait
+    detail::bisect_interval(data, lg, ug, 0, n);
+  }
+#else
+  detail::bisect_interval(data, lg, ug, 0, n);
+#endif
+}
+
+/** @brief Computes the eigenvectors of a symmetric tridiagonal matrix for the given eigenvalues by inverse iteration.
+  *
+  * Eigenvalues closer than 10^{-3} times the norm of the matrix form a cluster, within which the eigenvectors are orthogonalized.
+  * Clusters are processed in parallel.
+  *
+  * @param diagonal       Diagonal entries of the matrix
+  * @param superdiagonal  Off-diagonal entries of the matrix, where superdiagonal[i] couples rows i-1 and i. superdiagonal[0] is not referenced.
+  * @param eigenvalues    The eigenvalues in ascending order as computed by bisect()
+  * @param eigenvectors   The matrix receiving the eigenvectors as columns
+  */
+template<typename NumericT>
+void bisect_eigenvectors(std::vector<NumericT> const & diagonal, std::vector<NumericT> const & superdiagonal,
+                         std::vector<NumericT> const & eigenvalues, matrix_base<NumericT> & eigenvectors)
+{
+  vcl_size_t n = diagonal.size();
+  vcl_size_t num_eigenvalues = eigenvalues.size();
+  if (n == 0 || num_eigenvalues == 0)
+    return;
+
+  std::vector<NumericT> s(superdiagonal.begin(), superdiagonal.begin() + static_cast<long>(n));
+  s[0] = 0;
+
+  NumericT norm_T = 0;  // 1-norm
+  for (vcl_size_t i = 0; i < n; ++i)
+    norm_T = std::max(norm_T, std::fabs(diagonal[i]) + std::fabs(s[i]) + ((i + 1 < n) ? std::fabs(s[i+1]) : NumericT(0)));
+
+  std::vector<vcl_size_t> cluster_starts(1, 0);
+  for (vcl_size_t j = 1; j < num_eigenvalues; ++j)
+    if (eigenvalues[j] - eigenvalues[j-1] > NumericT(1e-3) * norm_T)
+      cluster_starts.push_back(j);
+  cluster_starts.push_back(num_eigenvalues);
+
+  std::vector<NumericT> Z(n * num_eigenvalues);
+
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for schedule(dynamic) if (n > VIENNACL_OPENMP_BISECT_MIN_SIZE)
+#endif
+  for (long c = 0; c < static_cast<long>(cluster_starts.size()) - 1; ++c)
+    detail::bisect_inverse_iteration(&diagonal[0], &s[0], n, norm_T, &eigenvalues[0],
+                                     cluster_starts[static_cast<vcl_size_t>(c)], cluster_starts[static_cast<vcl_size_t>(c) + 1], &Z[0]);
+
+  NumericT * data_Z = detail::extract_raw_pointer<NumericT>(eigenvectors);
+  vcl_size_t start1 = viennacl::traits::start1(eigenvectors), stride1 = viennacl::traits::stride1(eigenvectors);
+  vcl_size_t start2 = viennacl::traits::start2(eigenvectors), stride2 = viennacl::traits::stride2(eigenvectors);
+  if (eigenvectors.row_major())
+  {
+    detail::matrix_array_wrapper<NumericT, row_major, false> wrapper_Z(data_Z, start1, start2, stride1, stride2, eigenvectors.internal_size1(), eigenvectors.internal_size2());
+    for (vcl_size_t i = 0; i < n; ++i)
+      for (vcl_size_t j = 0; j < num_eigenvalues; ++j)
+        wrapper_Z(i, j) = Z[j * n + i];
+  }
+  else
+  {
+    detail::matrix_array_wrapper<NumericT, column_major, false> wrapper_Z(data_Z, start1, start2, stride1, stride2, eigenvectors.internal_size1(), eigenvectors.internal_size2());
+    for (vcl_size_t j = 0; j < num_eigenvalues; ++j)
+      for (vcl_size_t i = 0; i < n; ++i)
+        wrapper_Z(i, j) = Z[j * n + i];
+  }
+}
+
+} // namespace host_based
+} // namespace linalg
+} // namespace viennacl
+
+#endif
@@ -0,0 +1,888 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_CHOLESKY_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_CHOLESKY_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/cholesky_operations.hpp
+    @brief Implementations of dense Cholesky and LDL^T factorizations in host memory.
+
+    Both factorizations only reference and overwrite the lower triangle of the matrix.
+    Updates of symmetric blocks are carried out as symmetric rank-k updates which compute only the lower triangle (cf. BLAS SYRK).
+    The right-looking Cholesky factorization schedules its tile operations as OpenMP tasks with data dependencies (OpenMP 4.0 or higher),
+    the left-looking variant and the LDL^T factorization update their block columns and trailing matrices in parallel over tiles.
+*/
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "viennacl/forwards.h"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/start.hpp"
+#include "viennacl/traits/stride.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+
+// Default tile size for the blocked factorizations:
+#ifndef VIENNACL_HOST_CHOLESKY_BLOCK_SIZE
+  #define VIENNACL_HOST_CHOLESKY_BLOCK_SIZE  96
+#endif
+
+// Minimum matrix size for using OpenMP in the factorizations:
+#ifndef VIENNACL_OPENMP_CHOLESKY_MIN_SIZE
+  #define VIENNACL_OPENMP_CHOLESKY_MIN_SIZE  256
+#endif
+
+// OpenMP tasks with dependencies are available from OpenMP 4.0 on:
+#if defined(VIENNACL_WITH_OPENMP) && defined(_OPENMP)
+  #if _OPENMP >= 201307
+    #define VIENNACL_CHOLESKY_OPENMP_TASKS
+  #endif
+#endif
+
+namespace viennacl
+{
+namespace linalg
+{
+namespace host_based
+{
+namespace detail
+{
+  /** @brief Copies the block A(r0:r0+rows, c0:c0+cols) to the row-major buffer buf. */
+  template<typename MatrixAccT, typename NumericT>
+  void chol_pack(MatrixAccT & A, vcl_size_t r0, vcl_size_t c0, vcl_size_t rows, vcl_size_t cols, NumericT * buf)
+  {
+    for (vcl_size_t i = 0; i < rows; ++i)
+      for (vcl_size_t j = 0; j < cols; ++j)
+        buf[i * cols + j] = A(r0 + i, c0 + j);
+  }
+
+  /** @brief Copies the transpose of the block A(r0:r0+rows, c0:c0+cols) to the row-major buffer buf, i.e. buf is of size cols x rows. */
+  template<typename MatrixAccT, typename NumericT>
+  void chol_pack_trans(MatrixAccT & A, vcl_size_t r0, vcl_size_t c0, vcl_size_t rows, vcl_size_t cols, NumericT * buf)
+  {
+    for (vcl_size_t i = 0; i < rows; ++i)
+      for (vcl_size_t j = 0; j < cols; ++j)
+        buf[j * rows + i] = A(r0 + i, c0 + j);
+  }
+
+  /** @brief Computes A(r0:r0+rows, c0:c0+cols) -= X * Yt, where X is a row-major rows-by-k buffer and Yt a row-major k-by-cols buffer with row stride ldy.
+    *
+    * If lower_only is set (requires r0 == c0), only the lower triangle of the diagonal block is updated as in a symmetric rank-k update (SYRK).
+    * The buffer acc must hold at least cols entries.
+    */
+  template<typename MatrixAccT, typename NumericT>
+  void chol_update_block(MatrixAccT & A, vcl_size_t r0, vcl_size_t c0, vcl_size_t rows, vcl_size_t cols,
+                         NumericT const * X, NumericT const * Yt, vcl_size_t ldy, vcl_size_t k, bool lower_only, NumericT * acc)
+  {
+    for (vcl_size_t i = 0; i < rows; ++i)
+    {
+      vcl_size_t j_end = lower_only ? std::min(i + 1, cols) : cols;
+      std::fill(acc, acc + j_end, NumericT(0));
+
+      NumericT const * X_row = X + i * k;
+      for (vcl_size_t l = 0; l < k; ++l)
+      {
+        NumericT x = X_row[l];
+        NumericT const * Yt_row = Yt + l * ldy;
+        for (vcl_size_t j = 0; j < j_end; ++j)
+          acc[j] += x * Yt_row[j];
+      }
+
+      for (vcl_size_t j = 0; j < j_end; ++j)
+        A(r0 + i, c0 + j) -= acc[j];
+    }
+  }
+
+  /** @brief Updates the lower triangle of the tile A(r0:r0+rows, c0:c0+cols) with the tiles in columns k0:k0+k, i.e. A_rc -= A_rk A_ck^T. */
+  template<typename MatrixAccT>
+  void chol_update_tile(MatrixAccT & A, vcl_size_t r0, vcl_size_t c0, vcl_size_t rows, vcl_size_t cols, vcl_size_t k0, vcl_size_t k)
+  {
+    typedef typename MatrixAccT::value_type    value_type;
+
+    std::vector<value_type> X(rows * k);
+    std::vector<value_type> Yt(k * cols);
+    std::vector<value_type> acc(cols);
+
+    chol_pack(A, r0, k0, rows, k, &(X[0]));
+    chol_pack_trans(A, c0, k0, cols, k, &(Yt[0]));
+    chol_update_block(A, r0, c0, rows, cols, &(X[0]), &(Yt[0]), cols, k, r0 == c0, &(acc[0]));
+  }
+
+  /** @brief Unblocked Cholesky factorization of the diagonal tile A(k0:k0+b, k0:k0+b). Returns false if the tile is not positive definite. */
+  template<typename MatrixAccT>
+  bool chol_potrf_tile(MatrixAccT & A, vcl_size_t k0, vcl_size_t b)
+  {
+    typedef typename MatrixAccT::value_type    value_type;
+
+    for (vcl_size_t j = k0; j < k0 + b; ++j)
+    {
+      value_type a_jj = A(j, j);
+      for (vcl_size_t l = k0; l < j; ++l)
+        a_jj -= A(j, l) * A(j, l);
+      if (!(a_jj > 0))
+        return false;
+      a_jj = std::sqrt(a_jj);
+      A(j, j) = a_jj;
+
+      for (vcl_size_t i = j + 1; i < k0 + b; ++i)
+      {
+        value_type a_ij = A(i, j);
+        for (vcl_size_t l = k0; l < j; ++l)
+          a_ij -= A(i, l) * A(j, l);
+        A(i, j) = a_ij / a_jj;
+      }
+    }
+    return true;
+  }
+
+  /** @brief Solves A(r0:r0+rows, k0:k0+b) L^T = A(r0:r0+rows, k0:k0+b) for the tile, where L is the factored diagonal tile at k0. */
+  template<typename MatrixAccT>
+  void chol_trsm_tile(MatrixAccT & A, vcl_size_t k0, vcl_size_t b, vcl_size_t r0, vcl_size_t rows)
+  {
+    typedef typename MatrixAccT::value_type    value_type;
+
+    // work on the transposed tile, so that all updates run over contiguous memory:
+    std::vector<value_type> Rt(b * rows);
+    chol_pack_trans(A, r0, k0, rows, b, &(Rt[0]));
+
+    for (vcl_size_t j = 0; j < b; ++j)
+    {
+      value_type * R_j = &(Rt[j * rows]);
+      value_type inv_l_jj = value_type(1) / A(k0 + j, k0 + j);
+      for (vcl_size_t r = 0; r < rows; ++r)
+        R_j[r] *= inv_l_jj;
+
+      for (vcl_size_t jj = j + 1; jj < b; ++jj)
+      {
+        value_type l_jjj = A(k0 + jj, k0 + j);
+        value_type * R_jj = &(Rt[jj * rows]);
+        for (vcl_size_t r = 0; r < rows; ++r)
+          R_jj[r] -= R_j[r] * l_jjj;
+      }
+    }
+
+    for (vcl_size_t r = 0; r < rows; ++r)
+      for (vcl_size_t j = 0; j < b; ++j)
+        A(r0 + r, k0 + j) = Rt[j * rows + r];
+  }
+
+  /** @brief Right-looking tiled Cholesky factorization. Returns the index of the first tile which is not positive definite, or the number of tiles on success. */
+  template<typename MatrixAccT>
+  vcl_size_t cholesky_right_looking(MatrixAccT & A, vcl_size_t n, vcl_size_t block_size)
+  {
+    vcl_size_t num_tiles = (n + block_size - 1) / block_size;
+    vcl_size_t failed_tile = num_tiles;
+
+#ifdef VIENNACL_CHOLESKY_OPENMP_TASKS
+    // dependency tokens of the tiles:
+    std::vector<char> tile_tokens(num_tiles * num_tiles);
+    char * tokens = &(tile_tokens[0]);
+
+    #pragma omp parallel if (n > VIENNACL_OPENMP_CHOLESKY_MIN_SIZE)
+    #pragma omp single
+#endif
+    for (vcl_size_t k = 0; k < num_tiles; ++k)
+    {
+      vcl_size_t k0 = k * block_size;
+      vcl_size_t kb = std::min(block_size, n - k0);
+
+#ifdef VIENNACL_CHOLESKY_OPENMP_TASKS
+      #pragma omp task depend(inout: tokens[k * num_tiles + k])
+#endif
+      {
+        // potrf tasks are serialized by their dependencies, so only these write the failure state:
+        if (!chol_potrf_tile(A, k0, kb) && failed_tile == num_tiles)
+          failed_tile = k;
+      }
+
+      for (vcl_size_t i = k + 1; i < num_tiles; ++i)
+      {
+#ifdef VIENNACL_CHOLESKY_OPENMP_TASKS
+        #pragma omp task depend(in: tokens[k * num_tiles + k]) depend(inout: tokens[i * num_tiles + k])
+#endif
+        chol_trsm_tile(A, k0, kb, i * block_size, std::min(block_size, n - i * block_size));
+      }
+
+      for (vcl_size_t i = k + 1; i < num_tiles; ++i)
+      {
+        for (vcl_size_t j = k + 1; j <= i; ++j)
+        {
+#ifdef VIENNACL_CHOLESKY_OPENMP_TASKS
+          #pragma omp task depend(in: tokens[i * num_tiles + k], tokens[j * num_tiles + k]) depend(inout: tokens[i * num_tiles + j])
+#endif
+          chol_update_tile(A, i * block_size, j * block_size,
+                           std::min(block_size, n - i * block_size), std::min(block_size, n - j * block_size),
+                           k0, kb);
+        }
+      }
+    }
+
+    return failed_tile;
+  }
+
+  /** @brief Left-looking blocked Cholesky factorization. Returns the index of the first block which is not positive definite, or the number of blocks on success. */
+  template<typename MatrixAccT>
+  vcl_size_t cholesky_left_looking(MatrixAccT & A, vcl_size_t n, vcl_size_t block_size)
+  {
+    typedef typename MatrixAccT::value_type    value_type;
+
+    vcl_size_t num_tiles = (n + block_size - 1) / block_size;
+    std::vector<value_type> Yt;
+
+    for (vcl_size_t k = 0; k < num_tiles; ++k)
+    {
+      vcl_size_t k0 = k * block_size;
+      vcl_size_t kb = std::min(block_size, n - k0);
+
+      // update block column k with all previous block columns: A(k0:n, k0:k0+kb) -= L(k0:n, 0:k0) L(k0:k0+kb, 0:k0)^T
+      if (k0 > 0)
+      {
+        Yt.resize(k0 * kb);
+        chol_pack_trans(A, k0, 0, kb, k0, &(Yt[0]));
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for if ((n - k0) * k0 > VIENNACL_OPENMP_CHOLESKY_MIN_SIZE * VIENNACL_OPENMP_CHOLESKY_MIN_SIZE)
+#endif
+        for (long i2 = static_cast<long>(k); i2 < static_cast<long>(num_tiles); ++i2)
+        {
+          vcl_size_t r0   = static_cast<vcl_size_t>(i2) * block_size;
+          vcl_size_t rows = std::min(block_size, n - r0);
+          std::vector<value_type> X(rows * k0);
+          std::vector<value_type> acc(kb);
+
+          chol_pack(A, r0, 0, rows, k0, &(X[0]));
+          chol_update_block(A, r0, k0, rows, kb, &(X[0]), &(Yt[0]), kb, k0, r0 == k0, &(acc[0]));
+        }
+      }
+
+      if (!chol_potrf_tile(A, k0, kb))
+        return k;
+
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if ((n - k0) * kb > VIENNACL_OPENMP_CHOLESKY_MIN_SIZE * VIENNACL_OPENMP_CHOLESKY_MIN_SIZE)
+#endif
+      for (long i2 = static_cast<long>(k + 1); i2 < static_cast<long>(num_tiles); ++i2)
+      {
+        vcl_size_t r0 = static_cast<vcl_size_t>(i2) * block_size;
+        chol_trsm_tile(A, k0, kb, r0, std::min(block_size, n - r0));
+      }
+    }
+
+    return num_tiles;
+  }
+
+
+  //
+  // LDL^T factorization with Bunch-Kaufman pivoting (cf. LAPACK's xSYTRF, lower triangle)
+  //
+
+  /** @brief Swaps rows r1 and r2 of the block columns [c_start, c_end) of A. */
+  template<typename MatrixAccT>
+  void ldlt_swap_rows(MatrixAccT & A, vcl_size_t r1, vcl_size_t r2, vcl_size_t c_start, vcl_size_t c_end)
+  {
+    for (vcl_size_t j = c_start; j < c_end; ++j)
+      std::swap(A(r1, j), A(r2, j));
+  }
+
+  /** @brief Unblocked Bunch-Kaufman factorization of the trailing matrix A(k_start:n, k_start:n) (cf. LAPACK's xSYTF2).
+    *
+    * Pivots use the encoding of ldlt_factorize(). Returns false if D is exactly singular (the factorization is completed nevertheless).
+    */
+  template<typename MatrixAccT>
+  bool ldlt_unblocked(MatrixAccT & A, vcl_size_t n, vcl_size_t k_start, std::vector<vcl_ptrdiff_t> & pivots)
+  {
+    typedef typename MatrixAccT::value_type    value_type;
+
+    value_type const alpha = (value_type(1) + std::sqrt(value_type(17))) / value_type(8);
+    bool nonsingular = true;
+
+    vcl_size_t k = k_start;
+    while (k < n)
+    {
+      vcl_size_t kstep = 1;
+      vcl_size_t kp = k;
+
+      value_type absakk = std::fabs(A(k, k));
+      vcl_size_t imax = k;
+      value_type colmax = 0;
+      for (vcl_size_t i = k + 1; i < n; ++i)
+        if (std::fabs(A(i, k)) > colmax)
+        {
+          colmax = std::fabs(A(i, k));
+          imax = i;
+        }
+
+      if (std::max(absakk, colmax) <= 0)
+        nonsingular = false;
+      else if (absakk < alpha * colmax)
+      {
+        // largest off-diagonal entry in row/column imax:
+        value_type rowmax = 0;
+        for (vcl_size_t j = k; j < imax; ++j)
+          rowmax = std::max(rowmax, std::fabs(A(imax, j)));
+        for (vcl_size_t i = imax + 1; i < n; ++i)
+          rowmax = std::max(rowmax, std::fabs(A(i, imax)));
+
+        if (absakk >= alpha * colmax * (colmax / rowmax))
+          kp = k;
+        else if (std::fabs(A(imax, imax)) >= alpha * rowmax)
+          kp = imax;
+        else
+        {
+          kp = imax;
+          kstep = 2;
+        }
+      }
+
+      // symmetric interchange of rows and columns kk and kp in the trailing matrix:
+      vcl_size_t kk = k + kstep - 1;
+      if (kp != kk)
+      {
+        for (vcl_size_t i = kp + 1; i < n; ++i)
+          std::swap(A(i, kk), A(i, kp));
+        for (vcl_size_t j = kk + 1; j < kp; ++j)
+          std::swap(A(j, kk), A(kp, j));
+        std::swap(A(kk, kk), A(kp, kp));
+        if (kstep == 2)
+          std::swap(A(k + 1, k), A(kp, k));
+      }
+
+      if (kstep == 1)
+      {
+        if (A(k, k) > 0 || A(k, k) < 0)
+        {
+          // rank-1 update of the lower triangle of the trailing matrix:
+          value_type d11 = value_type(1) / A(k, k);
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for if ((n - k) > VIENNACL_OPENMP_CHOLESKY_MIN_SIZE)
+#endif
+          for (long j2 = static_cast<long>(k + 1); j2 < static_cast<long>(n); ++j2)
+          {
+            vcl_size_t j = static_cast<vcl_size_t>(j2);
+            value_type w_j = d11 * A(j, k);
+            for (vcl_size_t i = j; i < n; ++i)
+              A(i, j) -= A(i, k) * w_j;
+          }
+
+          for (vcl_size_t i = k + 1; i < n; ++i)
+            A(i, k) *= d11;
+        }
+        pivots[k] = static_cast<vcl_ptrdiff_t>(kp);
+      }
+      else
+      {
+        if (k + 2 < n)
+        {
+          // rank-2 update of the lower triangle of the trailing matrix:
+          value_type d21 = A(k + 1, k);
+          value_type d11 = A(k + 1, k + 1) / d21;
+          value_type d22 = A(k, k) / d21;
+          value_type t   = value_type(1) / (d11 * d22 - value_type(1));
+          d21 = t / d21;
+
+#ifdef VIENNACL_WITH_OPENMP
+          #pragma omp parallel for if ((n - k) > VIENNACL_OPENMP_CHOLESKY_MIN_SIZE)
+#endif
+          for (long j2 = static_cast<long>(k + 2); j2 < static_cast<long>(n); ++j2)
+          {
+            vcl_size_t j = static_cast<vcl_size_t>(j2);
+            value_type wk   = d21 * (d11 * A(j, k)     - A(j, k + 1));
+            value_type wkp1 = d21 * (d22 * A(j, k + 1) - A(j, k));
+            for (vcl_size_t i = j; i < n; ++i)
+              A(i, j) -= A(i, k) * wk + A(i, k + 1) * wkp1;
+          }
+
+          // the multipliers are written after all columns are updated, as they are read by the update of later columns:
+          for (vcl_size_t j = k + 2; j < n; ++j)
+          {
+            value_type wk   = d21 * (d11 * A(j, k)     - A(j, k + 1));
+            value_type wkp1 = d21 * (d22 * A(j, k + 1) - A(j, k));
+            A(j, k)     = wk;
+            A(j, k + 1) = wkp1;
+          }
+        }
+        pivots[k]     = -static_cast<vcl_ptrdiff_t>(kp) - 1;
+        pivots[k + 1] = -static_cast<vcl_ptrdiff_t>(kp) - 1;
+      }
+
+      k += kstep;
+    }
+
+    return nonsingular;
+  }
+
+  /** @brief Factors a panel of at most nb columns of the trailing matrix A(k_start:n, k_start:n) with Bunch-Kaufman pivoting (cf. LAPACK's xLASYF, lower triangle).
+    *
+    * The trailing matrix right of the panel is updated by a symmetric rank-k update of its lower triangle.
+    * Returns the number of columns factored (nb or nb-1). The flag nonsingular is cleared if D is exactly singular.
+    */
+  template<typename MatrixAccT>
+  vcl_size_t ldlt_panel(MatrixAccT & A, vcl_size_t n, vcl_size_t k_start, vcl_size_t nb, std::vector<vcl_ptrdiff_t> & pivots, bool & nonsingular)
+  {
+    typedef typename MatrixAccT::value_type    value_type;
+
+    value_type const alpha = (value_type(1) + std::sqrt(value_type(17))) / value_type(8);
+    vcl_size_t m = n - k_start;
+
+    // W is m-by-nb, column-major, rows relative to k_start. W(:, j) holds the updated column j of the panel multiplied by D.
+    std::vector<value_type> W(m * nb);
+
+    vcl_size_t k = 0; // column relative to k_start
+    while (k + 1 < nb && k < m)
+    {
+      vcl_size_t gk = k_start + k;
+      value_type * W_k = &(W[k * m]);
+
+      // copy column k of A to W(:, k) and update it with the previous columns of the panel:
+      for (vcl_size_t i = k; i < m; ++i)
+        W_k[i] = A(k_start + i, gk);
+      for (vcl_size_t l = 0; l < k; ++l)
+      {
+        value_type w_kl = W[l * m + k];
+        for (vcl_size_t i = k; i < m; ++i)
+          W_k[i] -= A(k_start + i, k_start + l) * w_kl;
+      }
+
+      vcl_size_t kstep = 1;
+      vcl_size_t kp = k;
+
+      value_type absakk = std::fabs(W_k[k]);
+      vcl_size_t imax = k;
+      value_type colmax = 0;
+      for (vcl_size_t i = k + 1; i < m; ++i)
+        if (std::fabs(W_k[i]) > colmax)
+        {
+          colmax = std::fabs(W_k[i]);
+          imax = i;
+        }
+
+      if (std::max(absakk, colmax) <= 0)
+        nonsingular = false;
+      else if (absakk < alpha * colmax)
+      {
+        // copy column imax to W(:, k+1) and update it:
+        value_type * W_k1 = &(W[(k + 1) * m]);
+        for (vcl_size_t i = k; i < imax; ++i)
+          W_k1[i] = A(k_start + imax, k_start + i);
+        for (vcl_size_t i = imax; i < m; ++i)
+          W_k1[i] = A(k_start + i, k_start + imax);
+        for (vcl_size_t l = 0; l < k; ++l)
+        {
+          value_type w_il = W[l * m + imax];
+          for (vcl_size_t i = k; i < m; ++i)
+            W_k1[i] -= A(k_start + i, k_start + l) * w_il;
+        }
+
+        value_type rowmax = 0;
+        for (vcl_size_t i = k; i < m; ++i)
+          if (i != imax)
+            rowmax = std::max(rowmax, std::fabs(W_k1[i]));
+
+        if (absakk >= alpha * colmax * (colmax / rowmax))
+          kp = k;
+        else if (std::fabs(W_k1[imax]) >= alpha * rowmax)
+        {
+          kp = imax;
+          std::copy(W_k1 + k, W_k1 + m, W_k + k);
+        }
+        else
+        {
+          kp = imax;
+          kstep = 2;
+        }
+      }
+
+      vcl_size_t kk = k + kstep - 1;
+      vcl_size_t gkk = k_start + kk;
+      vcl_size_t gkp = k_start + kp;
+
+      // interchange rows and columns kk and kp. The updated column kp is already stored in W(:, kk).
+      if (kp != kk)
+      {
+        A(gkp, gkp) = A(gkk, gkk);
+        for (vcl_size_t j = gkk + 1; j < gkp; ++j)
+          A(gkp, j) = A(j, gkk);
+        for (vcl_size_t i = gkp + 1; i < n; ++i)
+          A(i, gkp) = A(i, gkk);
+
+        ldlt_swap_rows(A, gkk, gkp, k_start, gk);
+        for (vcl_size_t l = 0; l <= kk; ++l)
+          std::swap(W[l * m + kk], W[l * m + kp]);
+      }
+
+      if (kstep == 1)
+      {
+        for (vcl_size_t i = k; i < m; ++i)
+          A(k_start + i, gk) = W_k[i];
+        value_type a_kk = W_k[k];
+        if (a_kk > 0 || a_kk < 0)
+          for (vcl_size_t i = k + 1; i < m; ++i)
+            A(k_start + i, gk) /= a_kk;
+        pivots[gk] = static_cast<vcl_ptrdiff_t>(gkp);
+      }
+      else
+      {
+        value_type * W_k1 = &(W[(k + 1) * m]);
+        if (k + 2 < m)
+        {
+          value_type d21 = W_k[k + 1];
+          value_type d11 = W_k1[k + 1] / d21;
+          value_type d22 = W_k[k] / d21;
+          value_type t   = value_type(1) / (d11 * d22 - value_type(1));
+          d21 = t / d21;
+          for (vcl_size_t j = k + 2; j < m; ++j)
+          {
+            A(k_start + j, gk)     = d21 * (d11 * W_k[j]  - W_k1[j]);
+            A(k_start + j, gk + 1) = d21 * (d22 * W_k1[j] - W_k[j]);
+          }
+        }
+        A(gk, gk)         = W_k[k];
+        A(gk + 1, gk)     = W_k[k + 1];
+        A(gk + 1, gk + 1) = W_k1[k + 1];
+        pivots[gk]     = -static_cast<vcl_ptrdiff_t>(gkp) - 1;
+        pivots[gk + 1] = -static_cast<vcl_ptrdiff_t>(gkp) - 1;
+      }
+
+      k += kstep;
+    }
+
+    vcl_size_t kb = k;
+
+    // update the lower triangle of the trailing matrix: A22 -= L21 W21^T, in parallel over tiles:
+    if (kb < m)
+    {
+      vcl_size_t rows = m - kb;
+      std::vector<value_type> Wt(kb * rows);  // W21^T, row-major kb-by-rows
+      for (vcl_size_t l = 0; l < kb; ++l)
+        std::copy(W.begin() + static_cast<long>(l * m + kb), W.begin() + static_cast<long>(l * m + m), Wt.begin() + static_cast<long>(l * rows));
+
+      vcl_size_t const tile_size = VIENNACL_HOST_CHOLESKY_BLOCK_SIZE;
+      vcl_size_t num_tiles = (rows + tile_size - 1) / tile_size;
+      vcl_size_t g0 = k_start + kb;
+
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for schedule(dynamic) if (rows > VIENNACL_OPENMP_CHOLESKY_MIN_SIZE)
+#endif
+      for (long t2 = 0; t2 < static_cast<long>(num_tiles); ++t2)
+      {
+        // tile row t2 updates the columns 0:r0+tile_rows of the trailing matrix:
+        vcl_size_t r0 = static_cast<vcl_size_t>(t2) * tile_size;
+        vcl_size_t tile_rows = std::min(tile_size, rows - r0);
+        std::vector<value_type> X(tile_rows * kb);
+        std::vector<value_type> acc(std::max<vcl_size_t>(r0, tile_rows));
+
+        chol_pack(A, g0 + r0, k_start, tile_rows, kb, &(X[0]));
+        if (r0 > 0)
+          chol_update_block(A, g0 + r0, g0, tile_rows, r0, &(X[0]), &(Wt[0]), rows, kb, false, &(acc[0]));
+        chol_update_block(A, g0 + r0, g0 + r0, tile_rows, tile_rows, &(X[0]), &(Wt[r0]), rows, kb, true, &(acc[0]));
+      }
+    }
+
+    // undo the row interchanges of later pivots in the panel's columns of L:
+    vcl_size_t j = kb;
+    while (j > 0)
+    {
+      vcl_size_t jj = j - 1;
+      vcl_size_t jp;
+      if (pivots[k_start + jj] < 0)
+      {
+        jp = static_cast<vcl_size_t>(-pivots[k_start + jj] - 1);
+        j -= 2;
+      }
+      else
+      {
+        jp = static_cast<vcl_size_t>(pivots[k_start + jj]);
+        j -= 1;
+      }
+      // the pivot column(s) ending at jj were swapped for columns before j:
+      if (jp != k_start + jj && j > 0)
+        ldlt_swap_rows(A, jp, k_start + jj, k_start, k_start + j);
+    }
+
+    return kb;
+  }
+
+} // namespace detail
+
+
+/** @brief Computes the Cholesky factorization A = L L^T of a symmetric positive definite matrix in host memory.
+  *
+  * Only the lower triangle of A is referenced and overwritten with L.
+  *
+  * @param A             The system matrix (row-major or column-major)
+  * @param block_size    Tile size of the blocked factorization
+  * @param left_looking  If true, the left-looking variant is used, otherwise the right-looking tiled variant
+  */
+template<typename NumericT>
+void cholesky_factorize(matrix_base<NumericT> & A, vcl_size_t block_size, bool left_looking)
+{
+  vcl_size_t n = viennacl::traits::size1(A);
+  assert(viennacl::traits::size2(A) == n && bool("Matrix must be square for the Cholesky factorization!"));
+  if (n == 0)
+    return;
+
+  if (block_size == 0)
+    block_size = VIENNACL_HOST_CHOLESKY_BLOCK_SIZE;
+
+  NumericT * data_A = detail::extract_raw_pointer<NumericT>(A);
+
+  vcl_size_t A_start1 = viennacl::traits::start1(A);
+  vcl_size_t A_start2 = viennacl::traits::start2(A);
+  vcl_size_t A_inc1   = viennacl::traits::stride1(A);
+  vcl_size_t A_inc2   = viennacl::traits::stride2(A);
+  vcl_size_t A_internal_size1  = viennacl::traits::internal_size1(A);
+  vcl_size_t A_internal_size2  = viennacl::traits::internal_size2(A);
+
+  vcl_size_t num_tiles = (n + block_size - 1) / block_size;
+  vcl_size_t result = 0;
+  if (A.row_major())
+  {
+    detail::matrix_array_wrapper<NumericT, row_major, false> wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+    result = left_looking ? detail::cholesky_left_looking(wrapper_A, n, block_size) : detail::cholesky_right_looking(wrapper_A, n, block_size);
+  }
+  else
+  {
+    detail::matrix_array_wrapper<NumericT, column_major, false> wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+    result = left_looking ? detail::cholesky_left_looking(wrapper_A, n, block_size) : detail::cholesky_right_looking(wrapper_A, n, block_size);
+  }
+
+  if (result != num_tiles)
+    throw zero_on_diagonal_exception("ViennaCL: Matrix is not positive definite in Cholesky factorization!");
+}
+
+
+/** @brief Computes the factorization P A P^T = L D L^T of a symmetric (possibly indefinite) matrix in host memory using Bunch-Kaufman pivoting.
+  *
+  * Only the lower triangle of A is referenced and overwritten with the unit lower triangular factor L and the block diagonal matrix D (1x1 and 2x2 blocks).
+  *
+  * @param A           The system matrix (row-major or column-major)
+  * @param pivots      The interchanges: If pivots[k] >= 0, D(k,k) is a 1x1 block and rows/columns k and pivots[k] were interchanged.
+  *                    If pivots[k] = pivots[k+1] < 0, D(k:k+1, k:k+1) is a 2x2 block and rows/columns k+1 and -pivots[k]-1 were interchanged.
+  * @param block_size  Number of columns factored per panel
+  * @return            False if D is exactly singular
+  */
+template<typename NumericT>
+bool ldlt_factorize(matrix_base<NumericT> & A, std::vector<vcl_ptrdiff_t> & pivots, vcl_size_t block_size)
+{
+  vcl_size_t n = viennacl::traits::size1(A);
+  assert(viennacl::traits::size2(A) == n && bool("Matrix must be square for the LDL^T factorization!"));
+  pivots.resize(n);
+
+  if (block_size < 2)
+    block_size = VIENNACL_HOST_CHOLESKY_BLOCK_SIZE;
+
+  NumericT * data_A = detail::extract_raw_pointer<NumericT>(A);
+
+  vcl_size_t A_start1 = viennacl::traits::start1(A);
+  vcl_size_t A_start2 = viennacl::traits::start2(A);
+  vcl_size_t A_inc1   = viennacl::traits::stride1(A);
+  vcl_size_t A_inc2   = viennacl::traits::stride2(A);
+  vcl_size_t A_internal_size1  = viennacl::traits::internal_size1(A);
+  vcl_size_t A_internal_size2  = viennacl::traits::internal_size2(A);
+
+  bool nonsingular = true;
+  if (A.row_major())
+  {
+    detail::matrix_array_wrapper<NumericT, row_major, false> wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+    vcl_size_t k = 0;
+    while (k + block_size < n)
+      k += detail::ldlt_panel(wrapper_A, n, k, block_size, pivots, nonsingular);
+    nonsingular = detail::ldlt_unblocked(wrapper_A, n, k, pivots) && nonsingular;
+  }
+  else
+  {
+    detail::matrix_array_wrapper<NumericT, column_major, false> wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+    vcl_size_t k = 0;
+    while (k + block_size < n)
+      k += detail::ldlt_panel(wrapper_A, n, k, block_size, pivots, nonsingular);
+    nonsingular = detail::ldlt_unblocked(wrapper_A, n, k, pivots) && nonsingular;
+  }
+
+  return nonsingular;
+}
+
+
+namespace detail
+{
+  /** @brief Solves A X = B for the columns [col_start, col_end) of B, where A holds the factors of ldlt_factorize() (cf. LAPACK's xSYTRS). */
+  template<typename MatrixAccT1, typename MatrixAccT2>
+  void ldlt_substitute(MatrixAccT1 & A, vcl_size_t n, std::vector<vcl_ptrdiff_t> const & pivots,
+                       MatrixAccT2 & B, vcl_size_t col_start, vcl_size_t col_end)
+  {
+    typedef typename MatrixAccT2::value_type    value_type;
+
+    // solve L D Y = P B:
+    vcl_size_t k = 0;
+    while (k < n)
+    {
+      if (pivots[k] >= 0)
+      {
+        vcl_size_t kp = static_cast<vcl_size_t>(pivots[k]);
+        if (kp != k)
+          ldlt_swap_rows(B, k, kp, col_start, col_end);
+        value_type inv_d = value_type(1) / A(k, k);
+        for (vcl_size_t j = col_start; j < col_end; ++j)
+        {
+          value_type b_kj = B(k, j);
+          for (vcl_size_t i = k + 1; i < n; ++i)
+            B(i, j) -= A(i, k) * b_kj;
+          B(k, j) = b_kj * inv_d;
+        }
+        k += 1;
+      }
+      else
+      {
+        vcl_size_t kp = static_cast<vcl_size_t>(-pivots[k] - 1);
+        if (kp != k + 1)
+          ldlt_swap_rows(B, k + 1, kp, col_start, col_end);
+
+        value_type akm1k = A(k + 1, k);
+        value_type akm1  = A(k, k) / akm1k;
+        value_type ak    = A(k + 1, k + 1) / akm1k;
+        value_type denom = akm1 * ak - value_type(1);
+        for (vcl_size_t j = col_start; j < col_end; ++j)
+        {
+          value_type b_kj  = B(k, j);
+          value_type b_k1j = B(k + 1, j);
+          for (vcl_size_t i = k + 2; i < n; ++i)
+            B(i, j) -= A(i, k) * b_kj + A(i, k + 1) * b_k1j;
+
+          value_type bkm1 = b_kj  / akm1k;
+          value_type bk   = b_k1j / akm1k;
+          B(k, j)     = (ak * bkm1 - bk) / denom;
+          B(k + 1, j) = (akm1 * bk - bkm1) / denom;
+        }
+        k += 2;
+      }
+    }
+
+    // solve L^T P X = Y:
+    k = n;
+    while (k > 0)
+    {
+      vcl_size_t kk = k - 1;
+      vcl_size_t kstep = (pivots[kk] >= 0) ? 1 : 2;
+      for (vcl_size_t j = col_start; j < col_end; ++j)
+      {
+        for (vcl_size_t s = 0; s < kstep; ++s)
+        {
+          vcl_size_t c = kk - s;
+          value_type sum = 0;
+          for (vcl_size_t i = kk + 1; i < n; ++i)
+            sum += A(i, c) * B(i, j);
+          B(c, j) -= sum;
+        }
+      }
+
+      vcl_size_t kp = (pivots[kk] >= 0) ? static_cast<vcl_size_t>(pivots[kk]) : static_cast<vcl_size_t>(-pivots[kk] - 1);
+      if (kp != kk)
+        ldlt_swap_rows(B, kk, kp, col_start, col_end);
+      k -= kstep;
+    }
+  }
+
+  template<typename NumericT, typename MatrixAccT>
+  void ldlt_substitute(matrix_base<NumericT> const & A, std::vector<vcl_ptrdiff_t> const & pivots, MatrixAccT & B, vcl_size_t num_cols)
+  {
+    NumericT const * data_A = detail::extract_raw_pointer<NumericT>(A);
+
+    vcl_size_t n        = viennacl::traits::size1(A);
+    vcl_size_t A_start1 = viennacl::traits::start1(A);
+    vcl_size_t A_start2 = viennacl::traits::start2(A);
+    vcl_size_t A_inc1   = viennacl::traits::stride1(A);
+    vcl_size_t A_inc2   = viennacl::traits::stride2(A);
+    vcl_size_t A_internal_size1  = viennacl::traits::internal_size1(A);
+    vcl_size_t A_internal_size2  = viennacl::traits::internal_size2(A);
+
+    vcl_size_t const panel_size = 16;
+    vcl_size_t num_panels = (num_cols + panel_size - 1) / panel_size;
+
+    if (A.row_major())
+    {
+      detail::matrix_array_wrapper<NumericT const, row_major, false> wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if (num_panels > 1 && n * num_cols > VIENNACL_OPENMP_CHOLESKY_MIN_SIZE * VIENNACL_OPENMP_CHOLESKY_MIN_SIZE)
+#endif
+      for (long p2 = 0; p2 < static_cast<long>(num_panels); ++p2)
+        ldlt_substitute(wrapper_A, n, pivots, B, static_cast<vcl_size_t>(p2) * panel_size, std::min(static_cast<vcl_size_t>(p2 + 1) * panel_size, num_cols));
+    }
+    else
+    {
+      detail::matrix_array_wrapper<NumericT const, column_major, false> wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if (num_panels > 1 && n * num_cols > VIENNACL_OPENMP_CHOLESKY_MIN_SIZE * VIENNACL_OPENMP_CHOLESKY_MIN_SIZE)
+#endif
+      for (long p2 = 0; p2 < static_cast<long>(num_panels); ++p2)
+        ldlt_substitute(wrapper_A, n, pivots, B, static_cast<vcl_size_t>(p2) * panel_size, std::min(static_cast<vcl_size_t>(p2 + 1) * panel_size, num_cols));
+    }
+  }
+}
+
+/** @brief Solves A X = B in place using the factors of ldlt_factorize().
+  *
+  * @param A       The factors computed by ldlt_factorize()
+  * @param pivots  The interchanges computed by ldlt_factorize()
+  * @param B       The matrix of load vectors, where the solution is directly written to
+  */
+template<typename NumericT>
+void ldlt_substitute(matrix_base<NumericT> const & A, std::vector<vcl_ptrdiff_t> const & pivots, matrix_base<NumericT> & B)
+{
+  NumericT * data_B = detail::extract_raw_pointer<NumericT>(B);
+
+  vcl_size_t B_start1 = viennacl::traits::start1(B);
+  vcl_size_t B_start2 = viennacl::traits::start2(B);
+  vcl_size_t B_inc1   = viennacl::traits::stride1(B);
+  vcl_size_t B_inc2   = viennacl::traits::stride2(B);
+  vcl_size_t B_internal_size1  = viennacl::traits::internal_size1(B);
+  vcl_size_t B_internal_size2  = viennacl::traits::internal_size2(B);
+
+  if (B.row_major())
+  {
+    detail::matrix_array_wrapper<NumericT, row_major, false> wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+    detail::ldlt_substitute(A, pivots, wrapper_B, viennacl::traits::size2(B));
+  }
+  else
+  {
+    detail::matrix_array_wrapper<NumericT, column_major, false> wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+    detail::ldlt_substitute(A, pivots, wrapper_B, viennacl::traits::size2(B));
+  }
+}
+
+/** @brief Solves A x = b in place using the factors of ldlt_factorize().
+  *
+  * @param A       The factors computed by ldlt_factorize()
+  * @param pivots  The interchanges computed by ldlt_factorize()
+  * @param vec     The load vector, where the solution is directly written to
+  */
+template<typename NumericT>
+void ldlt_substitute(matrix_base<NumericT> const & A, std::vector<vcl_ptrdiff_t> const & pivots, vector_base<NumericT> & vec)
+{
+  NumericT * data_vec = detail::extract_raw_pointer<NumericT>(vec);
+
+  // the vector is accessed as a matrix with a single column:
+  detail::matrix_array_wrapper<NumericT, row_major, false> wrapper_vec(data_vec, viennacl::traits::start(vec), 0, viennacl::traits::stride(vec), 1, viennacl::traits::size(vec), 1);
+  detail::ldlt_substitute(A, pivots, wrapper_vec, 1);
+}
+
+} //namespace host_based
+} //namespace linalg
+} //namespace viennacl
+
+
+#endif
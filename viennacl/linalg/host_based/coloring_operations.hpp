@@ -0,0 +1,332 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_COLORING_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_COLORING_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/coloring_operations.hpp
+    @brief Implementations of graph colorings of sparse matrices and of multicolor relaxation sweeps using the host (OpenMP)
+*/
+
+#include <vector>
+#include <algorithm>  //for std::max, std::sort, std::unique_copy
+
+#include "viennacl/forwards.h"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+// Minimum number of nodes for using OpenMP in graph colorings and multicolor sweeps:
+#ifndef VIENNACL_OPENMP_COLORING_MIN_SIZE
+  #define VIENNACL_OPENMP_COLORING_MIN_SIZE  5000
+#endif
+
+namespace viennacl
+{
+namespace linalg
+{
+namespace host_based
+{
+
+namespace detail
+{
+  /** @brief Marker for nodes without a color */
+  static const unsigned int uncolored = ~0u;
+
+  /** @brief Marks color c as used in the neighborhood of node v. 'forbidden' holds the last node a color was marked for, hence it never needs to be cleared. */
+  inline void forbid_color(std::vector<unsigned int> & forbidden, unsigned int c, unsigned int v)
+  {
+    if (c == uncolored)
+      return;
+    if (c >= forbidden.size())
+      forbidden.resize(c + 1, uncolored);
+    forbidden[c] = v;
+  }
+
+  /** @brief Returns the smallest color not used by the nodes at distance one (and two, if distance > 1) from node v */
+  inline unsigned int smallest_free_color(unsigned int const * row_buffer, unsigned int const * col_buffer, unsigned int const * colors,
+                                          unsigned int v, vcl_size_t distance, std::vector<unsigned int> & forbidden)
+  {
+    for (unsigned int j = row_buffer[v]; j < row_buffer[v+1]; ++j)
+    {
+      unsigned int u = col_buffer[j];
+      if (u == v)
+        continue;
+      forbid_color(forbidden, colors[u], v);
+
+      if (distance > 1)
+        for (unsigned int k = row_buffer[u]; k < row_buffer[u+1]; ++k)
+          if (col_buffer[k] != v)
+            forbid_color(forbidden, colors[col_buffer[k]], v);
+    }
+
+    unsigned int c = 0;
+    while (c < forbidden.size() && forbidden[c] == v)
+      ++c;
+    return c;
+  }
+
+  /** @brief Pseudo-random priority of a node in the Jones-Plassmann coloring (integer hash by T. Wang), ties are broken by the node index */
+  inline unsigned int coloring_priority(unsigned int v)
+  {
+    v = (v ^ 61u) ^ (v >> 16);
+    v *= 9u;
+    v ^= v >> 4;
+    v *= 0x27d4eb2du;
+    v ^= v >> 15;
+    return v;
+  }
+
+  /** @brief Returns true if node u takes precedence over node v */
+  inline bool coloring_precedes(unsigned int u, unsigned int v)
+  {
+    unsigned int prio_u = coloring_priority(u);
+    unsigned int prio_v = coloring_priority(v);
+    return prio_u > prio_v || (prio_u == prio_v && u > v);
+  }
+
+  /** @brief Returns true if node v takes precedence over all uncolored nodes at distance one (and two, if distance > 1) */
+  inline bool is_local_maximum(unsigned int const * row_buffer, unsigned int const * col_buffer, unsigned int const * colors,
+                               unsigned int v, vcl_size_t distance)
+  {
+    for (unsigned int j = row_buffer[v]; j < row_buffer[v+1]; ++j)
+    {
+      unsigned int u = col_buffer[j];
+      if (u == v)
+        continue;
+      if (colors[u] == uncolored && coloring_precedes(u, v))
+        return false;
+
+      if (distance > 1)
+        for (unsigned int k = row_buffer[u]; k < row_buffer[u+1]; ++k)
+        {
+          unsigned int w = col_buffer[k];
+          if (w != v && colors[w] == uncolored && coloring_precedes(w, v))
+            return false;
+        }
+    }
+    return true;
+  }
+
+  /** @brief Computes the off-diagonal pattern of A + A^T in CSR format, i.e. the adjacency graph of a sparse matrix with possibly nonsymmetric pattern.
+    *
+    * Nodes i and k are adjacent if a_ik != 0 or a_ki != 0. Only if both directions of each coupling are present, nodes of the same color are guaranteed to be uncoupled.
+    */
+  inline void symmetric_adjacency(unsigned int const * row_buffer, unsigned int const * col_buffer, vcl_size_t n,
+                                  std::vector<unsigned int> & adj_ptr, std::vector<unsigned int> & adj_idx)
+  {
+    // upper bound for the number of neighbors: row length plus column length
+    std::vector<unsigned int> offset(n + 1, 0);
+    for (vcl_size_t i = 0; i < n; ++i)
+      for (unsigned int j = row_buffer[i]; j < row_buffer[i+1]; ++j)
+        if (col_buffer[j] != i)
+        {
+          ++offset[i + 1];
+          ++offset[col_buffer[j] + 1];
+        }
+    for (vcl_size_t i = 0; i < n; ++i)
+      offset[i + 1] += offset[i];
+
+    std::vector<unsigned int> fill(offset.begin(), offset.end() - 1);
+    std::vector<unsigned int> neighbors(offset[n]);
+    for (vcl_size_t i = 0; i < n; ++i)
+      for (unsigned int j = row_buffer[i]; j < row_buffer[i+1]; ++j)
+        if (col_buffer[j] != i)
+        {
+          neighbors[fill[i]++]             = col_buffer[j];
+          neighbors[fill[col_buffer[j]]++] = static_cast<unsigned int>(i);
+        }
+
+    // remove the duplicates of couplings present in both directions:
+    adj_ptr.resize(n + 1);
+    adj_idx.resize(offset[n]);
+    adj_ptr[0] = 0;
+    for (vcl_size_t i = 0; i < n; ++i)
+    {
+      std::sort(neighbors.begin() + offset[i], neighbors.begin() + offset[i+1]);
+      std::vector<unsigned int>::iterator row_end = std::unique_copy(neighbors.begin() + offset[i], neighbors.begin() + offset[i+1], adj_idx.begin() + adj_ptr[i]);
+      adj_ptr[i + 1] = static_cast<unsigned int>(row_end - adj_idx.begin());
+    }
+    adj_idx.resize(adj_ptr[n]);
+  }
+}
+
+/** @brief Computes a distance-1 or distance-2 coloring of the adjacency graph of a sparse matrix in host memory.
+  *
+  * Jones-Plassmann coloring (cf. Jones and Plassmann, SIAM J. Sci. Comp., 1993): In each round, all uncolored nodes with a higher priority than their uncolored neighbors are determined in parallel.
+  * These nodes are not coupled, hence they are colored in parallel with the smallest color not used by their neighbors.
+  * The priorities are pseudo-random, which keeps the number of rounds small. The coloring does not depend on the number of threads.
+  * Nonsymmetric patterns are supported: The adjacency graph is the pattern of A + A^T, hence nodes i and k get different colors if a_ik != 0 or a_ki != 0.
+  *
+  * @param A          The sparse matrix
+  * @param distance   1 for a distance-1 coloring (adjacent nodes have different colors), 2 for a distance-2 coloring (nodes with a common neighbor have different colors as well)
+  * @return The colors 0, 1, ... of the nodes
+  */
+template<typename NumericT, unsigned int AlignmentV>
+std::vector<unsigned int> jones_plassmann_coloring(viennacl::compressed_matrix<NumericT, AlignmentV> const & A, vcl_size_t distance)
+{
+  vcl_size_t n = A.size1();
+
+  std::vector<unsigned int> adj_ptr, adj_idx;
+  detail::symmetric_adjacency(detail::extract_raw_pointer<unsigned int>(A.handle1()), detail::extract_raw_pointer<unsigned int>(A.handle2()), n, adj_ptr, adj_idx);
+  unsigned int const * row_buffer = &(adj_ptr[0]);
+  unsigned int const * col_buffer = adj_idx.empty() ? NULL : &(adj_idx[0]);
+
+  std::vector<unsigned int> colors(n, detail::uncolored);
+  std::vector<unsigned int> worklist(n);
+  for (vcl_size_t i = 0; i < n; ++i)
+    worklist[i] = static_cast<unsigned int>(i);
+  std::vector<char> selected;
+
+  while (!worklist.empty())
+  {
+    // independent set of nodes colored in this round:
+    selected.resize(worklist.size());
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (worklist.size() > VIENNACL_OPENMP_COLORING_MIN_SIZE)
+#endif
+    for (long k = 0; k < long(worklist.size()); ++k)
+      selected[vcl_size_t(k)] = detail::is_local_maximum(row_buffer, col_buffer, &(colors[0]), worklist[vcl_size_t(k)], distance);
+
+    // color the independent set. The colors of its nodes are only determined by nodes colored in earlier rounds:
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel if (worklist.size() > VIENNACL_OPENMP_COLORING_MIN_SIZE)
+#endif
+    {
+      std::vector<unsigned int> forbidden;
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp for
+#endif
+      for (long k = 0; k < long(worklist.size()); ++k)
+      {
+        unsigned int v = worklist[vcl_size_t(k)];
+        if (selected[vcl_size_t(k)])
+          colors[v] = detail::smallest_free_color(row_buffer, col_buffer, &(colors[0]), v, distance, forbidden);
+      }
+    }
+
+    vcl_size_t num_remaining = 0;
+    for (vcl_size_t k = 0; k < worklist.size(); ++k)
+      if (!selected[k])
+        worklist[num_remaining++] = worklist[k];
+    worklist.resize(num_remaining);
+  }
+
+  return colors;
+}
+
+/** @brief Groups the nodes by color. The nodes of color c are color_rows[color_ptr[c]], ..., color_rows[color_ptr[c+1] - 1] in increasing order.
+  *
+  * @param colors       The colors of the nodes as obtained from jones_plassmann_coloring()
+  * @param color_ptr    Offsets of the colors in color_rows, one entry more than there are colors
+  * @param color_rows   The nodes ordered by color
+  */
+inline void color_blocks(std::vector<unsigned int> const & colors, std::vector<unsigned int> & color_ptr, std::vector<unsigned int> & color_rows)
+{
+  unsigned int num_colors = 0;
+  for (vcl_size_t i = 0; i < colors.size(); ++i)
+    num_colors = std::max(num_colors, colors[i] + 1);
+
+  color_ptr.assign(num_colors + 1, 0);
+  for (vcl_size_t i = 0; i < colors.size(); ++i)
+    ++color_ptr[colors[i] + 1];
+  for (unsigned int c = 0; c < num_colors; ++c)
+    color_ptr[c + 1] += color_ptr[c];
+
+  std::vector<unsigned int> offset(color_ptr.begin(), color_ptr.end() - 1);
+  color_rows.resize(colors.size());
+  for (vcl_size_t i = 0; i < colors.size(); ++i)
+    color_rows[offset[colors[i]]++] = static_cast<unsigned int>(i);
+}
+
+/** @brief Returns the permutation which numbers the nodes color by color, where r[i] is the new index of node i. The nodes of each color keep their relative order.
+  *
+  * @param colors       The colors of the nodes as obtained from jones_plassmann_coloring()
+  * @param color_ptr    Offsets of the colors in the new numbering, one entry more than there are colors
+  */
+inline std::vector<unsigned int> multicolor_permutation(std::vector<unsigned int> const & colors, std::vector<unsigned int> & color_ptr)
+{
+  std::vector<unsigned int> color_rows;
+  color_blocks(colors, color_ptr, color_rows);
+
+  std::vector<unsigned int> r(color_rows.size());
+  for (vcl_size_t k = 0; k < color_rows.size(); ++k)
+    r[color_rows[k]] = static_cast<unsigned int>(k);
+  return r;
+}
+
+/** @brief Performs one (S)SOR relaxation sweep x <- x + omega D^{-1} (b - A x) color by color for a matrix in multicolor ordering in host memory.
+  *
+  * The rows of one color are not coupled, hence they are relaxed in parallel.
+  *
+  * @param A            The sparse matrix in multicolor ordering, i.e. the rows color_ptr[c], ..., color_ptr[c+1] - 1 have color c
+  * @param inv_diag     The inverse diagonal entries of A
+  * @param color_ptr    Offsets of the colors in the numbering of A
+  * @param b            The right hand side vector
+  * @param x            The current iterate, updated in place
+  * @param omega        The relaxation parameter, omega = 1 yields Gauss-Seidel
+  * @param forward      Relaxes the colors in increasing order if true, in decreasing order otherwise
+  */
+template<typename NumericT, unsigned int AlignmentV>
+void multicolor_sor_sweep(viennacl::compressed_matrix<NumericT, AlignmentV> const & A,
+                          std::vector<NumericT> const & inv_diag,
+                          std::vector<unsigned int> const & color_ptr,
+                          viennacl::vector_base<NumericT> const & b,
+                          viennacl::vector_base<NumericT> & x,
+                          NumericT omega,
+                          bool forward)
+{
+  unsigned int const * row_buffer = detail::extract_raw_pointer<unsigned int>(A.handle1());
+  unsigned int const * col_buffer = detail::extract_raw_pointer<unsigned int>(A.handle2());
+  NumericT     const * elements   = detail::extract_raw_pointer<NumericT>(A.handle());
+
+  NumericT const * data_b = detail::extract_raw_pointer<NumericT>(b);
+  NumericT       * data_x = detail::extract_raw_pointer<NumericT>(x);
+  vcl_size_t start_b = viennacl::traits::start(b), inc_b = viennacl::traits::stride(b);
+  vcl_size_t start_x = viennacl::traits::start(x), inc_x = viennacl::traits::stride(x);
+
+  vcl_size_t num_colors = color_ptr.size() - 1;
+  for (vcl_size_t c2 = 0; c2 < num_colors; ++c2)
+  {
+    vcl_size_t c = forward ? c2 : num_colors - 1 - c2;
+    long block_begin = long(color_ptr[c]);
+    long block_end   = long(color_ptr[c+1]);
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (block_end - block_begin > VIENNACL_OPENMP_COLORING_MIN_SIZE)
+#endif
+    for (long row2 = block_begin; row2 < block_end; ++row2)
+    {
+      vcl_size_t row = vcl_size_t(row2);
+      NumericT residual = data_b[start_b + row * inc_b];
+      for (unsigned int j = row_buffer[row]; j < row_buffer[row+1]; ++j)
+        residual -= elements[j] * data_x[start_x + col_buffer[j] * inc_x];
+      data_x[start_x + row * inc_x] += omega * inv_diag[row] * residual;
+    }
+  }
+}
+
+} // namespace host_based
+} // namespace linalg
+} // namespace viennacl
+
+
+#endif
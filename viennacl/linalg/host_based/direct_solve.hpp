@@ -20,12 +20,31 @@
 
 /** @file viennacl/linalg/host_based/direct_solve.hpp
     @brief Implementations of dense direct triangular solvers are found here.
+
+    Triangular solves with multiple right hand sides are blocked recursively: Diagonal blocks are solved directly in parallel over panels of right hand sides,
+    while the off-diagonal updates are carried out by the host matrix-matrix product.
 */
 
 #include "viennacl/vector.hpp"
 #include "viennacl/matrix.hpp"
 
 #include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/matrix_operations.hpp"
+
+// Triangular systems up to this size are solved directly, larger systems are split recursively:
+#ifndef VIENNACL_HOST_DIRECT_SOLVE_BLOCKSIZE
+  #define VIENNACL_HOST_DIRECT_SOLVE_BLOCKSIZE 64
+#endif
+
+// Number of right hand sides processed by a thread in the direct solve of a diagonal block:
+#ifndef VIENNACL_HOST_DIRECT_SOLVE_PANEL_SIZE
+  #define VIENNACL_HOST_DIRECT_SOLVE_PANEL_SIZE 32
+#endif
+
+// Minimum work (system size times number of right hand sides) for using OpenMP in the direct solve of a diagonal block:
+#ifndef VIENNACL_OPENMP_DIRECT_SOLVE_MIN_SIZE
+  #define VIENNACL_OPENMP_DIRECT_SOLVE_MIN_SIZE 5000
+#endif
 
 namespace viennacl
 {
@@ -44,22 +63,34 @@ namespace detail
   {
     typedef typename MatrixT2::value_type   value_type;
 
-    for (vcl_size_t i = 0; i < A_size; ++i)
-    {
-      vcl_size_t current_row = A_size - i - 1;
+    vcl_size_t panel_size = VIENNACL_HOST_DIRECT_SOLVE_PANEL_SIZE;
+    vcl_size_t num_panels = (B_size + panel_size - 1) / panel_size;
 
-      for (vcl_size_t j = current_row + 1; j < A_size; ++j)
-      {
-        value_type A_element = A(current_row, j);
-        for (vcl_size_t k=0; k < B_size; ++k)
-          B(current_row, k) -= A_element * B(j, k);
-      }
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (num_panels > 1 && A_size * B_size > VIENNACL_OPENMP_DIRECT_SOLVE_MIN_SIZE)
+#endif
+    for (long panel2 = 0; panel2 < static_cast<long>(num_panels); ++panel2)
+    {
+      vcl_size_t k_start = static_cast<vcl_size_t>(panel2) * panel_size;
+      vcl_size_t k_end   = std::min(k_start + panel_size, B_size);
 
-      if (!unit_diagonal)
+      for (vcl_size_t i = 0; i < A_size; ++i)
       {
-        value_type A_diag = A(current_row, current_row);
-        for (vcl_size_t k=0; k < B_size; ++k)
-          B(current_row, k) /= A_diag;
+        vcl_size_t current_row = A_size - i - 1;
+
+        for (vcl_size_t j = current_row + 1; j < A_size; ++j)
+        {
+          value_type A_element = A(current_row, j);
+          for (vcl_size_t k = k_start; k < k_end; ++k)
+            B(current_row, k) -= A_element * B(j, k);
+        }
+
+        if (!unit_diagonal)
+        {
+          value_type A_diag = A(current_row, current_row);
+          for (vcl_size_t k = k_start; k < k_end; ++k)
+            B(current_row, k) /= A_diag;
+        }
       }
     }
   }
@@ -84,20 +115,32 @@ namespace detail
   {
     typedef typename MatrixT2::value_type   value_type;
 
-    for (vcl_size_t i = 0; i < A_size; ++i)
+    vcl_size_t panel_size = VIENNACL_HOST_DIRECT_SOLVE_PANEL_SIZE;
+    vcl_size_t num_panels = (B_size + panel_size - 1) / panel_size;
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (num_panels > 1 && A_size * B_size > VIENNACL_OPENMP_DIRECT_SOLVE_MIN_SIZE)
+#endif
+    for (long panel2 = 0; panel2 < static_cast<long>(num_panels); ++panel2)
     {
-      for (vcl_size_t j = 0; j < i; ++j)
-      {
-        value_type A_element = A(i, j);
-        for (vcl_size_t k=0; k < B_size; ++k)
-          B(i, k) -= A_element * B(j, k);
-      }
+      vcl_size_t k_start = static_cast<vcl_size_t>(panel2) * panel_size;
+      vcl_size_t k_end   = std::min(k_start + panel_size, B_size);
 
-      if (!unit_diagonal)
+      for (vcl_size_t i = 0; i < A_size; ++i)
       {
-        value_type A_diag = A(i, i);
-        for (vcl_size_t k=0; k < B_size; ++k)
-          B(i, k) /= A_diag;
+        for (vcl_size_t j = 0; j < i; ++j)
+        {
+          value_type A_element = A(i, j);
+          for (vcl_size_t k = k_start; k < k_end; ++k)
+            B(i, k) -= A_element * B(j, k);
+        }
+
+        if (!unit_diagonal)
+        {
+          value_type A_diag = A(i, i);
+          for (vcl_size_t k = k_start; k < k_end; ++k)
+            B(i, k) /= A_diag;
+        }
       }
     }
   }
@@ -114,15 +157,160 @@ namespace detail
     lower_inplace_solve_matrix(A, B, A_size, B_size, false);
   }
 
-}
+  /** @brief Solves the triangular system A \ B directly, i.e. without blocking. Right hand sides are processed in parallel panels. */
+  template<typename NumericT, typename SolverTagT>
+  void inplace_solve_direct(matrix_base<NumericT> const & A,
+                            matrix_base<NumericT> & B,
+                            SolverTagT)
+  {
+    typedef NumericT        value_type;
+
+    value_type const * data_A = detail::extract_raw_pointer<value_type>(A);
+    value_type       * data_B = detail::extract_raw_pointer<value_type>(B);
+
+    vcl_size_t A_start1 = viennacl::traits::start1(A);
+    vcl_size_t A_start2 = viennacl::traits::start2(A);
+    vcl_size_t A_inc1   = viennacl::traits::stride1(A);
+    vcl_size_t A_inc2   = viennacl::traits::stride2(A);
+    //vcl_size_t A_size1  = viennacl::traits::size1(A);
+    vcl_size_t A_size2  = viennacl::traits::size2(A);
+    vcl_size_t A_internal_size1  = viennacl::traits::internal_size1(A);
+    vcl_size_t A_internal_size2  = viennacl::traits::internal_size2(A);
+
+    vcl_size_t B_start1 = viennacl::traits::start1(B);
+    vcl_size_t B_start2 = viennacl::traits::start2(B);
+    vcl_size_t B_inc1   = viennacl::traits::stride1(B);
+    vcl_size_t B_inc2   = viennacl::traits::stride2(B);
+    //vcl_size_t B_size1  = viennacl::traits::size1(B);
+    vcl_size_t B_size2  = viennacl::traits::size2(B);
+    vcl_size_t B_internal_size1  = viennacl::traits::internal_size1(B);
+    vcl_size_t B_internal_size2  = viennacl::traits::internal_size2(B);
+
+
+    if (A.row_major() && B.row_major())
+    {
+      detail::matrix_array_wrapper<value_type const, row_major, false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+      detail::matrix_array_wrapper<value_type,       row_major, false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+
+      detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size2, SolverTagT());
+    }
+    else if (A.row_major() && !B.row_major())
+    {
+      detail::matrix_array_wrapper<value_type const, row_major,    false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+      detail::matrix_array_wrapper<value_type,       column_major, false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+
+      detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size2, SolverTagT());
+    }
+    else if (!A.row_major() && B.row_major())
+    {
+      detail::matrix_array_wrapper<value_type const, column_major, false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+      detail::matrix_array_wrapper<value_type,       row_major,    false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+
+      detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size2, SolverTagT());
+    }
+    else
+    {
+      detail::matrix_array_wrapper<value_type const, column_major, false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+      detail::matrix_array_wrapper<value_type,       column_major, false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+
+      detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size2, SolverTagT());
+    }
+  }
+
+  /** @brief Recursive blocked solver for triangular systems.
+    *
+    * For lower triangular A, solves A_11 \ B_1, updates B_2 -= A_21 B_1 via a matrix-matrix product, and solves A_22 \ B_2.
+    * For upper triangular A, solves A_22 \ B_2, updates B_1 -= A_12 B_2 via a matrix-matrix product, and solves A_11 \ B_1.
+    */
+  template<typename NumericT, typename SolverTagT>
+  void inplace_solve_recursive(matrix_base<NumericT> const & A, matrix_base<NumericT> & B, SolverTagT, bool is_lower)
+  {
+    typedef typename matrix_base<NumericT>::handle_type    handle_type;
+
+    vcl_size_t A_size = viennacl::traits::size1(A);
+    if (A_size <= VIENNACL_HOST_DIRECT_SOLVE_BLOCKSIZE)
+    {
+      inplace_solve_direct(A, B, SolverTagT());
+      return;
+    }
+
+    // split at a multiple of the block size:
+    vcl_size_t n1 = ((A_size / 2 + VIENNACL_HOST_DIRECT_SOLVE_BLOCKSIZE - 1) / VIENNACL_HOST_DIRECT_SOLVE_BLOCKSIZE) * VIENNACL_HOST_DIRECT_SOLVE_BLOCKSIZE;
+    vcl_size_t n2 = A_size - n1;
+
+    handle_type & A_handle = const_cast<handle_type &>(A.handle());
+    vcl_size_t A_start1 = viennacl::traits::start1(A);
+    vcl_size_t A_start2 = viennacl::traits::start2(A);
+    vcl_size_t A_inc1   = viennacl::traits::stride1(A);
+    vcl_size_t A_inc2   = viennacl::traits::stride2(A);
+    vcl_size_t A_internal_size1  = viennacl::traits::internal_size1(A);
+    vcl_size_t A_internal_size2  = viennacl::traits::internal_size2(A);
+
+    handle_type & B_handle = B.handle();
+    vcl_size_t B_start1 = viennacl::traits::start1(B);
+    vcl_size_t B_start2 = viennacl::traits::start2(B);
+    vcl_size_t B_inc1   = viennacl::traits::stride1(B);
+    vcl_size_t B_inc2   = viennacl::traits::stride2(B);
+    vcl_size_t B_size2  = viennacl::traits::size2(B);
+    vcl_size_t B_internal_size1  = viennacl::traits::internal_size1(B);
+    vcl_size_t B_internal_size2  = viennacl::traits::internal_size2(B);
+
+    // blocks sharing the memory of A and B:
+    matrix_base<NumericT> A_11(A_handle, n1, A_start1,             A_inc1, A_internal_size1, n1, A_start2,             A_inc2, A_internal_size2, A.row_major());
+    matrix_base<NumericT> A_12(A_handle, n1, A_start1,             A_inc1, A_internal_size1, n2, A_start2 + n1 * A_inc2, A_inc2, A_internal_size2, A.row_major());
+    matrix_base<NumericT> A_21(A_handle, n2, A_start1 + n1 * A_inc1, A_inc1, A_internal_size1, n1, A_start2,             A_inc2, A_internal_size2, A.row_major());
+    matrix_base<NumericT> A_22(A_handle, n2, A_start1 + n1 * A_inc1, A_inc1, A_internal_size1, n2, A_start2 + n1 * A_inc2, A_inc2, A_internal_size2, A.row_major());
+    matrix_base<NumericT> B_1(B_handle, n1, B_start1,             B_inc1, B_internal_size1, B_size2, B_start2, B_inc2, B_internal_size2, B.row_major());
+    matrix_base<NumericT> B_2(B_handle, n2, B_start1 + n1 * B_inc1, B_inc1, B_internal_size1, B_size2, B_start2, B_inc2, B_internal_size2, B.row_major());
+
+    if (is_lower)
+    {
+      inplace_solve_recursive(A_11, B_1, SolverTagT(), true);
+      viennacl::linalg::host_based::prod_impl(A_21, false, B_1, false, B_2, NumericT(-1), NumericT(1));
+      inplace_solve_recursive(A_22, B_2, SolverTagT(), true);
+    }
+    else
+    {
+      inplace_solve_recursive(A_22, B_2, SolverTagT(), false);
+      viennacl::linalg::host_based::prod_impl(A_12, false, B_2, false, B_1, NumericT(-1), NumericT(1));
+      inplace_solve_recursive(A_11, B_1, SolverTagT(), false);
+    }
+  }
+
+  template<typename NumericT>
+  void inplace_solve_recursive(matrix_base<NumericT> const & A, matrix_base<NumericT> & B, viennacl::linalg::lower_tag)
+  {
+    inplace_solve_recursive(A, B, viennacl::linalg::lower_tag(), true);
+  }
+
+  template<typename NumericT>
+  void inplace_solve_recursive(matrix_base<NumericT> const & A, matrix_base<NumericT> & B, viennacl::linalg::unit_lower_tag)
+  {
+    inplace_solve_recursive(A, B, viennacl::linalg::unit_lower_tag(), true);
+  }
+
+  template<typename NumericT>
+  void inplace_solve_recursive(matrix_base<NumericT> const & A, matrix_base<NumericT> & B, viennacl::linalg::upper_tag)
+  {
+    inplace_solve_recursive(A, B, viennacl::linalg::upper_tag(), false);
+  }
+
+  template<typename NumericT>
+  void inplace_solve_recursive(matrix_base<NumericT> const & A, matrix_base<NumericT> & B, viennacl::linalg::unit_upper_tag)
+  {
+    inplace_solve_recursive(A, B, viennacl::linalg::unit_upper_tag(), false);
+  }
+
+} // namespace detail
 
 //
 // Note: By convention, all size checks are performed in the calling frontend. No need to double-check here.
 //
 
-////////////////// upper triangular solver (upper_tag) //////////////////////////////////////
 /** @brief Direct inplace solver for triangular systems with multiple right hand sides, i.e. A \ B   (MATLAB notation)
 *
+* Large systems are split recursively, such that most of the work is carried out by matrix-matrix products.
+*
 * @param A        The system matrix
 * @param B        The matrix of row vectors, where the solution is directly written to
 */
@@ -131,58 +319,7 @@ void inplace_solve(matrix_base<NumericT> const & A,
                    matrix_base<NumericT> & B,
                    SolverTagT)
 {
-  typedef NumericT        value_type;
-
-  value_type const * data_A = detail::extract_raw_pointer<value_type>(A);
-  value_type       * data_B = detail::extract_raw_pointer<value_type>(B);
-
-  vcl_size_t A_start1 = viennacl::traits::start1(A);
-  vcl_size_t A_start2 = viennacl::traits::start2(A);
-  vcl_size_t A_inc1   = viennacl::traits::stride1(A);
-  vcl_size_t A_inc2   = viennacl::traits::stride2(A);
-  //vcl_size_t A_size1  = viennacl::traits::size1(A);
-  vcl_size_t A_size2  = viennacl::traits::size2(A);
-  vcl_size_t A_internal_size1  = viennacl::traits::internal_size1(A);
-  vcl_size_t A_internal_size2  = viennacl::traits::internal_size2(A);
-
-  vcl_size_t B_start1 = viennacl::traits::start1(B);
-  vcl_size_t B_start2 = viennacl::traits::start2(B);
-  vcl_size_t B_inc1   = viennacl::traits::stride1(B);
-  vcl_size_t B_inc2   = viennacl::traits::stride2(B);
-  //vcl_size_t B_size1  = viennacl::traits::size1(B);
-  vcl_size_t B_size2  = viennacl::traits::size2(B);
-  vcl_size_t B_internal_size1  = viennacl::traits::internal_size1(B);
-  vcl_size_t B_internal_size2  = viennacl::traits::internal_size2(B);
-
-
-  if (A.row_major() && B.row_major())
-  {
-    detail::matrix_array_wrapper<value_type const, row_major, false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-    detail::matrix_array_wrapper<value_type,       row_major, false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-
-    detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size2, SolverTagT());
-  }
-  else if (A.row_major() && !B.row_major())
-  {
-    detail::matrix_array_wrapper<value_type const, row_major,    false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-    detail::matrix_array_wrapper<value_type,       column_major, false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-
-    detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size2, SolverTagT());
-  }
-  else if (!A.row_major() && B.row_major())
-  {
-    detail::matrix_array_wrapper<value_type const, column_major, false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-    detail::matrix_array_wrapper<value_type,       row_major,    false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-
-    detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size2, SolverTagT());
-  }
-  else
-  {
-    detail::matrix_array_wrapper<value_type const, column_major, false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
-    detail::matrix_array_wrapper<value_type,       column_major, false>   wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
-
-    detail::inplace_solve_matrix(wrapper_A, wrapper_B, A_size2, B_size2, SolverTagT());
-  }
+  detail::inplace_solve_recursive(A, B, SolverTagT());
 }
 
 
@@ -0,0 +1,755 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_EIGEN_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_EIGEN_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/eigen_operations.hpp
+    @brief Implementations of a symmetric eigensolver for dense matrices in host memory.
+
+    The solver consists of three stages:
+      - blocked Householder tridiagonalization with symmetric rank-2k updates of the trailing matrix,
+      - divide-and-conquer for the eigenvalues and eigenvectors of the tridiagonal matrix,
+      - back-transformation of the eigenvectors, processed in parallel over blocks of eigenvectors.
+    All stages operate on a column-major copy of the matrix, hence row-major and column-major matrices are supported alike.
+*/
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "viennacl/forwards.h"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/start.hpp"
+#include "viennacl/traits/stride.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+
+// Minimum matrix size for using OpenMP in the symmetric eigensolver:
+#ifndef VIENNACL_OPENMP_EIGEN_MIN_SIZE
+  #define VIENNACL_OPENMP_EIGEN_MIN_SIZE  64
+#endif
+
+// Number of columns reduced per panel in the blocked tridiagonalization:
+#ifndef VIENNACL_EIGEN_TRIDIAG_BLOCK_SIZE
+  #define VIENNACL_EIGEN_TRIDIAG_BLOCK_SIZE  32
+#endif
+
+// Size of the tridiagonal subproblems solved directly by implicit QL iterations in the divide-and-conquer stage:
+#ifndef VIENNACL_EIGEN_DC_LEAF_SIZE
+  #define VIENNACL_EIGEN_DC_LEAF_SIZE  25
+#endif
+
+namespace viennacl
+{
+namespace linalg
+{
+namespace host_based
+{
+namespace detail
+{
+  /** @brief Generates an elementary reflector H = I - tau v v^T such that H (alpha, x)^T = (beta, 0)^T with v = (1, x_new)^T. On exit, alpha holds beta and x holds x_new. */
+  template<typename NumericT>
+  void eigen_householder_generate(vcl_size_t n, NumericT & alpha, NumericT * x, NumericT & tau)
+  {
+    NumericT x_norm = 0;
+    for (vcl_size_t i=0; i<n; ++i)
+      x_norm += x[i] * x[i];
+    x_norm = std::sqrt(x_norm);
+
+    if (x_norm <= 0)
+    {
+      tau = 0;
+      return;
+    }
+
+    NumericT beta = std::sqrt(alpha * alpha + x_norm * x_norm);
+    if (alpha > 0)
+      beta = -beta;
+    tau = (beta - alpha) / beta;
+    NumericT scale = NumericT(1) / (alpha - beta);
+    for (vcl_size_t i=0; i<n; ++i)
+      x[i] *= scale;
+    alpha = beta;
+  }
+
+  /** @brief Reduces the panel of columns [k, k+nb) of the symmetric matrix A (column-major, lower triangle referenced) to tridiagonal form.
+    *
+    * Returns the matrix W such that the trailing matrix is updated via A22 -= V W^T + W V^T, where V holds the reflectors of the panel.
+    * This is the lower-triangular variant of LAPACK's xLATRD.
+    */
+  template<typename NumericT>
+  void eigen_tridiag_panel(vcl_size_t n, NumericT * A, vcl_size_t k, vcl_size_t nb,
+                           NumericT * W, NumericT * d, NumericT * e, NumericT * tau)
+  {
+    std::vector<NumericT> tmp(nb);
+
+    for (vcl_size_t p = 0; p < nb; ++p)
+    {
+      vcl_size_t i = k + p;
+      NumericT * A_i = A + i * n;
+      NumericT * W_p = W + p * n;
+
+      // apply previous reflectors of the panel to column i:
+      for (vcl_size_t q = 0; q < p; ++q)
+      {
+        NumericT const * V_q = A + (k + q) * n;
+        NumericT const * W_q = W + q * n;
+        NumericT w_iq = W_q[i];
+        NumericT v_iq = V_q[i];
+        for (vcl_size_t r = i; r < n; ++r)
+          A_i[r] -= V_q[r] * w_iq + W_q[r] * v_iq;
+      }
+      d[i] = A_i[i];
+
+      // generate reflector annihilating A(i+2:n, i):
+      vcl_size_t m = n - i - 1;
+      eigen_householder_generate(m - 1, A_i[i+1], A_i + i + 2, tau[i]);
+      e[i] = A_i[i+1];
+      A_i[i+1] = 1;
+      NumericT const * v = A_i + i + 1;
+
+      // W(i+1:n, p) = A(i+1:n, i+1:n) * v, using the lower triangle only:
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if (m > VIENNACL_OPENMP_EIGEN_MIN_SIZE)
+#endif
+      for (long row2 = 0; row2 < static_cast<long>(m); ++row2)
+      {
+        vcl_size_t r = static_cast<vcl_size_t>(row2);
+        NumericT sum = 0;
+        for (vcl_size_t c = 0; c < r; ++c)
+          sum += A[(i + 1 + c) * n + i + 1 + r] * v[c];
+        NumericT const * A_col = A + (i + 1 + r) * n + i + 1;
+        for (vcl_size_t c = r; c < m; ++c)
+          sum += A_col[c] * v[c];
+        W_p[i + 1 + r] = sum;
+      }
+
+      // corrections from previous reflectors of the panel:
+      if (p > 0)
+      {
+        for (vcl_size_t q = 0; q < p; ++q)
+        {
+          NumericT const * W_q = W + q * n;
+          NumericT s = 0;
+          for (vcl_size_t r = 0; r < m; ++r)
+            s += W_q[i + 1 + r] * v[r];
+          tmp[q] = s;
+        }
+        for (vcl_size_t q = 0; q < p; ++q)
+        {
+          NumericT const * V_q = A + (k + q) * n;
+          for (vcl_size_t r = 0; r < m; ++r)
+            W_p[i + 1 + r] -= V_q[i + 1 + r] * tmp[q];
+        }
+        for (vcl_size_t q = 0; q < p; ++q)
+        {
+          NumericT const * V_q = A + (k + q) * n;
+          NumericT s = 0;
+          for (vcl_size_t r = 0; r < m; ++r)
+            s += V_q[i + 1 + r] * v[r];
+          tmp[q] = s;
+        }
+        for (vcl_size_t q = 0; q < p; ++q)
+        {
+          NumericT const * W_q = W + q * n;
+          for (vcl_size_t r = 0; r < m; ++r)
+            W_p[i + 1 + r] -= W_q[i + 1 + r] * tmp[q];
+        }
+      }
+
+      NumericT alpha = 0;
+      for (vcl_size_t r = 0; r < m; ++r)
+      {
+        W_p[i + 1 + r] *= tau[i];
+        alpha += W_p[i + 1 + r] * v[r];
+      }
+      alpha *= NumericT(-0.5) * tau[i];
+      for (vcl_size_t r = 0; r < m; ++r)
+        W_p[i + 1 + r] += alpha * v[r];
+    }
+  }
+
+  /** @brief Symmetric rank-2k update A(k:n, k:n) -= V W^T + W V^T of the lower triangle, where V = A(k:n, k-nb:k). Parallel over the columns of A. */
+  template<typename NumericT>
+  void eigen_tridiag_trailing_update(vcl_size_t n, NumericT * A, vcl_size_t k, vcl_size_t nb, NumericT const * W)
+  {
+    vcl_size_t panel_start = k - nb;
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for schedule(dynamic, 8) if (n - k > VIENNACL_OPENMP_EIGEN_MIN_SIZE)
+#endif
+    for (long col2 = static_cast<long>(k); col2 < static_cast<long>(n); ++col2)
+    {
+      vcl_size_t c = static_cast<vcl_size_t>(col2);
+      NumericT * A_c = A + c * n;
+      for (vcl_size_t q = 0; q < nb; ++q)
+      {
+        NumericT const * V_q = A + (panel_start + q) * n;
+        NumericT const * W_q = W + q * n;
+        NumericT w_cq = W_q[c];
+        NumericT v_cq = V_q[c];
+        for (vcl_size_t r = c; r < n; ++r)
+          A_c[r] -= V_q[r] * w_cq + W_q[r] * v_cq;
+      }
+    }
+  }
+
+  /** @brief Computes the eigenvalues and eigenvectors of a small symmetric tridiagonal matrix by implicit QL iterations.
+    *
+    * @param n   Size of the matrix
+    * @param d   Diagonal on input, eigenvalues (unsorted) on output
+    * @param e   Off-diagonal of length n (e[i] couples i and i+1, e[n-1] unused). Destroyed on output.
+    * @param Z   Column-major n-by-n matrix, eigenvectors are accumulated into it
+    */
+  template<typename NumericT>
+  void eigen_tridiagonal_ql(vcl_size_t n, NumericT * d, NumericT * e, NumericT * Z)
+  {
+    NumericT eps = std::numeric_limits<NumericT>::epsilon();
+    if (n == 0)
+      return;
+    e[n-1] = 0;
+
+    for (vcl_size_t l = 0; l < n; ++l)
+    {
+      vcl_size_t iter = 0;
+      vcl_size_t m;
+      do
+      {
+        for (m = l; m + 1 < n; ++m)
+        {
+          NumericT dd = std::fabs(d[m]) + std::fabs(d[m+1]);
+          if (std::fabs(e[m]) <= eps * dd)
+            break;
+        }
+        if (m != l)
+        {
+          if (iter++ == 60)
+            break;
+
+          NumericT g = (d[l+1] - d[l]) / (NumericT(2) * e[l]);
+          NumericT r = std::sqrt(g * g + NumericT(1));
+          g = d[m] - d[l] + e[l] / (g + (g >= 0 ? r : -r));
+          NumericT s = 1, c = 1, p = 0;
+          bool underflow = false;
+          for (vcl_size_t i = m; i-- > l;)
+          {
+            NumericT f = s * e[i];
+            NumericT b = c * e[i];
+            r = std::sqrt(f * f + g * g);
+            e[i+1] = r;
+            if (r <= 0)
+            {
+              d[i+1] -= p;
+              e[m] = 0;
+              underflow = true;
+              break;
+            }
+            s = f / r;
+            c = g / r;
+            g = d[i+1] - p;
+            r = (d[i] - g) * s + NumericT(2) * c * b;
+            p = s * r;
+            d[i+1] = g + p;
+            g = c * r - b;
+
+            NumericT * Z_i  = Z + i * n;
+            NumericT * Z_i1 = Z + (i + 1) * n;
+            for (vcl_size_t k = 0; k < n; ++k)
+            {
+              f = Z_i1[k];
+              Z_i1[k] = s * Z_i[k] + c * f;
+              Z_i[k]  = c * Z_i[k] - s * f;
+            }
+          }
+          if (underflow)
+            continue;
+          d[l] -= p;
+          e[l] = g;
+          e[m] = 0;
+        }
+      } while (m != l);
+    }
+  }
+
+  /** @brief Sorts eigenvalues in ascending order and permutes the columns of the column-major n-by-n matrix Z accordingly. */
+  template<typename NumericT>
+  void eigen_sort(vcl_size_t n, NumericT * d, std::vector<NumericT> & Z)
+  {
+    std::vector<std::pair<NumericT, vcl_size_t> > order(n);
+    for (vcl_size_t i=0; i<n; ++i)
+      order[i] = std::make_pair(d[i], i);
+    std::sort(order.begin(), order.end());
+
+    std::vector<NumericT> Z_sorted(n * n);
+    for (vcl_size_t j=0; j<n; ++j)
+    {
+      d[j] = order[j].first;
+      std::copy(Z.begin() + vcl_ptrdiff_t(order[j].second * n), Z.begin() + vcl_ptrdiff_t((order[j].second + 1) * n), Z_sorted.begin() + vcl_ptrdiff_t(j * n));
+    }
+    Z.swap(Z_sorted);
+  }
+
+  /** @brief Finds the j-th root of the secular equation 1 + rho * sum_i z_i^2 / (d_i - lambda) = 0 for strictly increasing d and rho > 0.
+    *
+    * The root is computed relative to the closest pole d_origin in order to obtain the differences delta_i = d_i - lambda to high relative accuracy.
+    * Safeguarded Newton iterations within a bisection bracket are used.
+    *
+    * @return The index of the pole used as origin. On exit, delta holds d_i - lambda and tau holds lambda - d_origin.
+    */
+  template<typename NumericT>
+  vcl_size_t eigen_secular_root(vcl_size_t k, vcl_size_t j, NumericT const * d, NumericT const * z, NumericT rho, NumericT * delta, NumericT & tau)
+  {
+    NumericT eps = std::numeric_limits<NumericT>::epsilon();
+    vcl_size_t origin = j;
+    NumericT lo, hi;
+
+    if (j + 1 < k)
+    {
+      NumericT mid = (d[j+1] - d[j]) / NumericT(2);
+      NumericT f = 1;
+      for (vcl_size_t i=0; i<k; ++i)
+        f += rho * z[i] * z[i] / ((d[i] - d[j]) - mid);
+      if (f >= 0)
+      {
+        lo = 0;
+        hi = mid;
+      }
+      else
+      {
+        origin = j + 1;
+        lo = -mid;
+        hi = 0;
+      }
+    }
+    else
+    {
+      NumericT z_norm2 = 0;
+      for (vcl_size_t i=0; i<k; ++i)
+        z_norm2 += z[i] * z[i];
+      lo = 0;
+      hi = rho * z_norm2;
+    }
+
+    tau = (lo + hi) / NumericT(2);
+    for (vcl_size_t iter = 0; iter < 100; ++iter)
+    {
+      NumericT f = 1;
+      NumericT f_prime = 0;
+      for (vcl_size_t i=0; i<k; ++i)
+      {
+        NumericT di = (d[i] - d[origin]) - tau;
+        NumericT zi_over_di = z[i] / di;
+        f       += rho * z[i] * zi_over_di;
+        f_prime += rho * zi_over_di * zi_over_di;
+      }
+
+      if (f > 0)
+        hi = tau;
+      else if (f < 0)
+        lo = tau;
+      else
+        break;
+
+      NumericT tau_new = tau - f / f_prime;
+      if (!(tau_new > lo && tau_new < hi))
+        tau_new = (lo + hi) / NumericT(2);
+
+      bool converged = std::fabs(tau_new - tau) <= NumericT(2) * eps * std::fabs(tau_new)
+                    || (hi - lo) <= NumericT(2) * eps * std::max(std::fabs(lo), std::fabs(hi));
+      tau = tau_new;
+      if (converged)
+        break;
+    }
+
+    for (vcl_size_t i=0; i<k; ++i)
+      delta[i] = (d[i] - d[origin]) - tau;
+
+    return origin;
+  }
+
+  /** @brief Merges the eigendecompositions of two tridiagonal subproblems (divide-and-conquer step).
+    *
+    * Computes the eigendecomposition of blockdiag(Q1 D1 Q1^T, Q2 D2 Q2^T) + beta u u^T, where u couples the last row of the first and the first row of the second block.
+    * Deflation of small components and of close eigenvalues follows Cuppen and Dongarra/Sorensen,
+    * the eigenvectors of the rank-one modification are computed via the Gu-Eisenstat formula for numerical orthogonality.
+    */
+  template<typename NumericT>
+  void eigen_dc_merge(vcl_size_t n, vcl_size_t n1, NumericT * d, NumericT beta,
+                      std::vector<NumericT> const & Q1, std::vector<NumericT> const & Q2, std::vector<NumericT> & Q)
+  {
+    NumericT eps = std::numeric_limits<NumericT>::epsilon();
+    vcl_size_t n2 = n - n1;
+
+    // block-diagonal eigenvector matrix and coupling vector:
+    std::vector<NumericT> Qb(n * n, NumericT(0));
+    std::vector<NumericT> z(n);
+    for (vcl_size_t j=0; j<n1; ++j)
+    {
+      std::copy(Q1.begin() + vcl_ptrdiff_t(j * n1), Q1.begin() + vcl_ptrdiff_t((j + 1) * n1), Qb.begin() + vcl_ptrdiff_t(j * n));
+      z[j] = Q1[j * n1 + n1 - 1];
+    }
+    for (vcl_size_t j=0; j<n2; ++j)
+    {
+      std::copy(Q2.begin() + vcl_ptrdiff_t(j * n2), Q2.begin() + vcl_ptrdiff_t((j + 1) * n2), Qb.begin() + vcl_ptrdiff_t((n1 + j) * n + n1));
+      z[n1 + j] = Q2[j * n2];
+    }
+
+    // normalize to rho > 0 and ||z|| = 1:
+    bool flipped = (beta < 0);
+    NumericT rho = NumericT(2) * std::fabs(beta);
+    NumericT inv_sqrt2 = NumericT(1) / std::sqrt(NumericT(2));
+    for (vcl_size_t i=0; i<n; ++i)
+    {
+      if (flipped)
+        d[i] = -d[i];
+      z[i] *= inv_sqrt2;
+    }
+
+    // sort poles:
+    std::vector<std::pair<NumericT, vcl_size_t> > order(n);
+    for (vcl_size_t i=0; i<n; ++i)
+      order[i] = std::make_pair(d[i], i);
+    std::sort(order.begin(), order.end());
+
+    NumericT d_max = 0;
+    for (vcl_size_t i=0; i<n; ++i)
+      d_max = std::max(d_max, std::fabs(d[i]));
+    NumericT tol = NumericT(8) * eps * std::max(d_max, rho);
+
+    // deflation:
+    std::vector<vcl_size_t> kept;           // column indices in Qb of the non-deflated problem
+    std::vector<NumericT>   kept_d, kept_z;
+    std::vector<vcl_size_t> deflated;
+    std::vector<NumericT>   deflated_d;
+    std::vector<NumericT>   sorted_d(n), sorted_z(n);
+    for (vcl_size_t i=0; i<n; ++i)
+    {
+      sorted_d[i] = order[i].first;
+      sorted_z[i] = z[order[i].second];
+    }
+
+    vcl_size_t prev = n;  // index (in sorted order) of the previous non-deflated pole
+    for (vcl_size_t i=0; i<n; ++i)
+    {
+      if (rho * std::fabs(sorted_z[i]) <= tol)
+      {
+        deflated.push_back(order[i].second);
+        deflated_d.push_back(sorted_d[i]);
+        continue;
+      }
+
+      if (prev < n)
+      {
+        NumericT t = std::sqrt(sorted_z[prev] * sorted_z[prev] + sorted_z[i] * sorted_z[i]);
+        NumericT c = sorted_z[i] / t;
+        NumericT s = -sorted_z[prev] / t;
+        if (std::fabs((sorted_d[i] - sorted_d[prev]) * c * s) <= tol)
+        {
+          // Givens rotation zeroing z[prev], deflates the previous pole:
+          NumericT * Q_p = &Qb[order[prev].second * n];
+          NumericT * Q_i = &Qb[order[i].second * n];
+          for (vcl_size_t r=0; r<n; ++r)
+          {
+            NumericT x = Q_p[r];
+            NumericT y = Q_i[r];
+            Q_p[r] = c * x + s * y;
+            Q_i[r] = c * y - s * x;
+          }
+          NumericT d_p = sorted_d[prev] * c * c + sorted_d[i] * s * s;
+          sorted_d[i]  = sorted_d[prev] * s * s + sorted_d[i] * c * c;
+          sorted_z[i]  = t;
+          sorted_z[prev] = 0;
+
+          kept.pop_back(); kept_d.pop_back(); kept_z.pop_back();
+          deflated.push_back(order[prev].second);
+          deflated_d.push_back(d_p);
+        }
+      }
+
+      kept.push_back(order[i].second);
+      kept_d.push_back(sorted_d[i]);
+      kept_z.push_back(sorted_z[i]);
+      prev = i;
+    }
+
+    vcl_size_t k = kept.size();
+    std::vector<NumericT> lambda(n);
+    std::vector<NumericT> Q_unsorted(n * n);
+
+    if (k > 0)
+    {
+      // roots of the secular equation and the differences d_i - lambda_j:
+      std::vector<NumericT> delta(k * k);
+      std::vector<vcl_size_t> origin(k);
+      std::vector<NumericT> tau(k);
+
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for schedule(dynamic, 4) if (k > VIENNACL_OPENMP_EIGEN_MIN_SIZE)
+#endif
+      for (long j2 = 0; j2 < static_cast<long>(k); ++j2)
+      {
+        vcl_size_t j = static_cast<vcl_size_t>(j2);
+        origin[j] = eigen_secular_root(k, j, &kept_d[0], &kept_z[0], rho, &delta[j * k], tau[j]);
+      }
+
+      // Gu-Eisenstat: recompute z such that the computed roots are exact eigenvalues of a nearby problem:
+      std::vector<NumericT> z_hat(k);
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if (k > VIENNACL_OPENMP_EIGEN_MIN_SIZE)
+#endif
+      for (long i2 = 0; i2 < static_cast<long>(k); ++i2)
+      {
+        vcl_size_t i = static_cast<vcl_size_t>(i2);
+        NumericT prod = -delta[(k - 1) * k + i] / rho;
+        for (vcl_size_t j=0; j<i; ++j)
+          prod *= -delta[j * k + i] / (kept_d[j] - kept_d[i]);
+        for (vcl_size_t j=i; j+1<k; ++j)
+          prod *= -delta[j * k + i] / (kept_d[j+1] - kept_d[i]);
+        NumericT value = std::sqrt(std::fabs(prod));
+        z_hat[i] = (kept_z[i] >= 0) ? value : -value;
+      }
+
+      // eigenvectors of the rank-one modified diagonal matrix and back-transformation with Qb:
+      std::vector<NumericT> Qk(n * k);
+      for (vcl_size_t i=0; i<k; ++i)
+        std::copy(Qb.begin() + vcl_ptrdiff_t(kept[i] * n), Qb.begin() + vcl_ptrdiff_t((kept[i] + 1) * n), Qk.begin() + vcl_ptrdiff_t(i * n));
+
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if (k > VIENNACL_OPENMP_EIGEN_MIN_SIZE)
+#endif
+      for (long j2 = 0; j2 < static_cast<long>(k); ++j2)
+      {
+        vcl_size_t j = static_cast<vcl_size_t>(j2);
+        NumericT * u = &delta[j * k];
+        NumericT u_norm = 0;
+        for (vcl_size_t i=0; i<k; ++i)
+        {
+          u[i] = z_hat[i] / u[i];
+          u_norm += u[i] * u[i];
+        }
+        u_norm = std::sqrt(u_norm);
+
+        NumericT * Q_j = &Q_unsorted[j * n];
+        for (vcl_size_t r=0; r<n; ++r)
+          Q_j[r] = 0;
+        for (vcl_size_t i=0; i<k; ++i)
+        {
+          NumericT factor = u[i] / u_norm;
+          NumericT const * Qk_i = &Qk[i * n];
+          for (vcl_size_t r=0; r<n; ++r)
+            Q_j[r] += Qk_i[r] * factor;
+        }
+        lambda[j] = kept_d[origin[j]] + tau[j];
+      }
+    }
+
+    for (vcl_size_t i=0; i<deflated.size(); ++i)
+    {
+      std::copy(Qb.begin() + vcl_ptrdiff_t(deflated[i] * n), Qb.begin() + vcl_ptrdiff_t((deflated[i] + 1) * n), Q_unsorted.begin() + vcl_ptrdiff_t((k + i) * n));
+      lambda[k + i] = deflated_d[i];
+    }
+
+    for (vcl_size_t i=0; i<n; ++i)
+      d[i] = flipped ? -lambda[i] : lambda[i];
+
+    eigen_sort(n, d, Q_unsorted);
+    Q.swap(Q_unsorted);
+  }
+
+  /** @brief Applies the reflectors H(0) H(1) ... H(n-2) stored below the subdiagonal of A (column-major) from the left to the column-major n-by-n matrix Z.
+    *
+    * The columns of Z are processed in blocks, which are distributed among threads. Each reflector is loaded once per block.
+    */
+  template<typename NumericT>
+  void eigen_tridiag_back_transform(vcl_size_t n, NumericT const * A, NumericT const * tau, NumericT * Z)
+  {
+    vcl_size_t const block_size = 16;
+    vcl_size_t num_blocks = (n + block_size - 1) / block_size;
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for schedule(dynamic, 1) if (n > VIENNACL_OPENMP_EIGEN_MIN_SIZE)
+#endif
+    for (long block2 = 0; block2 < static_cast<long>(num_blocks); ++block2)
+    {
+      vcl_size_t col_start = static_cast<vcl_size_t>(block2) * block_size;
+      vcl_size_t col_end   = std::min(col_start + block_size, n);
+
+      for (vcl_size_t i = n - 1; i-- > 0;)
+      {
+        if (tau[i] <= 0 && tau[i] >= 0)
+          continue;
+
+        NumericT const * v = A + i * n;   // v[i+1] == 1 implicitly, v[i+2:n] stored
+        for (vcl_size_t c = col_start; c < col_end; ++c)
+        {
+          NumericT * Z_c = Z + c * n;
+          NumericT s = Z_c[i+1];
+          for (vcl_size_t r = i + 2; r < n; ++r)
+            s += v[r] * Z_c[r];
+          s *= tau[i];
+          Z_c[i+1] -= s;
+          for (vcl_size_t r = i + 2; r < n; ++r)
+            Z_c[r] -= s * v[r];
+        }
+      }
+    }
+  }
+
+} // namespace detail
+
+
+/** @brief Reduces a symmetric matrix to tridiagonal form T = Q^T A Q by blocked Householder reflections.
+  *
+  * @param n    Size of the matrix
+  * @param A    Column-major n-by-n array. Only the lower triangle is referenced. On exit, the reflectors are stored below the subdiagonal.
+  * @param d    Diagonal of T (size n)
+  * @param e    Off-diagonal of T (size n, e[n-1] is set to zero)
+  * @param tau  Scalar factors of the reflectors (size n)
+  */
+template<typename NumericT>
+void symmetric_tridiagonalize(vcl_size_t n, NumericT * A, std::vector<NumericT> & d, std::vector<NumericT> & e, std::vector<NumericT> & tau)
+{
+  d.resize(n);
+  e.resize(n);
+  tau.resize(n);
+  if (n == 0)
+    return;
+
+  vcl_size_t nb = VIENNACL_EIGEN_TRIDIAG_BLOCK_SIZE;
+  std::vector<NumericT> W(n * nb);
+
+  vcl_size_t k = 0;
+  while (k + 1 < n)
+  {
+    vcl_size_t panel_size = std::min(nb, n - 1 - k);
+    detail::eigen_tridiag_panel(n, A, k, panel_size, &W[0], &d[0], &e[0], &tau[0]);
+    detail::eigen_tridiag_trailing_update(n, A, k + panel_size, panel_size, &W[0]);
+    for (vcl_size_t j = k; j < k + panel_size; ++j)
+      A[j * n + j + 1] = e[j];
+    k += panel_size;
+  }
+  d[n-1] = A[(n-1) * n + n - 1];
+  e[n-1] = 0;
+  tau[n-1] = 0;
+}
+
+
+/** @brief Computes all eigenvalues and eigenvectors of a symmetric tridiagonal matrix by the divide-and-conquer method.
+  *
+  * @param n    Size of the matrix
+  * @param d    Diagonal on input, eigenvalues in ascending order on output
+  * @param e    Off-diagonal (e[i] couples i and i+1), at least n-1 entries. Not modified.
+  * @param Z    Column-major n-by-n matrix of eigenvectors on output
+  */
+template<typename NumericT>
+void tridiagonal_eigen_dc(vcl_size_t n, NumericT * d, NumericT const * e, std::vector<NumericT> & Z)
+{
+  Z.resize(n * n);
+  if (n == 0)
+    return;
+
+  if (n <= VIENNACL_EIGEN_DC_LEAF_SIZE)
+  {
+    std::fill(Z.begin(), Z.end(), NumericT(0));
+    for (vcl_size_t i=0; i<n; ++i)
+      Z[i * n + i] = 1;
+    std::vector<NumericT> e_work(e, e + (n - 1));
+    e_work.push_back(0);
+    detail::eigen_tridiagonal_ql(n, d, &e_work[0], &Z[0]);
+    detail::eigen_sort(n, d, Z);
+    return;
+  }
+
+  vcl_size_t n1 = n / 2;
+  NumericT beta = e[n1 - 1];
+  d[n1 - 1] -= beta;
+  d[n1]     -= beta;
+
+  std::vector<NumericT> Q1, Q2;
+  tridiagonal_eigen_dc(n1,     d,      e,      Q1);
+  tridiagonal_eigen_dc(n - n1, d + n1, e + n1, Q2);
+
+  detail::eigen_dc_merge(n, n1, d, beta, Q1, Q2, Z);
+}
+
+
+/** @brief Computes all eigenvalues and eigenvectors of a dense symmetric matrix in host memory.
+  *
+  * @param A    The symmetric matrix (row-major or column-major). Not modified.
+  * @param Q    The matrix receiving the eigenvectors as columns
+  * @param D    The eigenvalues in ascending order
+  */
+template<typename NumericT>
+void symmetric_eigen(matrix_base<NumericT> const & A,
+                     matrix_base<NumericT> & Q,
+                     std::vector<NumericT> & D)
+{
+  assert(viennacl::traits::size1(A) == viennacl::traits::size2(A) && bool("Matrix must be square for the symmetric eigensolver!"));
+  assert(viennacl::traits::size1(Q) == viennacl::traits::size1(A) && viennacl::traits::size2(Q) == viennacl::traits::size1(A) && bool("Size mismatch of eigenvector matrix!"));
+
+  vcl_size_t n = viennacl::traits::size1(A);
+
+  NumericT const * data_A = detail::extract_raw_pointer<NumericT>(A);
+  NumericT       * data_Q = detail::extract_raw_pointer<NumericT>(Q);
+
+  vcl_size_t A_start1 = viennacl::traits::start1(A);
+  vcl_size_t A_start2 = viennacl::traits::start2(A);
+  vcl_size_t A_inc1   = viennacl::traits::stride1(A);
+  vcl_size_t A_inc2   = viennacl::traits::stride2(A);
+  vcl_size_t A_internal_size1  = viennacl::traits::internal_size1(A);
+  vcl_size_t A_internal_size2  = viennacl::traits::internal_size2(A);
+
+  vcl_size_t Q_start1 = viennacl::traits::start1(Q);
+  vcl_size_t Q_start2 = viennacl::traits::start2(Q);
+  vcl_size_t Q_inc1   = viennacl::traits::stride1(Q);
+  vcl_size_t Q_inc2   = viennacl::traits::stride2(Q);
+  vcl_size_t Q_internal_size1  = viennacl::traits::internal_size1(Q);
+  vcl_size_t Q_internal_size2  = viennacl::traits::internal_size2(Q);
+
+  // column-major working copy of the lower triangle:
+  std::vector<NumericT> A_work(n * n);
+  for (vcl_size_t j=0; j<n; ++j)
+    for (vcl_size_t i=j; i<n; ++i)
+      A_work[j * n + i] = A.row_major() ? data_A[viennacl::row_major::mem_index(i * A_inc1 + A_start1, j * A_inc2 + A_start2, A_internal_size1, A_internal_size2)]
+                                        : data_A[viennacl::column_major::mem_index(i * A_inc1 + A_start1, j * A_inc2 + A_start2, A_internal_size1, A_internal_size2)];
+
+  std::vector<NumericT> d, e, tau;
+  symmetric_tridiagonalize(n, &A_work[0], d, e, tau);
+
+  std::vector<NumericT> Z;
+  tridiagonal_eigen_dc(n, &d[0], &e[0], Z);
+
+  detail::eigen_tridiag_back_transform(n, &A_work[0], &tau[0], &Z[0]);
+
+  D = d;
+  for (vcl_size_t j=0; j<n; ++j)
+    for (vcl_size_t i=0; i<n; ++i)
+    {
+      if (Q.row_major())
+        data_Q[viennacl::row_major::mem_index(i * Q_inc1 + Q_start1, j * Q_inc2 + Q_start2, Q_internal_size1, Q_internal_size2)] = Z[j * n + i];
+      else
+        data_Q[viennacl::column_major::mem_index(i * Q_inc1 + Q_start1, j * Q_inc2 + Q_start2, Q_internal_size1, Q_internal_size2)] = Z[j * n + i];
+    }
+}
+
+} //namespace host_based
+} //namespace linalg
+} //namespace viennacl
+
+
+#endif
@@ -31,6 +31,22 @@
 #include <stdexcept>
 #include <cmath>
 #include <complex>
+#include <vector>
+#include <algorithm>
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+// Minimum length of a transform (or total length of a batch of transforms) for using OpenMP:
+#ifndef VIENNACL_OPENMP_FFT_MIN_SIZE
+  #define VIENNACL_OPENMP_FFT_MIN_SIZE  4096
+#endif
+
+// Number of adjacent columns gathered into a contiguous buffer by strided (column-wise) transforms:
+#ifndef VIENNACL_FFT_TILE_SIZE
+  #define VIENNACL_FFT_TILE_SIZE  16
+#endif
 
 namespace viennacl
 {
@@ -194,6 +210,646 @@ namespace detail
       }
     }
 
+
+    /** @brief Radix-p butterflies of the forward transform (negative sign in the exponent) on p complex values in split representation */
+    template<unsigned int RadixV, typename NumericT>
+    struct butterfly;
+
+    template<typename NumericT>
+    struct butterfly<2, NumericT>
+    {
+      static void apply(NumericT * re, NumericT * im)
+      {
+        NumericT t_re = re[0] - re[1]; re[0] += re[1]; re[1] = t_re;
+        NumericT t_im = im[0] - im[1]; im[0] += im[1]; im[1] = t_im;
+      }
+    };
+
+    template<typename NumericT>
+    struct butterfly<3, NumericT>
+    {
+      static void apply(NumericT * re, NumericT * im)
+      {
+        NumericT const s3 = NumericT(0.866025403784438646763723170752936183);  // sin(2 pi / 3)
+        NumericT t1_re = re[1] + re[2], t1_im = im[1] + im[2];
+        NumericT u_re  = s3 * (re[1] - re[2]), u_im = s3 * (im[1] - im[2]);
+        NumericT m_re  = re[0] - NumericT(0.5) * t1_re, m_im = im[0] - NumericT(0.5) * t1_im;
+        re[0] += t1_re;       im[0] += t1_im;
+        re[1] = m_re + u_im;  im[1] = m_im - u_re;
+        re[2] = m_re - u_im;  im[2] = m_im + u_re;
+      }
+    };
+
+    template<typename NumericT>
+    struct butterfly<4, NumericT>
+    {
+      static void apply(NumericT * re, NumericT * im)
+      {
+        NumericT t0_re = re[0] + re[2], t0_im = im[0] + im[2];
+        NumericT t1_re = re[0] - re[2], t1_im = im[0] - im[2];
+        NumericT t2_re = re[1] + re[3], t2_im = im[1] + im[3];
+        NumericT t3_re = re[1] - re[3], t3_im = im[1] - im[3];
+        re[0] = t0_re + t2_re;  im[0] = t0_im + t2_im;
+        re[2] = t0_re - t2_re;  im[2] = t0_im - t2_im;
+        re[1] = t1_re + t3_im;  im[1] = t1_im - t3_re;   // t1 - i t3
+        re[3] = t1_re - t3_im;  im[3] = t1_im + t3_re;   // t1 + i t3
+      }
+    };
+
+    template<typename NumericT>
+    struct butterfly<5, NumericT>
+    {
+      static void apply(NumericT * re, NumericT * im)
+      {
+        NumericT const c1 = NumericT( 0.309016994374947424102293417182819059);  // cos(2 pi / 5)
+        NumericT const c2 = NumericT(-0.809016994374947424102293417182819059);  // cos(4 pi / 5)
+        NumericT const s1 = NumericT( 0.951056516295153572116439333379382143);  // sin(2 pi / 5)
+        NumericT const s2 = NumericT( 0.587785252292473129168705954639072769);  // sin(4 pi / 5)
+
+        NumericT t1_re = re[1] + re[4], t1_im = im[1] + im[4];
+        NumericT t2_re = re[2] + re[3], t2_im = im[2] + im[3];
+        NumericT t3_re = re[1] - re[4], t3_im = im[1] - im[4];
+        NumericT t4_re = re[2] - re[3], t4_im = im[2] - im[3];
+
+        NumericT b1_re = re[0] + c1 * t1_re + c2 * t2_re, b1_im = im[0] + c1 * t1_im + c2 * t2_im;
+        NumericT b2_re = re[0] + c2 * t1_re + c1 * t2_re, b2_im = im[0] + c2 * t1_im + c1 * t2_im;
+        NumericT d1_re = s1 * t3_re + s2 * t4_re, d1_im = s1 * t3_im + s2 * t4_im;
+        NumericT d2_re = s2 * t3_re - s1 * t4_re, d2_im = s2 * t3_im - s1 * t4_im;
+
+        re[0] += t1_re + t2_re;  im[0] += t1_im + t2_im;
+        re[1] = b1_re + d1_im;   im[1] = b1_im - d1_re;   // b1 - i d1
+        re[4] = b1_re - d1_im;   im[4] = b1_im + d1_re;   // b1 + i d1
+        re[2] = b2_re + d2_im;   im[2] = b2_im - d2_re;   // b2 - i d2
+        re[3] = b2_re - d2_im;   im[3] = b2_im + d2_re;   // b2 + i d2
+      }
+    };
+
+    template<typename NumericT>
+    struct butterfly<8, NumericT>
+    {
+      static void apply(NumericT * re, NumericT * im)
+      {
+        NumericT const c = NumericT(0.707106781186547524400844362104849039);  // sqrt(1/2)
+
+        NumericT e_re[4] = { re[0], re[2], re[4], re[6] }, e_im[4] = { im[0], im[2], im[4], im[6] };
+        NumericT o_re[4] = { re[1], re[3], re[5], re[7] }, o_im[4] = { im[1], im[3], im[5], im[7] };
+        butterfly<4, NumericT>::apply(e_re, e_im);
+        butterfly<4, NumericT>::apply(o_re, o_im);
+
+        // multiply the odd part by exp(-i pi k / 4):
+        NumericT w1_re = c * (o_re[1] + o_im[1]), w1_im = c * (o_im[1] - o_re[1]);
+        NumericT w2_re = o_im[2],                 w2_im = -o_re[2];
+        NumericT w3_re = c * (o_im[3] - o_re[3]), w3_im = -c * (o_re[3] + o_im[3]);
+
+        re[0] = e_re[0] + o_re[0];  im[0] = e_im[0] + o_im[0];
+        re[4] = e_re[0] - o_re[0];  im[4] = e_im[0] - o_im[0];
+        re[1] = e_re[1] + w1_re;    im[1] = e_im[1] + w1_im;
+        re[5] = e_re[1] - w1_re;    im[5] = e_im[1] - w1_im;
+        re[2] = e_re[2] + w2_re;    im[2] = e_im[2] + w2_im;
+        re[6] = e_re[2] - w2_re;    im[6] = e_im[2] - w2_im;
+        re[3] = e_re[3] + w3_re;    im[3] = e_im[3] + w3_im;
+        re[7] = e_re[3] - w3_re;    im[7] = e_im[3] - w3_im;
+      }
+    };
+
+    /** @brief One pass of the Stockham autosort algorithm with radix RadixV for interleaved complex data.
+     *
+     * Each of the n / RadixV butterflies reads its inputs at distance n / RadixV from src, multiplies them with the precomputed twiddle factors,
+     * and writes the results at distance ns to dst, where ns is the product of the radices of the previous passes.
+     * The innermost loop runs over consecutive elements of src, dst and the twiddle table, so no bit reversal is required.
+     */
+    template<unsigned int RadixV, typename NumericT>
+    void stockham_pass(NumericT const * src, NumericT * dst, NumericT const * twiddles,
+                       vcl_size_t n, vcl_size_t ns, bool parallel)
+    {
+      vcl_size_t distance = n / RadixV;
+      vcl_size_t blocks   = distance / ns;
+
+      (void)parallel;
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if (parallel && n > VIENNACL_OPENMP_FFT_MIN_SIZE)
+#endif
+      for (long block2 = 0; block2 < long(blocks); ++block2)
+      {
+        vcl_size_t block = vcl_size_t(block2);
+        NumericT re[RadixV];
+        NumericT im[RadixV];
+        for (vcl_size_t k = 0; k < ns; ++k)
+        {
+          vcl_size_t j = block * ns + k;
+
+          re[0] = src[2 * j];
+          im[0] = src[2 * j + 1];
+          for (vcl_size_t r = 1; r < RadixV; ++r)
+          {
+            NumericT x_re = src[2 * (j + r * distance)];
+            NumericT x_im = src[2 * (j + r * distance) + 1];
+            NumericT w_re = twiddles[2 * ((r - 1) * ns + k)];
+            NumericT w_im = twiddles[2 * ((r - 1) * ns + k) + 1];
+            re[r] = x_re * w_re - x_im * w_im;
+            im[r] = x_re * w_im + x_im * w_re;
+          }
+
+          butterfly<RadixV, NumericT>::apply(re, im);
+
+          vcl_size_t out = block * ns * RadixV + k;
+          for (vcl_size_t r = 0; r < RadixV; ++r)
+          {
+            dst[2 * (out + r * ns)]     = re[r];
+            dst[2 * (out + r * ns) + 1] = im[r];
+          }
+        }
+      }
+    }
+
+    /** @brief Precomputed data for repeated Fourier transforms of a fixed size on the host.
+     *
+     * Sizes with prime factors 2, 3 and 5 only are decomposed into passes of radix 8, 4, 2, 3 and 5 of the Stockham algorithm.
+     * All other sizes use Bluestein's algorithm, for which the chirp and the spectrum of the convolution kernel are precomputed.
+     * The twiddle factors of all passes are tabulated once, so no trigonometric functions are evaluated when the plan is executed.
+     */
+    template<typename NumericT>
+    class plan
+    {
+    public:
+      explicit plan(vcl_size_t size = 0) { init(size); }
+
+      /** @brief Returns the length of the transformed sequences */
+      vcl_size_t size() const { return size_; }
+
+      /** @brief Returns true if the size is not a product of the supported radices and Bluestein's algorithm is used */
+      bool uses_bluestein() const { return size_ != core_size_; }
+
+      /** @brief Returns the radices of the passes of the underlying Stockham algorithm */
+      std::vector<vcl_size_t> const & radices() const { return radices_; }
+
+      /** @brief Returns the number of scalars of the buffers passed to transform() */
+      vcl_size_t workspace_size() const { return 2 * core_size_; }
+
+      /** @brief Forward transform (negative sign in the exponent) of a single contiguous interleaved complex sequence.
+       *
+       * @param x         The sequence, padded to workspace_size() scalars
+       * @param work      Temporary buffer of workspace_size() scalars
+       * @param parallel  Whether the passes may use OpenMP, i.e. the function is not called from within a parallel region
+       */
+      void transform(NumericT * x, NumericT * work, bool parallel) const
+      {
+        if (size_ <= 1)
+          return;
+
+        if (!uses_bluestein())
+        {
+          stockham(x, work, parallel);
+          return;
+        }
+
+        // X_k = w_k * sum_j (x_j w_j) conj(w_{k-j}), the convolution is computed with transforms of length core_size_:
+        for (vcl_size_t k = 0; k < size_; ++k)
+        {
+          NumericT x_re = x[2 * k], x_im = x[2 * k + 1];
+          x[2 * k]     = x_re * chirp_[2 * k] - x_im * chirp_[2 * k + 1];
+          x[2 * k + 1] = x_re * chirp_[2 * k + 1] + x_im * chirp_[2 * k];
+        }
+        std::fill(x + 2 * size_, x + 2 * core_size_, NumericT(0));
+
+        stockham(x, work, parallel);
+
+        // multiply with the kernel spectrum and conjugate, so that the inverse transform is a forward transform:
+        for (vcl_size_t k = 0; k < core_size_; ++k)
+        {
+          NumericT x_re = x[2 * k], x_im = x[2 * k + 1];
+          x[2 * k]     =   x_re * chirp_spectrum_[2 * k] - x_im * chirp_spectrum_[2 * k + 1];
+          x[2 * k + 1] = -(x_re * chirp_spectrum_[2 * k + 1] + x_im * chirp_spectrum_[2 * k]);
+        }
+
+        stockham(x, work, parallel);
+
+        for (vcl_size_t k = 0; k < size_; ++k)
+        {
+          NumericT x_re = x[2 * k], x_im = -x[2 * k + 1];
+          x[2 * k]     = x_re * chirp_[2 * k] - x_im * chirp_[2 * k + 1];
+          x[2 * k + 1] = x_re * chirp_[2 * k + 1] + x_im * chirp_[2 * k];
+        }
+      }
+
+      /** @brief Transforms batch_num interleaved complex sequences in place.
+       *
+       * @param data        Interleaved complex data (real and imaginary part of each entry stored consecutively)
+       * @param batch_num   Number of sequences
+       * @param stride      Distance of consecutive sequences (row-major) or of consecutive entries of a sequence (column-major) in complex entries
+       * @param sign        Sign of the exponent
+       * @param data_order  Layout of the sequences in data
+       */
+      void execute(NumericT * data, vcl_size_t batch_num, vcl_size_t stride, NumericT sign,
+                   FFT_DATA_ORDER::DATA_ORDER data_order = FFT_DATA_ORDER::ROW_MAJOR) const
+      {
+        if (size_ <= 1)
+          return;
+
+        if (data_order == FFT_DATA_ORDER::COL_MAJOR)
+        {
+          execute_columns(data, batch_num, stride, 1, 0, sign);
+          return;
+        }
+
+        // the transform with positive sign is the conjugate of the transform of the conjugate:
+        NumericT conj = (sign > 0) ? NumericT(-1) : NumericT(1);
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel if (batch_num > 1 && batch_num * size_ > VIENNACL_OPENMP_FFT_MIN_SIZE)
+#endif
+        {
+          std::vector<NumericT> buffer(workspace_size());
+          std::vector<NumericT> work(workspace_size());
+
+#ifdef VIENNACL_WITH_OPENMP
+          bool parallel = (batch_num == 1) && !omp_in_parallel();
+          #pragma omp for
+#else
+          bool parallel = false;
+#endif
+          for (long batch_id2 = 0; batch_id2 < long(batch_num); ++batch_id2)
+          {
+            vcl_size_t batch_id = vcl_size_t(batch_id2);
+            NumericT * x = data + 2 * batch_id * stride;
+            for (vcl_size_t i = 0; i < size_; ++i)
+            {
+              buffer[2 * i]     = x[2 * i];
+              buffer[2 * i + 1] = conj * x[2 * i + 1];
+            }
+
+            transform(&buffer[0], &work[0], parallel);
+
+            for (vcl_size_t i = 0; i < size_; ++i)
+            {
+              x[2 * i]     = buffer[2 * i];
+              x[2 * i + 1] = conj * buffer[2 * i + 1];
+            }
+          }
+        }
+      }
+
+      /** @brief Transforms strided sequences of interleaved complex data in place, e.g. the columns of a row-major matrix.
+       *
+       * Sequence j of block o consists of the complex entries o * block_stride + i * elem_stride + j for i = 0, ..., size()-1 and j < column_num.
+       * Tiles of VIENNACL_FFT_TILE_SIZE adjacent sequences are gathered row by row into a contiguous buffer, transformed there and scattered back,
+       * so the data is traversed along cache lines rather than with stride elem_stride.
+       *
+       * @param data          Interleaved complex data
+       * @param column_num    Number of adjacent sequences in each block
+       * @param elem_stride   Distance of consecutive entries of a sequence in complex entries
+       * @param block_num     Number of blocks
+       * @param block_stride  Distance of consecutive blocks in complex entries
+       * @param sign          Sign of the exponent
+       */
+      void execute_columns(NumericT * data, vcl_size_t column_num, vcl_size_t elem_stride,
+                           vcl_size_t block_num, vcl_size_t block_stride, NumericT sign) const
+      {
+        if (size_ <= 1)
+          return;
+
+        NumericT conj = (sign > 0) ? NumericT(-1) : NumericT(1);
+        vcl_size_t tile_size = VIENNACL_FFT_TILE_SIZE;
+        vcl_size_t tiles_per_block = (column_num + tile_size - 1) / tile_size;
+        vcl_size_t tile_num = block_num * tiles_per_block;
+        vcl_size_t ws = workspace_size();
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel if (tile_num > 1 && block_num * column_num * size_ > VIENNACL_OPENMP_FFT_MIN_SIZE)
+#endif
+        {
+          std::vector<NumericT> buffer(tile_size * ws);
+          std::vector<NumericT> work(ws);
+
+#ifdef VIENNACL_WITH_OPENMP
+          bool parallel = (tile_num == 1) && !omp_in_parallel();
+          #pragma omp for
+#else
+          bool parallel = false;
+#endif
+          for (long tile_id2 = 0; tile_id2 < long(tile_num); ++tile_id2)
+          {
+            vcl_size_t tile_id = vcl_size_t(tile_id2);
+            vcl_size_t col_start = (tile_id % tiles_per_block) * tile_size;
+            vcl_size_t width = std::min(tile_size, column_num - col_start);
+            NumericT * x = data + 2 * ((tile_id / tiles_per_block) * block_stride + col_start);
+
+            for (vcl_size_t i = 0; i < size_; ++i)
+            {
+              NumericT const * row = x + 2 * i * elem_stride;
+              for (vcl_size_t j = 0; j < width; ++j)
+              {
+                buffer[j * ws + 2 * i]     = row[2 * j];
+                buffer[j * ws + 2 * i + 1] = conj * row[2 * j + 1];
+              }
+            }
+
+            for (vcl_size_t j = 0; j < width; ++j)
+              transform(&buffer[j * ws], &work[0], parallel);
+
+            for (vcl_size_t i = 0; i < size_; ++i)
+            {
+              NumericT * row = x + 2 * i * elem_stride;
+              for (vcl_size_t j = 0; j < width; ++j)
+              {
+                row[2 * j]     = buffer[j * ws + 2 * i];
+                row[2 * j + 1] = conj * buffer[j * ws + 2 * i + 1];
+              }
+            }
+          }
+        }
+      }
+
+    private:
+      void init(vcl_size_t size)
+      {
+        size_ = size;
+        core_size_ = size;
+        radices_.clear();
+        twiddles_.clear();
+        twiddle_offsets_.clear();
+        chirp_.clear();
+        chirp_spectrum_.clear();
+
+        if (size <= 1)
+          return;
+
+        if (!factorize(size))
+        {
+          core_size_ = next_power_2(2 * size - 1);
+          factorize(core_size_);
+        }
+
+        // twiddle factors exp(-2 pi i r k / (ns * p)) for each pass, computed in double precision:
+        double const NUM_PI = 3.14159265358979323846;
+        vcl_size_t ns = 1;
+        for (vcl_size_t s = 0; s < radices_.size(); ++s)
+        {
+          vcl_size_t p = radices_[s];
+          twiddle_offsets_.push_back(twiddles_.size());
+          for (vcl_size_t r = 1; r < p; ++r)
+            for (vcl_size_t k = 0; k < ns; ++k)
+            {
+              double angle = -2.0 * NUM_PI * double(r * k) / double(ns * p);
+              twiddles_.push_back(NumericT(std::cos(angle)));
+              twiddles_.push_back(NumericT(std::sin(angle)));
+            }
+          ns *= p;
+        }
+
+        if (uses_bluestein())
+        {
+          // chirp w_k = exp(-pi i k^2 / n), using k^2 mod 2n to retain accuracy for large k:
+          chirp_.resize(2 * size_);
+          for (vcl_size_t k = 0; k < size_; ++k)
+          {
+            double angle = -NUM_PI * double((k * k) % (2 * size_)) / double(size_);
+            chirp_[2 * k]     = NumericT(std::cos(angle));
+            chirp_[2 * k + 1] = NumericT(std::sin(angle));
+          }
+
+          // spectrum of the convolution kernel conj(w_k), scaled by the normalization of the inverse transform:
+          chirp_spectrum_.resize(2 * core_size_, NumericT(0));
+          for (vcl_size_t k = 0; k < size_; ++k)
+          {
+            chirp_spectrum_[2 * k]     =  chirp_[2 * k];
+            chirp_spectrum_[2 * k + 1] = -chirp_[2 * k + 1];
+            if (k > 0)
+            {
+              chirp_spectrum_[2 * (core_size_ - k)]     =  chirp_[2 * k];
+              chirp_spectrum_[2 * (core_size_ - k) + 1] = -chirp_[2 * k + 1];
+            }
+          }
+          std::vector<NumericT> work(2 * core_size_);
+          stockham(&chirp_spectrum_[0], &work[0], false);
+          for (vcl_size_t i = 0; i < 2 * core_size_; ++i)
+            chirp_spectrum_[i] /= NumericT(core_size_);
+        }
+      }
+
+      /** @brief Decomposes n into the supported radices, preferring radix 8 and 4 for powers of two. Returns false if n has other prime factors. */
+      bool factorize(vcl_size_t n)
+      {
+        radices_.clear();
+        while (n % 8 == 0) { radices_.push_back(8); n /= 8; }
+        if    (n % 4 == 0) { radices_.push_back(4); n /= 4; }
+        if    (n % 2 == 0) { radices_.push_back(2); n /= 2; }
+        while (n % 3 == 0) { radices_.push_back(3); n /= 3; }
+        while (n % 5 == 0) { radices_.push_back(5); n /= 5; }
+        return n == 1;
+      }
+
+      /** @brief Forward transform of length core_size_ of the data in x, using work as temporary buffer */
+      void stockham(NumericT * x, NumericT * work, bool parallel) const
+      {
+        NumericT * src = x;
+        NumericT * dst = work;
+        vcl_size_t ns = 1;
+        for (vcl_size_t s = 0; s < radices_.size(); ++s)
+        {
+          NumericT const * tw = twiddles_.size() > 0 ? &twiddles_[twiddle_offsets_[s]] : NULL;
+          switch (radices_[s])
+          {
+          case 2: stockham_pass<2>(src, dst, tw, core_size_, ns, parallel); break;
+          case 3: stockham_pass<3>(src, dst, tw, core_size_, ns, parallel); break;
+          case 4: stockham_pass<4>(src, dst, tw, core_size_, ns, parallel); break;
+          case 5: stockham_pass<5>(src, dst, tw, core_size_, ns, parallel); break;
+          default: stockham_pass<8>(src, dst, tw, core_size_, ns, parallel); break;
+          }
+          ns *= radices_[s];
+          std::swap(src, dst);
+        }
+        if (src != x)
+          std::copy(src, src + 2 * core_size_, x);
+      }
+
+      vcl_size_t size_;
+      vcl_size_t core_size_;
+      std::vector<vcl_size_t> radices_;
+      std::vector<vcl_size_t> twiddle_offsets_;
+      std::vector<NumericT> twiddles_;
+      std::vector<NumericT> chirp_;
+      std::vector<NumericT> chirp_spectrum_;
+    };
+
+
+    /** @brief Precomputed data for repeated real-to-complex and complex-to-real Fourier transforms of a fixed size on the host.
+     *
+     * The transform of a real sequence of length n is Hermitian, so only the entries 0, ..., n/2 of the spectrum are stored.
+     * For even n, the real sequence is transformed as a complex sequence of length n/2 holding the even entries in the real parts and the odd entries in the imaginary parts,
+     * from which the spectrum is recovered by a post-processing pass. Odd n use a complex transform of length n.
+     */
+    template<typename NumericT>
+    class real_plan
+    {
+    public:
+      explicit real_plan(vcl_size_t size = 0) : size_(size), complex_plan_((size % 2 == 0) ? size / 2 : size)
+      {
+        if (size_ % 2 == 0)
+        {
+          // twiddle factors exp(-2 pi i k / n) for k = 0, ..., n/2:
+          double const NUM_PI = 3.14159265358979323846;
+          twiddles_.resize(size_ + 2);
+          for (vcl_size_t k = 0; k <= size_ / 2; ++k)
+          {
+            double angle = -2.0 * NUM_PI * double(k) / double(size_);
+            twiddles_[2 * k]     = NumericT(std::cos(angle));
+            twiddles_[2 * k + 1] = NumericT(std::sin(angle));
+          }
+        }
+      }
+
+      /** @brief Returns the length of the real sequences */
+      vcl_size_t size() const { return size_; }
+
+      /** @brief Returns the number of complex entries of the Hermitian-packed spectrum */
+      vcl_size_t packed_size() const { return size_ / 2 + 1; }
+
+      /** @brief Real-to-complex transform (negative sign in the exponent) of batch_num sequences.
+       *
+       * @param in        Real input, sequence b starts at in + b * in_dist
+       * @param in_dist   Distance of consecutive input sequences in scalars
+       * @param out       Interleaved complex output of packed_size() entries per sequence, sequence b starts at out + 2 * b * out_dist
+       * @param out_dist  Distance of consecutive output sequences in complex entries
+       * @param batch_num Number of sequences
+       */
+      void forward(NumericT const * in, vcl_size_t in_dist, NumericT * out, vcl_size_t out_dist, vcl_size_t batch_num) const
+      {
+        if (size_ == 0)
+          return;
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel if (batch_num > 1 && batch_num * size_ > VIENNACL_OPENMP_FFT_MIN_SIZE)
+#endif
+        {
+          std::vector<NumericT> buffer(complex_plan_.workspace_size());
+          std::vector<NumericT> work(complex_plan_.workspace_size());
+
+#ifdef VIENNACL_WITH_OPENMP
+          bool parallel = (batch_num == 1) && !omp_in_parallel();
+          #pragma omp for
+#else
+          bool parallel = false;
+#endif
+          for (long batch_id2 = 0; batch_id2 < long(batch_num); ++batch_id2)
+          {
+            vcl_size_t batch_id = vcl_size_t(batch_id2);
+            NumericT const * x = in + batch_id * in_dist;
+            NumericT * X = out + 2 * batch_id * out_dist;
+
+            if (size_ % 2 == 1)
+            {
+              for (vcl_size_t j = 0; j < size_; ++j)
+              {
+                buffer[2 * j]     = x[j];
+                buffer[2 * j + 1] = 0;
+              }
+              complex_plan_.transform(&buffer[0], &work[0], parallel);
+              std::copy(buffer.begin(), buffer.begin() + 2 * packed_size(), X);
+              continue;
+            }
+
+            // even and odd entries as real and imaginary parts of a sequence of half length:
+            vcl_size_t h = size_ / 2;
+            std::copy(x, x + size_, buffer.begin());
+            complex_plan_.transform(&buffer[0], &work[0], parallel);
+
+            // X_k = E_k + exp(-2 pi i k / n) O_k with E_k = (Z_k + conj(Z_{h-k})) / 2 and O_k = (Z_k - conj(Z_{h-k})) / (2i):
+            for (vcl_size_t k = 0; k <= h; ++k)
+            {
+              vcl_size_t k1 = (k == h) ? 0 : k;
+              vcl_size_t k2 = (k == 0) ? 0 : h - k;
+              NumericT z1_re = buffer[2 * k1], z1_im = buffer[2 * k1 + 1];
+              NumericT z2_re = buffer[2 * k2], z2_im = -buffer[2 * k2 + 1];
+              NumericT e_re = NumericT(0.5) * (z1_re + z2_re), e_im = NumericT(0.5) * (z1_im + z2_im);
+              NumericT o_re = NumericT(0.5) * (z1_im - z2_im), o_im = NumericT(0.5) * (z2_re - z1_re);
+              NumericT w_re = twiddles_[2 * k], w_im = twiddles_[2 * k + 1];
+              X[2 * k]     = e_re + w_re * o_re - w_im * o_im;
+              X[2 * k + 1] = e_im + w_re * o_im + w_im * o_re;
+            }
+          }
+        }
+      }
+
+      /** @brief Complex-to-real transform (positive sign in the exponent, without normalization) of batch_num Hermitian-packed spectra.
+       *
+       * @param in        Interleaved complex input of packed_size() entries per sequence, sequence b starts at in + 2 * b * in_dist
+       * @param in_dist   Distance of consecutive input sequences in complex entries
+       * @param out       Real output, sequence b starts at out + b * out_dist
+       * @param out_dist  Distance of consecutive output sequences in scalars
+       * @param batch_num Number of sequences
+       */
+      void backward(NumericT const * in, vcl_size_t in_dist, NumericT * out, vcl_size_t out_dist, vcl_size_t batch_num) const
+      {
+        if (size_ == 0)
+          return;
+
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel if (batch_num > 1 && batch_num * size_ > VIENNACL_OPENMP_FFT_MIN_SIZE)
+#endif
+        {
+          std::vector<NumericT> buffer(complex_plan_.workspace_size());
+          std::vector<NumericT> work(complex_plan_.workspace_size());
+
+#ifdef VIENNACL_WITH_OPENMP
+          bool parallel = (batch_num == 1) && !omp_in_parallel();
+          #pragma omp for
+#else
+          bool parallel = false;
+#endif
+          for (long batch_id2 = 0; batch_id2 < long(batch_num); ++batch_id2)
+          {
+            vcl_size_t batch_id = vcl_size_t(batch_id2);
+            NumericT const * X = in + 2 * batch_id * in_dist;
+            NumericT * x = out + batch_id * out_dist;
+
+            // the inverse transform is computed as the conjugate of the forward transform of the conjugate:
+            if (size_ % 2 == 1)
+            {
+              for (vcl_size_t k = 0; k < packed_size(); ++k)
+              {
+                buffer[2 * k]     =  X[2 * k];
+                buffer[2 * k + 1] = -X[2 * k + 1];
+                if (k > 0)
+                {
+                  buffer[2 * (size_ - k)]     = X[2 * k];
+                  buffer[2 * (size_ - k) + 1] = X[2 * k + 1];
+                }
+              }
+              complex_plan_.transform(&buffer[0], &work[0], parallel);
+              for (vcl_size_t j = 0; j < size_; ++j)
+                x[j] = buffer[2 * j];
+              continue;
+            }
+
+            // Z_k = E_k + i O_k with E_k = X_k + conj(X_{h-k}) and O_k = (X_k - conj(X_{h-k})) exp(2 pi i k / n):
+            vcl_size_t h = size_ / 2;
+            for (vcl_size_t k = 0; k < h; ++k)
+            {
+              NumericT x1_re = X[2 * k], x1_im = X[2 * k + 1];
+              NumericT x2_re = X[2 * (h - k)], x2_im = -X[2 * (h - k) + 1];
+              NumericT d_re = x1_re - x2_re, d_im = x1_im - x2_im;
+              NumericT w_re = twiddles_[2 * k], w_im = -twiddles_[2 * k + 1];
+              NumericT o_re = d_re * w_re - d_im * w_im, o_im = d_re * w_im + d_im * w_re;
+              buffer[2 * k]     =   x1_re + x2_re - o_im;
+              buffer[2 * k + 1] = -(x1_im + x2_im + o_re);
+            }
+            complex_plan_.transform(&buffer[0], &work[0], parallel);
+            for (vcl_size_t j = 0; j < h; ++j)
+            {
+              x[2 * j]     =  buffer[2 * j];
+              x[2 * j + 1] = -buffer[2 * j + 1];
+            }
+          }
+        }
+      }
+
+    private:
+      vcl_size_t size_;
+      plan<NumericT> complex_plan_;
+      std::vector<NumericT> twiddles_;
+    };
+
   } //namespace fft
 
 } //namespace detail
@@ -223,7 +879,7 @@ void fft_direct(std::complex<NumericT> * input_complex, std::complex<NumericT> *
           input = input_complex[batch_id * stride + n]; //input index here
         else
           input = input_complex[n * stride + batch_id];
-        NumericT arg = sign * 2 * NUM_PI * NumericT(k) / NumericT(size * n);
+        NumericT arg = sign * 2 * NUM_PI * NumericT((k * n) % size) / NumericT(size);
         NumericT sn  = std::sin(arg);
         NumericT cs  = std::cos(arg);
 
@@ -382,136 +1038,130 @@ void reorder(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>& in,
 }
 
 /**
- * @brief Radix-2 algorithm for computing Fourier transformation.
- * Kernel for computing smaller amount of data
+ * @brief Computes the Fourier transform of batch_num consecutive sequences stored in a vector in place, using a precomputed plan.
  */
 template<typename NumericT>
-void fft_radix2(std::complex<NumericT> * input_complex, vcl_size_t batch_num,
-                vcl_size_t bit_size, vcl_size_t size, vcl_size_t stride, NumericT sign,
-                viennacl::linalg::host_based::detail::fft::FFT_DATA_ORDER::DATA_ORDER data_order = viennacl::linalg::host_based::detail::fft::FFT_DATA_ORDER::ROW_MAJOR)
+void execute_plan(viennacl::linalg::host_based::detail::fft::plan<NumericT> const & p,
+                  viennacl::vector_base<NumericT> & in, vcl_size_t batch_num, NumericT sign = NumericT(-1))
 {
-  NumericT const NUM_PI = NumericT(3.14159265358979323846);
-
-  for (vcl_size_t step = 0; step < bit_size; step++)
-  {
-    vcl_size_t ss = 1 << step;
-    vcl_size_t half_size = size >> 1;
-
-#ifdef VIENNACL_WITH_OPENMP
-    #pragma omp parallel for
-#endif
-    for (long batch_id2 = 0; batch_id2 < long(batch_num); batch_id2++)
-    {
-      vcl_size_t batch_id = vcl_size_t(batch_id2);
-      for (vcl_size_t tid = 0; tid < half_size; tid++)
-      {
-        vcl_size_t group = (tid & (ss - 1));
-        vcl_size_t pos = ((tid >> step) << (step + 1)) + group;
-        std::complex<NumericT> in1;
-        std::complex<NumericT> in2;
-        vcl_size_t offset;
-        if (!data_order)
-        {
-          offset = batch_id * stride + pos;
-          in1 = input_complex[offset];
-          in2 = input_complex[offset + ss];
-        }
-        else
-        {
-          offset = pos * stride + batch_id;
-          in1 = input_complex[offset];
-          in2 = input_complex[offset + ss * stride];
-        }
-        NumericT arg = NumericT(group) * sign * NUM_PI / NumericT(ss);
-        NumericT sn = std::sin(arg);
-        NumericT cs = std::cos(arg);
-        std::complex<NumericT> ex(cs, sn);
-        std::complex<NumericT> tmp(in2.real() * ex.real() - in2.imag() * ex.imag(),
-                                   in2.real() * ex.imag() + in2.imag() * ex.real());
-        if (!data_order)
-          input_complex[offset + ss] = in1 - tmp;
-        else
-          input_complex[offset + ss * stride] = in1 - tmp;
-        input_complex[offset] = in1 + tmp;
-      }
-    }
-  }
+  NumericT * data = detail::extract_raw_pointer<NumericT>(in) + viennacl::traits::start(in);
+  p.execute(data, batch_num, p.size(), sign);
+}
 
+/**
+ * @brief Real-to-complex transform of batch_num consecutive real sequences stored in a vector, using a precomputed plan.
+ *
+ * The Hermitian-packed spectra of plan.packed_size() complex entries each are stored consecutively in out.
+ */
+template<typename NumericT>
+void rfft(viennacl::linalg::host_based::detail::fft::real_plan<NumericT> const & p,
+          viennacl::vector_base<NumericT> const & in, viennacl::vector_base<NumericT> & out, vcl_size_t batch_num)
+{
+  NumericT const * data_in  = detail::extract_raw_pointer<NumericT>(in) + viennacl::traits::start(in);
+  NumericT       * data_out = detail::extract_raw_pointer<NumericT>(out) + viennacl::traits::start(out);
+  p.forward(data_in, p.size(), data_out, p.packed_size(), batch_num);
 }
 
 /**
- * @brief Radix-2 algorithm for computing Fourier transformation.
- * Kernel for computing bigger amount of data
+ * @brief Complex-to-real transform (without normalization) of batch_num consecutive Hermitian-packed spectra stored in a vector, using a precomputed plan.
  */
 template<typename NumericT>
-void fft_radix2_local(std::complex<NumericT> * input_complex,
-                      std::complex<NumericT> * lcl_input, vcl_size_t batch_num, vcl_size_t bit_size,
-                      vcl_size_t size, vcl_size_t stride, NumericT sign,
-                      viennacl::linalg::host_based::detail::fft::FFT_DATA_ORDER::DATA_ORDER data_order = viennacl::linalg::host_based::detail::fft::FFT_DATA_ORDER::ROW_MAJOR)
+void irfft(viennacl::linalg::host_based::detail::fft::real_plan<NumericT> const & p,
+           viennacl::vector_base<NumericT> const & in, viennacl::vector_base<NumericT> & out, vcl_size_t batch_num)
 {
-  NumericT const NUM_PI = NumericT(3.14159265358979323846);
+  NumericT const * data_in  = detail::extract_raw_pointer<NumericT>(in) + viennacl::traits::start(in);
+  NumericT       * data_out = detail::extract_raw_pointer<NumericT>(out) + viennacl::traits::start(out);
+  p.backward(data_in, p.packed_size(), data_out, p.size(), batch_num);
+}
 
-  for (vcl_size_t batch_id = 0; batch_id < batch_num; batch_id++)
-  {
-#ifdef VIENNACL_WITH_OPENMP
-    #pragma omp parallel for
-#endif
-    for (long p2 = 0; p2 < long(size); p2 += 1)
-    {
-      vcl_size_t p = vcl_size_t(p2);
-      vcl_size_t v = viennacl::linalg::host_based::detail::fft::get_reorder_num(p, bit_size);
+/**
+ * @brief 2D real-to-complex transform of a row-major matrix.
+ *
+ * Each row is transformed by a real-to-complex transform, the resulting size2()/2 + 1 complex columns of out are transformed by complex transforms.
+ * The complex entries of out are stored interleaved, so out has 2 * (in.size2() / 2 + 1) columns.
+ */
+template<typename NumericT, unsigned int AlignmentV>
+void rfft(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> const & in,
+          viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>       & out)
+{
+  viennacl::linalg::host_based::detail::fft::real_plan<NumericT> row_plan(in.size2());
+  viennacl::linalg::host_based::detail::fft::plan<NumericT> col_plan(in.size1());
 
-      if (!data_order)
-        lcl_input[v] = input_complex[batch_id * stride + p]; //index
-      else
-        lcl_input[v] = input_complex[p * stride + batch_id];
-    }
+  NumericT const * data_in  = detail::extract_raw_pointer<NumericT>(in);
+  NumericT       * data_out = detail::extract_raw_pointer<NumericT>(out);
 
-    for (vcl_size_t s = 0; s < bit_size; s++)
-    {
-      vcl_size_t ss = 1 << s;
-#ifdef VIENNACL_WITH_OPENMP
-      #pragma omp parallel for
-#endif
-      for (long tid2 = 0; tid2 < long(size)/2; tid2++)
-      {
-        vcl_size_t tid = vcl_size_t(tid2);
-        vcl_size_t group = (tid & (ss - 1));
-        vcl_size_t pos = ((tid >> s) << (s + 1)) + group;
+  row_plan.forward(data_in, in.internal_size2(), data_out, out.internal_size2() / 2, in.size1());
+  col_plan.execute(data_out, row_plan.packed_size(), out.internal_size2() / 2, NumericT(-1),
+                   viennacl::linalg::host_based::detail::fft::FFT_DATA_ORDER::COL_MAJOR);
+}
 
-        std::complex<NumericT> in1 = lcl_input[pos];
-        std::complex<NumericT> in2 = lcl_input[pos + ss];
+/**
+ * @brief 2D complex-to-real transform (without normalization) of a row-major matrix holding the Hermitian-packed spectrum computed by rfft().
+ *
+ * The number of columns of the real result is given by out.size2(). The input is not modified.
+ */
+template<typename NumericT, unsigned int AlignmentV>
+void irfft(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> const & in,
+           viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>       & out)
+{
+  viennacl::linalg::host_based::detail::fft::real_plan<NumericT> row_plan(out.size2());
+  viennacl::linalg::host_based::detail::fft::plan<NumericT> col_plan(out.size1());
 
-        NumericT arg = NumericT(group) * sign * NUM_PI / NumericT(ss);
+  vcl_size_t packed_size = row_plan.packed_size();
+  std::vector<NumericT> tmp(2 * packed_size * out.size1());
 
-        NumericT sn = std::sin(arg);
-        NumericT cs = std::cos(arg);
-        std::complex<NumericT> ex(cs, sn);
+  NumericT const * data_in  = detail::extract_raw_pointer<NumericT>(in);
+  NumericT       * data_out = detail::extract_raw_pointer<NumericT>(out);
 
-        std::complex<NumericT> tmp(in2.real() * ex.real() - in2.imag() * ex.imag(),
-                                   in2.real() * ex.imag() + in2.imag() * ex.real());
+  for (vcl_size_t i = 0; i < out.size1(); ++i)
+    std::copy(data_in + i * in.internal_size2(), data_in + i * in.internal_size2() + 2 * packed_size, tmp.begin() + long(2 * i * packed_size));
 
-        lcl_input[pos + ss] = in1 - tmp;
-        lcl_input[pos] = in1 + tmp;
-      }
+  col_plan.execute(&tmp[0], packed_size, packed_size, NumericT(1),
+                   viennacl::linalg::host_based::detail::fft::FFT_DATA_ORDER::COL_MAJOR);
+  row_plan.backward(&tmp[0], packed_size, data_out, out.internal_size2(), out.size1());
+}
 
-    }
-#ifdef VIENNACL_WITH_OPENMP
-    #pragma omp parallel for
-#endif
-    //copy local array back to global memory
-    for (long p2 = 0; p2 < long(size); p2 += 1)
-    {
-      vcl_size_t p = vcl_size_t(p2);
-      if (!data_order)
-        input_complex[batch_id * stride + p] = lcl_input[p];
-      else
-        input_complex[p * stride + batch_id] = lcl_input[p];
+/**
+ * @brief 3D Fourier transformation in place of a volume stored as depth slabs of size1()/depth consecutive rows of a row-major matrix.
+ *
+ * Entry (z, y, x) of the volume is the complex entry x of row z * size1()/depth + y.
+ * Rows and columns of each slab are transformed while the slab is still in cache, the transforms along z use tiles of adjacent columns as well.
+ * A 2D transformation is obtained for depth == 1.
+ */
+template<typename NumericT, unsigned int AlignmentV>
+void fft_3d(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> & in, vcl_size_t depth, NumericT sign = NumericT(-1))
+{
+  assert(depth > 0 && in.size1() % depth == 0 && bool("Number of rows is not a multiple of the depth"));
 
-    }
+  vcl_size_t height = in.size1() / depth;
+  vcl_size_t width  = in.size2() >> 1;
+  vcl_size_t stride = in.internal_size2() >> 1;
+  NumericT * data = detail::extract_raw_pointer<NumericT>(in);
+
+  viennacl::linalg::host_based::detail::fft::plan<NumericT> x_plan(width);
+  viennacl::linalg::host_based::detail::fft::plan<NumericT> y_plan(height);
+
+  for (vcl_size_t z = 0; z < depth; ++z)
+  {
+    NumericT * slab = data + 2 * z * height * stride;
+    x_plan.execute(slab, height, stride, sign);
+    y_plan.execute_columns(slab, width, stride, 1, 0, sign);
+  }
 
+  if (depth > 1)
+  {
+    viennacl::linalg::host_based::detail::fft::plan<NumericT> z_plan(depth);
+    z_plan.execute_columns(data, width, height * stride, height, stride, sign);
   }
+}
 
+/**
+ * @brief 2D Fourier transformation in place of a row-major matrix of interleaved complex entries, for any number of rows and columns.
+ */
+template<typename NumericT, unsigned int AlignmentV>
+void fft_2d(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV> & in, NumericT sign = NumericT(-1))
+{
+  viennacl::linalg::host_based::fft_3d(in, 1, sign);
 }
 
 /**
@@ -526,25 +1176,8 @@ void radix2(viennacl::vector<NumericT, AlignmentV>& in, vcl_size_t size, vcl_siz
             vcl_size_t batch_num, NumericT sign = NumericT(-1),
             viennacl::linalg::host_based::detail::fft::FFT_DATA_ORDER::DATA_ORDER data_order = viennacl::linalg::host_based::detail::fft::FFT_DATA_ORDER::ROW_MAJOR)
 {
-
-  vcl_size_t bit_size = viennacl::linalg::host_based::detail::fft::num_bits(size);
-
-  std::vector<std::complex<NumericT> > input_complex(size * batch_num);
-  std::vector<std::complex<NumericT> > lcl_input(size * batch_num);
-  viennacl::linalg::host_based::detail::fft::copy_to_complex_array(&input_complex[0], in, size * batch_num);
-
-  if (size <= viennacl::linalg::host_based::detail::fft::MAX_LOCAL_POINTS_NUM)
-  {
-    viennacl::linalg::host_based::fft_radix2_local(&input_complex[0], &lcl_input[0], batch_num, bit_size, size, stride, sign, data_order);
-  }
-  else
-  {
-    viennacl::linalg::host_based::reorder<NumericT>(in, size, stride, bit_size, batch_num, data_order);
-    viennacl::linalg::host_based::detail::fft::copy_to_complex_array(&input_complex[0], in, size * batch_num);
-    viennacl::linalg::host_based::fft_radix2(&input_complex[0], batch_num, bit_size, size, stride, sign, data_order);
-  }
-
-  viennacl::linalg::host_based::detail::fft::copy_to_vector(&input_complex[0], in, size * batch_num);
+  viennacl::linalg::host_based::detail::fft::plan<NumericT> p(size);
+  p.execute(detail::extract_raw_pointer<NumericT>(in), batch_num, stride, sign, data_order);
 }
 
 /**
@@ -559,122 +1192,26 @@ void radix2(viennacl::matrix<NumericT, viennacl::row_major, AlignmentV>& in, vcl
             vcl_size_t stride, vcl_size_t batch_num, NumericT sign = NumericT(-1),
             viennacl::linalg::host_based::detail::fft::FFT_DATA_ORDER::DATA_ORDER data_order = viennacl::linalg::host_based::detail::fft::FFT_DATA_ORDER::ROW_MAJOR)
 {
-
-  vcl_size_t bit_size = viennacl::linalg::host_based::detail::fft::num_bits(size);
-
-  NumericT * data = detail::extract_raw_pointer<NumericT>(in);
-
-  vcl_size_t row_num = in.internal_size1();
-  vcl_size_t col_num = in.internal_size2() >> 1;
-  vcl_size_t size_mat = row_num * col_num;
-
-  std::vector<std::complex<NumericT> > input_complex(size_mat);
-
-  viennacl::linalg::host_based::detail::fft::copy_to_complex_array(&input_complex[0], data, size_mat);
-  if (size <= viennacl::linalg::host_based::detail::fft::MAX_LOCAL_POINTS_NUM)
-  {
-    //std::cout<<bit_size<<","<<size<<","<<stride<<","<<batch_num<<","<<size<<","<<sign<<","<<data_order<<std::endl;
-    std::vector<std::complex<NumericT> > lcl_input(size_mat);
-    viennacl::linalg::host_based::fft_radix2_local(&input_complex[0], &lcl_input[0], batch_num, bit_size, size, stride, sign, data_order);
-  }
-  else
-  {
-    viennacl::linalg::host_based::reorder<NumericT>(in, size, stride, bit_size, batch_num, data_order);
-    viennacl::linalg::host_based::detail::fft::copy_to_complex_array(&input_complex[0], data, size_mat);
-    viennacl::linalg::host_based::fft_radix2(&input_complex[0], batch_num, bit_size, size, stride, sign, data_order);
-  }
-
-  viennacl::linalg::host_based::detail::fft::copy_to_vector(&input_complex[0], data, size_mat);
-
+  viennacl::linalg::host_based::detail::fft::plan<NumericT> p(size);
+  p.execute(detail::extract_raw_pointer<NumericT>(in), batch_num, stride, sign, data_order);
 }
 
 /**
  * @brief Bluestein's algorithm for computing Fourier transformation.
  *
- * Currently,  Works only for sizes of input data which less than 2^16.
- * Uses a lot of additional memory, but should be fast for any size of data.
- * Serial implementation has something about o(n * lg n) complexity
+ * Works for any size of input data, the chirp and the spectrum of the convolution kernel are set up by the plan.
  */
 template<typename NumericT, unsigned int AlignmentV>
 void bluestein(viennacl::vector<NumericT, AlignmentV>& in, viennacl::vector<NumericT, AlignmentV>& out, vcl_size_t /*batch_num*/)
 {
-
   vcl_size_t size = in.size() >> 1;
-  vcl_size_t ext_size = viennacl::linalg::host_based::detail::fft::next_power_2(2 * size - 1);
-
-  viennacl::vector<NumericT, AlignmentV> A(ext_size << 1);
-  viennacl::vector<NumericT, AlignmentV> B(ext_size << 1);
-  viennacl::vector<NumericT, AlignmentV> Z(ext_size << 1);
-
-  std::vector<std::complex<NumericT> > input_complex(size);
-  std::vector<std::complex<NumericT> > output_complex(size);
-
-  std::vector<std::complex<NumericT> > A_complex(ext_size);
-  std::vector<std::complex<NumericT> > B_complex(ext_size);
-  std::vector<std::complex<NumericT> > Z_complex(ext_size);
-
-  viennacl::linalg::host_based::detail::fft::copy_to_complex_array(&input_complex[0], in, size);
-#ifdef VIENNACL_WITH_OPENMP
-  #pragma omp parallel for
-#endif
-  for (long i2 = 0; i2 < long(ext_size); i2++)
-  {
-    vcl_size_t i = vcl_size_t(i2);
-    A_complex[i] = 0;
-    B_complex[i] = 0;
-  }
-
-  vcl_size_t double_size = size << 1;
-
-  NumericT const NUM_PI = NumericT(3.14159265358979323846);
-#ifdef VIENNACL_WITH_OPENMP
-  #pragma omp parallel for
-#endif
-  for (long i2 = 0; i2 < long(size); i2++)
-  {
-    vcl_size_t i = vcl_size_t(i2);
-    vcl_size_t rm = i * i % (double_size);
-    NumericT angle = NumericT(rm) / NumericT(size) * NumericT(NUM_PI);
-
-    NumericT sn_a = std::sin(-angle);
-    NumericT cs_a = std::cos(-angle);
 
-    std::complex<NumericT> a_i(cs_a, sn_a);
-    std::complex<NumericT> b_i(cs_a, -sn_a);
-
-    A_complex[i] = std::complex<NumericT>(input_complex[i].real() * a_i.real() - input_complex[i].imag() * a_i.imag(),
-                                          input_complex[i].real() * a_i.imag() + input_complex[i].imag() * a_i.real());
-    B_complex[i] = b_i;
-
-    // very bad instruction, to be fixed
-    if (i)
-      B_complex[ext_size - i] = b_i;
-  }
-
-  viennacl::linalg::host_based::detail::fft::copy_to_vector(&input_complex[0], in, size);
-  viennacl::linalg::host_based::detail::fft::copy_to_vector(&A_complex[0], A, ext_size);
-  viennacl::linalg::host_based::detail::fft::copy_to_vector(&B_complex[0], B, ext_size);
-
-  viennacl::linalg::convolve_i(A, B, Z);
-
-  viennacl::linalg::host_based::detail::fft::copy_to_complex_array(&Z_complex[0], Z, ext_size);
-
-#ifdef VIENNACL_WITH_OPENMP
-  #pragma omp parallel for
-#endif
-  for (long i2 = 0; i2 < long(size); i2++)
-  {
-    vcl_size_t i = vcl_size_t(i2);
-    vcl_size_t rm = i * i % (double_size);
-    NumericT angle = NumericT(rm) / NumericT(size) * NumericT(-NUM_PI);
-    NumericT sn_a = std::sin(angle);
-    NumericT cs_a = std::cos(angle);
-    std::complex<NumericT> b_i(cs_a, sn_a);
-    output_complex[i] = std::complex<NumericT>(Z_complex[i].real() * b_i.real() - Z_complex[i].imag() * b_i.imag(),
-                                               Z_complex[i].real() * b_i.imag() + Z_complex[i].imag() * b_i.real());
-  }
-  viennacl::linalg::host_based::detail::fft::copy_to_vector(&output_complex[0], out, size);
+  NumericT const * data_in  = detail::extract_raw_pointer<NumericT>(in);
+  NumericT       * data_out = detail::extract_raw_pointer<NumericT>(out);
+  std::copy(data_in, data_in + 2 * size, data_out);
 
+  viennacl::linalg::host_based::detail::fft::plan<NumericT> p(size);
+  p.execute(data_out, 1, size, NumericT(-1));
 }
 
 /**
@@ -685,9 +1222,12 @@ void normalize(viennacl::vector<NumericT, AlignmentV> & input)
 {
   vcl_size_t size = input.size() >> 1;
   NumericT norm_factor = static_cast<NumericT>(size);
-  for (vcl_size_t i = 0; i < size * 2; i++)
-    input[i] /= norm_factor;
-
+  NumericT * data = detail::extract_raw_pointer<NumericT>(input);
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for if (size > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+  for (long i = 0; i < long(size * 2); i++)
+    data[i] /= norm_factor;
 }
 
 /**
@@ -700,26 +1240,23 @@ void multiply_complex(viennacl::vector<NumericT, AlignmentV> const & input1,
 {
   vcl_size_t size = input1.size() >> 1;
 
-  std::vector<std::complex<NumericT> > input1_complex(size);
-  std::vector<std::complex<NumericT> > input2_complex(size);
-  std::vector<std::complex<NumericT> > output_complex(size);
-  viennacl::linalg::host_based::detail::fft::copy_to_complex_array(&input1_complex[0], input1, size);
-  viennacl::linalg::host_based::detail::fft::copy_to_complex_array(&input2_complex[0], input2, size);
+  NumericT const * data1 = detail::extract_raw_pointer<NumericT>(input1);
+  NumericT const * data2 = detail::extract_raw_pointer<NumericT>(input2);
+  NumericT       * data3 = detail::extract_raw_pointer<NumericT>(output);
 
 #ifdef VIENNACL_WITH_OPENMP
-  #pragma omp parallel for
+  #pragma omp parallel for if (size > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
 #endif
   for (long i2 = 0; i2 < long(size); i2++)
   {
     vcl_size_t i = vcl_size_t(i2);
-    std::complex<NumericT> in1 = input1_complex[i];
-    std::complex<NumericT> in2 = input2_complex[i];
-    output_complex[i] = std::complex<NumericT>(in1.real() * in2.real() - in1.imag() * in2.imag(),
-                                               in1.real() * in2.imag() + in1.imag() * in2.real());
+    NumericT in1_re = data1[2 * i], in1_im = data1[2 * i + 1];
+    NumericT in2_re = data2[2 * i], in2_im = data2[2 * i + 1];
+    data3[2 * i]     = in1_re * in2_re - in1_im * in2_im;
+    data3[2 * i + 1] = in1_re * in2_im + in1_im * in2_re;
   }
-  viennacl::linalg::host_based::detail::fft::copy_to_vector(&output_complex[0], output, size);
-
 }
+
 /**
  * @brief Inplace transpose of matrix
  */
@@ -834,18 +1371,119 @@ void complex_to_real(viennacl::vector_base<NumericT> const & in,
 template<typename NumericT>
 void reverse(viennacl::vector_base<NumericT> & in)
 {
-  vcl_size_t size = in.size();
+  vcl_size_t size   = in.size();
+  vcl_size_t stride = viennacl::traits::stride(in);
+  NumericT * data = detail::extract_raw_pointer<NumericT>(in) + viennacl::traits::start(in);
 
 #ifdef VIENNACL_WITH_OPENMP
   #pragma omp parallel for if (size > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
 #endif
-  for (long i2 = 0; i2 < long(size); i2++)
+  for (long i2 = 0; i2 < long(size / 2); i2++)
+  {
+    vcl_size_t i = vcl_size_t(i2);
+    std::swap(data[i * stride], data[(size - i - 1) * stride]);
+  }
+}
+
+/**
+ * @brief Computes the first n entries of the circular convolutions of batch_num real sequences, zero-padded to the length of the plan, with a generator of precomputed spectrum.
+ *
+ * Entry i of sequence j is located at x[i * x_inc + j * x_dist] and y[i * y_inc + j * y_dist], respectively.
+ *
+ * @param p           Real-to-complex plan for the length of the circular convolution
+ * @param gen_hat     Hermitian-packed spectrum of the generator, scaled by 1/p.size()
+ * @param buffer      Workspace for the padded sequences, resized as needed
+ * @param buffer_hat  Workspace for their spectra, resized as needed
+ */
+template<typename NumericT>
+void circular_convolution(viennacl::linalg::host_based::detail::fft::real_plan<NumericT> const & p, NumericT const * gen_hat,
+                          NumericT const * x, vcl_size_t x_inc, vcl_size_t x_dist,
+                          NumericT       * y, vcl_size_t y_inc, vcl_size_t y_dist,
+                          vcl_size_t n, vcl_size_t batch_num,
+                          std::vector<NumericT> & buffer, std::vector<NumericT> & buffer_hat)
+{
+  vcl_size_t size        = p.size();
+  vcl_size_t packed_size = p.packed_size();
+
+  // process the sequences in chunks of about 32k scalars, such that the buffers of a chunk remain in cache:
+  vcl_size_t chunk_size = std::max<vcl_size_t>(1, std::min<vcl_size_t>(batch_num, 32768 / size));
+  buffer.resize(size * chunk_size);
+  buffer_hat.resize(2 * packed_size * chunk_size);
+
+  for (vcl_size_t chunk_start = 0; chunk_start < batch_num; chunk_start += chunk_size)
+  {
+    vcl_size_t chunk_num = std::min(chunk_size, batch_num - chunk_start);
+    NumericT const * x_chunk = x + chunk_start * x_dist;
+    NumericT       * y_chunk = y + chunk_start * y_dist;
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (n * chunk_num > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+    for (long i2 = 0; i2 < long(n); ++i2)
+    {
+      vcl_size_t i = vcl_size_t(i2);
+      for (vcl_size_t j = 0; j < chunk_num; ++j)
+        buffer[j * size + i] = x_chunk[i * x_inc + j * x_dist];
+    }
+    for (vcl_size_t j = 0; j < chunk_num; ++j)
+      std::fill(&buffer[0] + j * size + n, &buffer[0] + (j + 1) * size, NumericT(0));
+
+    p.forward(&buffer[0], size, &buffer_hat[0], packed_size, chunk_num);
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (packed_size * chunk_num > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+    for (long k2 = 0; k2 < long(packed_size); ++k2)
+    {
+      vcl_size_t k = vcl_size_t(k2);
+      for (vcl_size_t j = 0; j < chunk_num; ++j)
+      {
+        NumericT * b = &buffer_hat[2 * (j * packed_size + k)];
+        NumericT b_re = b[0], b_im = b[1];
+        b[0] = b_re * gen_hat[2 * k] - b_im * gen_hat[2 * k + 1];
+        b[1] = b_re * gen_hat[2 * k + 1] + b_im * gen_hat[2 * k];
+      }
+    }
+
+    p.backward(&buffer_hat[0], packed_size, &buffer[0], size, chunk_num);
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (n * chunk_num > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+    for (long i2 = 0; i2 < long(n); ++i2)
+    {
+      vcl_size_t i = vcl_size_t(i2);
+      for (vcl_size_t j = 0; j < chunk_num; ++j)
+        y_chunk[i * y_inc + j * y_dist] = buffer[j * size + i];
+    }
+  }
+}
+
+/**
+ * @brief Product of the Vandermonde matrix with rows (1, v_i, v_i^2, ...) with batch_num sequences, evaluated with Horner's scheme for all sequences at once.
+ *
+ * Entry i of sequence j is located at x[i * x_inc + j * x_dist] and y[i * y_inc + j * y_dist], respectively.
+ */
+template<typename NumericT>
+void vandermonde_prod(NumericT const * v, vcl_size_t v_inc,
+                      NumericT const * x, vcl_size_t x_inc, vcl_size_t x_dist,
+                      NumericT       * y, vcl_size_t y_inc, vcl_size_t y_dist,
+                      vcl_size_t n, vcl_size_t batch_num)
+{
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for if (n * n * batch_num > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+  for (long i2 = 0; i2 < long(n); ++i2)
   {
     vcl_size_t i = vcl_size_t(i2);
-    NumericT val1 = in[i];
-    NumericT val2 = in[size - i - 1];
-    in[i] = val2;
-    in[size - i - 1] = val1;
+    NumericT v_i = v[i * v_inc];
+    for (vcl_size_t j = 0; j < batch_num; ++j)
+    {
+      NumericT val = 0;
+      for (vcl_size_t k = n; k > 0; --k)
+        val = val * v_i + x[(k - 1) * x_inc + j * x_dist];
+      y[i * y_inc + j * y_dist] = val;
+    }
   }
 }
 
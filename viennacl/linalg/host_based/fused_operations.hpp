@@ -0,0 +1,567 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_FUSED_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_FUSED_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/fused_operations.hpp
+    @brief Fused evaluation of vector expression trees in a single loop using a plain single-threaded or OpenMP-enabled execution on CPU.
+
+    The expression tree is mapped to a nested evaluator at compile time, so entry i of an expression such as a*y + b*z - c*w or b - prod(A, x)
+    is computed by inlined code without temporaries. Optionally, the entries are reduced (sum, norms) within the same loop.
+*/
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "viennacl/forwards.h"
+#include "viennacl/tools/tools.hpp"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/start.hpp"
+#include "viennacl/traits/stride.hpp"
+#include "viennacl/traits/handle.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/vector_operations.hpp"  //for VIENNACL_REDUCE_MANY_CHUNK_SIZE
+#include "viennacl/linalg/detail/op_applier.hpp"
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+// Minimum vector size for using OpenMP on vector operations:
+#ifndef VIENNACL_OPENMP_VECTOR_MIN_SIZE
+  #define VIENNACL_OPENMP_VECTOR_MIN_SIZE  5000
+#endif
+
+namespace viennacl
+{
+namespace linalg
+{
+namespace host_based
+{
+namespace detail
+{
+  /** @brief Numeric types for which vector expressions are fused. Integer expressions keep using the individual kernels. */
+  template<typename NumericT>
+  struct fused_numeric_type { enum { value = 0 }; };
+
+  /** \cond */
+  template<> struct fused_numeric_type<float>  { enum { value = 1 }; };
+  template<> struct fused_numeric_type<double> { enum { value = 1 }; };
+  /** \endcond */
+
+
+  /** @brief Scalar factors in expressions such as alpha * x. Scalars are read once when the evaluator is set up. */
+  template<typename NumericT, typename ScalarT>
+  struct fused_scalar { enum { supported = 0 }; };
+
+  /** \cond */
+  template<typename NumericT>
+  struct fused_scalar<NumericT, NumericT>
+  {
+    enum { supported = 1 };
+    static NumericT value(NumericT s) { return s; }
+  };
+
+  template<typename NumericT>
+  struct fused_scalar<NumericT, viennacl::scalar<NumericT> >
+  {
+    enum { supported = 1 };
+    static NumericT value(viennacl::scalar<NumericT> const & s) { return s; }
+  };
+  /** \endcond */
+
+
+  /** @brief Element-wise binary operations which can be fused. */
+  template<typename OpT>
+  struct fused_element_binary { enum { supported = 0 }; };
+
+  /** \cond */
+  template<> struct fused_element_binary<op_prod> { enum { supported = 1 }; };
+  template<> struct fused_element_binary<op_div>  { enum { supported = 1 }; };
+  template<> struct fused_element_binary<op_pow>  { enum { supported = 1 }; };
+  /** \endcond */
+
+
+  /** @brief Compile-time evaluator of entry i of a vector expression tree.
+  *
+  * Each specialization provides
+  *   - 'supported': whether the expression can be fused,
+  *   - 'gathers': whether entry i depends on entries other than i of some vector (e.g. sparse matrix-vector products),
+  *   - operator()(i): the value of entry i,
+  *   - in_host_memory(expr): whether all operands reside in main memory,
+  *   - is_safe_for(expr, x): whether the expression can be written to x entry by entry without overwriting operands still needed.
+  *
+  * Unsupported expressions (e.g. dense matrix-vector products) are evaluated by the individual kernels as before.
+  */
+  template<typename NumericT, typename ExpressionT>
+  struct fused_evaluator { enum { supported = 0, gathers = 0 }; };
+
+  /** \cond */
+
+  // leaf: vector (or range, or slice)
+  template<typename NumericT>
+  struct fused_evaluator<NumericT, vector_base<NumericT> >
+  {
+    typedef vector_base<NumericT>   expression_type;
+    enum { supported = 1, gathers = 0 };
+
+    explicit fused_evaluator(expression_type const & vec)
+      : data_(extract_raw_pointer<NumericT>(vec)), start_(viennacl::traits::start(vec)), inc_(viennacl::traits::stride(vec)) {}
+
+    NumericT operator()(vcl_size_t i) const { return data_[i * inc_ + start_]; }
+
+    static bool in_host_memory(expression_type const & vec) { return viennacl::traits::active_handle_id(vec) == viennacl::MAIN_MEMORY; }
+
+    // reading and writing the same entry in the same iteration is fine, overlapping entries with a shift are not:
+    static bool is_safe_for(expression_type const & vec, vector_base<NumericT> const * x)
+    {
+      return !x || !(viennacl::traits::handle(vec) == viennacl::traits::handle(*x))
+             || (viennacl::traits::start(vec) == viennacl::traits::start(*x) && viennacl::traits::stride(vec) == viennacl::traits::stride(*x));
+    }
+
+  private:
+    NumericT const * data_;
+    vcl_size_t start_;
+    vcl_size_t inc_;
+  };
+
+
+  // x1 + x2, x1 - x2
+  template<typename NumericT, typename LHS, typename RHS, typename OpT>
+  struct fused_binary_evaluator
+  {
+    typedef vector_expression<LHS, RHS, OpT>                                                     expression_type;
+    typedef fused_evaluator<NumericT, typename viennacl::tools::CONST_REMOVER<LHS>::ResultType>  lhs_evaluator;
+    typedef fused_evaluator<NumericT, typename viennacl::tools::CONST_REMOVER<RHS>::ResultType>  rhs_evaluator;
+    enum { supported = lhs_evaluator::supported && rhs_evaluator::supported,
+           gathers   = lhs_evaluator::gathers   || rhs_evaluator::gathers };
+
+    explicit fused_binary_evaluator(expression_type const & proxy) : lhs_(proxy.lhs()), rhs_(proxy.rhs()) {}
+
+    static bool in_host_memory(expression_type const & proxy) { return lhs_evaluator::in_host_memory(proxy.lhs()) && rhs_evaluator::in_host_memory(proxy.rhs()); }
+
+    static bool is_safe_for(expression_type const & proxy, vector_base<NumericT> const * x) { return lhs_evaluator::is_safe_for(proxy.lhs(), x) && rhs_evaluator::is_safe_for(proxy.rhs(), x); }
+
+  protected:
+    lhs_evaluator lhs_;
+    rhs_evaluator rhs_;
+  };
+
+  template<typename NumericT, typename LHS, typename RHS>
+  struct fused_evaluator<NumericT, vector_expression<LHS, RHS, op_add> > : public fused_binary_evaluator<NumericT, LHS, RHS, op_add>
+  {
+    typedef fused_binary_evaluator<NumericT, LHS, RHS, op_add>   base_type;
+
+    explicit fused_evaluator(typename base_type::expression_type const & proxy) : base_type(proxy) {}
+
+    NumericT operator()(vcl_size_t i) const { return base_type::lhs_(i) + base_type::rhs_(i); }
+  };
+
+  template<typename NumericT, typename LHS, typename RHS>
+  struct fused_evaluator<NumericT, vector_expression<LHS, RHS, op_sub> > : public fused_binary_evaluator<NumericT, LHS, RHS, op_sub>
+  {
+    typedef fused_binary_evaluator<NumericT, LHS, RHS, op_sub>   base_type;
+
+    explicit fused_evaluator(typename base_type::expression_type const & proxy) : base_type(proxy) {}
+
+    NumericT operator()(vcl_size_t i) const { return base_type::lhs_(i) - base_type::rhs_(i); }
+  };
+
+  // element_prod(x1, x2), element_div(x1, x2), element_pow(x1, x2)
+  template<typename NumericT, typename LHS, typename RHS, typename OpT>
+  struct fused_evaluator<NumericT, vector_expression<LHS, RHS, op_element_binary<OpT> > > : public fused_binary_evaluator<NumericT, LHS, RHS, op_element_binary<OpT> >
+  {
+    typedef fused_binary_evaluator<NumericT, LHS, RHS, op_element_binary<OpT> >   base_type;
+    enum { supported = base_type::supported && fused_element_binary<OpT>::supported };
+
+    explicit fused_evaluator(typename base_type::expression_type const & proxy) : base_type(proxy) {}
+
+    NumericT operator()(vcl_size_t i) const
+    {
+      NumericT result;
+      viennacl::linalg::detail::op_applier<op_element_binary<OpT> >::apply(result, base_type::lhs_(i), base_type::rhs_(i));
+      return result;
+    }
+  };
+
+
+  // x1 * alpha, x1 / alpha
+  template<typename NumericT, typename LHS, typename ScalarT, typename OpT>
+  struct fused_scaling_evaluator
+  {
+    typedef vector_expression<LHS, ScalarT, OpT>                                                 expression_type;
+    typedef fused_evaluator<NumericT, typename viennacl::tools::CONST_REMOVER<LHS>::ResultType>  lhs_evaluator;
+    typedef fused_scalar<NumericT, typename viennacl::tools::CONST_REMOVER<ScalarT>::ResultType> scalar_type;
+    enum { supported = lhs_evaluator::supported && scalar_type::supported,
+           gathers   = lhs_evaluator::gathers };
+
+    explicit fused_scaling_evaluator(expression_type const & proxy) : lhs_(proxy.lhs()), alpha_(scalar_type::value(proxy.rhs())) {}
+
+    static bool in_host_memory(expression_type const & proxy) { return lhs_evaluator::in_host_memory(proxy.lhs()); }
+
+    static bool is_safe_for(expression_type const & proxy, vector_base<NumericT> const * x) { return lhs_evaluator::is_safe_for(proxy.lhs(), x); }
+
+  protected:
+    lhs_evaluator lhs_;
+    NumericT alpha_;
+  };
+
+  template<typename NumericT, typename LHS, typename ScalarT>
+  struct fused_evaluator<NumericT, vector_expression<LHS, ScalarT, op_mult> > : public fused_scaling_evaluator<NumericT, LHS, ScalarT, op_mult>
+  {
+    typedef fused_scaling_evaluator<NumericT, LHS, ScalarT, op_mult>   base_type;
+
+    explicit fused_evaluator(typename base_type::expression_type const & proxy) : base_type(proxy) {}
+
+    NumericT operator()(vcl_size_t i) const { return base_type::lhs_(i) * base_type::alpha_; }
+  };
+
+  template<typename NumericT, typename LHS, typename ScalarT>
+  struct fused_evaluator<NumericT, vector_expression<LHS, ScalarT, op_div> > : public fused_scaling_evaluator<NumericT, LHS, ScalarT, op_div>
+  {
+    typedef fused_scaling_evaluator<NumericT, LHS, ScalarT, op_div>   base_type;
+
+    explicit fused_evaluator(typename base_type::expression_type const & proxy) : base_type(proxy) {}
+
+    NumericT operator()(vcl_size_t i) const { return base_type::lhs_(i) / base_type::alpha_; }
+  };
+
+
+  // element_exp(x1), element_sqrt(x1), etc.
+  template<typename NumericT, typename LHS, typename RHS, typename OpT>
+  struct fused_evaluator<NumericT, vector_expression<LHS, RHS, op_element_unary<OpT> > >
+  {
+    typedef vector_expression<LHS, RHS, op_element_unary<OpT> >                                  expression_type;
+    typedef fused_evaluator<NumericT, typename viennacl::tools::CONST_REMOVER<LHS>::ResultType>  lhs_evaluator;
+    enum { supported = lhs_evaluator::supported,
+           gathers   = lhs_evaluator::gathers };
+
+    explicit fused_evaluator(expression_type const & proxy) : lhs_(proxy.lhs()) {}
+
+    NumericT operator()(vcl_size_t i) const
+    {
+      NumericT result;
+      viennacl::linalg::detail::op_applier<op_element_unary<OpT> >::apply(result, lhs_(i));
+      return result;
+    }
+
+    static bool in_host_memory(expression_type const & proxy) { return lhs_evaluator::in_host_memory(proxy.lhs()); }
+
+    static bool is_safe_for(expression_type const & proxy, vector_base<NumericT> const * x) { return lhs_evaluator::is_safe_for(proxy.lhs(), x); }
+
+  private:
+    lhs_evaluator lhs_;
+  };
+
+
+  // prod(A, x1) for a sparse matrix A in CSR format: entry i is the dot product of row i with x1
+  template<typename NumericT, unsigned int AlignmentV>
+  struct fused_evaluator<NumericT, vector_expression<const viennacl::compressed_matrix<NumericT, AlignmentV>, const vector_base<NumericT>, op_prod> >
+  {
+    typedef vector_expression<const viennacl::compressed_matrix<NumericT, AlignmentV>, const vector_base<NumericT>, op_prod>   expression_type;
+    enum { supported = 1, gathers = 1 };
+
+    explicit fused_evaluator(expression_type const & proxy)
+      : elements_(extract_raw_pointer<NumericT>(proxy.lhs().handle())),
+        row_buffer_(extract_raw_pointer<unsigned int>(proxy.lhs().handle1())),
+        col_buffer_(extract_raw_pointer<unsigned int>(proxy.lhs().handle2())),
+        data_(extract_raw_pointer<NumericT>(proxy.rhs())),
+        start_(viennacl::traits::start(proxy.rhs())),
+        inc_(viennacl::traits::stride(proxy.rhs())) {}
+
+    NumericT operator()(vcl_size_t i) const
+    {
+      NumericT dot_prod = 0;
+      vcl_size_t row_end = row_buffer_[i+1];
+      for (vcl_size_t k = row_buffer_[i]; k < row_end; ++k)
+        dot_prod += elements_[k] * data_[col_buffer_[k] * inc_ + start_];
+      return dot_prod;
+    }
+
+    static bool in_host_memory(expression_type const & proxy)
+    {
+      return viennacl::traits::active_handle_id(proxy.lhs()) == viennacl::MAIN_MEMORY && viennacl::traits::active_handle_id(proxy.rhs()) == viennacl::MAIN_MEMORY;
+    }
+
+    // all entries of the vector are needed for each row, hence the vector must not be overwritten:
+    static bool is_safe_for(expression_type const & proxy, vector_base<NumericT> const * x)
+    {
+      return !x || !(viennacl::traits::handle(proxy.rhs()) == viennacl::traits::handle(*x));
+    }
+
+  private:
+    NumericT     const * elements_;
+    unsigned int const * row_buffer_;
+    unsigned int const * col_buffer_;
+    NumericT     const * data_;
+    vcl_size_t start_;
+    vcl_size_t inc_;
+  };
+
+
+  // entry-wise products for inner products of two expressions:
+  template<typename NumericT, typename LHS, typename RHS>
+  struct fused_inner_prod_evaluator
+  {
+    typedef fused_evaluator<NumericT, LHS>   lhs_evaluator;
+    typedef fused_evaluator<NumericT, RHS>   rhs_evaluator;
+
+    fused_inner_prod_evaluator(LHS const & lhs, RHS const & rhs) : lhs_(lhs), rhs_(rhs) {}
+
+    NumericT operator()(vcl_size_t i) const { return lhs_(i) * rhs_(i); }
+
+  private:
+    lhs_evaluator lhs_;
+    rhs_evaluator rhs_;
+  };
+
+
+  // how the value of entry i is written to the result vector. The discarding store never touches x, which is NULL then:
+  template<typename OpT>
+  struct fused_store;
+
+  struct fused_discard {};
+
+  template<>
+  struct fused_store<op_assign>
+  {
+    template<typename NumericT>
+    static NumericT apply(NumericT * x, vcl_size_t index, NumericT value) { x[index] = value; return value; }
+  };
+
+  template<>
+  struct fused_store<op_inplace_add>
+  {
+    template<typename NumericT>
+    static NumericT apply(NumericT * x, vcl_size_t index, NumericT value) { x[index] += value; return x[index]; }
+  };
+
+  template<>
+  struct fused_store<op_inplace_sub>
+  {
+    template<typename NumericT>
+    static NumericT apply(NumericT * x, vcl_size_t index, NumericT value) { x[index] -= value; return x[index]; }
+  };
+
+  template<>
+  struct fused_store<fused_discard>
+  {
+    template<typename NumericT>
+    static NumericT apply(NumericT * /*x*/, vcl_size_t /*index*/, NumericT value) { return value; }
+  };
+
+
+  // how the entries are reduced:
+  template<typename ReductionT>
+  struct fused_reduction;
+
+  template<>
+  struct fused_reduction<op_sum>
+  {
+    template<typename NumericT>
+    static void apply(NumericT & partial, NumericT value) { partial += value; }
+    template<typename NumericT>
+    static void combine(NumericT & partial, NumericT other) { partial += other; }
+    template<typename NumericT>
+    static NumericT finalize(NumericT partial) { return partial; }
+  };
+
+  template<>
+  struct fused_reduction<op_norm_1>
+  {
+    template<typename NumericT>
+    static void apply(NumericT & partial, NumericT value) { partial += std::fabs(value); }
+    template<typename NumericT>
+    static void combine(NumericT & partial, NumericT other) { partial += other; }
+    template<typename NumericT>
+    static NumericT finalize(NumericT partial) { return partial; }
+  };
+
+  template<>
+  struct fused_reduction<op_norm_2>
+  {
+    template<typename NumericT>
+    static void apply(NumericT & partial, NumericT value) { partial += value * value; }
+    template<typename NumericT>
+    static void combine(NumericT & partial, NumericT other) { partial += other; }
+    template<typename NumericT>
+    static NumericT finalize(NumericT partial) { return std::sqrt(partial); }
+  };
+
+  template<>
+  struct fused_reduction<op_norm_inf>
+  {
+    template<typename NumericT>
+    static void apply(NumericT & partial, NumericT value) { partial = std::max<NumericT>(partial, std::fabs(value)); }
+    template<typename NumericT>
+    static void combine(NumericT & partial, NumericT other) { partial = std::max<NumericT>(partial, other); }
+    template<typename NumericT>
+    static NumericT finalize(NumericT partial) { return partial; }
+  };
+
+
+  /** @brief Runs the fused loop x[i] (op)= eval(i) for all entries */
+  template<typename OpT, typename NumericT, typename EvaluatorT>
+  void fused_loop(NumericT * data_x, vcl_size_t start_x, vcl_size_t inc_x, vcl_size_t size, EvaluatorT const & eval, bool gathers)
+  {
+    (void)gathers;
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (gathers || size > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+    for (long i = 0; i < static_cast<long>(size); ++i)
+      fused_store<OpT>::apply(data_x, static_cast<vcl_size_t>(i) * inc_x + start_x, eval(static_cast<vcl_size_t>(i)));
+  }
+
+  /** @brief Runs the fused loop x[i] (op)= eval(i) for all entries and reduces the new values of x[i].
+  *
+  * The entries are processed in chunks of VIENNACL_REDUCE_MANY_CHUNK_SIZE entries, whose partial results are combined pairwise in a fixed order.
+  * Thus, the result neither depends on the number of threads nor on the size of the thread team actually provided by the OpenMP runtime.
+  * For OpT = fused_discard the values eval(i) are only reduced.
+  */
+  template<typename OpT, typename ReductionT, typename NumericT, typename EvaluatorT>
+  NumericT fused_reduce_loop(NumericT * data_x, vcl_size_t start_x, vcl_size_t inc_x, vcl_size_t size, EvaluatorT const & eval, bool gathers)
+  {
+    (void)gathers;
+    if (size == 0)
+      return fused_reduction<ReductionT>::finalize(NumericT(0));
+
+    vcl_size_t chunk_size = VIENNACL_REDUCE_MANY_CHUNK_SIZE;
+    vcl_size_t num_chunks = (size - 1) / chunk_size + 1;
+    std::vector<NumericT> partial(num_chunks);
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (gathers || size > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+    for (long chunk = 0; chunk < static_cast<long>(num_chunks); ++chunk)
+    {
+      vcl_size_t begin = static_cast<vcl_size_t>(chunk) * chunk_size;
+      vcl_size_t end   = std::min<vcl_size_t>(begin + chunk_size, size);
+
+      NumericT temp = 0;
+      for (vcl_size_t i = begin; i < end; ++i)
+        fused_reduction<ReductionT>::apply(temp, fused_store<OpT>::apply(data_x, i * inc_x + start_x, eval(i)));
+      partial[static_cast<vcl_size_t>(chunk)] = temp;
+    }
+
+    // combine the partial results of the chunks pairwise:
+    for (vcl_size_t width = 1; width < num_chunks; width *= 2)
+      for (vcl_size_t chunk = 0; chunk + width < num_chunks; chunk += 2 * width)
+        fused_reduction<ReductionT>::combine(partial[chunk], partial[chunk + width]);
+
+    return fused_reduction<ReductionT>::finalize(partial[0]);
+  }
+
+  /** \endcond */
+
+} //namespace detail
+
+
+/** @brief Compile-time check whether x = expr, x += expr, x -= expr and reductions of expr can be evaluated by a single fused loop */
+template<typename NumericT, typename ExpressionT>
+struct fused_expression
+{
+  enum { supported = detail::fused_numeric_type<NumericT>::value && detail::fused_evaluator<NumericT, ExpressionT>::supported };
+};
+
+/** @brief Returns true if all operands of a supported expression reside in main memory and x can be written entry by entry.
+*
+* @param x      The result vector, or NULL if the expression is only reduced
+* @param expr   The vector expression
+*/
+template<typename NumericT, typename ExpressionT>
+bool fused_op_possible(vector_base<NumericT> const * x, ExpressionT const & expr)
+{
+  typedef detail::fused_evaluator<NumericT, ExpressionT>   evaluator_type;
+
+  return (!x || viennacl::traits::active_handle_id(*x) == viennacl::MAIN_MEMORY)
+         && evaluator_type::in_host_memory(expr)
+         && evaluator_type::is_safe_for(expr, x);
+}
+
+/** @brief Evaluates x = expr, x += expr or x -= expr in a single loop without temporaries.
+*
+* Requires fused_expression<NumericT, ExpressionT>::supported and fused_op_possible(&x, expr).
+*
+* @tparam OpT   One out of {op_assign, op_inplace_add, op_inplace_sub}
+* @param x      The result vector (or -range, or -slice)
+* @param expr   The vector expression
+*/
+template<typename OpT, typename NumericT, typename ExpressionT>
+void fused_op(vector_base<NumericT> & x, ExpressionT const & expr)
+{
+  typedef detail::fused_evaluator<NumericT, ExpressionT>   evaluator_type;
+
+  detail::fused_loop<OpT>(detail::extract_raw_pointer<NumericT>(x), viennacl::traits::start(x), viennacl::traits::stride(x), viennacl::traits::size(x),
+                          evaluator_type(expr), evaluator_type::gathers != 0);
+}
+
+/** @brief Evaluates x = expr, x += expr or x -= expr and returns a reduction of the updated x in a single loop, e.g. the residual norm for r = b - prod(A, x).
+*
+* Requires fused_expression<NumericT, ExpressionT>::supported and fused_op_possible(&x, expr).
+*
+* @tparam OpT          One out of {op_assign, op_inplace_add, op_inplace_sub}
+* @tparam ReductionT   One out of {op_sum, op_norm_1, op_norm_2, op_norm_inf}
+* @param x             The result vector (or -range, or -slice)
+* @param expr          The vector expression
+*/
+template<typename OpT, typename ReductionT, typename NumericT, typename ExpressionT>
+NumericT fused_op_reduce(vector_base<NumericT> & x, ExpressionT const & expr)
+{
+  typedef detail::fused_evaluator<NumericT, ExpressionT>   evaluator_type;
+
+  return detail::fused_reduce_loop<OpT, ReductionT>(detail::extract_raw_pointer<NumericT>(x), viennacl::traits::start(x), viennacl::traits::stride(x), viennacl::traits::size(x),
+                                                    evaluator_type(expr), evaluator_type::gathers != 0);
+}
+
+/** @brief Computes a reduction of a vector expression in a single loop without temporaries.
+*
+* Requires fused_expression<NumericT, ExpressionT>::supported and fused_op_possible(NULL, expr).
+*
+* @tparam ReductionT   One out of {op_sum, op_norm_1, op_norm_2, op_norm_inf}
+* @param expr          The vector expression
+*/
+template<typename ReductionT, typename NumericT, typename ExpressionT>
+NumericT fused_reduce(ExpressionT const & expr)
+{
+  typedef detail::fused_evaluator<NumericT, ExpressionT>   evaluator_type;
+
+  return detail::fused_reduce_loop<detail::fused_discard, ReductionT>(static_cast<NumericT *>(NULL), 0, 0, viennacl::traits::size(expr), evaluator_type(expr), evaluator_type::gathers != 0);
+}
+
+/** @brief Computes the inner product of two vector expressions in a single loop without temporaries.
+*
+* Requires fused_expression<NumericT, ...>::supported and fused_op_possible(NULL, ...) for both expressions.
+*/
+template<typename NumericT, typename LHS, typename RHS>
+NumericT fused_inner_prod(LHS const & lhs, RHS const & rhs)
+{
+  typedef detail::fused_evaluator<NumericT, LHS>   lhs_evaluator;
+  typedef detail::fused_evaluator<NumericT, RHS>   rhs_evaluator;
+
+  return detail::fused_reduce_loop<detail::fused_discard, op_sum>(static_cast<NumericT *>(NULL), 0, 0, viennacl::traits::size(lhs),
+                                                                  detail::fused_inner_prod_evaluator<NumericT, LHS, RHS>(lhs, rhs),
+                                                                  lhs_evaluator::gathers || rhs_evaluator::gathers);
+}
+
+} //namespace host_based
+} //namespace linalg
+} //namespace viennacl
+
+
+#endif
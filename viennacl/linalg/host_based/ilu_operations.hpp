@@ -251,6 +251,72 @@ void icc_chow_patel_sweep(compressed_matrix<NumericT> & L,
 }
 
 
+/** @brief Performs one asynchronous (Gauss-Seidel-like) nonlinear relaxation step in the Chow-Patel-ICC using OpenMP.
+  *
+  * Updates are written to L in place, hence no backup of L is required and the latest available values are used right away.
+  * Returns an estimate of the nonlinear residual ||A - LL^T||_F on the pattern of L, accumulated from the values seen during the sweep.
+  */
+template<typename NumericT>
+NumericT icc_chow_patel_sweep_async(compressed_matrix<NumericT>       & L,
+                                    vector<NumericT>            const & aij_L)
+{
+  unsigned int const *L_row_buffer = detail::extract_raw_pointer<unsigned int>(L.handle1());
+  unsigned int const *L_col_buffer = detail::extract_raw_pointer<unsigned int>(L.handle2());
+  NumericT           *L_elements   = detail::extract_raw_pointer<NumericT>(L.handle());
+
+  NumericT     const *aij_ptr      = detail::extract_raw_pointer<NumericT>(aij_L.handle());
+
+  NumericT residual = 0;
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for reduction(+: residual) if (L.size1() > VIENNACL_OPENMP_ILU_MIN_SIZE)
+#endif
+  for (long row = 0; row < static_cast<long>(L.size1()); ++row)
+  {
+    unsigned int row_Li_start = L_row_buffer[row];
+    unsigned int row_Li_end   = L_row_buffer[row + 1];
+
+    for (unsigned int i = row_Li_start; i < row_Li_end; ++i)
+    {
+      unsigned int col = L_col_buffer[i];
+
+      unsigned int row_Lj_start = L_row_buffer[col];
+      unsigned int row_Lj_end   = L_row_buffer[col+1];
+
+      // compute \sum_{k=1}^{j-1} l_ik l_jk
+      unsigned int index_Lj = row_Lj_start;
+      unsigned int col_Lj = L_col_buffer[index_Lj];
+      NumericT s = aij_ptr[i];
+      for (unsigned int index_Li = row_Li_start; index_Li < i; ++index_Li)
+      {
+        unsigned int col_Li = L_col_buffer[index_Li];
+
+        // find element in row j
+        while (col_Lj < col_Li)
+        {
+          ++index_Lj;
+          col_Lj = L_col_buffer[index_Lj];
+        }
+
+        if (col_Lj == col_Li)
+          s -= L_elements[index_Li] * L_elements[index_Lj];
+      }
+
+      NumericT diag_j = L_elements[row_Lj_end - 1]; // diagonal element is last in row!
+      NumericT r = s - L_elements[i] * diag_j;
+      residual += r * r;
+
+      if (row != col)
+        L_elements[i] = s / diag_j;
+      else
+        L_elements[i] = std::sqrt(s);
+    }
+  }
+
+  return std::sqrt(residual);
+}
+
+
 
 //////////////////////// ILU ////////////////////////
 
@@ -622,6 +688,123 @@ void ilu_chow_patel_sweep(compressed_matrix<NumericT>       & L,
 }
 
 
+/** @brief Performs one asynchronous (Gauss-Seidel-like) nonlinear relaxation step in the Chow-Patel-ILU using OpenMP.
+  *
+  * In contrast to ilu_chow_patel_sweep(), updates are written to L and U_trans in place. Thus, no backup copies of the factors
+  * are allocated and every update immediately uses the most recent values available (Algorithm 2 in the paper as proposed).
+  * Returns an estimate of the nonlinear residual ||A - LU||_F on the pattern of A, accumulated from the values seen during the sweep.
+  */
+template<typename NumericT>
+NumericT ilu_chow_patel_sweep_async(compressed_matrix<NumericT>       & L,
+                                    vector<NumericT>            const & aij_L,
+                                    compressed_matrix<NumericT>       & U_trans,
+                                    vector<NumericT>            const & aij_U_trans)
+{
+  unsigned int const *L_row_buffer = detail::extract_raw_pointer<unsigned int>(L.handle1());
+  unsigned int const *L_col_buffer = detail::extract_raw_pointer<unsigned int>(L.handle2());
+  NumericT           *L_elements   = detail::extract_raw_pointer<NumericT>(L.handle());
+
+  NumericT     const *aij_L_ptr    = detail::extract_raw_pointer<NumericT>(aij_L.handle());
+
+  unsigned int const *U_row_buffer = detail::extract_raw_pointer<unsigned int>(U_trans.handle1());
+  unsigned int const *U_col_buffer = detail::extract_raw_pointer<unsigned int>(U_trans.handle2());
+  NumericT           *U_elements   = detail::extract_raw_pointer<NumericT>(U_trans.handle());
+
+  NumericT     const *aij_U_trans_ptr = detail::extract_raw_pointer<NumericT>(aij_U_trans.handle());
+
+  NumericT residual = 0;
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for reduction(+: residual) if (L.size1() > VIENNACL_OPENMP_ILU_MIN_SIZE)
+#endif
+  for (long row = 0; row < static_cast<long>(L.size1()); ++row)
+  {
+    //
+    // update L:
+    //
+    unsigned int row_L_start = L_row_buffer[row];
+    unsigned int row_L_end   = L_row_buffer[row + 1];
+
+    for (unsigned int j = row_L_start; j < row_L_end; ++j)
+    {
+      unsigned int col = L_col_buffer[j];
+
+      if (col == row)
+        continue;
+
+      unsigned int row_U_start = U_row_buffer[col];
+      unsigned int row_U_end   = U_row_buffer[col + 1];
+
+      // compute \sum_{k=1}^{j-1} l_ik u_kj
+      unsigned int index_U = row_U_start;
+      unsigned int col_U = (index_U < row_U_end) ? U_col_buffer[index_U] : static_cast<unsigned int>(U_trans.size2());
+      NumericT sum = 0;
+      for (unsigned int k = row_L_start; k < j; ++k)
+      {
+        unsigned int col_L = L_col_buffer[k];
+
+        // find element in U
+        while (col_U < col_L)
+        {
+          ++index_U;
+          col_U = U_col_buffer[index_U];
+        }
+
+        if (col_U == col_L)
+          sum += L_elements[k] * U_elements[index_U];
+      }
+
+      // update l_ij:
+      assert(U_col_buffer[row_U_end - 1] == col && bool("Accessing U element which is not a diagonal element!"));
+      NumericT diag_U = U_elements[row_U_end - 1];  // diagonal element is last entry in U
+      NumericT r = aij_L_ptr[j] - sum - L_elements[j] * diag_U;
+      residual += r * r;
+      L_elements[j] = (aij_L_ptr[j] - sum) / diag_U;
+    }
+
+
+    //
+    // update U:
+    //
+    unsigned int row_U_start = U_row_buffer[row];
+    unsigned int row_U_end   = U_row_buffer[row + 1];
+    for (unsigned int j = row_U_start; j < row_U_end; ++j)
+    {
+      unsigned int col = U_col_buffer[j];
+
+      row_L_start = L_row_buffer[col];
+      row_L_end   = L_row_buffer[col + 1];
+
+      // compute \sum_{k=1}^{j-1} l_ik u_kj
+      unsigned int index_L = row_L_start;
+      unsigned int col_L = (index_L < row_L_end) ? L_col_buffer[index_L] : static_cast<unsigned int>(L.size1());
+      NumericT sum = 0;
+      for (unsigned int k = row_U_start; k < j; ++k)
+      {
+        unsigned int col_U = U_col_buffer[k];
+
+        // find element in L
+        while (col_L < col_U)
+        {
+          ++index_L;
+          col_L = L_col_buffer[index_L];
+        }
+
+        if (col_U == col_L)
+          sum += L_elements[index_L] * U_elements[k];
+      }
+
+      // update u_ij:
+      NumericT r = aij_U_trans_ptr[j] - sum - U_elements[j];
+      residual += r * r;
+      U_elements[j] = aij_U_trans_ptr[j] - sum;
+    }
+  }
+
+  return std::sqrt(residual);
+}
+
+
 template<typename NumericT>
 void ilu_form_neumann_matrix(compressed_matrix<NumericT> & R,
                              vector<NumericT> & diag_R)
@@ -664,6 +847,37 @@ void ilu_form_neumann_matrix(compressed_matrix<NumericT> & R,
   //std::cout << "diag_R: " << diag_R << std::endl;
 }
 
+
+/** @brief Inverse of ilu_form_neumann_matrix(): Recovers the factor R from (I - D^{-1}R) and the diagonal D. Used for warm-starting the sweeps. */
+template<typename NumericT>
+void ilu_restore_from_neumann_matrix(compressed_matrix<NumericT>       & R,
+                                     vector<NumericT>            const & diag_R)
+{
+  unsigned int const *R_row_buffer = detail::extract_raw_pointer<unsigned int>(R.handle1());
+  unsigned int const *R_col_buffer = detail::extract_raw_pointer<unsigned int>(R.handle2());
+  NumericT           *R_elements   = detail::extract_raw_pointer<NumericT>(R.handle());
+
+  NumericT     const *diag_R_ptr   = detail::extract_raw_pointer<NumericT>(diag_R.handle());
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (R.size1() > VIENNACL_OPENMP_ILU_MIN_SIZE)
+#endif
+  for (long row = 0; row < static_cast<long>(R.size1()); ++row)
+  {
+    unsigned int col_begin = R_row_buffer[row];
+    unsigned int col_end   = R_row_buffer[row+1];
+
+    NumericT diag = diag_R_ptr[row];
+    for (unsigned int j = col_begin; j < col_end; ++j)
+    {
+      if (R_col_buffer[j] == static_cast<unsigned int>(row))
+        R_elements[j] = diag;
+      else
+        R_elements[j] *= -diag;
+    }
+  }
+}
+
 } //namespace host_based
 } //namespace linalg
 } //namespace viennacl
@@ -34,6 +34,7 @@
 #include "viennacl/traits/start.hpp"
 #include "viennacl/linalg/host_based/common.hpp"
 #include "viennacl/linalg/detail/op_applier.hpp"
+#include "viennacl/linalg/host_based/sparse_matrix_operations.hpp"
 #include "viennacl/traits/stride.hpp"
 
 
@@ -42,6 +43,11 @@
   #define VIENNACL_OPENMP_VECTOR_MIN_SIZE  5000
 #endif
 
+// Minimum number of rows for using OpenMP in the fused polynomial preconditioner steps:
+#ifndef VIENNACL_OPENMP_POLYNOMIAL_PRECOND_MIN_SIZE
+  #define VIENNACL_OPENMP_POLYNOMIAL_PRECOND_MIN_SIZE  5000
+#endif
+
 namespace viennacl
 {
 namespace linalg
@@ -872,6 +878,108 @@ void pipelined_gmres_prod(MatrixType const & A,
 }
 
 
+/** @brief Performs one fused step of a polynomial preconditioner with a compressed_matrix.
+  *
+  * This routine computes for a matrix A and vectors 'x', 'w', 'r', 'y', and 'z':
+  *   y  = a * prod(A, x) + b * x + c * w + d * r;
+  *   z += e * y;      (skipped if e == 0)
+  * within a single pass over the rows of A. 'y' must neither alias 'x' nor 'w'.
+  */
+template<typename NumericT>
+void polynomial_precond_step(compressed_matrix<NumericT> const & A,
+                             vector_base<NumericT> const & x,
+                             vector_base<NumericT> const & w,
+                             vector_base<NumericT> const & r,
+                             vector_base<NumericT> & y,
+                             vector_base<NumericT> & z,
+                             NumericT a, NumericT b, NumericT c, NumericT d, NumericT e)
+{
+  typedef NumericT        value_type;
+
+  value_type   const *  x_buf      = detail::extract_raw_pointer<value_type>(x.handle()) + viennacl::traits::start(x);
+  value_type   const *  w_buf      = detail::extract_raw_pointer<value_type>(w.handle()) + viennacl::traits::start(w);
+  value_type   const *  r_buf      = detail::extract_raw_pointer<value_type>(r.handle()) + viennacl::traits::start(r);
+  value_type         *  y_buf      = detail::extract_raw_pointer<value_type>(y.handle()) + viennacl::traits::start(y);
+  value_type         *  z_buf      = detail::extract_raw_pointer<value_type>(z.handle()) + viennacl::traits::start(z);
+  value_type   const * elements    = detail::extract_raw_pointer<value_type>(A.handle());
+  unsigned int const *  row_buffer = detail::extract_raw_pointer<unsigned int>(A.handle1());
+  unsigned int const *  col_buffer = detail::extract_raw_pointer<unsigned int>(A.handle2());
+
+  vcl_size_t x_inc = viennacl::traits::stride(x);
+  vcl_size_t w_inc = viennacl::traits::stride(w);
+  vcl_size_t r_inc = viennacl::traits::stride(r);
+  vcl_size_t y_inc = viennacl::traits::stride(y);
+  vcl_size_t z_inc = viennacl::traits::stride(z);
+
+  bool update_z = (e < 0 || e > 0);
+
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for if (A.size1() > VIENNACL_OPENMP_POLYNOMIAL_PRECOND_MIN_SIZE)
+#endif
+  for (long row = 0; row < static_cast<long>(A.size1()); ++row)
+  {
+    vcl_size_t i = static_cast<vcl_size_t>(row);
+
+    value_type dot_prod = 0;
+    vcl_size_t row_end = row_buffer[i+1];
+    for (vcl_size_t k = row_buffer[i]; k < row_end; ++k)
+      dot_prod += elements[k] * x_buf[col_buffer[k] * x_inc];
+
+    value_type value_y = a * dot_prod + b * x_buf[i * x_inc] + c * w_buf[i * w_inc] + d * r_buf[i * r_inc];
+    y_buf[i * y_inc] = value_y;
+    if (update_z)
+      z_buf[i * z_inc] += e * value_y;
+  }
+}
+
+/** @brief Performs one step of a polynomial preconditioner for sparse matrix types other than compressed_matrix.
+  *
+  * Computes the same as the compressed_matrix overload, but runs the sparse matrix-vector product first and
+  * fuses all vector updates into a single subsequent pass. 'y' must neither alias 'x' nor 'w'.
+  */
+template<typename MatrixT, typename NumericT>
+void polynomial_precond_step(MatrixT const & A,
+                             vector_base<NumericT> const & x,
+                             vector_base<NumericT> const & w,
+                             vector_base<NumericT> const & r,
+                             vector_base<NumericT> & y,
+                             vector_base<NumericT> & z,
+                             NumericT a, NumericT b, NumericT c, NumericT d, NumericT e)
+{
+  typedef NumericT        value_type;
+
+  viennacl::linalg::host_based::prod_impl(A, x, y);
+
+  value_type   const *  x_buf      = detail::extract_raw_pointer<value_type>(x.handle()) + viennacl::traits::start(x);
+  value_type   const *  w_buf      = detail::extract_raw_pointer<value_type>(w.handle()) + viennacl::traits::start(w);
+  value_type   const *  r_buf      = detail::extract_raw_pointer<value_type>(r.handle()) + viennacl::traits::start(r);
+  value_type         *  y_buf      = detail::extract_raw_pointer<value_type>(y.handle()) + viennacl::traits::start(y);
+  value_type         *  z_buf      = detail::extract_raw_pointer<value_type>(z.handle()) + viennacl::traits::start(z);
+
+  vcl_size_t x_inc = viennacl::traits::stride(x);
+  vcl_size_t w_inc = viennacl::traits::stride(w);
+  vcl_size_t r_inc = viennacl::traits::stride(r);
+  vcl_size_t y_inc = viennacl::traits::stride(y);
+  vcl_size_t z_inc = viennacl::traits::stride(z);
+
+  bool update_z = (e < 0 || e > 0);
+  vcl_size_t size = viennacl::traits::size(y);
+
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for if (size > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+  for (long row = 0; row < static_cast<long>(size); ++row)
+  {
+    vcl_size_t i = static_cast<vcl_size_t>(row);
+
+    value_type value_y = a * y_buf[i * y_inc] + b * x_buf[i * x_inc] + c * w_buf[i * w_inc] + d * r_buf[i * r_inc];
+    y_buf[i * y_inc] = value_y;
+    if (update_z)
+      z_buf[i * z_inc] += e * value_y;
+  }
+}
+
+
 } //namespace host_based
 } //namespace linalg
 } //namespace viennacl
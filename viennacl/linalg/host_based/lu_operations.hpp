@@ -0,0 +1,252 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_LU_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_LU_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/lu_operations.hpp
+    @brief Implementations of the LU factorization with partial pivoting for dense matrices in host memory.
+
+    The factorization is computed in place by recursive splitting of the columns (cf. LAPACK's xGETRF2):
+    The left half is factored recursively, the right half is updated by a triangular solve and a matrix-matrix product, and the trailing matrix is factored recursively.
+    Narrow panels are factored directly. Row interchanges are applied to the remaining columns in parallel.
+*/
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "viennacl/forwards.h"
+#include "viennacl/matrix_proxy.hpp"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/start.hpp"
+#include "viennacl/traits/stride.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/matrix_operations.hpp"
+#include "viennacl/linalg/host_based/direct_solve.hpp"
+
+// Panels with at most this number of columns are factored directly, wider panels are split recursively:
+#ifndef VIENNACL_HOST_LU_PANEL_SIZE
+  #define VIENNACL_HOST_LU_PANEL_SIZE  16
+#endif
+
+// Minimum matrix size for using OpenMP when applying row interchanges:
+#ifndef VIENNACL_OPENMP_LU_MIN_SIZE
+  #define VIENNACL_OPENMP_LU_MIN_SIZE  128
+#endif
+
+namespace viennacl
+{
+namespace linalg
+{
+namespace host_based
+{
+namespace detail
+{
+  /** @brief Applies the row interchanges pivots[k_start], ..., pivots[k_end-1] to the columns [col_start, col_end) of A. Blocks of columns are processed in parallel. */
+  template<typename MatrixAccT>
+  void lu_swap_rows(MatrixAccT & A, vcl_size_t col_start, vcl_size_t col_end,
+                    std::vector<vcl_size_t> const & pivots, vcl_size_t k_start, vcl_size_t k_end)
+  {
+    vcl_size_t const block_size = 64;
+    vcl_size_t num_blocks = (col_end - col_start + block_size - 1) / block_size;
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (num_blocks > 1 && (col_end - col_start) * (k_end - k_start) > VIENNACL_OPENMP_LU_MIN_SIZE * VIENNACL_OPENMP_LU_MIN_SIZE)
+#endif
+    for (long block2 = 0; block2 < static_cast<long>(num_blocks); ++block2)
+    {
+      vcl_size_t j_start = col_start + static_cast<vcl_size_t>(block2) * block_size;
+      vcl_size_t j_end   = std::min(j_start + block_size, col_end);
+      for (vcl_size_t k = k_start; k < k_end; ++k)
+      {
+        vcl_size_t p = pivots[k];
+        if (p != k)
+          for (vcl_size_t j = j_start; j < j_end; ++j)
+            std::swap(A(k, j), A(p, j));
+      }
+    }
+  }
+
+  /** @brief Factors the panel of columns [c0, c0+n) and rows [c0, m) directly by a right-looking elimination with partial pivoting. Row interchanges are applied within the panel only. */
+  template<typename MatrixAccT>
+  void lu_panel(MatrixAccT & A, vcl_size_t m, vcl_size_t c0, vcl_size_t n, std::vector<vcl_size_t> & pivots)
+  {
+    typedef typename MatrixAccT::value_type    value_type;
+
+    for (vcl_size_t k = c0; k < c0 + n; ++k)
+    {
+      // pivot search:
+      vcl_size_t p = k;
+      value_type max_abs = std::fabs(A(k, k));
+      for (vcl_size_t i = k + 1; i < m; ++i)
+      {
+        value_type abs_val = std::fabs(A(i, k));
+        if (abs_val > max_abs)
+        {
+          max_abs = abs_val;
+          p = i;
+        }
+      }
+      pivots[k] = p;
+      if (p != k)
+        for (vcl_size_t j = c0; j < c0 + n; ++j)
+          std::swap(A(k, j), A(p, j));
+
+      // compute multipliers. A zero pivot leaves the column unscaled, the factor U is singular then:
+      value_type a_kk = A(k, k);
+      if (a_kk > 0 || a_kk < 0)
+        for (vcl_size_t i = k + 1; i < m; ++i)
+          A(i, k) /= a_kk;
+
+      // rank-1 update of the remaining columns of the panel:
+      for (vcl_size_t j = k + 1; j < c0 + n; ++j)
+      {
+        value_type a_kj = A(k, j);
+        for (vcl_size_t i = k + 1; i < m; ++i)
+          A(i, j) -= A(i, k) * a_kj;
+      }
+    }
+  }
+
+  /** @brief Recursively factors the columns [c0, c0+n) and rows [c0, m) of A, where the left columns [0, c0) are not touched. */
+  template<typename NumericT, typename MatrixAccT>
+  void lu_recursive(matrix_base<NumericT> & A, MatrixAccT & A_acc, vcl_size_t m, vcl_size_t c0, vcl_size_t n, std::vector<vcl_size_t> & pivots)
+  {
+    if (n <= VIENNACL_HOST_LU_PANEL_SIZE)
+    {
+      lu_panel(A_acc, m, c0, n, pivots);
+      return;
+    }
+
+    vcl_size_t n1 = n / 2;
+    vcl_size_t n2 = n - n1;
+    vcl_size_t c1 = c0 + n1;
+
+    // [L_11; L_21] U_11 = P [A_11; A_21]:
+    lu_recursive(A, A_acc, m, c0, n1, pivots);
+
+    // A_12 <- L_11^{-1} P A_12, A_22 <- A_22 - L_21 A_12:
+    lu_swap_rows(A_acc, c1, c0 + n, pivots, c0, c1);
+
+    viennacl::matrix_range<matrix_base<NumericT> > L_11(A, viennacl::range(c0, c1), viennacl::range(c0, c1));
+    viennacl::matrix_range<matrix_base<NumericT> > A_12(A, viennacl::range(c0, c1), viennacl::range(c1, c0 + n));
+    viennacl::linalg::host_based::inplace_solve(L_11, A_12, viennacl::linalg::unit_lower_tag());
+
+    viennacl::matrix_range<matrix_base<NumericT> > L_21(A, viennacl::range(c1, m), viennacl::range(c0, c1));
+    viennacl::matrix_range<matrix_base<NumericT> > A_22(A, viennacl::range(c1, m), viennacl::range(c1, c0 + n));
+    viennacl::linalg::host_based::prod_impl(L_21, false, A_12, false, A_22, NumericT(-1), NumericT(1));
+
+    // factor the trailing matrix and apply its row interchanges to L_21:
+    lu_recursive(A, A_acc, m, c1, n2, pivots);
+    lu_swap_rows(A_acc, c0, c1, pivots, c1, c0 + n);
+  }
+
+} // namespace detail
+
+
+/** @brief Computes the LU factorization P A = L U with partial pivoting of a square dense matrix in host memory.
+  *
+  * @param A       The system matrix (row-major or column-major). Overwritten with the factors L (unit diagonal not stored) and U.
+  * @param pivots  The row interchanges: Row k was interchanged with row pivots[k] >= k, in the order k = 0, 1, ...
+  */
+template<typename NumericT>
+void lu_factorize(matrix_base<NumericT> & A, std::vector<vcl_size_t> & pivots)
+{
+  vcl_size_t n = viennacl::traits::size1(A);
+  assert(viennacl::traits::size2(A) == n && bool("Matrix must be square for the LU factorization!"));
+
+  pivots.resize(n);
+  if (n == 0)
+    return;
+
+  NumericT * data_A = detail::extract_raw_pointer<NumericT>(A);
+
+  vcl_size_t A_start1 = viennacl::traits::start1(A);
+  vcl_size_t A_start2 = viennacl::traits::start2(A);
+  vcl_size_t A_inc1   = viennacl::traits::stride1(A);
+  vcl_size_t A_inc2   = viennacl::traits::stride2(A);
+  vcl_size_t A_internal_size1  = viennacl::traits::internal_size1(A);
+  vcl_size_t A_internal_size2  = viennacl::traits::internal_size2(A);
+
+  if (A.row_major())
+  {
+    detail::matrix_array_wrapper<NumericT, row_major, false> wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+    detail::lu_recursive(A, wrapper_A, n, 0, n, pivots);
+  }
+  else
+  {
+    detail::matrix_array_wrapper<NumericT, column_major, false> wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+    detail::lu_recursive(A, wrapper_A, n, 0, n, pivots);
+  }
+}
+
+
+/** @brief Applies the row interchanges of an LU factorization with partial pivoting to the rows of B, i.e. computes P B.
+  *
+  * @param B       The matrix of load vectors
+  * @param pivots  The row interchanges as returned by lu_factorize()
+  */
+template<typename NumericT>
+void lu_permute(matrix_base<NumericT> & B, std::vector<vcl_size_t> const & pivots)
+{
+  NumericT * data_B = detail::extract_raw_pointer<NumericT>(B);
+
+  vcl_size_t B_start1 = viennacl::traits::start1(B);
+  vcl_size_t B_start2 = viennacl::traits::start2(B);
+  vcl_size_t B_inc1   = viennacl::traits::stride1(B);
+  vcl_size_t B_inc2   = viennacl::traits::stride2(B);
+  vcl_size_t B_size2  = viennacl::traits::size2(B);
+  vcl_size_t B_internal_size1  = viennacl::traits::internal_size1(B);
+  vcl_size_t B_internal_size2  = viennacl::traits::internal_size2(B);
+
+  if (B.row_major())
+  {
+    detail::matrix_array_wrapper<NumericT, row_major, false> wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+    detail::lu_swap_rows(wrapper_B, 0, B_size2, pivots, 0, pivots.size());
+  }
+  else
+  {
+    detail::matrix_array_wrapper<NumericT, column_major, false> wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+    detail::lu_swap_rows(wrapper_B, 0, B_size2, pivots, 0, pivots.size());
+  }
+}
+
+/** @brief Applies the row interchanges of an LU factorization with partial pivoting to the vector b, i.e. computes P b.
+  *
+  * @param b       The load vector
+  * @param pivots  The row interchanges as returned by lu_factorize()
+  */
+template<typename NumericT>
+void lu_permute(vector_base<NumericT> & b, std::vector<vcl_size_t> const & pivots)
+{
+  NumericT * data_b = detail::extract_raw_pointer<NumericT>(b);
+
+  vcl_size_t start = viennacl::traits::start(b);
+  vcl_size_t inc   = viennacl::traits::stride(b);
+
+  for (vcl_size_t k = 0; k < pivots.size(); ++k)
+    if (pivots[k] != k)
+      std::swap(data_b[k * inc + start], data_b[pivots[k] * inc + start]);
+}
+
+} //namespace host_based
+} //namespace linalg
+} //namespace viennacl
+
+
+#endif
@@ -1065,16 +1065,19 @@ namespace detail
             for (vcl_size_t k = offset_k; k < std::min(offset_k + blocksize, A_size2); ++k)
               buffer_B[(k - offset_k) + (j - offset_j) * blocksize] = B(k, j);
 
-          // multiply (this is the hot spot in terms of flops)
-          for (vcl_size_t i = 0; i < blocksize; ++i)
+          // multiply (this is the hot spot in terms of flops). Blocks at the boundary are only partially filled:
+          vcl_size_t block_size_i = std::min(blocksize, C_size1 - offset_i);
+          vcl_size_t block_size_j = std::min(blocksize, C_size2 - offset_j);
+          vcl_size_t block_size_k = std::min(blocksize, A_size2 - offset_k);
+          for (vcl_size_t i = 0; i < block_size_i; ++i)
           {
             NumericT const * ptrA = &(buffer_A[i*blocksize]);
-            for (vcl_size_t j = 0; j < blocksize; ++j)
+            for (vcl_size_t j = 0; j < block_size_j; ++j)
             {
               NumericT const * ptrB = &(buffer_B[j*blocksize]);
 
               NumericT temp = NumericT(0);
-              for (vcl_size_t k = 0; k < blocksize; ++k)
+              for (vcl_size_t k = 0; k < block_size_k; ++k)
                 temp += ptrA[k] * ptrB[k];  // buffer_A[i*blocksize + k] * buffer_B[k + j*blocksize];
 
               buffer_C[i*blocksize + j] += temp;
@@ -22,13 +22,26 @@
  @brief Implementations of NMF operations using a plain single-threaded or OpenMP-enabled execution on CPU
  */
 
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <algorithm>
+
 #include "viennacl/vector.hpp"
 #include "viennacl/matrix.hpp"
+#include "viennacl/compressed_matrix.hpp"
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/linalg/norm_2.hpp"
 #include "viennacl/linalg/norm_frobenius.hpp"
 
 #include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/sparse_matrix_operations.hpp"
+#include "viennacl/linalg/host_based/amg_operations.hpp"
+
+// Minimum number of operations per factor update for using OpenMP in the nonnegative matrix factorization:
+#ifndef VIENNACL_OPENMP_NMF_MIN_SIZE
+  #define VIENNACL_OPENMP_NMF_MIN_SIZE  5000
+#endif
 
 namespace viennacl
 {
@@ -39,11 +52,42 @@ namespace linalg
 class nmf_config
 {
 public:
+  /** @brief The update scheme for the factors */
+  enum solver_type
+  {
+    multiplicative_update = 0,   ///< Multiplicative updates by Lee and Seung
+    hals,                        ///< Hierarchical alternating least squares: exact nonnegative update of one row of H (column of W) after the other
+    anls                         ///< Alternating nonnegative least squares, each subproblem solved approximately by accelerated projected gradient steps
+  };
+
   nmf_config(double val_epsilon = 1e-4, double val_epsilon_stagnation = 1e-5,
       vcl_size_t num_max_iters = 10000, vcl_size_t num_check_iters = 100) :
       eps_(val_epsilon), stagnation_eps_(val_epsilon_stagnation), max_iters_(num_max_iters), check_after_steps_(
-          (num_check_iters > 0) ? num_check_iters : 1), print_relative_error_(false), iters_(0)
+          (num_check_iters > 0) ? num_check_iters : 1), print_relative_error_(false), solver_(multiplicative_update), inner_iters_(10), iters_(0)
+  {
+  }
+
+  /** @brief Returns the update scheme for the factors */
+  solver_type solver() const
   {
+    return solver_;
+  }
+  /** @brief Sets the update scheme for the factors. Schemes other than multiplicative updates are computed in host memory. */
+  void solver(solver_type s)
+  {
+    solver_ = s;
+  }
+
+  /** @brief Returns the number of projected gradient steps per subproblem for the ANLS scheme */
+  vcl_size_t inner_iterations() const
+  {
+    return inner_iters_;
+  }
+  /** @brief Sets the number of projected gradient steps per subproblem for the ANLS scheme */
+  void inner_iterations(vcl_size_t i)
+  {
+    if (i > 0)
+      inner_iters_ = i;
   }
 
   /** @brief Returns the relative tolerance for convergence */
@@ -121,44 +165,261 @@ private:
   vcl_size_t max_iters_;
   vcl_size_t check_after_steps_;
   bool print_relative_error_;
+  solver_type solver_;
+  vcl_size_t inner_iters_;
 public:
   mutable vcl_size_t iters_;
 };
 
 namespace host_based
 {
-  /** @brief Missing OpenMP kernel for nonnegative matrix factorization of a dense matrices. */
+namespace detail
+{
+  /** @brief Strided access to a matrix, where the entry (r, p) is located at data[offset + r * stride_r + p * stride_p].
+   *
+   * Each factor is viewed as a set of vectors of length k (index r), which are independent in the updates: the columns of H and the rows of W.
+   */
+  template<typename NumericT>
+  struct nmf_view
+  {
+    NumericT * data;
+    vcl_size_t offset;
+    vcl_size_t stride_r;
+    vcl_size_t stride_p;
+
+    NumericT & operator()(vcl_size_t r, vcl_size_t p) const { return data[offset + r * stride_r + p * stride_p]; }
+  };
+
+  /** @brief Returns the view of M, where r indexes the rows of M if r_is_row is true and the columns of M otherwise */
+  template<typename NumericT>
+  nmf_view<NumericT> nmf_make_view(viennacl::matrix_base<NumericT> & M, bool r_is_row)
+  {
+    vcl_size_t is1 = viennacl::traits::internal_size1(M);
+    vcl_size_t is2 = viennacl::traits::internal_size2(M);
+    vcl_size_t stride_row = M.row_major() ? viennacl::traits::stride1(M) * is2 : viennacl::traits::stride1(M);
+    vcl_size_t stride_col = M.row_major() ? viennacl::traits::stride2(M) : viennacl::traits::stride2(M) * is1;
+
+    nmf_view<NumericT> v;
+    v.data     = extract_raw_pointer<NumericT>(M);
+    v.offset   = M.row_major() ? viennacl::traits::start1(M) * is2 + viennacl::traits::start2(M)
+                               : viennacl::traits::start1(M) + viennacl::traits::start2(M) * is1;
+    v.stride_r = r_is_row ? stride_row : stride_col;
+    v.stride_p = r_is_row ? stride_col : stride_row;
+    return v;
+  }
+
+  /** @brief Copies the symmetric k-by-k Gram matrix to a dense row-major array */
+  template<typename NumericT>
+  void nmf_gram_to_array(viennacl::matrix_base<NumericT> & G, std::vector<NumericT> & G_array)
+  {
+    vcl_size_t k = G.size1();
+    nmf_view<NumericT> view_G = nmf_make_view(G, true);
+    G_array.resize(k * k);
+    for (vcl_size_t r = 0; r < k; ++r)
+      for (vcl_size_t s = 0; s < k; ++s)
+        G_array[r * k + s] = view_G(r, s);
+  }
+
+  /** @brief Projects onto the nonnegative numbers. Entries decaying to zero are flushed before they become subnormal, since subnormal entries slow down all subsequent products considerably. */
   template<typename NumericT>
-  void el_wise_mul_div(NumericT       * matrix1,
-                       NumericT const * matrix2,
-                       NumericT const * matrix3, vcl_size_t size)
+  NumericT nmf_flush(NumericT value)
   {
+    return (value < std::numeric_limits<NumericT>::min()) ? NumericT(0) : value;
+  }
+
+  /** @brief Fused update of the factor F with respect to the objective 0.5 * ||V - W H||^2 for all vectors p of length k.
+   *
+   * With G the Gram matrix of the other factor and N the product of V with the other factor, the gradient is G F(:,p) - N(:,p).
+   * The gradient is formed on the fly for each vector, so no further temporaries of the size of F are needed.
+   *
+   * @param F        The factor to be updated (H, or W viewed as W^T)
+   * @param N        W^T V (viewed as k-by-n), or (V H^T)^T
+   * @param G        The k-by-k row-major Gram matrix W^T W or H H^T
+   * @param k        The inner dimension of the factorization
+   * @param count    The number of vectors in F
+   * @param conf     The configuration holding the update scheme
+   */
+  template<typename NumericT>
+  void nmf_update_factor(nmf_view<NumericT> F, nmf_view<NumericT> N, std::vector<NumericT> const & G,
+                         vcl_size_t k, vcl_size_t count, viennacl::linalg::nmf_config const & conf)
+  {
+    if (k == 0)
+      return;
+    NumericT const * G_data = &G[0];
+
+    // Lipschitz constant of the gradient for the projected gradient steps, bounded by the Frobenius norm of G:
+    NumericT lipschitz = 0;
+    if (conf.solver() == viennacl::linalg::nmf_config::anls)
+    {
+      for (vcl_size_t i = 0; i < k * k; ++i)
+        lipschitz += G_data[i] * G_data[i];
+      lipschitz = std::sqrt(lipschitz);
+    }
+
 #ifdef VIENNACL_WITH_OPENMP
-#pragma omp parallel for
+    #pragma omp parallel if (count * k * k > VIENNACL_OPENMP_NMF_MIN_SIZE)
 #endif
-    for (long i2 = 0; i2 < long(size); i2++)
     {
-      vcl_size_t i = vcl_size_t(i2);
-      NumericT val     = matrix1[i] * matrix2[i];
-      NumericT divisor = matrix3[i];
-      matrix1[i] = (divisor > (NumericT) 0.00001) ? (val / divisor) : (NumericT) 0;
+      std::vector<NumericT> x(k), y(k), x_old(k), Gy(k);
+
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp for
+#endif
+      for (long p2 = 0; p2 < static_cast<long>(count); ++p2)
+      {
+        vcl_size_t p = static_cast<vcl_size_t>(p2);
+        switch (conf.solver())
+        {
+        case viennacl::linalg::nmf_config::hals:
+          // Gauss-Seidel sweep over the entries, each minimized exactly subject to nonnegativity:
+          for (vcl_size_t r = 0; r < k; ++r)
+          {
+            NumericT diag = G_data[r * k + r];
+            if (diag <= 0)
+              continue;
+            NumericT gradient = -N(r, p);
+            for (vcl_size_t s = 0; s < k; ++s)
+              gradient += G_data[r * k + s] * F(s, p);
+            F(r, p) = nmf_flush(F(r, p) - gradient / diag);
+          }
+          break;
+
+        case viennacl::linalg::nmf_config::anls:
+        {
+          if (lipschitz <= 0)
+            break;
+          // accelerated projected gradient (Nesterov) for min_{x >= 0} 0.5 x^T G x - N(:,p)^T x:
+          for (vcl_size_t r = 0; r < k; ++r)
+            x[r] = y[r] = F(r, p);
+          NumericT t = 1;
+          for (vcl_size_t it = 0; it < conf.inner_iterations(); ++it)
+          {
+            for (vcl_size_t r = 0; r < k; ++r)
+            {
+              NumericT value = 0;
+              for (vcl_size_t s = 0; s < k; ++s)
+                value += G_data[r * k + s] * y[s];
+              Gy[r] = value;
+            }
+            NumericT t_new = (NumericT(1) + std::sqrt(NumericT(1) + NumericT(4) * t * t)) / NumericT(2);
+            for (vcl_size_t r = 0; r < k; ++r)
+            {
+              x_old[r] = x[r];
+              x[r] = nmf_flush(y[r] - (Gy[r] - N(r, p)) / lipschitz);
+              y[r] = x[r] + ((t - NumericT(1)) / t_new) * (x[r] - x_old[r]);
+            }
+            t = t_new;
+          }
+          for (vcl_size_t r = 0; r < k; ++r)
+            F(r, p) = nmf_flush(x[r]);
+          break;
+        }
+
+        default:
+          // multiplicative update F <- F .* N ./ (G F):
+          for (vcl_size_t r = 0; r < k; ++r)
+          {
+            NumericT divisor = 0;
+            for (vcl_size_t s = 0; s < k; ++s)
+              divisor += G_data[r * k + s] * F(s, p);
+            x[r] = divisor;
+          }
+          for (vcl_size_t r = 0; r < k; ++r)
+            F(r, p) = nmf_flush((x[r] > NumericT(0.00001)) ? (F(r, p) * N(r, p) / x[r]) : NumericT(0));
+        }
+      }
     }
   }
 
-  /** @brief The nonnegative matrix factorization (approximation) algorithm as suggested by Lee and Seung. Factorizes a matrix V with nonnegative entries into matrices W and H such that ||V - W*H|| is minimized.
-   *
-   * @param V     Input matrix
-   * @param W     First factor
-   * @param H     Second factor
-   * @param conf  A configuration object holding tolerances and the like
-   */
+  /** @brief Returns the sum of the entrywise products of A and B in double precision */
   template<typename NumericT>
-  void nmf(viennacl::matrix_base<NumericT> const & V,
-           viennacl::matrix_base<NumericT> & W,
-           viennacl::matrix_base<NumericT> & H,
-           viennacl::linalg::nmf_config const & conf)
+  double nmf_inner_product(nmf_view<NumericT> A, nmf_view<NumericT> B, vcl_size_t k, vcl_size_t count)
+  {
+    double result = 0;
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for reduction(+: result) if (count * k > VIENNACL_OPENMP_NMF_MIN_SIZE)
+#endif
+    for (long p2 = 0; p2 < static_cast<long>(count); ++p2)
+    {
+      vcl_size_t p = static_cast<vcl_size_t>(p2);
+      for (vcl_size_t r = 0; r < k; ++r)
+        result += double(A(r, p)) * double(B(r, p));
+    }
+    return result;
+  }
+
+  /** @brief Products of a dense matrix V with the factors for the updates */
+  template<typename NumericT>
+  class nmf_dense_input
+  {
+  public:
+    nmf_dense_input(viennacl::matrix_base<NumericT> const & V) : V_(V) {}
+
+    /** @brief Computes VtW = V^T W (n-by-k) */
+    void trans_prod(viennacl::matrix_base<NumericT> const & W, viennacl::matrix_base<NumericT> & VtW) { VtW = viennacl::linalg::prod(trans(V_), W); }
+    /** @brief Computes VHt = V H^T (m-by-k) */
+    void prod_trans(viennacl::matrix_base<NumericT> const & H, viennacl::matrix_base<NumericT> & VHt) { VHt = viennacl::linalg::prod(V_, trans(H)); }
+
+    double norm_frobenius_squared() const
+    {
+      double norm = viennacl::linalg::norm_frobenius(V_);
+      return norm * norm;
+    }
+
+    /** @brief Computes ||V - W H||_F explicitly, used if the evaluation from the Gram matrices suffers from cancellation */
+    NumericT residual(viennacl::matrix_base<NumericT> const & W, viennacl::matrix_base<NumericT> const & H) const
+    {
+      viennacl::matrix_base<NumericT> appr(V_.size1(), V_.size2(), V_.row_major(), viennacl::traits::context(V_));
+      appr = viennacl::linalg::prod(W, H);
+      appr -= V_;
+      return viennacl::linalg::norm_frobenius(appr);
+    }
+
+  private:
+    viennacl::matrix_base<NumericT> const & V_;
+  };
+
+  /** @brief Products of a sparse matrix V with the factors for the updates. The transpose of V is set up once. */
+  template<typename NumericT>
+  class nmf_sparse_input
+  {
+  public:
+    nmf_sparse_input(viennacl::compressed_matrix<NumericT> const & V) : V_(V)
+    {
+      viennacl::linalg::host_based::amg::amg_transpose(V_, Vt_);
+    }
+
+    /** @brief Computes VtW = V^T W (n-by-k) */
+    void trans_prod(viennacl::matrix_base<NumericT> const & W, viennacl::matrix_base<NumericT> & VtW) { viennacl::linalg::host_based::prod_impl(Vt_, W, VtW); }
+    /** @brief Computes VHt = V H^T (m-by-k) */
+    void prod_trans(viennacl::matrix_base<NumericT> const & H, viennacl::matrix_base<NumericT> & VHt) { viennacl::linalg::host_based::prod_impl(V_, trans(H), VHt); }
+
+    double norm_frobenius_squared() const
+    {
+      NumericT const * elements = extract_raw_pointer<NumericT>(V_.handle());
+      double norm = 0;
+      for (vcl_size_t i = 0; i < V_.nnz(); ++i)
+        norm += double(elements[i]) * double(elements[i]);
+      return norm;
+    }
+
+    /** @brief The explicit residual would require a dense m-by-n matrix, hence only the evaluation from the Gram matrices is used */
+    NumericT residual(viennacl::matrix_base<NumericT> const &, viennacl::matrix_base<NumericT> const &) const { return NumericT(-1); }
+
+  private:
+    viennacl::compressed_matrix<NumericT> const & V_;
+    viennacl::compressed_matrix<NumericT> Vt_;
+  };
+
+  /** @brief Runs the NMF iteration for the input V wrapped by InputT. See nmf() for details. */
+  template<typename NumericT, typename InputT>
+  void nmf_impl(InputT & input, vcl_size_t m, vcl_size_t n,
+                viennacl::matrix_base<NumericT> & W,
+                viennacl::matrix_base<NumericT> & H,
+                viennacl::linalg::nmf_config const & conf)
   {
     vcl_size_t k = W.size2();
+    viennacl::context ctx = viennacl::traits::context(W);
     conf.iters_ = 0;
 
     if (viennacl::linalg::norm_frobenius(W) <= 0)
@@ -167,50 +428,58 @@ namespace host_based
     if (viennacl::linalg::norm_frobenius(H) <= 0)
       H = viennacl::scalar_matrix<NumericT>(H.size1(), H.size2(), NumericT(1.0));
 
-    viennacl::matrix_base<NumericT> wn(V.size1(), k, W.row_major());
-    viennacl::matrix_base<NumericT> wd(V.size1(), k, W.row_major());
-    viennacl::matrix_base<NumericT> wtmp(V.size1(), V.size2(), W.row_major());
+    // workspace, reused in all iterations:
+    viennacl::matrix_base<NumericT> VtW(n, k, true, ctx);
+    viennacl::matrix_base<NumericT> VHt(m, k, true, ctx);
+    viennacl::matrix_base<NumericT> WtW(k, k, true, ctx);
+    viennacl::matrix_base<NumericT> HHt(k, k, true, ctx);
+    std::vector<NumericT> G_W, G_H;
 
-    viennacl::matrix_base<NumericT> hn(k, V.size2(), H.row_major());
-    viennacl::matrix_base<NumericT> hd(k, V.size2(), H.row_major());
-    viennacl::matrix_base<NumericT> htmp(k, k, H.row_major());
+    nmf_view<NumericT> view_W   = nmf_make_view(W, false);    // r: column of W, p: row of W
+    nmf_view<NumericT> view_H   = nmf_make_view(H, true);     // r: row of H, p: column of H
+    nmf_view<NumericT> view_VtW = nmf_make_view(VtW, false);
+    nmf_view<NumericT> view_VHt = nmf_make_view(VHt, false);
 
-    viennacl::matrix_base<NumericT> appr(V.size1(), V.size2(), V.row_major());
+    double norm_V_squared = input.norm_frobenius_squared();
 
     NumericT last_diff = 0;
     NumericT diff_init = 0;
     bool stagnation_flag = false;
 
+    WtW = viennacl::linalg::prod(trans(W), W);
+    nmf_gram_to_array(WtW, G_W);
+
     for (vcl_size_t i = 0; i < conf.max_iterations(); i++)
     {
       conf.iters_ = i + 1;
 
-      hn   = viennacl::linalg::prod(trans(W), V);
-      htmp = viennacl::linalg::prod(trans(W), W);
-      hd   = viennacl::linalg::prod(htmp, H);
-
-      NumericT * data_H  = detail::extract_raw_pointer<NumericT>(H);
-      NumericT * data_hn = detail::extract_raw_pointer<NumericT>(hn);
-      NumericT * data_hd = detail::extract_raw_pointer<NumericT>(hd);
-
-      viennacl::linalg::host_based::el_wise_mul_div(data_H, data_hn, data_hd, H.internal_size1() * H.internal_size2());
+      input.trans_prod(W, VtW);
+      nmf_update_factor(view_H, view_VtW, G_W, k, n, conf);
 
-      wn   = viennacl::linalg::prod(V, trans(H));
-      wtmp = viennacl::linalg::prod(W, H);
-      wd   = viennacl::linalg::prod(wtmp, trans(H));
+      HHt = viennacl::linalg::prod(H, trans(H));
+      nmf_gram_to_array(HHt, G_H);
+      input.prod_trans(H, VHt);
+      nmf_update_factor(view_W, view_VHt, G_H, k, m, conf);
 
-      NumericT * data_W  = detail::extract_raw_pointer<NumericT>(W);
-      NumericT * data_wn = detail::extract_raw_pointer<NumericT>(wn);
-      NumericT * data_wd = detail::extract_raw_pointer<NumericT>(wd);
-
-      viennacl::linalg::host_based::el_wise_mul_div(data_W, data_wn, data_wd, W.internal_size1() * W.internal_size2());
+      WtW = viennacl::linalg::prod(trans(W), W);
+      nmf_gram_to_array(WtW, G_W);
 
       if (i % conf.check_after_steps() == 0)  //check for convergence
       {
-        appr = viennacl::linalg::prod(W, H);
-
-        appr -= V;
-        NumericT diff_val = viennacl::linalg::norm_frobenius(appr);
+        // ||V - W H||^2 = ||V||^2 - 2 <W, V H^T> + <W^T W, H H^T>, no reconstruction of W H required:
+        double gram_term = 0;
+        for (vcl_size_t j = 0; j < k * k; ++j)
+          gram_term += double(G_W[j]) * double(G_H[j]);
+        double diff_squared = norm_V_squared - 2.0 * nmf_inner_product(view_W, view_VHt, k, m) + gram_term;
+
+        // the evaluation suffers from cancellation for small residuals, fall back to the explicit residual if available:
+        NumericT diff_val = NumericT(std::sqrt(std::max(diff_squared, 0.0)));
+        if (diff_squared < 1000.0 * double(std::numeric_limits<NumericT>::epsilon()) * norm_V_squared)
+        {
+          NumericT explicit_diff = input.residual(W, H);
+          if (explicit_diff >= 0)
+            diff_val = explicit_diff;
+        }
 
         if (i == 0)
           diff_init = diff_val;
@@ -239,6 +508,45 @@ namespace host_based
       }
     }
   }
+} //namespace detail
+
+  /** @brief The nonnegative matrix factorization (approximation) algorithm. Factorizes a matrix V with nonnegative entries into matrices W and H such that ||V - W*H|| is minimized.
+   *
+   * The update scheme (multiplicative updates as suggested by Lee and Seung, HALS, or ANLS) is selected in the configuration object.
+   * All schemes only require the products V^T W and V H^T as well as the Gram matrices W^T W and H H^T, which are computed into a workspace allocated once.
+   * The residual for the convergence check is evaluated from these matrices as well.
+   *
+   * @param V     Input matrix
+   * @param W     First factor
+   * @param H     Second factor
+   * @param conf  A configuration object holding tolerances and the like
+   */
+  template<typename NumericT>
+  void nmf(viennacl::matrix_base<NumericT> const & V,
+           viennacl::matrix_base<NumericT> & W,
+           viennacl::matrix_base<NumericT> & H,
+           viennacl::linalg::nmf_config const & conf)
+  {
+    detail::nmf_dense_input<NumericT> input(V);
+    detail::nmf_impl(input, V.size1(), V.size2(), W, H, conf);
+  }
+
+  /** @brief The nonnegative matrix factorization (approximation) algorithm for a sparse matrix V. See the overload for dense matrices for details.
+   *
+   * @param V     Input matrix
+   * @param W     First factor
+   * @param H     Second factor
+   * @param conf  A configuration object holding tolerances and the like
+   */
+  template<typename NumericT>
+  void nmf(viennacl::compressed_matrix<NumericT> const & V,
+           viennacl::matrix_base<NumericT> & W,
+           viennacl::matrix_base<NumericT> & H,
+           viennacl::linalg::nmf_config const & conf)
+  {
+    detail::nmf_sparse_input<NumericT> input(V);
+    detail::nmf_impl(input, V.size1(), V.size2(), W, H, conf);
+  }
 
 } //namespace host_based
 } //namespace linalg
@@ -0,0 +1,587 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_REORDER_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_REORDER_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/reorder_operations.hpp
+    @brief Implementations of reorderings (Cuthill-McKee, nested dissection) and of symmetric permutations of sparse matrices using the host (OpenMP)
+
+    All routines work directly on the CSR arrays of a compressed_matrix, whose sparsity pattern is assumed to be structurally symmetric.
+    Breadth-first searches are carried out level by level, where the neighbors of each level are collected in parallel.
+*/
+
+#include <vector>
+#include <algorithm>  //for std::sort, std::min
+#include <utility>    //for std::pair
+
+#include "viennacl/forwards.h"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/vector.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+// Minimum number of nodes in a level set (or rows of a matrix) for using OpenMP in reorderings:
+#ifndef VIENNACL_OPENMP_REORDER_MIN_SIZE
+  #define VIENNACL_OPENMP_REORDER_MIN_SIZE  5000
+#endif
+
+namespace viennacl
+{
+namespace linalg
+{
+namespace host_based
+{
+namespace detail
+{
+  /** @brief Marker for nodes not reached by a breadth-first search, or not assigned a position yet */
+  static const unsigned int reorder_unassigned = ~0u;
+
+  /** @brief Workspace for breadth-first searches. One per thread when several searches run concurrently. */
+  struct reorder_workspace
+  {
+    reorder_workspace()
+    {
+#ifdef VIENNACL_WITH_OPENMP
+      buffers.resize(static_cast<vcl_size_t>(omp_get_max_threads()));
+#else
+      buffers.resize(1);
+#endif
+    }
+
+    std::vector<unsigned int> nodes;                   // nodes in the order of discovery, grouped by levels
+    std::vector<unsigned int> level_ptr;               // level l consists of nodes[level_ptr[l]], ..., nodes[level_ptr[l+1]-1]
+    std::vector<std::vector<unsigned int> > buffers;   // neighbors collected from each block of a level
+  };
+
+  /** @brief Computes the level sets of a breadth-first search rooted at 'root'.
+    *
+    * Only nodes with the same entry in 'part' as the root are visited (all nodes if part is NULL).
+    * The level of each visited node is written to 'level_of', which has to hold reorder_unassigned for all nodes to be visited.
+    * The neighbors of a level are collected in parallel from contiguous blocks of the level and merged in block order, so the result does not depend on the number of threads.
+    */
+  inline void bfs_level_sets(unsigned int const * row_buffer, unsigned int const * col_buffer,
+                             unsigned int root, unsigned int const * part,
+                             std::vector<unsigned int> & level_of, reorder_workspace & ws)
+  {
+    unsigned int part_id = part ? part[root] : 0;
+    long num_blocks = static_cast<long>(ws.buffers.size());
+
+    ws.nodes.clear();
+    ws.level_ptr.clear();
+    ws.nodes.push_back(root);
+    ws.level_ptr.push_back(0);
+    ws.level_ptr.push_back(1);
+    level_of[root] = 0;
+
+    for (unsigned int level = 0; ws.level_ptr[level] < ws.level_ptr[level + 1]; ++level)
+    {
+      vcl_size_t level_start = ws.level_ptr[level];
+      vcl_size_t level_size  = ws.level_ptr[level + 1] - level_start;
+
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if (level_size > VIENNACL_OPENMP_REORDER_MIN_SIZE)
+#endif
+      for (long block = 0; block < num_blocks; ++block)
+      {
+        std::vector<unsigned int> & buffer = ws.buffers[vcl_size_t(block)];
+        buffer.clear();
+        vcl_size_t block_start = level_start + level_size *  vcl_size_t(block)      / vcl_size_t(num_blocks);
+        vcl_size_t block_stop  = level_start + level_size * (vcl_size_t(block) + 1) / vcl_size_t(num_blocks);
+        for (vcl_size_t i = block_start; i < block_stop; ++i)
+        {
+          unsigned int node = ws.nodes[i];
+          for (unsigned int k = row_buffer[node]; k < row_buffer[node + 1]; ++k)
+          {
+            unsigned int neighbor = col_buffer[k];
+            if ((!part || part[neighbor] == part_id) && level_of[neighbor] == reorder_unassigned)
+              buffer.push_back(neighbor);
+          }
+        }
+      }
+
+      // merge, dropping nodes reached from several blocks:
+      for (vcl_size_t block = 0; block < ws.buffers.size(); ++block)
+        for (vcl_size_t i = 0; i < ws.buffers[block].size(); ++i)
+        {
+          unsigned int node = ws.buffers[block][i];
+          if (level_of[node] == reorder_unassigned)
+          {
+            level_of[node] = level + 1;
+            ws.nodes.push_back(node);
+          }
+        }
+      ws.level_ptr.push_back(static_cast<unsigned int>(ws.nodes.size()));
+    }
+    ws.level_ptr.pop_back(); // the last level is empty
+  }
+
+  /** @brief Resets 'level_of' for all nodes visited by the last breadth-first search in 'ws' */
+  inline void bfs_reset(std::vector<unsigned int> & level_of, reorder_workspace const & ws)
+  {
+    for (vcl_size_t i = 0; i < ws.nodes.size(); ++i)
+      level_of[ws.nodes[i]] = reorder_unassigned;
+  }
+
+  /** @brief Finds a pseudo-peripheral node in the connected component of 'start' (restricted to the part of 'start', if part is not NULL).
+    *
+    * Following the algorithm by N. Gibbs, W. Poole and P. Stockmeyer as refined by A. George and J. Liu:
+    * Starting from 'start', a breadth-first search is repeated from a node of minimum degree in the last level set as long as the number of levels increases.
+    * At most max_sweeps further searches are carried out.
+    * On return, 'ws' holds the level sets rooted at the returned node and 'level_of' holds their levels.
+    */
+  inline unsigned int pseudo_peripheral_node(unsigned int const * row_buffer, unsigned int const * col_buffer,
+                                             unsigned int start, unsigned int const * part,
+                                             std::vector<unsigned int> & level_of, reorder_workspace & ws,
+                                             vcl_size_t max_sweeps = ~vcl_size_t(0))
+  {
+    unsigned int root = start;
+    bfs_level_sets(row_buffer, col_buffer, root, part, level_of, ws);
+    vcl_size_t num_levels = ws.level_ptr.size() - 1;
+
+    for (vcl_size_t sweep = 0; sweep < max_sweeps; ++sweep)
+    {
+      unsigned int candidate = ws.nodes[ws.level_ptr[num_levels - 1]];
+      for (vcl_size_t i = ws.level_ptr[num_levels - 1]; i < ws.level_ptr[num_levels]; ++i)
+      {
+        unsigned int node = ws.nodes[i];
+        if (row_buffer[node + 1] - row_buffer[node] < row_buffer[candidate + 1] - row_buffer[candidate])
+          candidate = node;
+      }
+
+      bfs_reset(level_of, ws);
+      bfs_level_sets(row_buffer, col_buffer, candidate, part, level_of, ws);
+      vcl_size_t candidate_levels = ws.level_ptr.size() - 1;
+      if (candidate_levels < num_levels) // restore the level sets of the root
+      {
+        bfs_reset(level_of, ws);
+        bfs_level_sets(row_buffer, col_buffer, root, part, level_of, ws);
+        break;
+      }
+
+      root = candidate;  // a candidate with the same number of levels is just as good
+      if (candidate_levels == num_levels)
+        break;
+      num_levels = candidate_levels;
+    }
+
+    return root;
+  }
+
+  /** @brief Sort key of a node within its level set in the Cuthill-McKee ordering */
+  struct cuthill_mckee_key
+  {
+    unsigned int parent_position;  // smallest position of a neighbor in the previous level
+    unsigned int degree;
+    unsigned int node;
+
+    bool operator<(cuthill_mckee_key const & other) const
+    {
+      if (parent_position != other.parent_position)
+        return parent_position < other.parent_position;
+      if (degree != other.degree)
+        return degree < other.degree;
+      return node < other.node;
+    }
+  };
+} //namespace detail
+
+
+/** @brief Computes the (reverse) Cuthill-McKee ordering of the adjacency graph of a sparse matrix in host memory.
+  *
+  * Each connected component is started from a pseudo-peripheral node. Instead of processing the nodes one after another, the ordering is built level set by level set:
+  * Within a level, nodes are sorted by the position of their first ordered neighbor in the previous level and by their degree, which yields the same ordering as the classical algorithm.
+  * Both the level sets and the sort keys are computed in parallel.
+  *
+  * @param A          The sparse matrix with structurally symmetric pattern
+  * @param reverse    If true, the reverse Cuthill-McKee ordering is returned
+  * @return Permutation vector r, where r[i] is the new label of node i
+  */
+template<typename NumericT, unsigned int AlignmentV>
+std::vector<unsigned int> cuthill_mckee(viennacl::compressed_matrix<NumericT, AlignmentV> const & A, bool reverse)
+{
+  unsigned int const * row_buffer = detail::extract_raw_pointer<unsigned int>(A.handle1());
+  unsigned int const * col_buffer = detail::extract_raw_pointer<unsigned int>(A.handle2());
+  vcl_size_t n = A.size1();
+
+  std::vector<unsigned int> position(n, detail::reorder_unassigned);
+  std::vector<unsigned int> level_of(n, detail::reorder_unassigned);
+  std::vector<detail::cuthill_mckee_key> keys;
+  detail::reorder_workspace ws;
+
+  unsigned int current_position = 0;
+  for (vcl_size_t start = 0; start < n; ++start)
+  {
+    if (position[start] != detail::reorder_unassigned)
+      continue;
+
+    unsigned int root = detail::pseudo_peripheral_node(row_buffer, col_buffer, static_cast<unsigned int>(start), NULL, level_of, ws);
+    position[root] = current_position++;
+
+    for (vcl_size_t level = 1; level + 1 < ws.level_ptr.size(); ++level)
+    {
+      vcl_size_t level_start = ws.level_ptr[level];
+      vcl_size_t level_size  = ws.level_ptr[level + 1] - level_start;
+      keys.resize(level_size);
+
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if (level_size > VIENNACL_OPENMP_REORDER_MIN_SIZE)
+#endif
+      for (long i2 = 0; i2 < long(level_size); ++i2)
+      {
+        vcl_size_t i = vcl_size_t(i2);
+        unsigned int node = ws.nodes[level_start + i];
+        unsigned int parent_position = detail::reorder_unassigned;
+        for (unsigned int k = row_buffer[node]; k < row_buffer[node + 1]; ++k)
+          parent_position = std::min(parent_position, position[col_buffer[k]]);  // nodes of this and the next level are not ordered yet
+
+        keys[i].parent_position = parent_position;
+        keys[i].degree          = row_buffer[node + 1] - row_buffer[node];
+        keys[i].node            = node;
+      }
+
+      std::sort(keys.begin(), keys.end());
+      for (vcl_size_t i = 0; i < level_size; ++i)
+        position[keys[i].node] = current_position++;
+    }
+    // the nodes of this component keep their levels, so they are never visited again
+  }
+
+  if (reverse)
+  {
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (n > VIENNACL_OPENMP_REORDER_MIN_SIZE)
+#endif
+    for (long i = 0; i < long(n); ++i)
+      position[vcl_size_t(i)] = static_cast<unsigned int>(n) - 1 - position[vcl_size_t(i)];
+  }
+
+  return position;
+}
+
+
+/** @brief Computes the symmetric permutation B = P A P^T of a sparse matrix in host memory, i.e. B(r[i], r[j]) = A(i, j)
+  *
+  * @param A   The sparse matrix
+  * @param r   Permutation vector, where r[i] is the new label of row and column i
+  * @param B   The permuted matrix
+  */
+template<typename NumericT, unsigned int AlignmentV>
+void permute(viennacl::compressed_matrix<NumericT, AlignmentV> const & A, std::vector<unsigned int> const & r,
+             viennacl::compressed_matrix<NumericT, AlignmentV> & B)
+{
+  assert(A.size1() == A.size2() && A.size1() == r.size() && bool("Size mismatch"));
+
+  NumericT     const * A_elements   = detail::extract_raw_pointer<NumericT>(A.handle());
+  unsigned int const * A_row_buffer = detail::extract_raw_pointer<unsigned int>(A.handle1());
+  unsigned int const * A_col_buffer = detail::extract_raw_pointer<unsigned int>(A.handle2());
+  vcl_size_t n = A.size1();
+
+  B = viennacl::compressed_matrix<NumericT, AlignmentV>(n, n, A.nnz(), viennacl::traits::context(A));
+
+  NumericT     * B_elements   = detail::extract_raw_pointer<NumericT>(B.handle());
+  unsigned int * B_row_buffer = detail::extract_raw_pointer<unsigned int>(B.handle1());
+  unsigned int * B_col_buffer = detail::extract_raw_pointer<unsigned int>(B.handle2());
+
+  // row lengths of B, moved to the new row indices:
+  std::vector<unsigned int> inverse(n);
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for if (n > VIENNACL_OPENMP_REORDER_MIN_SIZE)
+#endif
+  for (long i2 = 0; i2 < long(n); ++i2)
+  {
+    vcl_size_t i = vcl_size_t(i2);
+    inverse[r[i]] = static_cast<unsigned int>(i);
+    B_row_buffer[r[i]] = A_row_buffer[i + 1] - A_row_buffer[i];
+  }
+
+  // exclusive scan:
+  unsigned int offset = 0;
+  for (vcl_size_t i = 0; i < n; ++i)
+  {
+    unsigned int tmp = B_row_buffer[i];
+    B_row_buffer[i] = offset;
+    offset += tmp;
+  }
+  B_row_buffer[n] = offset;
+
+  // relabel the columns of each row and restore their ascending order:
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for if (n > VIENNACL_OPENMP_REORDER_MIN_SIZE)
+#endif
+  for (long row2 = 0; row2 < long(n); ++row2)
+  {
+    vcl_size_t row = vcl_size_t(row2);
+    unsigned int A_row = inverse[row];
+    unsigned int A_start = A_row_buffer[A_row];
+    unsigned int B_start = B_row_buffer[row];
+    unsigned int length = A_row_buffer[A_row + 1] - A_start;
+
+    if (length > 32) // long rows: sort (column, value) pairs
+    {
+      std::vector<std::pair<unsigned int, NumericT> > entries(length);
+      for (unsigned int k = 0; k < length; ++k)
+        entries[k] = std::make_pair(r[A_col_buffer[A_start + k]], A_elements[A_start + k]);
+      std::sort(entries.begin(), entries.end());
+      for (unsigned int k = 0; k < length; ++k)
+      {
+        B_col_buffer[B_start + k] = entries[k].first;
+        B_elements[B_start + k]   = entries[k].second;
+      }
+      continue;
+    }
+
+    for (unsigned int k = 0; k < length; ++k) // short rows: insertion sort
+    {
+      unsigned int col   = r[A_col_buffer[A_start + k]];
+      NumericT     value = A_elements[A_start + k];
+
+      unsigned int pos = B_start + k;
+      while (pos > B_start && B_col_buffer[pos - 1] > col)
+      {
+        B_col_buffer[pos] = B_col_buffer[pos - 1];
+        B_elements[pos]   = B_elements[pos - 1];
+        --pos;
+      }
+      B_col_buffer[pos] = col;
+      B_elements[pos]   = value;
+    }
+  }
+
+  B.generate_row_block_information();
+}
+
+/** @brief Permutes the entries of a vector in host memory, y[r[i]] = x[i]
+  *
+  * @param x   The vector to be permuted
+  * @param r   Permutation vector, where r[i] is the new index of entry i
+  * @param y   The permuted vector
+  */
+template<typename NumericT>
+void permute(viennacl::vector_base<NumericT> const & x, std::vector<unsigned int> const & r, viennacl::vector_base<NumericT> & y)
+{
+  assert(x.size() == r.size() && y.size() == r.size() && bool("Size mismatch"));
+
+  NumericT const * data_x = detail::extract_raw_pointer<NumericT>(x);
+  NumericT       * data_y = detail::extract_raw_pointer<NumericT>(y);
+  vcl_size_t start_x = viennacl::traits::start(x), inc_x = viennacl::traits::stride(x);
+  vcl_size_t start_y = viennacl::traits::start(y), inc_y = viennacl::traits::stride(y);
+
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for if (r.size() > VIENNACL_OPENMP_REORDER_MIN_SIZE)
+#endif
+  for (long i2 = 0; i2 < long(r.size()); ++i2)
+  {
+    vcl_size_t i = vcl_size_t(i2);
+    data_y[start_y + r[i] * inc_y] = data_x[start_x + i * inc_x];
+  }
+}
+
+/** @brief Undoes the permutation of the entries of a vector in host memory, x[i] = y[r[i]]
+  *
+  * @param y   The permuted vector
+  * @param r   Permutation vector, where r[i] is the new index of entry i
+  * @param x   The vector in the original ordering
+  */
+template<typename NumericT>
+void inverse_permute(viennacl::vector_base<NumericT> const & y, std::vector<unsigned int> const & r, viennacl::vector_base<NumericT> & x)
+{
+  assert(x.size() == r.size() && y.size() == r.size() && bool("Size mismatch"));
+
+  NumericT const * data_y = detail::extract_raw_pointer<NumericT>(y);
+  NumericT       * data_x = detail::extract_raw_pointer<NumericT>(x);
+  vcl_size_t start_x = viennacl::traits::start(x), inc_x = viennacl::traits::stride(x);
+  vcl_size_t start_y = viennacl::traits::start(y), inc_y = viennacl::traits::stride(y);
+
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for if (r.size() > VIENNACL_OPENMP_REORDER_MIN_SIZE)
+#endif
+  for (long i2 = 0; i2 < long(r.size()); ++i2)
+  {
+    vcl_size_t i = vcl_size_t(i2);
+    data_x[start_x + i * inc_x] = data_y[start_y + r[i] * inc_y];
+  }
+}
+
+namespace detail
+{
+  /** @brief A subgraph in the nested dissection, which is ordered into the positions begin, begin+1, ..., begin + nodes.size() - 1 */
+  struct dissection_part
+  {
+    unsigned int begin;
+    std::vector<unsigned int> nodes;
+  };
+
+  /** @brief Splits a part of the graph into two parts and a separator, which is ordered last. Parts with at most leaf_size nodes are ordered directly.
+    *
+    * The separator is the middle level set of a breadth-first search from a pseudo-peripheral node. If the part is not connected, the component of its first node is split off without separator.
+    * Only positions of nodes in this part are written, 'part' is only read, so different parts can be processed concurrently.
+    */
+  inline void dissect(unsigned int const * row_buffer, unsigned int const * col_buffer, unsigned int const * part,
+                      dissection_part const & current, vcl_size_t leaf_size,
+                      std::vector<unsigned int> & position, std::vector<unsigned int> & level_of, reorder_workspace & ws,
+                      dissection_part & first, dissection_part & second)
+  {
+    first.nodes.clear();
+    second.nodes.clear();
+
+    vcl_size_t size = current.nodes.size();
+    if (size <= leaf_size)
+    {
+      for (vcl_size_t i = 0; i < size; ++i)
+        position[current.nodes[i]] = current.begin + static_cast<unsigned int>(i);
+      return;
+    }
+
+    // a single sweep suffices for a balanced separator, further sweeps hardly change it:
+    pseudo_peripheral_node(row_buffer, col_buffer, current.nodes[0], part, level_of, ws, 1);
+    vcl_size_t num_levels = ws.level_ptr.size() - 1;
+
+    if (ws.nodes.size() < size) // not connected: split off the component
+    {
+      first.nodes.assign(ws.nodes.begin(), ws.nodes.end());
+      for (vcl_size_t i = 0; i < size; ++i)
+        if (level_of[current.nodes[i]] == reorder_unassigned)
+          second.nodes.push_back(current.nodes[i]);
+      bfs_reset(level_of, ws);
+    }
+    else if (num_levels < 3) // no separating level set
+    {
+      for (vcl_size_t i = 0; i < size; ++i)
+        position[ws.nodes[i]] = current.begin + static_cast<unsigned int>(i);
+      bfs_reset(level_of, ws);
+      return;
+    }
+    else
+    {
+      vcl_size_t separator_level = 1;
+      while (separator_level + 2 < num_levels && 2 * ws.level_ptr[separator_level + 1] < size)
+        ++separator_level;
+
+      vcl_size_t separator_start = ws.level_ptr[separator_level];
+      vcl_size_t separator_stop  = ws.level_ptr[separator_level + 1];
+      first.nodes.assign(ws.nodes.begin(), ws.nodes.begin() + static_cast<long>(separator_start));
+      second.nodes.assign(ws.nodes.begin() + static_cast<long>(separator_stop), ws.nodes.end());
+
+      unsigned int separator_position = current.begin + static_cast<unsigned int>(size - (separator_stop - separator_start));
+      for (vcl_size_t i = separator_start; i < separator_stop; ++i)
+        position[ws.nodes[i]] = separator_position++;
+      bfs_reset(level_of, ws);
+    }
+
+    first.begin  = current.begin;
+    second.begin = current.begin + static_cast<unsigned int>(first.nodes.size());
+  }
+} //namespace detail
+
+
+/** @brief Computes a nested dissection ordering of the adjacency graph of a sparse matrix in host memory for reducing the fill-in of factorizations.
+  *
+  * The graph is recursively split into two parts by a level set separator, which is ordered after the two parts.
+  * All parts on the same level of the recursion are processed in parallel.
+  *
+  * @param A          The sparse matrix with structurally symmetric pattern
+  * @param leaf_size  Parts with at most this number of nodes are not split further
+  * @return Permutation vector r, where r[i] is the new label of node i
+  */
+template<typename NumericT, unsigned int AlignmentV>
+std::vector<unsigned int> nested_dissection(viennacl::compressed_matrix<NumericT, AlignmentV> const & A, vcl_size_t leaf_size)
+{
+  vcl_size_t n = A.size1();
+
+  // the subgraphs are dissected on a copy relabeled by Cuthill-McKee, in which they are stored in close-by rows:
+  std::vector<unsigned int> r = cuthill_mckee(A, false);
+  viennacl::compressed_matrix<NumericT, AlignmentV> A_cm(0, 0, 0, viennacl::traits::context(A));
+  permute(A, r, A_cm);
+
+  unsigned int const * row_buffer = detail::extract_raw_pointer<unsigned int>(A_cm.handle1());
+  unsigned int const * col_buffer = detail::extract_raw_pointer<unsigned int>(A_cm.handle2());
+
+  std::vector<unsigned int> position(n, detail::reorder_unassigned);
+  std::vector<unsigned int> level_of(n, detail::reorder_unassigned);
+  std::vector<unsigned int> part(n, 0);
+
+  std::vector<detail::dissection_part> current(1);
+  current[0].begin = 0;
+  current[0].nodes.resize(n);
+  for (vcl_size_t i = 0; i < n; ++i)
+    current[0].nodes[i] = static_cast<unsigned int>(i);
+  if (n == 0)
+    current.clear();
+
+  vcl_size_t num_workspaces = 1;
+#ifdef VIENNACL_WITH_OPENMP
+  num_workspaces = static_cast<vcl_size_t>(omp_get_max_threads());
+#endif
+  std::vector<detail::reorder_workspace> ws(num_workspaces);
+
+  while (current.size() > 0)
+  {
+    std::vector<detail::dissection_part> children(2 * current.size());
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for schedule(dynamic) if (current.size() > 1)
+#endif
+    for (long i = 0; i < long(current.size()); ++i)
+    {
+      vcl_size_t thread_id = 0;
+#ifdef VIENNACL_WITH_OPENMP
+      thread_id = static_cast<vcl_size_t>(omp_get_thread_num());
+#endif
+      detail::dissect(row_buffer, col_buffer, &part[0], current[vcl_size_t(i)], leaf_size, position, level_of, ws[thread_id],
+                      children[2 * vcl_size_t(i)], children[2 * vcl_size_t(i) + 1]);
+    }
+
+    // label the new parts, nodes already ordered do not belong to any part:
+    std::vector<detail::dissection_part> next;
+    for (vcl_size_t i = 0; i < current.size(); ++i)
+      for (vcl_size_t j = 0; j < current[i].nodes.size(); ++j)
+        part[current[i].nodes[j]] = detail::reorder_unassigned;
+    for (vcl_size_t i = 0; i < children.size(); ++i)
+    {
+      if (children[i].nodes.empty())
+        continue;
+      unsigned int part_id = static_cast<unsigned int>(next.size());
+      for (vcl_size_t j = 0; j < children[i].nodes.size(); ++j)
+        part[children[i].nodes[j]] = part_id;
+      next.push_back(detail::dissection_part());
+      next.back().begin = children[i].begin;
+      next.back().nodes.swap(children[i].nodes);
+    }
+    current.swap(next);
+  }
+
+  // positions of the original nodes:
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for if (n > VIENNACL_OPENMP_REORDER_MIN_SIZE)
+#endif
+  for (long i = 0; i < long(n); ++i)
+    r[vcl_size_t(i)] = position[r[vcl_size_t(i)]];
+
+  return r;
+}
+
+
+} // namespace host_based
+} //namespace linalg
+} //namespace viennacl
+
+
+#endif
@@ -0,0 +1,444 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_SPAI_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_SPAI_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the PDF manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/spai_operations.hpp
+    @brief Implementations of the setup of static-pattern sparse approximate inverse preconditioners (SPAI, FSPAI) using the host (OpenMP)
+
+    All small dense problems are solved in per-thread workspaces which are allocated once, the index sets are obtained directly from the CSR arrays.
+*/
+
+#include <cmath>
+#include <vector>
+#include <algorithm>  //for std::max, std::sort, std::lower_bound
+
+#include "viennacl/forwards.h"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+// Minimum number of rows for using OpenMP in the SPAI setup:
+#ifndef VIENNACL_OPENMP_SPAI_MIN_SIZE
+  #define VIENNACL_OPENMP_SPAI_MIN_SIZE  500
+#endif
+
+namespace viennacl
+{
+namespace linalg
+{
+namespace host_based
+{
+namespace detail
+{
+  /** @brief Per-thread workspace for the small dense problems in the SPAI setup. Sized once for the largest problem.
+    *
+    * @param max_rows     Maximum number of rows of the dense problems
+    * @param max_cols     Maximum number of columns of the dense problems
+    * @param max_indices  Maximum number of indices gathered before duplicates are removed (SPAI only)
+    */
+  template<typename NumericT>
+  struct spai_workspace
+  {
+    void init(vcl_size_t max_rows, vcl_size_t max_cols, vcl_size_t max_indices = 0)
+    {
+      indices.resize(std::max<vcl_size_t>(max_indices, 1));
+      dense.resize(std::max<vcl_size_t>(max_rows * max_cols, 1));
+      rhs.resize(std::max<vcl_size_t>(max_rows, 1));
+    }
+
+    std::vector<unsigned int> indices;  // row index set I including duplicates (SPAI)
+    std::vector<NumericT>     dense;    // dense submatrix, column-major
+    std::vector<NumericT>     rhs;      // right hand side, overwritten with solution
+  };
+
+  /** @brief Returns the number of workspaces required, i.e. the maximum number of threads. */
+  inline unsigned int spai_num_workspaces()
+  {
+#ifdef VIENNACL_WITH_OPENMP
+    return static_cast<unsigned int>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+  }
+
+  /** @brief Returns the ID of the calling thread, used for picking the respective workspace. */
+  inline unsigned int spai_thread_id()
+  {
+#ifdef VIENNACL_WITH_OPENMP
+    return static_cast<unsigned int>(omp_get_thread_num());
+#else
+    return 0;
+#endif
+  }
+
+  /** @brief Solves the dense least squares problem min ||B x - b|| for a column-major matrix B (rows x cols, rows >= cols) using Householder QR in place.
+    *
+    * On exit, the first 'cols' entries of b hold the solution. Columns with vanishing diagonal entries in R result in a zero solution component.
+    */
+  template<typename NumericT>
+  void spai_dense_least_squares(NumericT * B, NumericT * b, vcl_size_t rows, vcl_size_t cols)
+  {
+    for (vcl_size_t j = 0; j < cols; ++j)
+    {
+      NumericT * B_j = B + j * rows;
+
+      // compute Householder vector for column j:
+      NumericT norm_sq = 0;
+      for (vcl_size_t i = j; i < rows; ++i)
+        norm_sq += B_j[i] * B_j[i];
+
+      if (norm_sq <= 0)
+        continue;
+
+      NumericT alpha = (B_j[j] > 0) ? -std::sqrt(norm_sq) : std::sqrt(norm_sq);
+      NumericT v_0   = B_j[j] - alpha;
+      NumericT v_norm_sq = norm_sq - B_j[j] * B_j[j] + v_0 * v_0;
+      B_j[j] = v_0;
+
+      // apply reflector I - 2 v v^T / (v^T v) to remaining columns and to b:
+      for (vcl_size_t k = j + 1; k < cols; ++k)
+      {
+        NumericT * B_k = B + k * rows;
+        NumericT s = 0;
+        for (vcl_size_t i = j; i < rows; ++i)
+          s += B_j[i] * B_k[i];
+        s = NumericT(2) * s / v_norm_sq;
+        for (vcl_size_t i = j; i < rows; ++i)
+          B_k[i] -= s * B_j[i];
+      }
+
+      NumericT s = 0;
+      for (vcl_size_t i = j; i < rows; ++i)
+        s += B_j[i] * b[i];
+      s = NumericT(2) * s / v_norm_sq;
+      for (vcl_size_t i = j; i < rows; ++i)
+        b[i] -= s * B_j[i];
+
+      B_j[j] = alpha; // diagonal entry of R
+    }
+
+    // back substitution with R:
+    for (vcl_size_t j2 = 0; j2 < cols; ++j2)
+    {
+      vcl_size_t j = cols - j2 - 1;
+      NumericT diag = B[j * rows + j];
+      NumericT x_j = (diag > 0 || diag < 0) ? b[j] / diag : NumericT(0);
+      b[j] = x_j;
+      for (vcl_size_t i = 0; i < j; ++i)
+        b[i] -= B[j * rows + i] * x_j;
+    }
+  }
+
+  /** @brief Solves the small dense symmetric positive definite system B x = b (column-major, n x n) using a Cholesky factorization in place. Returns false if B is not numerically positive definite. */
+  template<typename NumericT>
+  bool spai_dense_cholesky_solve(NumericT * B, NumericT * b, vcl_size_t n)
+  {
+    // factorization B = L L^T, L stored in lower triangle:
+    for (vcl_size_t j = 0; j < n; ++j)
+    {
+      NumericT d = B[j * n + j];
+      for (vcl_size_t k = 0; k < j; ++k)
+        d -= B[k * n + j] * B[k * n + j];
+      if (d <= 0)
+        return false;
+      d = std::sqrt(d);
+      B[j * n + j] = d;
+
+      for (vcl_size_t i = j + 1; i < n; ++i)
+      {
+        NumericT s = B[j * n + i];
+        for (vcl_size_t k = 0; k < j; ++k)
+          s -= B[k * n + i] * B[k * n + j];
+        B[j * n + i] = s / d;
+      }
+    }
+
+    // forward substitution:
+    for (vcl_size_t i = 0; i < n; ++i)
+    {
+      NumericT s = b[i];
+      for (vcl_size_t k = 0; k < i; ++k)
+        s -= B[k * n + i] * b[k];
+      b[i] = s / B[i * n + i];
+    }
+
+    // backward substitution:
+    for (vcl_size_t i2 = 0; i2 < n; ++i2)
+    {
+      vcl_size_t i = n - i2 - 1;
+      NumericT s = b[i];
+      for (vcl_size_t k = i + 1; k < n; ++k)
+        s -= B[i * n + k] * b[k];
+      b[i] = s / B[i * n + i];
+    }
+
+    return true;
+  }
+
+  /** @brief Returns the position of 'col' in the sorted index range [begin, end), or -1 if not found. */
+  inline long spai_find_index(unsigned int const * begin, unsigned int const * end, unsigned int col)
+  {
+    unsigned int const * it = std::lower_bound(begin, end, col);
+    return (it != end && *it == col) ? static_cast<long>(it - begin) : -1;
+  }
+}
+
+
+/** @brief Computes the static-pattern SPAI preconditioner M with M A approximately I, where M has the sparsity pattern of A.
+  *
+  * Row i of M is obtained from the least squares problem min || A^T(I,J) m - e_i(I) ||, where J is the column pattern of row i in A
+  * and I is the union of the column patterns of all rows of A in J. Rows of M are independent and computed in parallel.
+  * The pattern of M is not adapted, i.e. this is the static-pattern SPAI only.
+  *
+  * @param A   System matrix in host memory with sorted column indices per row
+  * @param M   Resulting preconditioner (left approximate inverse) in host memory
+  */
+template<typename NumericT, unsigned int AlignmentV>
+void spai_static_setup(compressed_matrix<NumericT, AlignmentV> const & A,
+                       compressed_matrix<NumericT, AlignmentV>       & M)
+{
+  unsigned int const * A_row_buffer = detail::extract_raw_pointer<unsigned int>(A.handle1());
+  unsigned int const * A_col_buffer = detail::extract_raw_pointer<unsigned int>(A.handle2());
+  NumericT     const * A_elements   = detail::extract_raw_pointer<NumericT>(A.handle());
+
+  long num_rows = static_cast<long>(A.size1());
+
+  //
+  // Stage 1: Determine workspace sizes. I is gathered including duplicates (max_gathered), the dense problems only hold the distinct indices (max_I).
+  //
+  vcl_size_t max_J = 0;
+  vcl_size_t max_I = 0;
+  vcl_size_t max_gathered = 0;
+  std::vector<long> last_row(A.size2(), -1);
+  for (long i = 0; i < num_rows; ++i)
+  {
+    unsigned int row_start = A_row_buffer[i];
+    unsigned int row_end   = A_row_buffer[i+1];
+    vcl_size_t size_gathered = 0;
+    vcl_size_t size_I = 0;
+    for (unsigned int k = row_start; k < row_end; ++k)
+    {
+      unsigned int row_k = A_col_buffer[k];
+      size_gathered += A_row_buffer[row_k+1] - A_row_buffer[row_k];
+      for (unsigned int l = A_row_buffer[row_k]; l < A_row_buffer[row_k+1]; ++l)
+        if (last_row[A_col_buffer[l]] != i)
+        {
+          last_row[A_col_buffer[l]] = i;
+          ++size_I;
+        }
+    }
+    max_J        = std::max<vcl_size_t>(max_J, row_end - row_start);
+    max_I        = std::max<vcl_size_t>(max_I, size_I);
+    max_gathered = std::max<vcl_size_t>(max_gathered, size_gathered);
+  }
+
+  std::vector<detail::spai_workspace<NumericT> > workspaces(detail::spai_num_workspaces());
+  for (std::size_t i = 0; i < workspaces.size(); ++i)
+    workspaces[i].init(max_I, max_J, max_gathered);
+
+  //
+  // Stage 2: Set up M with the pattern of A
+  //
+  M = compressed_matrix<NumericT, AlignmentV>(A.size1(), A.size2(), A.nnz(), viennacl::context(viennacl::MAIN_MEMORY));
+
+  unsigned int * M_row_buffer = detail::extract_raw_pointer<unsigned int>(M.handle1());
+  unsigned int * M_col_buffer = detail::extract_raw_pointer<unsigned int>(M.handle2());
+  NumericT     * M_elements   = detail::extract_raw_pointer<NumericT>(M.handle());
+
+  std::copy(A_row_buffer, A_row_buffer + A.size1() + 1, M_row_buffer);
+  std::copy(A_col_buffer, A_col_buffer + A.nnz(),       M_col_buffer);
+
+  //
+  // Stage 3: Solve least squares problems for each row
+  //
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for schedule(dynamic, 64) if (num_rows > VIENNACL_OPENMP_SPAI_MIN_SIZE)
+#endif
+  for (long i = 0; i < num_rows; ++i)
+  {
+    detail::spai_workspace<NumericT> & ws = workspaces[detail::spai_thread_id()];
+
+    unsigned int row_start = A_row_buffer[i];
+    unsigned int row_end   = A_row_buffer[i+1];
+    vcl_size_t size_J = row_end - row_start;
+
+    if (size_J == 0)
+      continue;
+
+    // index set I: union of column indices of rows in J
+    unsigned int * I = &(ws.indices[0]);
+    vcl_size_t size_I = 0;
+    for (unsigned int k = row_start; k < row_end; ++k)
+    {
+      unsigned int row_k = A_col_buffer[k];
+      for (unsigned int l = A_row_buffer[row_k]; l < A_row_buffer[row_k+1]; ++l)
+        I[size_I++] = A_col_buffer[l];
+    }
+    std::sort(I, I + size_I);
+    size_I = static_cast<vcl_size_t>(std::unique(I, I + size_I) - I);
+
+    // dense submatrix A^T(I,J) in column-major layout: column q holds row J_q of A
+    NumericT * B = &(ws.dense[0]);
+    std::fill(B, B + size_I * size_J, NumericT(0));
+    for (vcl_size_t q = 0; q < size_J; ++q)
+    {
+      unsigned int row_k = A_col_buffer[row_start + q];
+      for (unsigned int l = A_row_buffer[row_k]; l < A_row_buffer[row_k+1]; ++l)
+        B[q * size_I + static_cast<vcl_size_t>(detail::spai_find_index(I, I + size_I, A_col_buffer[l]))] = A_elements[l];
+    }
+
+    // right hand side e_i(I):
+    NumericT * b = &(ws.rhs[0]);
+    std::fill(b, b + size_I, NumericT(0));
+    long pos_i = detail::spai_find_index(I, I + size_I, static_cast<unsigned int>(i));
+    if (pos_i >= 0)
+      b[pos_i] = NumericT(1);
+
+    if (size_I < size_J) // underdetermined (cannot happen for matrices with nonzero diagonal), use zero row
+    {
+      std::fill(M_elements + row_start, M_elements + row_end, NumericT(0));
+      continue;
+    }
+
+    detail::spai_dense_least_squares(B, b, size_I, size_J);
+
+    std::copy(b, b + size_J, M_elements + row_start);
+  }
+
+  M.generate_row_block_information();
+}
+
+
+/** @brief Computes the lower triangular factor G of the static-pattern factorized sparse approximate inverse G^T G approximately A^{-1} for a symmetric positive definite matrix A.
+  *
+  * Row i of G has the pattern P_i of the lower triangular part of row i of A and is obtained from the small SPD system A(P_i,P_i) g = e_i, followed by scaling with 1/sqrt(g_i).
+  * Rows of G are independent and computed in parallel.
+  *
+  * @param A   Symmetric positive definite system matrix in host memory with sorted column indices per row
+  * @param G   Resulting lower triangular factor in host memory
+  */
+template<typename NumericT, unsigned int AlignmentV>
+void fspai_static_setup(compressed_matrix<NumericT, AlignmentV> const & A,
+                        compressed_matrix<NumericT, AlignmentV>       & G)
+{
+  unsigned int const * A_row_buffer = detail::extract_raw_pointer<unsigned int>(A.handle1());
+  unsigned int const * A_col_buffer = detail::extract_raw_pointer<unsigned int>(A.handle2());
+  NumericT     const * A_elements   = detail::extract_raw_pointer<NumericT>(A.handle());
+
+  long num_rows = static_cast<long>(A.size1());
+
+  //
+  // Stage 1: Pattern of G (lower triangular part of A) and workspace sizes
+  //
+  std::vector<unsigned int> G_row_lengths(A.size1() + 1);
+  vcl_size_t max_P = 0;
+  for (long i = 0; i < num_rows; ++i)
+  {
+    unsigned int row_start = A_row_buffer[i];
+    unsigned int row_end   = A_row_buffer[i+1];
+    unsigned int lower_end = static_cast<unsigned int>(std::upper_bound(A_col_buffer + row_start, A_col_buffer + row_end, static_cast<unsigned int>(i)) - A_col_buffer);
+    G_row_lengths[i] = lower_end - row_start;
+    max_P = std::max<vcl_size_t>(max_P, G_row_lengths[i]);
+  }
+
+  std::vector<detail::spai_workspace<NumericT> > workspaces(detail::spai_num_workspaces());
+  for (std::size_t i = 0; i < workspaces.size(); ++i)
+    workspaces[i].init(max_P, max_P);
+
+  // exclusive scan:
+  unsigned int offset = 0;
+  for (std::size_t i = 0; i < G_row_lengths.size(); ++i)
+  {
+    unsigned int tmp = G_row_lengths[i];
+    G_row_lengths[i] = offset;
+    offset += tmp;
+  }
+
+  G = compressed_matrix<NumericT, AlignmentV>(A.size1(), A.size2(), offset, viennacl::context(viennacl::MAIN_MEMORY));
+
+  unsigned int * G_row_buffer = detail::extract_raw_pointer<unsigned int>(G.handle1());
+  unsigned int * G_col_buffer = detail::extract_raw_pointer<unsigned int>(G.handle2());
+  NumericT     * G_elements   = detail::extract_raw_pointer<NumericT>(G.handle());
+
+  std::copy(G_row_lengths.begin(), G_row_lengths.end(), G_row_buffer);
+
+  //
+  // Stage 2: Solve small SPD systems for each row
+  //
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for schedule(dynamic, 64) if (num_rows > VIENNACL_OPENMP_SPAI_MIN_SIZE)
+#endif
+  for (long i = 0; i < num_rows; ++i)
+  {
+    detail::spai_workspace<NumericT> & ws = workspaces[detail::spai_thread_id()];
+
+    unsigned int const * P = A_col_buffer + A_row_buffer[i];
+    vcl_size_t size_P = G_row_buffer[i+1] - G_row_buffer[i];
+
+    std::copy(P, P + size_P, G_col_buffer + G_row_buffer[i]);
+
+    if (size_P == 0)
+      continue;
+
+    // dense submatrix A(P,P):
+    NumericT * B = &(ws.dense[0]);
+    std::fill(B, B + size_P * size_P, NumericT(0));
+    for (vcl_size_t q = 0; q < size_P; ++q)
+    {
+      unsigned int row_q = P[q];
+      for (unsigned int l = A_row_buffer[row_q]; l < A_row_buffer[row_q+1]; ++l)
+      {
+        long p = detail::spai_find_index(P, P + size_P, A_col_buffer[l]);
+        if (p >= 0)
+          B[static_cast<vcl_size_t>(p) * size_P + q] = A_elements[l];
+      }
+    }
+
+    // right hand side e_i, where i is the last index in P:
+    NumericT * g = &(ws.rhs[0]);
+    std::fill(g, g + size_P, NumericT(0));
+    g[size_P - 1] = NumericT(1);
+
+    NumericT * G_row = G_elements + G_row_buffer[i];
+    if (P[size_P - 1] == static_cast<unsigned int>(i) && detail::spai_dense_cholesky_solve(B, g, size_P) && g[size_P - 1] > 0)
+    {
+      NumericT scaling = NumericT(1) / std::sqrt(g[size_P - 1]);
+      for (vcl_size_t q = 0; q < size_P; ++q)
+        G_row[q] = g[q] * scaling;
+    }
+    else // fallback: Jacobi scaling (zero row if there is no diagonal entry)
+    {
+      std::fill(G_row, G_row + size_P, NumericT(0));
+      if (P[size_P - 1] == static_cast<unsigned int>(i) && std::fabs(A_elements[A_row_buffer[i] + size_P - 1]) > 0)
+        G_row[size_P - 1] = NumericT(1) / std::sqrt(std::fabs(A_elements[A_row_buffer[i] + size_P - 1]));
+    }
+  }
+
+  G.generate_row_block_information();
+}
+
+} //namespace host_based
+} //namespace linalg
+} //namespace viennacl
+
+
+#endif
@@ -0,0 +1,748 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_SVD_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_SVD_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/svd_operations.hpp
+    @brief Implementations of the singular value decomposition for dense matrices in host memory.
+
+    The decomposition consists of three stages:
+      - blocked Householder bidiagonalization with rank-2k updates of the trailing matrix,
+      - implicit zero-shift/Wilkinson-shift QR sweeps on the bidiagonal matrix, where the Givens rotations are collected and applied to the singular vectors in parallel batches,
+      - back-transformation of the singular vectors, processed in parallel over blocks of columns.
+    All stages operate on a column-major copy of the matrix. Wide matrices are handled by decomposing the transpose.
+*/
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "viennacl/forwards.h"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/start.hpp"
+#include "viennacl/traits/stride.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/eigen_operations.hpp"
+
+// Minimum matrix size for using OpenMP in the singular value decomposition:
+#ifndef VIENNACL_OPENMP_SVD_MIN_SIZE
+  #define VIENNACL_OPENMP_SVD_MIN_SIZE  64
+#endif
+
+// Number of columns reduced per panel in the blocked bidiagonalization:
+#ifndef VIENNACL_SVD_BIDIAG_BLOCK_SIZE
+  #define VIENNACL_SVD_BIDIAG_BLOCK_SIZE  32
+#endif
+
+namespace viennacl
+{
+namespace linalg
+{
+namespace host_based
+{
+namespace detail
+{
+  /** @brief Reduces the panel of columns/rows [k, k+nb) of the column-major m-by-n matrix A (m >= n) to upper bidiagonal form.
+    *
+    * Returns the matrices X (m-by-nb) and Y (n-by-nb) such that the trailing matrix is updated via A22 -= V Y^T + X U,
+    * where V holds the left reflectors (columns) and U the right reflectors (rows) of the panel.
+    * This is LAPACK's xLABRD for the case m >= n. On exit, the unit entries of the reflectors are stored in place of the diagonal and superdiagonal.
+    */
+  template<typename NumericT>
+  void svd_bidiag_panel(vcl_size_t m, vcl_size_t n, NumericT * A, vcl_size_t k, vcl_size_t nb,
+                        NumericT * X, NumericT * Y,
+                        NumericT * d, NumericT * e, NumericT * tauq, NumericT * taup)
+  {
+    std::vector<NumericT> tmp(nb + 1);
+    std::vector<NumericT> u(n);
+
+    for (vcl_size_t p = 0; p < nb; ++p)
+    {
+      vcl_size_t i = k + p;
+      NumericT * A_i = A + i * m;
+      NumericT * X_p = X + p * m;
+      NumericT * Y_p = Y + p * n;
+
+      // update column i with the previous reflectors of the panel:
+      for (vcl_size_t q = 0; q < p; ++q)
+      {
+        NumericT const * V_q = A + (k + q) * m;
+        NumericT const * X_q = X + q * m;
+        NumericT y_iq = Y[q * n + i];
+        NumericT u_qi = A_i[k + q];
+        for (vcl_size_t r = i; r < m; ++r)
+          A_i[r] -= V_q[r] * y_iq + X_q[r] * u_qi;
+      }
+
+      // left reflector annihilating A(i+1:m, i):
+      eigen_householder_generate(m - i - 1, A_i[i], A_i + i + 1, tauq[i]);
+      d[i] = A_i[i];
+
+      if (i + 1 >= n)
+      {
+        taup[i] = 0;
+        e[i] = 0;
+        continue;
+      }
+
+      A_i[i] = 1;
+      NumericT const * v = A_i + i;
+      vcl_size_t mv = m - i;
+
+      // Y(i+1:n, p) = A(i:m, i+1:n)^T v:
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if ((n - i) * mv > VIENNACL_OPENMP_SVD_MIN_SIZE * VIENNACL_OPENMP_SVD_MIN_SIZE)
+#endif
+      for (long col2 = static_cast<long>(i + 1); col2 < static_cast<long>(n); ++col2)
+      {
+        NumericT const * A_c = A + static_cast<vcl_size_t>(col2) * m + i;
+        NumericT sum = 0;
+        for (vcl_size_t r = 0; r < mv; ++r)
+          sum += A_c[r] * v[r];
+        Y_p[col2] = sum;
+      }
+
+      // Y(i+1:n, p) -= Y(i+1:n, 0:p) V(i:m, 0:p)^T v + U(0:p, i+1:n)^T X(i:m, 0:p)^T v:
+      for (vcl_size_t q = 0; q < p; ++q)
+      {
+        NumericT const * V_q = A + (k + q) * m + i;
+        NumericT const * X_q = X + q * m + i;
+        NumericT s1 = 0, s2 = 0;
+        for (vcl_size_t r = 0; r < mv; ++r)
+        {
+          s1 += V_q[r] * v[r];
+          s2 += X_q[r] * v[r];
+        }
+        NumericT const * Y_q = Y + q * n;
+        for (vcl_size_t c = i + 1; c < n; ++c)
+          Y_p[c] -= Y_q[c] * s1 + A[c * m + k + q] * s2;
+      }
+      for (vcl_size_t c = i + 1; c < n; ++c)
+        Y_p[c] *= tauq[i];
+
+      // update row i: A(i, i+1:n) -= V(i, 0:p+1) Y(i+1:n, 0:p+1)^T + X(i, 0:p) U(0:p, i+1:n):
+      for (vcl_size_t c = i + 1; c < n; ++c)
+      {
+        NumericT sum = 0;
+        for (vcl_size_t q = 0; q <= p; ++q)
+          sum += A[(k + q) * m + i] * Y[q * n + c];
+        for (vcl_size_t q = 0; q < p; ++q)
+          sum += X[q * m + i] * A[c * m + k + q];
+        A[c * m + i] -= sum;
+      }
+
+      // right reflector annihilating A(i, i+2:n). The row is strided, hence it is generated in a contiguous buffer:
+      vcl_size_t nu = n - i - 1;
+      for (vcl_size_t c = 0; c < nu; ++c)
+        u[c] = A[(i + 1 + c) * m + i];
+      eigen_householder_generate(nu - 1, u[0], &u[0] + 1, taup[i]);
+      e[i] = u[0];
+      u[0] = 1;
+      for (vcl_size_t c = 0; c < nu; ++c)
+        A[(i + 1 + c) * m + i] = u[c];
+
+      // X(i+1:m, p) = A(i+1:m, i+1:n) u, processed in blocks of rows for contiguous access:
+      vcl_size_t const row_block = 256;
+      vcl_size_t mx = m - i - 1;
+      vcl_size_t num_row_blocks = (mx + row_block - 1) / row_block;
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if (nu * mx > VIENNACL_OPENMP_SVD_MIN_SIZE * VIENNACL_OPENMP_SVD_MIN_SIZE)
+#endif
+      for (long block2 = 0; block2 < static_cast<long>(num_row_blocks); ++block2)
+      {
+        vcl_size_t r_start = i + 1 + static_cast<vcl_size_t>(block2) * row_block;
+        vcl_size_t r_end   = std::min(r_start + row_block, m);
+        for (vcl_size_t r = r_start; r < r_end; ++r)
+          X_p[r] = 0;
+        for (vcl_size_t c = 0; c < nu; ++c)
+        {
+          NumericT const * A_c = A + (i + 1 + c) * m;
+          NumericT u_c = u[c];
+          for (vcl_size_t r = r_start; r < r_end; ++r)
+            X_p[r] += A_c[r] * u_c;
+        }
+      }
+
+      // X(i+1:m, p) -= V(i+1:m, 0:p+1) Y(i+1:n, 0:p+1)^T u + X(i+1:m, 0:p) U(0:p, i+1:n) u:
+      for (vcl_size_t q = 0; q <= p; ++q)
+      {
+        NumericT const * Y_q = Y + q * n + i + 1;
+        NumericT s = 0;
+        for (vcl_size_t c = 0; c < nu; ++c)
+          s += Y_q[c] * u[c];
+        tmp[q] = s;
+      }
+      for (vcl_size_t q = 0; q <= p; ++q)
+      {
+        NumericT const * V_q = A + (k + q) * m;
+        for (vcl_size_t r = i + 1; r < m; ++r)
+          X_p[r] -= V_q[r] * tmp[q];
+      }
+      for (vcl_size_t q = 0; q < p; ++q)
+      {
+        NumericT s = 0;
+        for (vcl_size_t c = 0; c < nu; ++c)
+          s += A[(i + 1 + c) * m + k + q] * u[c];
+        NumericT const * X_q = X + q * m;
+        for (vcl_size_t r = i + 1; r < m; ++r)
+          X_p[r] -= X_q[r] * s;
+      }
+      for (vcl_size_t r = i + 1; r < m; ++r)
+        X_p[r] *= taup[i];
+    }
+  }
+
+  /** @brief Applies the rank-2k update A(k:m, k:n) -= V Y^T + X U of the blocked bidiagonalization to the trailing matrix, processed in parallel over columns. */
+  template<typename NumericT>
+  void svd_bidiag_trailing_update(vcl_size_t m, vcl_size_t n, NumericT * A, vcl_size_t k, vcl_size_t nb,
+                                  NumericT const * X, NumericT const * Y)
+  {
+    vcl_size_t panel_start = k - nb;
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if ((n - k) * (m - k) > VIENNACL_OPENMP_SVD_MIN_SIZE * VIENNACL_OPENMP_SVD_MIN_SIZE)
+#endif
+    for (long col2 = static_cast<long>(k); col2 < static_cast<long>(n); ++col2)
+    {
+      vcl_size_t c = static_cast<vcl_size_t>(col2);
+      NumericT * A_c = A + c * m;
+      for (vcl_size_t q = 0; q < nb; ++q)
+      {
+        NumericT const * V_q = A + (panel_start + q) * m;
+        NumericT const * X_q = X + q * m;
+        NumericT y_cq = Y[q * n + c];
+        NumericT u_qc = A_c[panel_start + q];
+        for (vcl_size_t r = k; r < m; ++r)
+          A_c[r] -= V_q[r] * y_cq + X_q[r] * u_qc;
+      }
+    }
+  }
+
+  /** @brief Applies the product of reflectors H_0 H_1 ... H_{nr-1} from the left to the column-major rows-by-cols matrix Z.
+    *
+    * Reflector H_i = I - tau[i] v v^T has its implicit unit entry in row i + offset, the remaining entries are stored in V[i * ld + r] for r > i + offset.
+    * The columns of Z are processed in blocks, which are distributed among threads. Each reflector is loaded once per block.
+    */
+  template<typename NumericT>
+  void svd_apply_reflectors(vcl_size_t rows, vcl_size_t cols, NumericT * Z,
+                            NumericT const * V, vcl_size_t ld, vcl_size_t nr, NumericT const * tau, vcl_size_t offset)
+  {
+    vcl_size_t const block_size = 16;
+    vcl_size_t num_blocks = (cols + block_size - 1) / block_size;
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for schedule(dynamic, 1) if (rows > VIENNACL_OPENMP_SVD_MIN_SIZE && num_blocks > 1)
+#endif
+    for (long block2 = 0; block2 < static_cast<long>(num_blocks); ++block2)
+    {
+      vcl_size_t col_start = static_cast<vcl_size_t>(block2) * block_size;
+      vcl_size_t col_end   = std::min(col_start + block_size, cols);
+
+      for (vcl_size_t i = nr; i-- > 0;)
+      {
+        if (tau[i] <= 0 && tau[i] >= 0)
+          continue;
+
+        vcl_size_t j = i + offset;
+        NumericT const * v = V + i * ld;
+        for (vcl_size_t c = col_start; c < col_end; ++c)
+        {
+          NumericT * Z_c = Z + c * rows;
+          NumericT s = Z_c[j];
+          for (vcl_size_t r = j + 1; r < rows; ++r)
+            s += v[r] * Z_c[r];
+          s *= tau[i];
+          Z_c[j] -= s;
+          for (vcl_size_t r = j + 1; r < rows; ++r)
+            Z_c[r] -= s * v[r];
+        }
+      }
+    }
+  }
+
+  /** @brief A plane rotation acting on the entries first and second of each row of a matrix. A rotation with first == second scales the entry by c. */
+  template<typename NumericT>
+  struct svd_rotation
+  {
+    svd_rotation(vcl_size_t i, vcl_size_t j, NumericT cs, NumericT sn) : first(i), second(j), c(cs), s(sn) {}
+
+    vcl_size_t first;
+    vcl_size_t second;
+    NumericT c;
+    NumericT s;
+  };
+
+  /** @brief Applies the recorded rotations in order to the columns of the column-major n-by-n matrix Z and clears the list.
+    *
+    * The rows of Z are processed in blocks, which are distributed among threads. Within a block, each rotation acts on two contiguous column segments.
+    */
+  template<typename NumericT>
+  void svd_flush_rotations(vcl_size_t n, NumericT * Z, std::vector<svd_rotation<NumericT> > & rotations)
+  {
+    if (rotations.empty())
+      return;
+
+    svd_rotation<NumericT> const * rot = &rotations[0];
+    vcl_size_t num_rot = rotations.size();
+    vcl_size_t const block_size = 64;
+    vcl_size_t num_blocks = (n + block_size - 1) / block_size;
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (n * num_rot > VIENNACL_OPENMP_SVD_MIN_SIZE * VIENNACL_OPENMP_SVD_MIN_SIZE && num_blocks > 1)
+#endif
+    for (long block2 = 0; block2 < static_cast<long>(num_blocks); ++block2)
+    {
+      vcl_size_t row_start = static_cast<vcl_size_t>(block2) * block_size;
+      vcl_size_t row_end   = std::min(row_start + block_size, n);
+      for (vcl_size_t t = 0; t < num_rot; ++t)
+      {
+        NumericT * x = Z + rot[t].first * n;
+        NumericT c = rot[t].c;
+        if (rot[t].first == rot[t].second)
+        {
+          for (vcl_size_t r = row_start; r < row_end; ++r)
+            x[r] *= c;
+        }
+        else
+        {
+          NumericT * y = Z + rot[t].second * n;
+          NumericT s = rot[t].s;
+          for (vcl_size_t r = row_start; r < row_end; ++r)
+          {
+            NumericT tmp = c * x[r] + s * y[r];
+            y[r] = c * y[r] - s * x[r];
+            x[r] = tmp;
+          }
+        }
+      }
+    }
+
+    rotations.clear();
+  }
+
+  /** @brief Numerically stable computation of sqrt(a^2 + b^2). */
+  template<typename NumericT>
+  NumericT svd_hypot(NumericT a, NumericT b)
+  {
+    NumericT abs_a = std::fabs(a);
+    NumericT abs_b = std::fabs(b);
+    if (abs_a > abs_b)
+      return abs_a * std::sqrt(NumericT(1) + (b / a) * (b / a));
+    if (abs_b > 0)
+      return abs_b * std::sqrt(NumericT(1) + (a / b) * (a / b));
+    return 0;
+  }
+
+} // namespace detail
+
+
+/** @brief Reduces the column-major m-by-n matrix A (m >= n) to upper bidiagonal form B = Q^T A P by blocked Householder reflections.
+  *
+  * @param m     Number of rows
+  * @param n     Number of columns, must not exceed m
+  * @param A     Column-major m-by-n array. On exit, the left reflectors are stored below the diagonal, the right reflectors to the right of the superdiagonal.
+  * @param d     Diagonal of B (size n)
+  * @param e     Superdiagonal of B (size n, e[n-1] is set to zero)
+  * @param tauq  Scalar factors of the left reflectors (size n)
+  * @param taup  Scalar factors of the right reflectors (size n)
+  */
+template<typename NumericT>
+void bidiagonalize(vcl_size_t m, vcl_size_t n, NumericT * A,
+                   std::vector<NumericT> & d, std::vector<NumericT> & e,
+                   std::vector<NumericT> & tauq, std::vector<NumericT> & taup)
+{
+  assert(m >= n && bool("Bidiagonalization requires at least as many rows as columns!"));
+
+  d.resize(n);
+  e.resize(n);
+  tauq.resize(n);
+  taup.resize(n);
+  if (n == 0)
+    return;
+
+  vcl_size_t nb = VIENNACL_SVD_BIDIAG_BLOCK_SIZE;
+  std::vector<NumericT> X(m * nb);
+  std::vector<NumericT> Y(n * nb);
+
+  vcl_size_t k = 0;
+  while (k < n)
+  {
+    vcl_size_t panel_size = std::min(nb, n - k);
+    detail::svd_bidiag_panel(m, n, A, k, panel_size, &X[0], &Y[0], &d[0], &e[0], &tauq[0], &taup[0]);
+    if (k + panel_size < n)
+      detail::svd_bidiag_trailing_update(m, n, A, k + panel_size, panel_size, &X[0], &Y[0]);
+    for (vcl_size_t j = k; j < k + panel_size; ++j)
+    {
+      A[j * m + j] = d[j];
+      if (j + 1 < n)
+        A[(j + 1) * m + j] = e[j];
+    }
+    k += panel_size;
+  }
+  e[n-1] = 0;
+}
+
+
+/** @brief Computes the singular value decomposition B = U_B diag(d) V_B^T of an upper bidiagonal matrix by implicitly shifted QR sweeps.
+  *
+  * The Givens rotations of the sweeps are recorded and applied to U and V in batches, where blocks of rows are processed in parallel.
+  *
+  * @param n    Size of the matrix
+  * @param d    Diagonal on input, singular values in descending order on output
+  * @param e    Superdiagonal (size n, e[i] couples i and i+1). Destroyed on output.
+  * @param U    Column-major n-by-n matrix, the left singular vectors are accumulated into it
+  * @param V    Column-major n-by-n matrix, the right singular vectors are accumulated into it
+  */
+template<typename NumericT>
+void bidiagonal_svd(vcl_size_t n, NumericT * d, NumericT * e, NumericT * U, NumericT * V)
+{
+  if (n == 0)
+    return;
+
+  NumericT eps  = std::numeric_limits<NumericT>::epsilon();
+  NumericT tiny = std::numeric_limits<NumericT>::min() / eps;
+
+  std::vector<detail::svd_rotation<NumericT> > rot_U;
+  std::vector<detail::svd_rotation<NumericT> > rot_V;
+
+  e[n-1] = 0;
+  long p = static_cast<long>(n);
+  vcl_size_t iter = 0;
+
+  while (p > 0)
+  {
+    // flush batches of rotations once they amount to about one rotation per column:
+    if (rot_U.size() > n)
+      detail::svd_flush_rotations(n, U, rot_U);
+    if (rot_V.size() > n)
+      detail::svd_flush_rotations(n, V, rot_V);
+
+    // find the largest unreduced trailing block [k+1, p) and classify it:
+    long k, kase;
+    for (k = p - 2; k >= 0; --k)
+    {
+      if (std::fabs(e[k]) <= tiny + eps * (std::fabs(d[k]) + std::fabs(d[k+1])))
+      {
+        e[k] = 0;
+        break;
+      }
+    }
+    if (iter > 75)   // no convergence for this singular value, accept the current approximation
+    {
+      k = p - 2;
+      if (k >= 0)
+        e[k] = 0;
+    }
+
+    if (k == p - 2)
+      kase = 4;
+    else
+    {
+      long ks;
+      for (ks = p - 1; ks > k; --ks)
+      {
+        NumericT t = (ks != p ? std::fabs(e[ks]) : NumericT(0)) + (ks != k + 1 ? std::fabs(e[ks-1]) : NumericT(0));
+        if (std::fabs(d[ks]) <= tiny + eps * t)
+        {
+          d[ks] = 0;
+          break;
+        }
+      }
+      if (ks == k)
+        kase = 3;
+      else if (ks == p - 1)
+        kase = 1;
+      else
+      {
+        kase = 2;
+        k = ks;
+      }
+    }
+    ++k;
+
+    switch (kase)
+    {
+    case 1: // deflate negligible d[p-1]
+    {
+      NumericT f = e[p-2];
+      e[p-2] = 0;
+      for (long j = p - 2; j >= k; --j)
+      {
+        NumericT t  = detail::svd_hypot(d[j], f);
+        NumericT cs = d[j] / t;
+        NumericT sn = f / t;
+        d[j] = t;
+        if (j != k)
+        {
+          f = -sn * e[j-1];
+          e[j-1] = cs * e[j-1];
+        }
+        rot_V.push_back(detail::svd_rotation<NumericT>(vcl_size_t(j), vcl_size_t(p-1), cs, sn));
+      }
+      break;
+    }
+    case 2: // split at negligible d[k-1]
+    {
+      NumericT f = e[k-1];
+      e[k-1] = 0;
+      for (long j = k; j < p; ++j)
+      {
+        NumericT t  = detail::svd_hypot(d[j], f);
+        NumericT cs = d[j] / t;
+        NumericT sn = f / t;
+        d[j] = t;
+        f = -sn * e[j];
+        e[j] = cs * e[j];
+        rot_U.push_back(detail::svd_rotation<NumericT>(vcl_size_t(j), vcl_size_t(k-1), cs, sn));
+      }
+      break;
+    }
+    case 3: // QR sweep with Wilkinson shift
+    {
+      NumericT scale = std::max(std::max(std::max(std::max(std::fabs(d[p-1]), std::fabs(d[p-2])), std::fabs(e[p-2])), std::fabs(d[k])), std::fabs(e[k]));
+      NumericT sp   = d[p-1] / scale;
+      NumericT spm1 = d[p-2] / scale;
+      NumericT epm1 = e[p-2] / scale;
+      NumericT sk   = d[k] / scale;
+      NumericT ek   = e[k] / scale;
+      NumericT b = ((spm1 + sp) * (spm1 - sp) + epm1 * epm1) / NumericT(2);
+      NumericT c = (sp * epm1) * (sp * epm1);
+      NumericT shift = 0;
+      if (std::fabs(b) > 0 || std::fabs(c) > 0)
+      {
+        shift = std::sqrt(b * b + c);
+        if (b < 0)
+          shift = -shift;
+        shift = c / (b + shift);
+      }
+      NumericT f = (sk + sp) * (sk - sp) + shift;
+      NumericT g = sk * ek;
+
+      for (long j = k; j < p - 1; ++j)
+      {
+        NumericT t  = detail::svd_hypot(f, g);
+        NumericT cs = f / t;
+        NumericT sn = g / t;
+        if (j != k)
+          e[j-1] = t;
+        f      = cs * d[j] + sn * e[j];
+        e[j]   = cs * e[j] - sn * d[j];
+        g      = sn * d[j+1];
+        d[j+1] = cs * d[j+1];
+        rot_V.push_back(detail::svd_rotation<NumericT>(vcl_size_t(j), vcl_size_t(j+1), cs, sn));
+
+        t  = detail::svd_hypot(f, g);
+        cs = f / t;
+        sn = g / t;
+        d[j]   = t;
+        f      = cs * e[j] + sn * d[j+1];
+        d[j+1] = cs * d[j+1] - sn * e[j];
+        g      = sn * e[j+1];
+        e[j+1] = cs * e[j+1];
+        rot_U.push_back(detail::svd_rotation<NumericT>(vcl_size_t(j), vcl_size_t(j+1), cs, sn));
+      }
+      e[p-2] = f;
+      ++iter;
+      break;
+    }
+    default: // convergence of d[k]: make it nonnegative
+    {
+      if (d[k] <= 0)
+      {
+        d[k] = -d[k];
+        rot_V.push_back(detail::svd_rotation<NumericT>(vcl_size_t(k), vcl_size_t(k), NumericT(-1), NumericT(0)));
+      }
+      iter = 0;
+      --p;
+    }
+    }
+  }
+
+  detail::svd_flush_rotations(n, U, rot_U);
+  detail::svd_flush_rotations(n, V, rot_V);
+
+  // sort in descending order:
+  std::vector<std::pair<NumericT, vcl_size_t> > order(n);
+  for (vcl_size_t i=0; i<n; ++i)
+    order[i] = std::make_pair(-d[i], i);
+  std::stable_sort(order.begin(), order.end());
+
+  std::vector<NumericT> Z(U, U + n * n);
+  for (vcl_size_t i=0; i<n; ++i)
+  {
+    d[i] = -order[i].first;
+    std::copy(Z.begin() + static_cast<long>(order[i].second * n), Z.begin() + static_cast<long>((order[i].second + 1) * n), U + i * n);
+  }
+  std::copy(V, V + n * n, Z.begin());
+  for (vcl_size_t i=0; i<n; ++i)
+    std::copy(Z.begin() + static_cast<long>(order[i].second * n), Z.begin() + static_cast<long>((order[i].second + 1) * n), V + i * n);
+}
+
+
+/** @brief Computes the singular value decomposition A = U diag(sigma) V^T of the column-major m-by-n matrix A with m >= n.
+  *
+  * @param m       Number of rows
+  * @param n       Number of columns, must not exceed m
+  * @param A       Column-major m-by-n array. Destroyed on output.
+  * @param sigma   The n singular values in descending order
+  * @param U       Column-major m-by-U_cols matrix of left singular vectors on output
+  * @param U_cols  Number of left singular vectors to compute, either n (thin SVD) or m (full SVD)
+  * @param V       Column-major n-by-n matrix of right singular vectors on output
+  */
+template<typename NumericT>
+void svd(vcl_size_t m, vcl_size_t n, NumericT * A, std::vector<NumericT> & sigma,
+         std::vector<NumericT> & U, vcl_size_t U_cols, std::vector<NumericT> & V)
+{
+  assert(U_cols >= n && U_cols <= m && bool("Invalid number of left singular vectors requested!"));
+
+  std::vector<NumericT> e, tauq, taup;
+  bidiagonalize(m, n, A, sigma, e, tauq, taup);
+
+  std::vector<NumericT> U_B(n * n), V_B(n * n);
+  for (vcl_size_t i=0; i<n; ++i)
+  {
+    U_B[i * n + i] = 1;
+    V_B[i * n + i] = 1;
+  }
+  if (n > 0)
+    bidiagonal_svd(n, &sigma[0], &e[0], &U_B[0], &V_B[0]);
+
+  // U = Q [U_B 0; 0 I]:
+  U.assign(m * U_cols, NumericT(0));
+  for (vcl_size_t j=0; j<n; ++j)
+    for (vcl_size_t i=0; i<n; ++i)
+      U[j * m + i] = U_B[j * n + i];
+  for (vcl_size_t j=n; j<U_cols; ++j)
+    U[j * m + j] = 1;
+  if (n > 0)
+    detail::svd_apply_reflectors(m, U_cols, &U[0], A, m, n, &tauq[0], 0);
+
+  // V = P V_B, where the right reflectors are gathered from the rows of A:
+  V.swap(V_B);
+  if (n > 1)
+  {
+    std::vector<NumericT> P(n * n);
+    for (vcl_size_t i=0; i+1<n; ++i)
+      for (vcl_size_t c=i+1; c<n; ++c)
+        P[i * n + c] = A[c * m + i];
+    detail::svd_apply_reflectors(n, n, &V[0], &P[0], n, n - 1, &taup[0], 1);
+  }
+}
+
+
+namespace detail
+{
+  /** @brief Copies the matrix A (or its transpose) into a column-major array */
+  template<typename NumericT>
+  void svd_copy_in(matrix_base<NumericT> const & A, bool transposed, std::vector<NumericT> & A_work)
+  {
+    NumericT const * data_A = detail::extract_raw_pointer<NumericT>(A);
+
+    vcl_size_t A_size1  = viennacl::traits::size1(A);
+    vcl_size_t A_size2  = viennacl::traits::size2(A);
+    vcl_size_t A_start1 = viennacl::traits::start1(A);
+    vcl_size_t A_start2 = viennacl::traits::start2(A);
+    vcl_size_t A_inc1   = viennacl::traits::stride1(A);
+    vcl_size_t A_inc2   = viennacl::traits::stride2(A);
+    vcl_size_t A_internal_size1  = viennacl::traits::internal_size1(A);
+    vcl_size_t A_internal_size2  = viennacl::traits::internal_size2(A);
+
+    A_work.resize(A_size1 * A_size2);
+    for (vcl_size_t j=0; j<A_size2; ++j)
+      for (vcl_size_t i=0; i<A_size1; ++i)
+      {
+        NumericT val = A.row_major() ? data_A[viennacl::row_major::mem_index(i * A_inc1 + A_start1, j * A_inc2 + A_start2, A_internal_size1, A_internal_size2)]
+                                     : data_A[viennacl::column_major::mem_index(i * A_inc1 + A_start1, j * A_inc2 + A_start2, A_internal_size1, A_internal_size2)];
+        if (transposed)
+          A_work[i * A_size2 + j] = val;
+        else
+          A_work[j * A_size1 + i] = val;
+      }
+  }
+
+  /** @brief Writes the leading size1(B)-by-size2(B) block of the column-major array B_work with leading dimension ld to B */
+  template<typename NumericT>
+  void svd_copy_out(std::vector<NumericT> const & B_work, vcl_size_t ld, matrix_base<NumericT> & B)
+  {
+    NumericT * data_B = detail::extract_raw_pointer<NumericT>(B);
+
+    vcl_size_t B_size1  = viennacl::traits::size1(B);
+    vcl_size_t B_size2  = viennacl::traits::size2(B);
+    vcl_size_t B_start1 = viennacl::traits::start1(B);
+    vcl_size_t B_start2 = viennacl::traits::start2(B);
+    vcl_size_t B_inc1   = viennacl::traits::stride1(B);
+    vcl_size_t B_inc2   = viennacl::traits::stride2(B);
+    vcl_size_t B_internal_size1  = viennacl::traits::internal_size1(B);
+    vcl_size_t B_internal_size2  = viennacl::traits::internal_size2(B);
+
+    for (vcl_size_t j=0; j<B_size2; ++j)
+      for (vcl_size_t i=0; i<B_size1; ++i)
+      {
+        if (B.row_major())
+          data_B[viennacl::row_major::mem_index(i * B_inc1 + B_start1, j * B_inc2 + B_start2, B_internal_size1, B_internal_size2)] = B_work[j * ld + i];
+        else
+          data_B[viennacl::column_major::mem_index(i * B_inc1 + B_start1, j * B_inc2 + B_start2, B_internal_size1, B_internal_size2)] = B_work[j * ld + i];
+      }
+  }
+} // namespace detail
+
+
+/** @brief Computes the singular value decomposition A = QL Sigma QR^T of a dense matrix in host memory.
+  *
+  * @param A     The input matrix (row-major or column-major). Overwritten with the diagonal matrix Sigma of singular values (in descending order) on output.
+  * @param QL    The left orthogonal matrix (size1(A)-by-size1(A))
+  * @param QR    The right orthogonal matrix (size2(A)-by-size2(A))
+  */
+template<typename NumericT>
+void svd(matrix_base<NumericT> & A,
+         matrix_base<NumericT> & QL,
+         matrix_base<NumericT> & QR)
+{
+  vcl_size_t size1 = viennacl::traits::size1(A);
+  vcl_size_t size2 = viennacl::traits::size2(A);
+
+  assert(viennacl::traits::size1(QL) == size1 && viennacl::traits::size2(QL) == size1 && bool("Size mismatch of left orthogonal matrix!"));
+  assert(viennacl::traits::size1(QR) == size2 && viennacl::traits::size2(QR) == size2 && bool("Size mismatch of right orthogonal matrix!"));
+
+  // wide matrices are decomposed via A^T = QR Sigma^T QL^T:
+  bool transposed = size1 < size2;
+  vcl_size_t m = transposed ? size2 : size1;
+  vcl_size_t n = transposed ? size1 : size2;
+
+  std::vector<NumericT> A_work;
+  detail::svd_copy_in(A, transposed, A_work);
+
+  std::vector<NumericT> sigma, U, V;
+  svd(m, n, m > 0 ? &A_work[0] : NULL, sigma, U, m, V);
+
+  detail::svd_copy_out(U, m, transposed ? QR : QL);
+  detail::svd_copy_out(V, n, transposed ? QL : QR);
+
+  std::vector<NumericT> Sigma(size1 * size2);
+  for (vcl_size_t i=0; i<n; ++i)
+    Sigma[i * size1 + i] = sigma[i];
+  detail::svd_copy_out(Sigma, size1, A);
+}
+
+} //namespace host_based
+} //namespace linalg
+} //namespace viennacl
+
+
+#endif
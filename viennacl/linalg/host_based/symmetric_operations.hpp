@@ -0,0 +1,454 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_SYMMETRIC_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_SYMMETRIC_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/symmetric_operations.hpp
+    @brief Implementations of operations with symmetric dense matrices using a plain single-threaded or OpenMP-enabled execution on CPU.
+
+    The symmetric rank-k and rank-2k updates (SYRK, SYR2K) compute the blocks of one triangle of the result only and optionally mirror them to the other triangle.
+    The symmetric matrix-vector product (SYMV) reads each entry of the referenced triangle once.
+*/
+
+#include <vector>
+#include <algorithm>
+
+#include "viennacl/forwards.h"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/start.hpp"
+#include "viennacl/traits/stride.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+// Minimum vector size for using OpenMP in the symmetric matrix-vector product:
+#ifndef VIENNACL_OPENMP_SYMV_MIN_SIZE
+  #define VIENNACL_OPENMP_SYMV_MIN_SIZE  1024
+#endif
+
+namespace viennacl
+{
+namespace linalg
+{
+namespace host_based
+{
+namespace detail
+{
+  /** @brief Computes the lower triangle of C = alpha * (A B^T + B A^T) + beta * C, or of C = alpha * A A^T + beta * C if two_sided is false.
+    *
+    * A and B are accessors of size n x k. If mirror is set, the result is also written to the upper triangle of C.
+    */
+  template<typename MatrixAccT1, typename MatrixAccT2, typename MatrixAccT3, typename NumericT>
+  void syr2k(MatrixAccT1 & A, MatrixAccT2 & B, MatrixAccT3 & C,
+             vcl_size_t n, vcl_size_t k,
+             NumericT alpha, NumericT beta, bool two_sided, bool mirror)
+  {
+    if (n == 0)
+      return;
+
+    static const vcl_size_t blocksize = 64;
+
+    vcl_size_t num_blocks_C = (n - 1) / blocksize + 1;
+    vcl_size_t num_blocks_k = (k > 0) ? (k - 1) / blocksize + 1 : 0;
+    vcl_size_t num_block_pairs = num_blocks_C * (num_blocks_C + 1) / 2;
+
+    //
+    // Run over all blocks (block_idx_i, block_idx_j) of the lower triangle of C:
+    //
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for schedule(dynamic)
+#endif
+    for (long block_pair2 = 0; block_pair2 < static_cast<long>(num_block_pairs); ++block_pair2)
+    {
+      vcl_size_t block_idx_i = 0;
+      vcl_size_t block_idx_j = static_cast<vcl_size_t>(block_pair2);
+      while (block_idx_j > block_idx_i)
+      {
+        ++block_idx_i;
+        block_idx_j -= block_idx_i;
+      }
+      bool diagonal_block = (block_idx_i == block_idx_j);
+
+      // thread-local auxiliary buffers
+      std::vector<NumericT> buffer_A_i(blocksize * blocksize); // row-major
+      std::vector<NumericT> buffer_B_j(blocksize * blocksize); // column-major
+      std::vector<NumericT> buffer_B_i(two_sided ? blocksize * blocksize : 0); // row-major
+      std::vector<NumericT> buffer_A_j(two_sided ? blocksize * blocksize : 0); // column-major
+      std::vector<NumericT> buffer_C(blocksize * blocksize);   // row-major
+
+      vcl_size_t offset_i = block_idx_i * blocksize;
+      vcl_size_t offset_j = block_idx_j * blocksize;
+      vcl_size_t size_i = std::min(blocksize, n - offset_i);
+      vcl_size_t size_j = std::min(blocksize, n - offset_j);
+
+      for (vcl_size_t block_idx_k = 0; block_idx_k < num_blocks_k; ++block_idx_k)
+      {
+        vcl_size_t offset_k = block_idx_k * blocksize;
+        vcl_size_t size_k = std::min(blocksize, k - offset_k);
+
+        // load current data:
+        for (vcl_size_t i = 0; i < size_i; ++i)
+          for (vcl_size_t l = 0; l < size_k; ++l)
+            buffer_A_i[i * blocksize + l] = A(offset_i + i, offset_k + l);
+        for (vcl_size_t j = 0; j < size_j; ++j)
+          for (vcl_size_t l = 0; l < size_k; ++l)
+            buffer_B_j[j * blocksize + l] = B(offset_j + j, offset_k + l);
+        if (two_sided)
+        {
+          for (vcl_size_t i = 0; i < size_i; ++i)
+            for (vcl_size_t l = 0; l < size_k; ++l)
+              buffer_B_i[i * blocksize + l] = B(offset_i + i, offset_k + l);
+          for (vcl_size_t j = 0; j < size_j; ++j)
+            for (vcl_size_t l = 0; l < size_k; ++l)
+              buffer_A_j[j * blocksize + l] = A(offset_j + j, offset_k + l);
+        }
+
+        // multiply, only the lower triangle of diagonal blocks is computed:
+        for (vcl_size_t i = 0; i < size_i; ++i)
+        {
+          NumericT const * ptrA = &(buffer_A_i[i * blocksize]);
+          vcl_size_t j_end = diagonal_block ? i + 1 : size_j;
+          for (vcl_size_t j = 0; j < j_end; ++j)
+          {
+            NumericT const * ptrB = &(buffer_B_j[j * blocksize]);
+
+            NumericT temp = NumericT(0);
+            for (vcl_size_t l = 0; l < size_k; ++l)
+              temp += ptrA[l] * ptrB[l];
+
+            buffer_C[i * blocksize + j] += temp;
+          }
+        }
+
+        if (two_sided)
+        {
+          for (vcl_size_t i = 0; i < size_i; ++i)
+          {
+            NumericT const * ptrB = &(buffer_B_i[i * blocksize]);
+            vcl_size_t j_end = diagonal_block ? i + 1 : size_j;
+            for (vcl_size_t j = 0; j < j_end; ++j)
+            {
+              NumericT const * ptrA = &(buffer_A_j[j * blocksize]);
+
+              NumericT temp = NumericT(0);
+              for (vcl_size_t l = 0; l < size_k; ++l)
+                temp += ptrB[l] * ptrA[l];
+
+              buffer_C[i * blocksize + j] += temp;
+            }
+          }
+        }
+      }
+
+      // write result:
+      for (vcl_size_t i = 0; i < size_i; ++i)
+      {
+        vcl_size_t j_end = diagonal_block ? i + 1 : size_j;
+        for (vcl_size_t j = 0; j < j_end; ++j)
+        {
+          NumericT result = alpha * buffer_C[i * blocksize + j];
+          if (beta > 0 || beta < 0)
+            result += beta * C(offset_i + i, offset_j + j);
+          C(offset_i + i, offset_j + j) = result;
+          if (mirror)
+            C(offset_j + j, offset_i + i) = result;
+        }
+      }
+    }
+  }
+
+  /** @brief Dispatches the storage layout of C for syr2k(). Results are written to the upper triangle by passing a transposed accessor of C. */
+  template<typename MatrixAccT1, typename MatrixAccT2, typename NumericT>
+  void syr2k_dispatch_C(MatrixAccT1 & A, MatrixAccT2 & B, matrix_base<NumericT> & C, vcl_size_t k,
+                        NumericT alpha, NumericT beta, bool two_sided, bool upper, bool mirror)
+  {
+    NumericT * data_C = detail::extract_raw_pointer<NumericT>(C);
+
+    vcl_size_t C_start1 = viennacl::traits::start1(C);
+    vcl_size_t C_start2 = viennacl::traits::start2(C);
+    vcl_size_t C_inc1   = viennacl::traits::stride1(C);
+    vcl_size_t C_inc2   = viennacl::traits::stride2(C);
+    vcl_size_t C_size1  = viennacl::traits::size1(C);
+    vcl_size_t C_internal_size1  = viennacl::traits::internal_size1(C);
+    vcl_size_t C_internal_size2  = viennacl::traits::internal_size2(C);
+
+    if (C.row_major() && !upper)
+    {
+      detail::matrix_array_wrapper<NumericT, row_major, false>    wrapper_C(data_C, C_start1, C_start2, C_inc1, C_inc2, C_internal_size1, C_internal_size2);
+      detail::syr2k(A, B, wrapper_C, C_size1, k, alpha, beta, two_sided, mirror);
+    }
+    else if (C.row_major() && upper)
+    {
+      detail::matrix_array_wrapper<NumericT, row_major, true>     wrapper_C(data_C, C_start1, C_start2, C_inc1, C_inc2, C_internal_size1, C_internal_size2);
+      detail::syr2k(A, B, wrapper_C, C_size1, k, alpha, beta, two_sided, mirror);
+    }
+    else if (!upper)
+    {
+      detail::matrix_array_wrapper<NumericT, column_major, false> wrapper_C(data_C, C_start1, C_start2, C_inc1, C_inc2, C_internal_size1, C_internal_size2);
+      detail::syr2k(A, B, wrapper_C, C_size1, k, alpha, beta, two_sided, mirror);
+    }
+    else
+    {
+      detail::matrix_array_wrapper<NumericT, column_major, true>  wrapper_C(data_C, C_start1, C_start2, C_inc1, C_inc2, C_internal_size1, C_internal_size2);
+      detail::syr2k(A, B, wrapper_C, C_size1, k, alpha, beta, two_sided, mirror);
+    }
+  }
+
+  /** @brief Dispatches the storage layout and the transposition of B for syr2k(). */
+  template<typename MatrixAccT, typename NumericT>
+  void syr2k_dispatch_B(MatrixAccT & A, matrix_base<NumericT> const & B, bool trans, matrix_base<NumericT> & C, vcl_size_t k,
+                        NumericT alpha, NumericT beta, bool two_sided, bool upper, bool mirror)
+  {
+    NumericT const * data_B = detail::extract_raw_pointer<NumericT>(B);
+
+    vcl_size_t B_start1 = viennacl::traits::start1(B);
+    vcl_size_t B_start2 = viennacl::traits::start2(B);
+    vcl_size_t B_inc1   = viennacl::traits::stride1(B);
+    vcl_size_t B_inc2   = viennacl::traits::stride2(B);
+    vcl_size_t B_internal_size1  = viennacl::traits::internal_size1(B);
+    vcl_size_t B_internal_size2  = viennacl::traits::internal_size2(B);
+
+    if (B.row_major() && !trans)
+    {
+      detail::matrix_array_wrapper<NumericT const, row_major, false>    wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+      syr2k_dispatch_C(A, wrapper_B, C, k, alpha, beta, two_sided, upper, mirror);
+    }
+    else if (B.row_major() && trans)
+    {
+      detail::matrix_array_wrapper<NumericT const, row_major, true>     wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+      syr2k_dispatch_C(A, wrapper_B, C, k, alpha, beta, two_sided, upper, mirror);
+    }
+    else if (!trans)
+    {
+      detail::matrix_array_wrapper<NumericT const, column_major, false> wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+      syr2k_dispatch_C(A, wrapper_B, C, k, alpha, beta, two_sided, upper, mirror);
+    }
+    else
+    {
+      detail::matrix_array_wrapper<NumericT const, column_major, true>  wrapper_B(data_B, B_start1, B_start2, B_inc1, B_inc2, B_internal_size1, B_internal_size2);
+      syr2k_dispatch_C(A, wrapper_B, C, k, alpha, beta, two_sided, upper, mirror);
+    }
+  }
+
+  /** @brief Dispatches the storage layout and the transposition of A for syr2k(). */
+  template<typename NumericT>
+  void syr2k_dispatch_A(matrix_base<NumericT> const & A, matrix_base<NumericT> const & B, bool trans, matrix_base<NumericT> & C,
+                        NumericT alpha, NumericT beta, bool two_sided, bool upper, bool mirror)
+  {
+    NumericT const * data_A = detail::extract_raw_pointer<NumericT>(A);
+
+    vcl_size_t A_start1 = viennacl::traits::start1(A);
+    vcl_size_t A_start2 = viennacl::traits::start2(A);
+    vcl_size_t A_inc1   = viennacl::traits::stride1(A);
+    vcl_size_t A_inc2   = viennacl::traits::stride2(A);
+    vcl_size_t A_internal_size1  = viennacl::traits::internal_size1(A);
+    vcl_size_t A_internal_size2  = viennacl::traits::internal_size2(A);
+
+    vcl_size_t k = trans ? viennacl::traits::size1(A) : viennacl::traits::size2(A);
+
+    if (A.row_major() && !trans)
+    {
+      detail::matrix_array_wrapper<NumericT const, row_major, false>    wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+      syr2k_dispatch_B(wrapper_A, B, trans, C, k, alpha, beta, two_sided, upper, mirror);
+    }
+    else if (A.row_major() && trans)
+    {
+      detail::matrix_array_wrapper<NumericT const, row_major, true>     wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+      syr2k_dispatch_B(wrapper_A, B, trans, C, k, alpha, beta, two_sided, upper, mirror);
+    }
+    else if (!trans)
+    {
+      detail::matrix_array_wrapper<NumericT const, column_major, false> wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+      syr2k_dispatch_B(wrapper_A, B, trans, C, k, alpha, beta, two_sided, upper, mirror);
+    }
+    else
+    {
+      detail::matrix_array_wrapper<NumericT const, column_major, true>  wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+      syr2k_dispatch_B(wrapper_A, B, trans, C, k, alpha, beta, two_sided, upper, mirror);
+    }
+  }
+
+  /** @brief Computes result = A x for a symmetric matrix, where only the entries (i, j) with j <= i (or j >= i if upper is set) of the accessor A are read. */
+  template<typename MatrixAccT, typename NumericT>
+  void symv(MatrixAccT & A, vcl_size_t n, bool upper,
+            NumericT const * x, vcl_size_t x_start, vcl_size_t x_inc,
+            std::vector<NumericT> & result)
+  {
+    unsigned int num_threads = 1;
+#ifdef VIENNACL_WITH_OPENMP
+    if (n > VIENNACL_OPENMP_SYMV_MIN_SIZE)
+      num_threads = static_cast<unsigned int>(omp_get_max_threads());
+#endif
+
+    // each thread accumulates the contributions of the transposed entries to a separate buffer:
+    std::vector<NumericT> partial_results(num_threads * n);
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads)
+#endif
+    for (long row2 = 0; row2 < static_cast<long>(n); ++row2)
+    {
+      unsigned int thread_id = 0;
+#ifdef VIENNACL_WITH_OPENMP
+      thread_id = static_cast<unsigned int>(omp_get_thread_num());
+#endif
+      NumericT * partial = &(partial_results[thread_id * n]);
+
+      vcl_size_t row = static_cast<vcl_size_t>(row2);
+      vcl_size_t col_start = upper ? row + 1 : 0;
+      vcl_size_t col_end   = upper ? n       : row;
+
+      NumericT x_row = x[row * x_inc + x_start];
+      NumericT temp = A(row, row) * x_row;
+      for (vcl_size_t col = col_start; col < col_end; ++col)
+      {
+        NumericT a = A(row, col);
+        temp += a * x[col * x_inc + x_start];
+        partial[col] += a * x_row;
+      }
+      partial[row] += temp;
+    }
+
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (num_threads > 1)
+#endif
+    for (long i2 = 0; i2 < static_cast<long>(n); ++i2)
+    {
+      vcl_size_t i = static_cast<vcl_size_t>(i2);
+      NumericT temp = 0;
+      for (unsigned int t = 0; t < num_threads; ++t)
+        temp += partial_results[t * n + i];
+      result[i] = temp;
+    }
+  }
+
+} // namespace detail
+
+
+/** @brief Symmetric rank-k update C = alpha * op(A) op(A)^T + beta * C, where op(A) is either A or A^T.
+*
+* Only the lower (or upper) triangle of C is computed. If mirror is set, it is copied to the other triangle, otherwise the other triangle is not referenced.
+*
+* @param A        The matrix A
+* @param trans_A  If true, C = alpha * A^T A + beta * C is computed
+* @param C        The symmetric result matrix
+* @param alpha    Scaling factor of the product
+* @param beta     Scaling factor of C. C is not read if beta is zero.
+* @param upper    If true, the upper triangle of C is computed, otherwise the lower triangle
+* @param mirror   If true, the result is also written to the other triangle
+*/
+template<typename NumericT, typename ScalarT1, typename ScalarT2>
+void syrk(matrix_base<NumericT> const & A, bool trans_A,
+          matrix_base<NumericT> & C,
+          ScalarT1 alpha, ScalarT2 beta, bool upper, bool mirror)
+{
+  detail::syr2k_dispatch_A(A, A, trans_A, C, static_cast<NumericT>(alpha), static_cast<NumericT>(beta), false, upper, mirror);
+}
+
+/** @brief Symmetric rank-2k update C = alpha * (op(A) op(B)^T + op(B) op(A)^T) + beta * C, where op() denotes either the identity or the transposition.
+*
+* Only the lower (or upper) triangle of C is computed. If mirror is set, it is copied to the other triangle, otherwise the other triangle is not referenced.
+*
+* @param A        The matrix A
+* @param B        The matrix B of the same size as A
+* @param trans    If true, C = alpha * (A^T B + B^T A) + beta * C is computed
+* @param C        The symmetric result matrix
+* @param alpha    Scaling factor of the product
+* @param beta     Scaling factor of C. C is not read if beta is zero.
+* @param upper    If true, the upper triangle of C is computed, otherwise the lower triangle
+* @param mirror   If true, the result is also written to the other triangle
+*/
+template<typename NumericT, typename ScalarT1, typename ScalarT2>
+void syr2k(matrix_base<NumericT> const & A, matrix_base<NumericT> const & B, bool trans,
+           matrix_base<NumericT> & C,
+           ScalarT1 alpha, ScalarT2 beta, bool upper, bool mirror)
+{
+  detail::syr2k_dispatch_A(A, B, trans, C, static_cast<NumericT>(alpha), static_cast<NumericT>(beta), true, upper, mirror);
+}
+
+/** @brief Symmetric matrix-vector product y = alpha * A x + beta * y, where only the lower (or upper) triangle of A is referenced.
+*
+* @param A      The symmetric matrix
+* @param x      The vector x
+* @param y      The result vector. y is not read if beta is zero.
+* @param alpha  Scaling factor of the product
+* @param beta   Scaling factor of y
+* @param upper  If true, the upper triangle of A is referenced, otherwise the lower triangle
+*/
+template<typename NumericT, typename ScalarT1, typename ScalarT2>
+void symv(matrix_base<NumericT> const & A,
+          vector_base<NumericT> const & x,
+          vector_base<NumericT> & y,
+          ScalarT1 alpha, ScalarT2 beta, bool upper)
+{
+  typedef NumericT        value_type;
+
+  value_type const * data_A = detail::extract_raw_pointer<value_type>(A);
+  value_type const * data_x = detail::extract_raw_pointer<value_type>(x);
+  value_type       * data_y = detail::extract_raw_pointer<value_type>(y);
+
+  vcl_size_t A_start1 = viennacl::traits::start1(A);
+  vcl_size_t A_start2 = viennacl::traits::start2(A);
+  vcl_size_t A_inc1   = viennacl::traits::stride1(A);
+  vcl_size_t A_inc2   = viennacl::traits::stride2(A);
+  vcl_size_t A_size1  = viennacl::traits::size1(A);
+  vcl_size_t A_internal_size1  = viennacl::traits::internal_size1(A);
+  vcl_size_t A_internal_size2  = viennacl::traits::internal_size2(A);
+
+  vcl_size_t x_start = viennacl::traits::start(x);
+  vcl_size_t x_inc   = viennacl::traits::stride(x);
+  vcl_size_t y_start = viennacl::traits::start(y);
+  vcl_size_t y_inc   = viennacl::traits::stride(y);
+
+  std::vector<value_type> result(A_size1);
+
+  // The referenced triangle is traversed row by row for row-major storage. For column-major storage, the transposed accessor traverses it column by column:
+  if (A.row_major())
+  {
+    detail::matrix_array_wrapper<value_type const, row_major, false>   wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+    detail::symv(wrapper_A, A_size1, upper, data_x, x_start, x_inc, result);
+  }
+  else
+  {
+    detail::matrix_array_wrapper<value_type const, column_major, true> wrapper_A(data_A, A_start1, A_start2, A_inc1, A_inc2, A_internal_size1, A_internal_size2);
+    detail::symv(wrapper_A, A_size1, !upper, data_x, x_start, x_inc, result);
+  }
+
+  value_type a = static_cast<value_type>(alpha);
+  value_type b = static_cast<value_type>(beta);
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for if (A_size1 > VIENNACL_OPENMP_SYMV_MIN_SIZE)
+#endif
+  for (long i2 = 0; i2 < static_cast<long>(A_size1); ++i2)
+  {
+    vcl_size_t i = static_cast<vcl_size_t>(i2);
+    value_type temp = a * result[i];
+    if (b > 0 || b < 0)
+      temp += b * data_y[i * y_inc + y_start];
+    data_y[i * y_inc + y_start] = temp;
+  }
+}
+
+} // namespace host_based
+} //namespace linalg
+} //namespace viennacl
+
+
+#endif
@@ -0,0 +1,358 @@
+#ifndef VIENNACL_LINALG_HOST_BASED_TSQR_OPERATIONS_HPP_
+#define VIENNACL_LINALG_HOST_BASED_TSQR_OPERATIONS_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/host_based/tsqr_operations.hpp
+    @brief Implementation of the tall-skinny QR factorization (TSQR) using a plain single-threaded or OpenMP-enabled execution on CPU.
+
+    The rows are split into blocks, which are factored independently by Householder QR.
+    The triangular factors of the blocks are then combined pairwise along a binary reduction tree.
+    Each tree node factors two stacked upper triangular matrices, for which the Householder vectors are upper triangular again.
+*/
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "viennacl/forwards.h"
+#include "viennacl/traits/size.hpp"
+#include "viennacl/traits/start.hpp"
+#include "viennacl/traits/stride.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/eigen_operations.hpp"
+
+#ifdef VIENNACL_WITH_OPENMP
+#include <omp.h>
+#endif
+
+/** @brief Number of rows of the blocks at the leaves of the TSQR reduction tree. At least twice the number of columns is used. */
+#ifndef VIENNACL_HOST_TSQR_BLOCK_ROWS
+  #define VIENNACL_HOST_TSQR_BLOCK_ROWS  256
+#endif
+
+namespace viennacl
+{
+namespace linalg
+{
+namespace host_based
+{
+namespace detail
+{
+  /** @brief Applies the reflection I - tau [1; v] [1; v]^T to num_cols columns of length len+1, which start at X and are ld apart.
+    *
+    * Four columns are processed at once in order to reuse the entries of v.
+    */
+  template<typename NumericT>
+  void tsqr_reflect(NumericT const * v, vcl_size_t len, NumericT tau, NumericT * X, vcl_size_t ld, vcl_size_t num_cols)
+  {
+    vcl_size_t c = 0;
+    for (; c + 4 <= num_cols; c += 4)
+    {
+      NumericT * x0 = X + c * ld;
+      NumericT * x1 = x0 + ld;
+      NumericT * x2 = x1 + ld;
+      NumericT * x3 = x2 + ld;
+      NumericT w0 = x0[0], w1 = x1[0], w2 = x2[0], w3 = x3[0];
+      for (vcl_size_t i = 0; i < len; ++i)
+      {
+        NumericT v_i = v[i];
+        w0 += v_i * x0[i+1];
+        w1 += v_i * x1[i+1];
+        w2 += v_i * x2[i+1];
+        w3 += v_i * x3[i+1];
+      }
+      w0 *= tau; w1 *= tau; w2 *= tau; w3 *= tau;
+      x0[0] -= w0; x1[0] -= w1; x2[0] -= w2; x3[0] -= w3;
+      for (vcl_size_t i = 0; i < len; ++i)
+      {
+        NumericT v_i = v[i];
+        x0[i+1] -= w0 * v_i;
+        x1[i+1] -= w1 * v_i;
+        x2[i+1] -= w2 * v_i;
+        x3[i+1] -= w3 * v_i;
+      }
+    }
+    for (; c < num_cols; ++c)
+    {
+      NumericT * x = X + c * ld;
+      NumericT w = x[0];
+      for (vcl_size_t i = 0; i < len; ++i)
+        w += v[i] * x[i+1];
+      w *= tau;
+      x[0] -= w;
+      for (vcl_size_t i = 0; i < len; ++i)
+        x[i+1] -= w * v[i];
+    }
+  }
+
+  /** @brief Householder QR factorization of the column-major m-by-n block Y (m >= n). R is stored in the upper triangle of Y, the Householder vectors below the diagonal. */
+  template<typename NumericT>
+  void tsqr_block_factor(NumericT * Y, vcl_size_t m, vcl_size_t n, NumericT * tau)
+  {
+    for (vcl_size_t j = 0; j < n; ++j)
+    {
+      NumericT * Y_j = Y + j * m;
+      eigen_householder_generate(m - j - 1, Y_j[j], Y_j + j + 1, tau[j]);
+      if (tau[j] > 0)
+        tsqr_reflect(Y_j + j + 1, m - j - 1, tau[j], Y_j + m + j, m, n - j - 1);
+    }
+  }
+
+  /** @brief Overwrites the column-major m-by-n matrix X with Q X, where Q is the orthogonal factor computed by tsqr_block_factor(). */
+  template<typename NumericT>
+  void tsqr_block_apply(NumericT const * Y, vcl_size_t m, vcl_size_t n, NumericT const * tau, NumericT * X)
+  {
+    for (vcl_size_t j = n; j-- > 0;)
+      if (tau[j] > 0)
+        tsqr_reflect(Y + j * m + j + 1, m - j - 1, tau[j], X + j, m, n);
+  }
+
+  /** @brief QR factorization of [R1; R2] for upper triangular column-major n-by-n matrices R1 and R2.
+    *
+    * R1 is overwritten by the triangular factor, R2 by the (upper triangular) Householder vectors.
+    */
+  template<typename NumericT>
+  void tsqr_node_factor(NumericT * R1, NumericT * R2, vcl_size_t n, NumericT * tau)
+  {
+    for (vcl_size_t j = 0; j < n; ++j)
+    {
+      NumericT * v = R2 + j * n;
+      eigen_householder_generate(j + 1, R1[j * n + j], v, tau[j]);
+      if (tau[j] <= 0)
+        continue;
+
+      for (vcl_size_t k = j + 1; k < n; ++k)
+      {
+        NumericT * R2_k = R2 + k * n;
+        NumericT w = R1[k * n + j];
+        for (vcl_size_t i = 0; i <= j; ++i)
+          w += v[i] * R2_k[i];
+        w *= tau[j];
+        R1[k * n + j] -= w;
+        for (vcl_size_t i = 0; i <= j; ++i)
+          R2_k[i] -= w * v[i];
+      }
+    }
+  }
+
+  /** @brief Computes [X1; X2] = Q [X1; 0] for the orthogonal factor Q computed by tsqr_node_factor(). X1 and X2 are column-major n-by-n matrices. */
+  template<typename NumericT>
+  void tsqr_node_apply(NumericT const * V, vcl_size_t n, NumericT const * tau, NumericT * X1, NumericT * X2)
+  {
+    std::fill(X2, X2 + n * n, NumericT(0));
+    for (vcl_size_t j = n; j-- > 0;)
+    {
+      if (tau[j] <= 0)
+        continue;
+
+      NumericT const * v = V + j * n;
+      for (vcl_size_t c = 0; c < n; ++c)
+      {
+        NumericT * X2_c = X2 + c * n;
+        NumericT w = X1[c * n + j];
+        for (vcl_size_t i = 0; i <= j; ++i)
+          w += v[i] * X2_c[i];
+        w *= tau[j];
+        X1[c * n + j] -= w;
+        for (vcl_size_t i = 0; i <= j; ++i)
+          X2_c[i] -= w * v[i];
+      }
+    }
+  }
+
+  /** @brief Computes the QR factorization A = Q R of the m-by-n matrix A (m >= n), where A is overwritten by the explicit factor Q.
+    *
+    * @param A           Accessor of the matrix A
+    * @param m           Number of rows of A
+    * @param n           Number of columns of A
+    * @param R           Column-major n-by-n array receiving the upper triangular factor with nonnegative diagonal
+    * @param block_rows  Number of rows of the blocks at the leaves of the reduction tree
+    */
+  template<typename MatrixAccT, typename NumericT>
+  void tsqr(MatrixAccT & A, vcl_size_t m, vcl_size_t n, NumericT * R, vcl_size_t block_rows)
+  {
+    vcl_size_t rows_per_block = std::max(block_rows, 2 * n);
+    vcl_size_t num_blocks     = std::max<vcl_size_t>(1, m / rows_per_block);  // the last block takes the remaining rows
+    vcl_size_t nn = n * n;
+
+    std::vector<NumericT> Y(m * n);                    // Householder vectors of the blocks, block b starts at row b * rows_per_block
+    std::vector<NumericT> tau_blocks(num_blocks * n);
+    std::vector<NumericT> R_blocks(num_blocks * nn);   // triangular factors, overwritten by the Householder vectors of the tree nodes
+    std::vector<NumericT> tau_nodes(num_blocks * n);   // node combining blocks i and i+s is stored with block i+s
+    std::vector<NumericT> C(num_blocks * nn);          // coefficients of the blocks with respect to the explicit Q
+
+    //
+    // Stage 1: Factor the blocks
+    //
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (num_blocks > 1)
+#endif
+    for (long b2 = 0; b2 < static_cast<long>(num_blocks); ++b2)
+    {
+      vcl_size_t b = static_cast<vcl_size_t>(b2);
+      vcl_size_t row_start = b * rows_per_block;
+      vcl_size_t rows = (b + 1 == num_blocks) ? m - row_start : rows_per_block;
+      NumericT * Y_b = &Y[0] + row_start * n;
+
+      for (vcl_size_t i = 0; i < rows; ++i)
+        for (vcl_size_t j = 0; j < n; ++j)
+          Y_b[j * rows + i] = A(row_start + i, j);
+
+      tsqr_block_factor(Y_b, rows, n, &tau_blocks[0] + b * n);
+
+      NumericT * R_b = &R_blocks[0] + b * nn;
+      for (vcl_size_t j = 0; j < n; ++j)
+        for (vcl_size_t i = 0; i <= j; ++i)
+          R_b[j * n + i] = Y_b[j * rows + i];
+    }
+
+    //
+    // Stage 2: Reduction tree over the triangular factors
+    //
+    vcl_size_t top_stride = 1;
+    for (vcl_size_t s = 1; s < num_blocks; s *= 2)
+    {
+      top_stride = s;
+      long num_pairs = static_cast<long>((num_blocks - s - 1) / (2 * s) + 1);
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for if (num_pairs > 1)
+#endif
+      for (long p = 0; p < num_pairs; ++p)
+      {
+        vcl_size_t i = 2 * s * static_cast<vcl_size_t>(p);
+        tsqr_node_factor(&R_blocks[0] + i * nn, &R_blocks[0] + (i + s) * nn, n, &tau_nodes[0] + (i + s) * n);
+      }
+    }
+
+    // R with nonnegative diagonal. The signs are absorbed into the columns of Q by starting from C = diag(signs):
+    for (vcl_size_t j = 0; j < n; ++j)
+    {
+      NumericT sign = (R_blocks[j * n + j] < 0) ? NumericT(-1) : NumericT(1);
+      for (vcl_size_t i = 0; i < n; ++i)
+        R[i * n + j] = (j <= i) ? sign * R_blocks[i * n + j] : NumericT(0);
+      C[j * n + j] = sign;
+    }
+
+    //
+    // Stage 3: Propagate the coefficients of the explicit Q down the tree
+    //
+    if (num_blocks > 1)
+    {
+      for (vcl_size_t s = top_stride; s > 0; s /= 2)
+      {
+        long num_pairs = static_cast<long>((num_blocks - s - 1) / (2 * s) + 1);
+#ifdef VIENNACL_WITH_OPENMP
+        #pragma omp parallel for if (num_pairs > 1)
+#endif
+        for (long p = 0; p < num_pairs; ++p)
+        {
+          vcl_size_t i = 2 * s * static_cast<vcl_size_t>(p);
+          tsqr_node_apply(&R_blocks[0] + (i + s) * nn, n, &tau_nodes[0] + (i + s) * n, &C[0] + i * nn, &C[0] + (i + s) * nn);
+        }
+      }
+    }
+
+    //
+    // Stage 4: Form the explicit Q block by block
+    //
+#ifdef VIENNACL_WITH_OPENMP
+    #pragma omp parallel for if (num_blocks > 1)
+#endif
+    for (long b2 = 0; b2 < static_cast<long>(num_blocks); ++b2)
+    {
+      vcl_size_t b = static_cast<vcl_size_t>(b2);
+      vcl_size_t row_start = b * rows_per_block;
+      vcl_size_t rows = (b + 1 == num_blocks) ? m - row_start : rows_per_block;
+
+      std::vector<NumericT> X(rows * n);
+      NumericT const * C_b = &C[0] + b * nn;
+      for (vcl_size_t j = 0; j < n; ++j)
+        for (vcl_size_t i = 0; i < n; ++i)
+          X[j * rows + i] = C_b[j * n + i];
+
+      tsqr_block_apply(&Y[0] + row_start * n, rows, n, &tau_blocks[0] + b * n, &X[0]);
+
+      for (vcl_size_t i = 0; i < rows; ++i)
+        for (vcl_size_t j = 0; j < n; ++j)
+          A(row_start + i, j) = X[j * rows + i];
+    }
+  }
+
+  /** @brief Writes the column-major n-by-n array R to the matrix accessed by R_acc. */
+  template<typename NumericT, typename MatrixAccT>
+  void tsqr_write_R(MatrixAccT & R_acc, std::vector<NumericT> const & R, vcl_size_t n)
+  {
+    for (vcl_size_t i = 0; i < n; ++i)
+      for (vcl_size_t j = 0; j < n; ++j)
+        R_acc(i, j) = R[j * n + i];
+  }
+
+} // namespace detail
+
+
+/** @brief Computes the QR factorization A = Q R of a tall and skinny matrix A (size1(A) >= size2(A)) by a reduction tree over row blocks.
+  *
+  * @param A           The matrix A, overwritten by the orthonormal factor Q
+  * @param R           The square matrix receiving the upper triangular factor R with nonnegative diagonal
+  * @param block_rows  Number of rows of the blocks at the leaves of the reduction tree
+  */
+template<typename NumericT>
+void tsqr(matrix_base<NumericT> & A, matrix_base<NumericT> & R, vcl_size_t block_rows = VIENNACL_HOST_TSQR_BLOCK_ROWS)
+{
+  vcl_size_t m = viennacl::traits::size1(A);
+  vcl_size_t n = viennacl::traits::size2(A);
+  if (n == 0)
+    return;
+
+  std::vector<NumericT> R_buffer(n * n);
+
+  NumericT * data_A = detail::extract_raw_pointer<NumericT>(A);
+  if (A.row_major())
+  {
+    detail::matrix_array_wrapper<NumericT, row_major, false>
+        wrapper_A(data_A, viennacl::traits::start1(A), viennacl::traits::start2(A), viennacl::traits::stride1(A), viennacl::traits::stride2(A), A.internal_size1(), A.internal_size2());
+    detail::tsqr(wrapper_A, m, n, &R_buffer[0], block_rows);
+  }
+  else
+  {
+    detail::matrix_array_wrapper<NumericT, column_major, false>
+        wrapper_A(data_A, viennacl::traits::start1(A), viennacl::traits::start2(A), viennacl::traits::stride1(A), viennacl::traits::stride2(A), A.internal_size1(), A.internal_size2());
+    detail::tsqr(wrapper_A, m, n, &R_buffer[0], block_rows);
+  }
+
+  NumericT * data_R = detail::extract_raw_pointer<NumericT>(R);
+  if (R.row_major())
+  {
+    detail::matrix_array_wrapper<NumericT, row_major, false>
+        wrapper_R(data_R, viennacl::traits::start1(R), viennacl::traits::start2(R), viennacl::traits::stride1(R), viennacl::traits::stride2(R), R.internal_size1(), R.internal_size2());
+    detail::tsqr_write_R(wrapper_R, R_buffer, n);
+  }
+  else
+  {
+    detail::matrix_array_wrapper<NumericT, column_major, false>
+        wrapper_R(data_R, viennacl::traits::start1(R), viennacl::traits::start2(R), viennacl::traits::stride1(R), viennacl::traits::stride2(R), R.internal_size1(), R.internal_size2());
+    detail::tsqr_write_R(wrapper_R, R_buffer, n);
+  }
+}
+
+} // namespace host_based
+} // namespace linalg
+} // namespace viennacl
+
+#endif
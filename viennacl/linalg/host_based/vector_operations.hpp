@@ -45,6 +45,11 @@
   #define VIENNACL_OPENMP_VECTOR_MIN_SIZE  5000
 #endif
 
+// Number of entries per chunk in reduce_many_impl() and in fused reductions. The partial results of the chunks are combined in a fixed order, hence the results only depend on this value, not on the number of threads:
+#ifndef VIENNACL_REDUCE_MANY_CHUNK_SIZE
+  #define VIENNACL_REDUCE_MANY_CHUNK_SIZE  2048
+#endif
+
 namespace viennacl
 {
 namespace linalg
@@ -935,6 +940,218 @@ void sum_impl(vector_base<NumericT> const & vec1,
 }
 
 
+namespace detail
+{
+  template<typename NumericT>
+  NumericT reduce_many_abs(NumericT val) { return static_cast<NumericT>(std::fabs(static_cast<double>(val))); }  //casting to double in order to avoid problems if T is an integer type
+  inline float  reduce_many_abs(float  val) { return std::fabs(val); }
+  inline double reduce_many_abs(double val) { return std::fabs(val); }
+
+  /** @brief Element-wise update, combination and initial value of the partial results of a reduction in reduce_many_impl() */
+  template<reduction_types ReductionV>
+  struct reduce_many_functor;
+
+  template<>
+  struct reduce_many_functor<REDUCTION_INNER_PROD>
+  {
+    template<typename NumericT> static NumericT init(NumericT)                             { return 0; }
+    template<typename NumericT> static NumericT apply(NumericT acc, NumericT x, NumericT y) { return acc + x * y; }
+    template<typename NumericT> static NumericT combine(NumericT a, NumericT b)            { return a + b; }
+  };
+
+  template<>
+  struct reduce_many_functor<REDUCTION_NORM_1>
+  {
+    template<typename NumericT> static NumericT init(NumericT)                             { return 0; }
+    template<typename NumericT> static NumericT apply(NumericT acc, NumericT x, NumericT)  { return acc + reduce_many_abs(x); }
+    template<typename NumericT> static NumericT combine(NumericT a, NumericT b)            { return a + b; }
+  };
+
+  template<>
+  struct reduce_many_functor<REDUCTION_NORM_2>
+  {
+    template<typename NumericT> static NumericT init(NumericT)                             { return 0; }
+    template<typename NumericT> static NumericT apply(NumericT acc, NumericT x, NumericT)  { return acc + x * x; }
+    template<typename NumericT> static NumericT combine(NumericT a, NumericT b)            { return a + b; }
+  };
+
+  template<>
+  struct reduce_many_functor<REDUCTION_NORM_INF>
+  {
+    template<typename NumericT> static NumericT init(NumericT)                             { return 0; }
+    template<typename NumericT> static NumericT apply(NumericT acc, NumericT x, NumericT)  { NumericT a = reduce_many_abs(x); return (a > acc) ? a : acc; }
+    template<typename NumericT> static NumericT combine(NumericT a, NumericT b)            { return (b > a) ? b : a; }
+  };
+
+  template<>
+  struct reduce_many_functor<REDUCTION_MAX>
+  {
+    template<typename NumericT> static NumericT init(NumericT first)                       { return first; }
+    template<typename NumericT> static NumericT apply(NumericT acc, NumericT x, NumericT)  { return (x > acc) ? x : acc; }
+    template<typename NumericT> static NumericT combine(NumericT a, NumericT b)            { return (b > a) ? b : a; }
+  };
+
+  template<>
+  struct reduce_many_functor<REDUCTION_MIN>
+  {
+    template<typename NumericT> static NumericT init(NumericT first)                       { return first; }
+    template<typename NumericT> static NumericT apply(NumericT acc, NumericT x, NumericT)  { return (x < acc) ? x : acc; }
+    template<typename NumericT> static NumericT combine(NumericT a, NumericT b)            { return (b < a) ? b : a; }
+  };
+
+  template<>
+  struct reduce_many_functor<REDUCTION_SUM>
+  {
+    template<typename NumericT> static NumericT init(NumericT)                             { return 0; }
+    template<typename NumericT> static NumericT apply(NumericT acc, NumericT x, NumericT)  { return acc + x; }
+    template<typename NumericT> static NumericT combine(NumericT a, NumericT b)            { return a + b; }
+  };
+
+  /** @brief Reduces a chunk of (at least one) entries.
+  *
+  * Eight independent partial results are accumulated, so that the compiler can map the main loop to SIMD instructions.
+  * The partial results are combined pairwise at the end.
+  */
+  template<reduction_types ReductionV, bool UnitStrideV, typename NumericT>
+  NumericT reduce_many_chunk(NumericT const * x, vcl_size_t inc_x,
+                             NumericT const * y, vcl_size_t inc_y,
+                             vcl_size_t size)
+  {
+    typedef reduce_many_functor<ReductionV>   FunctorType;
+
+    NumericT partial[8];
+    for (vcl_size_t k = 0; k < 8; ++k)
+      partial[k] = FunctorType::init(x[0]);
+
+    vcl_size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+      for (vcl_size_t k = 0; k < 8; ++k)
+        partial[k] = FunctorType::apply(partial[k], x[UnitStrideV ? i+k : (i+k)*inc_x], y[UnitStrideV ? i+k : (i+k)*inc_y]);
+    for (; i < size; ++i)
+      partial[i % 8] = FunctorType::apply(partial[i % 8], x[i*inc_x], y[i*inc_y]);
+
+    for (vcl_size_t width = 4; width > 0; width /= 2)
+      for (vcl_size_t k = 0; k < width; ++k)
+        partial[k] = FunctorType::combine(partial[k], partial[k + width]);
+
+    return partial[0];
+  }
+
+  template<reduction_types ReductionV, typename NumericT>
+  NumericT reduce_many_chunk(NumericT const * x, vcl_size_t inc_x,
+                             NumericT const * y, vcl_size_t inc_y,
+                             vcl_size_t size)
+  {
+    if (inc_x == 1 && inc_y == 1)
+      return reduce_many_chunk<ReductionV, true>(x, inc_x, y, inc_y, size);
+    return reduce_many_chunk<ReductionV, false>(x, inc_x, y, inc_y, size);
+  }
+
+  template<typename NumericT>
+  NumericT reduce_many_chunk(reduction_types type,
+                             NumericT const * x, vcl_size_t inc_x,
+                             NumericT const * y, vcl_size_t inc_y,
+                             vcl_size_t size)
+  {
+    switch (type)
+    {
+      case REDUCTION_INNER_PROD: return reduce_many_chunk<REDUCTION_INNER_PROD>(x, inc_x, y, inc_y, size);
+      case REDUCTION_NORM_1:     return reduce_many_chunk<REDUCTION_NORM_1    >(x, inc_x, y, inc_y, size);
+      case REDUCTION_NORM_2:     return reduce_many_chunk<REDUCTION_NORM_2    >(x, inc_x, y, inc_y, size);
+      case REDUCTION_NORM_INF:   return reduce_many_chunk<REDUCTION_NORM_INF  >(x, inc_x, y, inc_y, size);
+      case REDUCTION_MAX:        return reduce_many_chunk<REDUCTION_MAX       >(x, inc_x, y, inc_y, size);
+      case REDUCTION_MIN:        return reduce_many_chunk<REDUCTION_MIN       >(x, inc_x, y, inc_y, size);
+      case REDUCTION_SUM:        return reduce_many_chunk<REDUCTION_SUM       >(x, inc_x, y, inc_y, size);
+    }
+    return 0;
+  }
+
+  template<typename NumericT>
+  NumericT reduce_many_combine(reduction_types type, NumericT a, NumericT b)
+  {
+    switch (type)
+    {
+      case REDUCTION_INNER_PROD: return reduce_many_functor<REDUCTION_INNER_PROD>::combine(a, b);
+      case REDUCTION_NORM_1:     return reduce_many_functor<REDUCTION_NORM_1    >::combine(a, b);
+      case REDUCTION_NORM_2:     return reduce_many_functor<REDUCTION_NORM_2    >::combine(a, b);
+      case REDUCTION_NORM_INF:   return reduce_many_functor<REDUCTION_NORM_INF  >::combine(a, b);
+      case REDUCTION_MAX:        return reduce_many_functor<REDUCTION_MAX       >::combine(a, b);
+      case REDUCTION_MIN:        return reduce_many_functor<REDUCTION_MIN       >::combine(a, b);
+      case REDUCTION_SUM:        return reduce_many_functor<REDUCTION_SUM       >::combine(a, b);
+    }
+    return a;
+  }
+}
+
+/** @brief Evaluates several reductions over vectors of the same size in a single pass - implementation. Library users should call reduce_many(reductions).
+*
+* The vectors are processed in chunks of VIENNACL_REDUCE_MANY_CHUNK_SIZE entries, for which all reductions are computed while the chunk resides in cache.
+* The partial results of the chunks are then combined pairwise in a fixed tree order, so the results do not depend on the number of threads.
+*
+* @param reductions  The reductions, all vectors in host memory
+* @param results     The results, one entry per reduction
+*/
+template<typename NumericT>
+void reduce_many_impl(reduction_list<NumericT> const & reductions,
+                      std::vector<NumericT> & results)
+{
+  typedef NumericT        value_type;
+
+  vcl_size_t num_reductions = reductions.size();
+  vcl_size_t size1          = viennacl::traits::size(reductions.lhs(0));
+
+  std::vector<reduction_types>    types(num_reductions);
+  std::vector<value_type const *> data_x(num_reductions);
+  std::vector<value_type const *> data_y(num_reductions);
+  std::vector<vcl_size_t>         inc_x(num_reductions);
+  std::vector<vcl_size_t>         inc_y(num_reductions);
+
+  for (vcl_size_t j = 0; j < num_reductions; ++j)
+  {
+    types[j]  = reductions.type(j);
+    data_x[j] = detail::extract_raw_pointer<value_type>(reductions.lhs(j)) + viennacl::traits::start(reductions.lhs(j));
+    data_y[j] = detail::extract_raw_pointer<value_type>(reductions.rhs(j)) + viennacl::traits::start(reductions.rhs(j));
+    inc_x[j]  = viennacl::traits::stride(reductions.lhs(j));
+    inc_y[j]  = viennacl::traits::stride(reductions.rhs(j));
+  }
+
+  results.resize(num_reductions);
+  if (size1 == 0)
+  {
+    std::fill(results.begin(), results.end(), value_type(0));
+    return;
+  }
+
+  vcl_size_t chunk_size = VIENNACL_REDUCE_MANY_CHUNK_SIZE;
+  vcl_size_t num_chunks = (size1 - 1) / chunk_size + 1;
+  std::vector<value_type> partial(num_chunks * num_reductions);
+
+#ifdef VIENNACL_WITH_OPENMP
+  #pragma omp parallel for if (size1 > VIENNACL_OPENMP_VECTOR_MIN_SIZE)
+#endif
+  for (long chunk = 0; chunk < static_cast<long>(num_chunks); ++chunk)
+  {
+    vcl_size_t begin = vcl_size_t(chunk) * chunk_size;
+    vcl_size_t size  = std::min<vcl_size_t>(chunk_size, size1 - begin);
+
+    for (vcl_size_t j = 0; j < num_reductions; ++j)
+      partial[vcl_size_t(chunk) * num_reductions + j] = detail::reduce_many_chunk(types[j],
+                                                                                  data_x[j] + begin * inc_x[j], inc_x[j],
+                                                                                  data_y[j] + begin * inc_y[j], inc_y[j],
+                                                                                  size);
+  }
+
+  // combine the partial results of the chunks pairwise:
+  for (vcl_size_t width = 1; width < num_chunks; width *= 2)
+    for (vcl_size_t chunk = 0; chunk + width < num_chunks; chunk += 2 * width)
+      for (vcl_size_t j = 0; j < num_reductions; ++j)
+        partial[chunk * num_reductions + j] = detail::reduce_many_combine(types[j], partial[chunk * num_reductions + j], partial[(chunk + width) * num_reductions + j]);
+
+  for (vcl_size_t j = 0; j < num_reductions; ++j)
+    results[j] = (types[j] == REDUCTION_NORM_2) ? static_cast<value_type>(std::sqrt(static_cast<double>(partial[j]))) : partial[j];
+}
+
+
 /** @brief Computes a plane rotation of two vectors.
 *
 * Computes (x,y) <- (alpha * x + beta * y, -beta * x + alpha * y)
@@ -163,6 +163,29 @@ break;
 
 
 
+/** @brief Performs one asynchronous (Gauss-Seidel-like) nonlinear relaxation step in the Chow-Patel-ICC and returns an estimate of the nonlinear residual.
+  *
+  * Only available for the host backend, since the in-place updates rely on the memory consistency of a shared-memory system.
+  *
+  * @param L       Factor L to be updated in place for the incomplete Cholesky factorization
+  * @param aij_L   Lower triangular potion from system matrix
+  */
+template<typename NumericT>
+NumericT icc_chow_patel_sweep_async(compressed_matrix<NumericT>       & L,
+                                    vector<NumericT>            const & aij_L)
+{
+  switch (viennacl::traits::handle(L).get_active_handle_id())
+  {
+  case viennacl::MAIN_MEMORY:
+    return viennacl::linalg::host_based::icc_chow_patel_sweep_async(L, aij_L);
+  case viennacl::MEMORY_NOT_INITIALIZED:
+    throw memory_exception("not initialised!");
+  default:
+    throw memory_exception("not implemented");
+  }
+}
+
+
 //////////////////////// ILU ////////////////////
 
 /** @brief Extracts the lower triangular part L and the upper triangular part U from A.
@@ -248,14 +271,6 @@ template<typename NumericT>
 void ilu_transpose(compressed_matrix<NumericT> const & A,
                    compressed_matrix<NumericT>       & B)
 {
-  viennacl::context orig_ctx = viennacl::traits::context(A);
-  viennacl::context cpu_ctx(viennacl::MAIN_MEMORY);
-  (void)orig_ctx;
-  (void)cpu_ctx;
-
-  viennacl::compressed_matrix<NumericT> A_host(0, 0, 0, cpu_ctx);
-  (void)A_host;
-
   switch (viennacl::traits::handle(A).get_active_handle_id())
   {
   case viennacl::MAIN_MEMORY:
@@ -263,19 +278,22 @@ void ilu_transpose(compressed_matrix<NumericT> const & A,
     break;
 #ifdef VIENNACL_WITH_OPENCL
   case viennacl::OPENCL_MEMORY:
-    A_host = A;
-    B.switch_memory_context(cpu_ctx);
-    viennacl::linalg::host_based::ilu_transpose(A_host, B);
-    B.switch_memory_context(orig_ctx);
-    break;
 #endif
 #ifdef VIENNACL_WITH_CUDA
   case viennacl::CUDA_MEMORY:
+#endif
+#if defined(VIENNACL_WITH_OPENCL) || defined(VIENNACL_WITH_CUDA)
+  {
+    viennacl::context orig_ctx = viennacl::traits::context(A);
+    viennacl::context cpu_ctx(viennacl::MAIN_MEMORY);
+
+    viennacl::compressed_matrix<NumericT> A_host(0, 0, 0, cpu_ctx);
     A_host = A;
     B.switch_memory_context(cpu_ctx);
     viennacl::linalg::host_based::ilu_transpose(A_host, B);
     B.switch_memory_context(orig_ctx);
     break;
+  }
 #endif
   case viennacl::MEMORY_NOT_INITIALIZED:
     throw memory_exception("not initialised!");
@@ -329,6 +347,33 @@ break;
   }
 }
 
+/** @brief Performs one asynchronous (Gauss-Seidel-like) nonlinear relaxation step in the Chow-Patel-ILU and returns an estimate of the nonlinear residual.
+  *
+  * Only available for the host backend, since the in-place updates rely on the memory consistency of a shared-memory system.
+  *
+  * @param L            Lower-triangular matrix L in LU factorization, updated in place
+  * @param aij_L        Lower-triangular matrix L from A
+  * @param U_trans      Upper-triangular matrix U in CSC-storage, updated in place
+  * @param aij_U_trans  Upper-triangular matrix from A in CSC-storage, which is the same as U^trans in CSR-storage
+  */
+template<typename NumericT>
+NumericT ilu_chow_patel_sweep_async(compressed_matrix<NumericT>       & L,
+                                    vector<NumericT>            const & aij_L,
+                                    compressed_matrix<NumericT>       & U_trans,
+                                    vector<NumericT>            const & aij_U_trans)
+{
+  switch (viennacl::traits::handle(L).get_active_handle_id())
+  {
+  case viennacl::MAIN_MEMORY:
+    return viennacl::linalg::host_based::ilu_chow_patel_sweep_async(L, aij_L, U_trans, aij_U_trans);
+  case viennacl::MEMORY_NOT_INITIALIZED:
+    throw memory_exception("not initialised!");
+  default:
+    throw memory_exception("not implemented");
+  }
+}
+
+
 /** @brief Extracts the lower triangular part L and the upper triangular part U from A.
   *
   * Diagonals of L and U are stored explicitly in order to enable better code reuse.
@@ -365,6 +410,48 @@ break;
   }
 }
 
+/** @brief Recovers the factor R from the matrix (I - D^{-1}R) and the diagonal D computed by ilu_form_neumann_matrix().
+  *
+  * Used for warm-starting the nonlinear sweeps from a previous factorization. Non-host data is processed on the host.
+  *
+  * @param R       On input the matrix (I - D^{-1}R), on output the factor R
+  * @param diag_R  Diagonal of R as obtained from ilu_form_neumann_matrix()
+  */
+template<typename NumericT>
+void ilu_restore_from_neumann_matrix(compressed_matrix<NumericT> & R,
+                                     vector<NumericT>            & diag_R)
+{
+  switch (viennacl::traits::handle(R).get_active_handle_id())
+  {
+  case viennacl::MAIN_MEMORY:
+    viennacl::linalg::host_based::ilu_restore_from_neumann_matrix(R, diag_R);
+    break;
+#ifdef VIENNACL_WITH_OPENCL
+  case viennacl::OPENCL_MEMORY:
+#endif
+#ifdef VIENNACL_WITH_CUDA
+  case viennacl::CUDA_MEMORY:
+#endif
+#if defined(VIENNACL_WITH_OPENCL) || defined(VIENNACL_WITH_CUDA)
+  {
+    viennacl::context orig_ctx = viennacl::traits::context(R);
+    viennacl::context cpu_ctx(viennacl::MAIN_MEMORY);
+
+    R.switch_memory_context(cpu_ctx);
+    diag_R.switch_memory_context(cpu_ctx);
+    viennacl::linalg::host_based::ilu_restore_from_neumann_matrix(R, diag_R);
+    R.switch_memory_context(orig_ctx);
+    diag_R.switch_memory_context(orig_ctx);
+    break;
+  }
+#endif
+  case viennacl::MEMORY_NOT_INITIALIZED:
+    throw memory_exception("not initialised!");
+  default:
+    throw memory_exception("not implemented");
+  }
+}
+
 } //namespace linalg
 } //namespace viennacl
 
@@ -32,6 +32,8 @@
 #include "viennacl/traits/start.hpp"
 #include "viennacl/traits/handle.hpp"
 #include "viennacl/traits/stride.hpp"
+#include "viennacl/linalg/vector_operations.hpp"
+#include "viennacl/linalg/sparse_matrix_operations.hpp"
 #include "viennacl/linalg/host_based/iterative_operations.hpp"
 
 #ifdef VIENNACL_WITH_OPENCL
@@ -471,6 +473,48 @@ break;
 }
 
 
+/** @brief Performs one step of a polynomial preconditioner (Chebyshev, least-squares, or truncated Neumann series).
+  *
+  * This routine computes for a sparse matrix A and vectors 'x', 'w', 'r', 'y', and 'z':
+  *   y  = a * prod(A, x) + b * x + c * w + d * r;
+  *   z += e * y;      (skipped if e == 0)
+  * The host backend fuses the sparse matrix-vector product with all vector updates into a single pass for compressed_matrix.
+  * Other backends run the sparse matrix-vector product followed by the respective vector kernels.
+  * 'y' must neither alias 'x' nor 'w'.
+  */
+template<typename MatrixT, typename NumericT>
+void polynomial_precond_step(MatrixT const & A,
+                             vector_base<NumericT> const & x,
+                             vector_base<NumericT> const & w,
+                             vector_base<NumericT> const & r,
+                             vector_base<NumericT> & y,
+                             vector_base<NumericT> & z,
+                             NumericT a, NumericT b, NumericT c, NumericT d, NumericT e)
+{
+  switch (viennacl::traits::handle(x).get_active_handle_id())
+  {
+  case viennacl::MAIN_MEMORY:
+    viennacl::linalg::host_based::polynomial_precond_step(A, x, w, r, y, z, a, b, c, d, e);
+    break;
+  case viennacl::MEMORY_NOT_INITIALIZED:
+    throw memory_exception("not initialised!");
+  default:
+    viennacl::linalg::prod_impl(A, x, y);
+    viennacl::linalg::avbv(y,
+                           y, a, 1, false, false,
+                           x, b, 1, false, false);
+    if (c < 0 || c > 0 || d < 0 || d > 0)
+      viennacl::linalg::avbv_v(y,
+                               w, c, 1, false, false,
+                               r, d, 1, false, false);
+    if (e < 0 || e > 0)
+      viennacl::linalg::avbv(z,
+                             z, NumericT(1), 1, false, false,
+                             y, e,           1, false, false);
+  }
+}
+
+
 } //namespace linalg
 } //namespace viennacl
 
@@ -26,13 +26,17 @@
 
 #include <cmath>
 #include <vector>
+#include <limits>
+#include <algorithm>
 #include "viennacl/vector.hpp"
 #include "viennacl/compressed_matrix.hpp"
+#include "viennacl/matrix_proxy.hpp"
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/linalg/inner_prod.hpp"
 #include "viennacl/linalg/norm_2.hpp"
 #include "viennacl/io/matrix_market.hpp"
 #include "viennacl/linalg/bisect.hpp"
+#include "viennacl/linalg/host_based/eigen_operations.hpp"
 #include "viennacl/tools/random.hpp"
 
 namespace viennacl
@@ -50,21 +54,22 @@ public:
   {
     partial_reorthogonalization = 0,
     full_reorthogonalization,
-    no_reorthogonalization
+    no_reorthogonalization,
+    thick_restart
   };
 
   /** @brief The constructor
   *
   * @param factor                 Exponent of epsilon - tolerance for batches of Reorthogonalization
   * @param numeig                 Number of eigenvalues to be returned
-  * @param met                    Method for Lanczos-Algorithm: 0 for partial Reorthogonalization, 1 for full Reorthogonalization and 2 for Lanczos without Reorthogonalization
+  * @param met                    Method for Lanczos-Algorithm: 0 for partial Reorthogonalization, 1 for full Reorthogonalization, 2 for Lanczos without Reorthogonalization and 3 for thick-restart Lanczos
   * @param krylov                 Maximum krylov-space size
   */
 
   lanczos_tag(double factor = 0.75,
               vcl_size_t numeig = 10,
               int met = 0,
-              vcl_size_t krylov = 100) : factor_(factor), num_eigenvalues_(numeig), method_(met), krylov_size_(krylov) {}
+              vcl_size_t krylov = 100) : factor_(factor), num_eigenvalues_(numeig), method_(met), krylov_size_(krylov), tolerance_(1e-8), max_restarts_(100), restarts_taken_(0) {}
 
   /** @brief Sets the number of eigenvalues */
   void num_eigenvalues(vcl_size_t numeig){ num_eigenvalues_ = numeig; }
@@ -90,12 +95,33 @@ public:
   /** @brief Returns the reorthogonalization method */
   int method() const { return method_; }
 
+  /** @brief Sets the relative tolerance for the residuals of the Ritz pairs in thick-restart Lanczos */
+  void tolerance(double tol) { tolerance_ = tol; }
+
+  /** @brief Returns the relative tolerance for the residuals of the Ritz pairs in thick-restart Lanczos */
+  double tolerance() const { return tolerance_; }
+
+  /** @brief Sets the maximum number of restarts of thick-restart Lanczos */
+  void max_restarts(vcl_size_t max) { max_restarts_ = max; }
+
+  /** @brief Returns the maximum number of restarts of thick-restart Lanczos */
+  vcl_size_t max_restarts() const { return max_restarts_; }
+
+  /** @brief Returns the number of restarts carried out by the last run of thick-restart Lanczos */
+  vcl_size_t restarts() const { return restarts_taken_; }
+  void restarts(vcl_size_t i) const { restarts_taken_ = i; }
+
 
 private:
   double factor_;
   vcl_size_t num_eigenvalues_;
   int method_; // see enum defined above for possible values
   vcl_size_t krylov_size_;
+  double tolerance_;
+  vcl_size_t max_restarts_;
+
+  //return values
+  mutable vcl_size_t restarts_taken_;
 };
 
 
@@ -434,6 +460,184 @@ namespace detail
     return eigenvalues;
   }
 
+  /**
+  *   @brief Implementation of thick-restart Lanczos for the largest eigenvalues and the associated eigenvectors.
+  *
+  *   The Krylov basis is bounded by krylov_dim vectors. Once it is full, it is compressed to the Ritz vectors of the largest Ritz values
+  *   and the Lanczos process continues from the last Lanczos vector (Wu and Simon, SIAM J. Matrix Anal. Appl., 2000).
+  *   Converged Ritz pairs are locked by dropping their coupling to the new Lanczos vectors.
+  *   Each new Lanczos vector is reorthogonalized against the whole basis by two passes of classical Gram-Schmidt, each consisting of two matrix-vector products with the basis.
+  *
+  *   @param A                      The system matrix
+  *   @param r                      Random start vector
+  *   @param eigenvectors_A         Dense matrix holding the eigenvectors of A (one eigenvector per column)
+  *   @param krylov_dim             Maximum size of the Krylov basis
+  *   @param tag                    Tag with several options for the lanczos algorithm
+  *   @param compute_eigenvectors   Boolean flag. If true, eigenvectors are computed. Otherwise the routine returns after calculating eigenvalues.
+  *   @return                       Returns the largest eigenvalues in descending order (number of eigenvalues defined in the lanczos_tag)
+  */
+  template<typename MatrixT, typename DenseMatrixT, typename NumericT>
+  std::vector<NumericT>
+  lanczos_thick_restart(MatrixT const& A, vector_base<NumericT> & r, DenseMatrixT & eigenvectors_A, vcl_size_t krylov_dim, lanczos_tag const & tag, bool compute_eigenvectors)
+  {
+    typedef viennacl::matrix<NumericT, viennacl::column_major>   BasisType;
+
+    vcl_size_t n   = r.size();
+    vcl_size_t nev = std::min(tag.num_eigenvalues(), n);
+    vcl_size_t m   = std::min(n, std::max(krylov_dim, nev + 2));
+    if (nev == 0)
+      return std::vector<NumericT>();
+
+    NumericT eps = std::numeric_limits<NumericT>::epsilon();
+    NumericT tol = std::max(NumericT(tag.tolerance()), eps);
+    viennacl::context ctx = viennacl::traits::context(r);
+    viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+    viennacl::tools::uniform_random_numbers<NumericT> random_gen;
+
+    BasisType V(n, m + 1, ctx);  // Krylov basis (each Krylov vector is one column)
+    viennacl::vector<NumericT> w(n, ctx);
+    viennacl::vector<NumericT> coeffs(m, ctx);
+    std::vector<NumericT> T(m * m);   // projected matrix, column-major
+    std::vector<NumericT> theta;      // Ritz values in ascending order
+    BasisType T_host(m, m, host_ctx);
+    BasisType Y(m, m, host_ctx);      // eigenvectors of T
+    NumericT * data_T = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(T_host);
+    NumericT * data_Y = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(Y);
+    vcl_size_t ldY = Y.internal_size1();
+
+    viennacl::vector_base<NumericT> v0(V.handle(), n, 0, 1);
+    v0 = r / viennacl::linalg::norm_2(r);
+
+    vcl_size_t k = 0;      // number of Ritz vectors kept at the last restart
+    NumericT beta = 0;
+    NumericT anorm = 0;    // estimate of the spectral norm of A
+    vcl_size_t restart = 0;
+    for (;; ++restart)
+    {
+      //
+      // Step 1: Extend the Krylov basis from k to m vectors
+      //
+      for (vcl_size_t j = k; j < m; ++j)
+      {
+        viennacl::vector_base<NumericT> v_j(V.handle(), n, j * V.internal_size1(), 1);
+        viennacl::vector_base<NumericT> v_jplus1(V.handle(), n, (j+1) * V.internal_size1(), 1);
+        viennacl::matrix_range<BasisType> V_j(V, viennacl::range(0, n), viennacl::range(0, j + 1));
+        viennacl::vector_range<viennacl::vector<NumericT> > coeffs_j(coeffs, viennacl::range(0, j + 1));
+
+        w = viennacl::linalg::prod(A, v_j);
+
+        // full reorthogonalization (the coefficients for v_j yield alpha_j):
+        coeffs_j = viennacl::linalg::prod(trans(V_j), w);
+        w -= viennacl::linalg::prod(V_j, coeffs_j);
+        NumericT alpha = coeffs[j];
+        coeffs_j = viennacl::linalg::prod(trans(V_j), w);
+        w -= viennacl::linalg::prod(V_j, coeffs_j);
+        alpha += coeffs[j];
+
+        T[j * m + j] = alpha;
+        beta = viennacl::linalg::norm_2(w);
+        anorm = std::max(anorm, std::max(std::fabs(alpha), beta));
+
+        if (beta > eps * anorm)
+          v_jplus1 = w / beta;
+        else if (j + 1 < n)
+        {
+          // invariant subspace found, continue with a random vector orthogonal to the basis:
+          beta = 0;
+          std::vector<NumericT> s(n);
+          for (vcl_size_t i=0; i<n; ++i)
+            s[i] = NumericT(0.5) - random_gen();
+          viennacl::copy(s, w);
+          for (vcl_size_t pass = 0; pass < 2; ++pass)
+          {
+            coeffs_j = viennacl::linalg::prod(trans(V_j), w);
+            w -= viennacl::linalg::prod(V_j, coeffs_j);
+          }
+          v_jplus1 = w / viennacl::linalg::norm_2(w);
+        }
+        else
+        {
+          beta = 0;
+          v_jplus1.clear();
+        }
+
+        if (j + 1 < m)
+        {
+          T[ j    * m + j + 1] = beta;
+          T[(j+1) * m + j    ] = beta;
+        }
+      }
+
+      //
+      // Step 2: Rayleigh-Ritz procedure. The residual norm of the Ritz pair (theta_i, V y_i) is |beta * y_i[m-1]|.
+      //
+      for (vcl_size_t j = 0; j < m; ++j)
+        for (vcl_size_t i = 0; i < m; ++i)
+          data_T[viennacl::column_major::mem_index(i, j, T_host.internal_size1(), T_host.internal_size2())] = T[j * m + i];
+      viennacl::linalg::host_based::symmetric_eigen(T_host, Y, theta);
+      anorm = std::max(anorm, std::max(std::fabs(theta[0]), std::fabs(theta[m-1])));
+
+      vcl_size_t num_converged = 0;
+      for (vcl_size_t i = m - nev; i < m; ++i)
+        if (std::fabs(beta * data_Y[i * ldY + m - 1]) <= tol * anorm)
+          ++num_converged;
+
+      if (num_converged == nev || restart >= tag.max_restarts())
+        break;
+
+      //
+      // Step 3: Thick restart with the Ritz vectors of the kk largest Ritz values, continuing with v_m
+      //
+      vcl_size_t kk = std::min(m - 1, nev + (m - nev) / 2);
+
+      BasisType Y_kept(m, kk, host_ctx);
+      NumericT * data_Y_kept = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(Y_kept);
+      for (vcl_size_t j = 0; j < kk; ++j)
+        for (vcl_size_t i = 0; i < m; ++i)
+          data_Y_kept[j * Y_kept.internal_size1() + i] = data_Y[(m - kk + j) * ldY + i];
+      Y_kept.switch_memory_context(ctx);
+
+      BasisType V_kept = viennacl::linalg::prod(viennacl::project(V, viennacl::range(0, n), viennacl::range(0, m)), Y_kept);
+      viennacl::project(V, viennacl::range(0, n), viennacl::range(0, kk)) = V_kept;
+      viennacl::vector_base<NumericT> v_kk(V.handle(), n, kk * V.internal_size1(), 1);
+      viennacl::vector_base<NumericT> v_m(V.handle(), n, m * V.internal_size1(), 1);
+      v_kk = v_m;
+
+      // projected matrix is diagonal with the couplings of the Ritz vectors to v_kk in row and column kk. Converged Ritz vectors are locked:
+      std::fill(T.begin(), T.end(), NumericT(0));
+      for (vcl_size_t j = 0; j < kk; ++j)
+      {
+        NumericT coupling = beta * data_Y[(m - kk + j) * ldY + m - 1];
+        if (std::fabs(coupling) <= tol * anorm)
+          coupling = 0;
+        T[j  * m + j ] = theta[m - kk + j];
+        T[j  * m + kk] = coupling;
+        T[kk * m + j ] = coupling;
+      }
+      k = kk;
+    }
+    tag.restarts(restart);
+
+    std::vector<NumericT> eigenvalues(nev);
+    for (vcl_size_t i = 0; i < nev; ++i)
+      eigenvalues[i] = theta[m - 1 - i];
+
+    if (compute_eigenvectors)
+    {
+      BasisType Y_wanted(m, nev, host_ctx);
+      NumericT * data_Y_wanted = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(Y_wanted);
+      for (vcl_size_t j = 0; j < nev; ++j)
+        for (vcl_size_t i = 0; i < m; ++i)
+          data_Y_wanted[j * Y_wanted.internal_size1() + i] = data_Y[(m - 1 - j) * ldY + i];
+      Y_wanted.switch_memory_context(ctx);
+
+      viennacl::project(eigenvectors_A, viennacl::range(0, n), viennacl::range(0, nev))
+          = viennacl::linalg::prod(viennacl::project(V, viennacl::range(0, n), viennacl::range(0, m)), Y_wanted);
+    }
+
+    return eigenvalues;
+  }
+
 } // end namespace detail
 
 /**
@@ -472,6 +676,8 @@ eig(MatrixT const & matrix, DenseMatrixT & eigenvectors_A, lanczos_tag const & t
 
   switch (tag.method())
   {
+  case lanczos_tag::thick_restart:
+    return detail::lanczos_thick_restart(matrix, r, eigenvectors_A, size_krylov, tag, compute_eigenvectors);
   case lanczos_tag::partial_reorthogonalization:
     eigenvalues = detail::lanczosPRO(matrix, r, eigenvectors_A, size_krylov, tag, compute_eigenvectors);
     break;
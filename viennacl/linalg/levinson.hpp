@@ -0,0 +1,139 @@
+#ifndef VIENNACL_LINALG_LEVINSON_HPP_
+#define VIENNACL_LINALG_LEVINSON_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/levinson.hpp
+    @brief Implementation of the Levinson-Durbin solver for symmetric Toeplitz systems. Experimental.
+*/
+
+#include <vector>
+#include <algorithm>
+
+#include "viennacl/forwards.h"
+#include "viennacl/vector.hpp"
+#include "viennacl/toeplitz_matrix.hpp"
+
+namespace viennacl
+{
+namespace linalg
+{
+
+/** @brief A tag for the Levinson-Durbin solver for symmetric Toeplitz systems. Used for dispatching the solve() function.
+*/
+class levinson_tag {};
+
+namespace detail
+{
+  /** @brief Solves T x = b for the symmetric Toeplitz matrix T with first column t in O(n^2) operations.
+  *
+  * Following Algorithm 4.7.2 (Levinson) in "Matrix Computations" by G. Golub and C. Van Loan.
+  * The solutions y of the Yule-Walker systems are updated alongside the solutions x of the leading k-by-k systems.
+  *
+  * @param t     First column of T
+  * @param b     Right hand side, overwritten by the solution
+  */
+  template<typename NumericT>
+  void levinson_solve(std::vector<NumericT> const & t, std::vector<NumericT> & b)
+  {
+    vcl_size_t n = t.size();
+    if (n == 0)
+      return;
+    if (t[0] <= 0 && t[0] >= 0)
+      throw zero_on_diagonal_exception("ViennaCL: Singular leading submatrix encountered in Levinson solver!");
+
+    // normalize to unit diagonal:
+    std::vector<NumericT> r(n);
+    for (vcl_size_t i = 0; i < n; ++i)
+      r[i] = t[i] / t[0];
+    std::vector<NumericT> x(n), y(n), z(n);
+
+    x[0] = b[0] / t[0];
+    NumericT alpha = (n > 1) ? -r[1] : NumericT(0);
+    NumericT beta  = 1;
+    y[0] = alpha;
+
+    for (vcl_size_t k = 1; k < n; ++k)
+    {
+      beta *= (1 - alpha) * (1 + alpha);
+      if (beta <= 0 && beta >= 0)
+        throw zero_on_diagonal_exception("ViennaCL: Singular leading submatrix encountered in Levinson solver!");
+
+      NumericT mu = b[k] / t[0];
+      for (vcl_size_t i = 0; i < k; ++i)
+        mu -= r[i + 1] * x[k - 1 - i];
+      mu /= beta;
+
+      for (vcl_size_t i = 0; i < k; ++i)
+        x[i] += mu * y[k - 1 - i];
+      x[k] = mu;
+
+      if (k + 1 < n)
+      {
+        alpha = -r[k + 1];
+        for (vcl_size_t i = 0; i < k; ++i)
+          alpha -= r[i + 1] * y[k - 1 - i];
+        alpha /= beta;
+
+        for (vcl_size_t i = 0; i < k; ++i)
+          z[i] = y[i] + alpha * y[k - 1 - i];
+        std::copy(z.begin(), z.begin() + static_cast<vcl_ptrdiff_t>(k), y.begin());
+        y[k] = alpha;
+      }
+    }
+
+    b.swap(x);
+  }
+}
+
+/** @brief Solves a system with a symmetric Toeplitz matrix using the Levinson-Durbin recursion in O(n^2) operations.
+*
+* Only the first column of the matrix is accessed, the matrix is assumed to be symmetric.
+* The recursion runs on the host and requires all leading principal submatrices to be nonsingular, which is the case for symmetric positive definite matrices.
+* Throws a zero_on_diagonal_exception if a singular leading principal submatrix is encountered.
+*
+* @param mat     The symmetric Toeplitz matrix
+* @param rhs     The right hand side vector
+* @return The result vector
+*/
+template<typename NumericT, unsigned int AlignmentV>
+viennacl::vector<NumericT> solve(viennacl::toeplitz_matrix<NumericT, AlignmentV> const & mat,
+                                 viennacl::vector_base<NumericT> const & rhs,
+                                 levinson_tag const &)
+{
+  assert(mat.size1() == rhs.size() && bool("Size mismatch"));
+
+  // the first column is stored in the first mat.size1() entries of the generator:
+  std::vector<NumericT> elements(mat.elements().size());
+  viennacl::fast_copy(mat.elements(), elements);
+  elements.resize(mat.size1());
+
+  std::vector<NumericT> x(rhs.size());
+  viennacl::copy(rhs.begin(), rhs.end(), x.begin());
+
+  detail::levinson_solve(elements, x);
+
+  viennacl::vector<NumericT> result(rhs.size(), viennacl::traits::context(rhs));
+  viennacl::copy(x.begin(), x.end(), result.begin());
+  return result;
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,347 @@
+#ifndef VIENNACL_LINALG_LOBPCG_HPP_
+#define VIENNACL_LINALG_LOBPCG_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/lobpcg.hpp
+*   @brief Implementation of the locally optimal block preconditioned conjugate gradient method (LOBPCG) for the smallest eigenvalues of symmetric matrices.
+*
+*   The search space consists of the current eigenvector approximations X, the preconditioned residuals W and the previous search directions P (Knyazev, SIAM J. Sci. Comput., 2001).
+*   All blocks are kept orthonormal, such that the Rayleigh-Ritz procedure only requires a standard symmetric eigenvalue problem of small size, which is solved on the host.
+*   The product of the system matrix with the whole search space is computed by a single sparse matrix-dense matrix product.
+*   Converged eigenpairs are soft-locked, i.e. their residuals and search directions are no longer added to the search space.
+*/
+
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "viennacl/vector.hpp"
+#include "viennacl/matrix.hpp"
+#include "viennacl/matrix_proxy.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/sparse_matrix_operations.hpp"
+#include "viennacl/linalg/tsqr.hpp"
+#include "viennacl/linalg/host_based/eigen_operations.hpp"
+#include "viennacl/tools/random.hpp"
+
+namespace viennacl
+{
+namespace linalg
+{
+
+/** @brief A tag for the LOBPCG eigenvalue solver. Used for supplying solver parameters and for dispatching the eig() function.
+*/
+class lobpcg_tag
+{
+public:
+  /** @brief The constructor
+  *
+  * @param numeig           Number of smallest eigenvalues to be computed
+  * @param tol              Relative tolerance for the residuals (eigenpair (lambda, x) is converged if ||A x - lambda x|| < tol * ||A||)
+  * @param max_iterations   The maximum number of iterations
+  */
+  lobpcg_tag(vcl_size_t numeig = 10, double tol = 1e-8, vcl_size_t max_iterations = 500)
+    : num_eigenvalues_(numeig), tol_(tol), iterations_(max_iterations), iters_taken_(0), last_error_(0) {}
+
+  /** @brief Sets the number of eigenvalues */
+  void num_eigenvalues(vcl_size_t numeig) { num_eigenvalues_ = numeig; }
+  /** @brief Returns the number of eigenvalues */
+  vcl_size_t num_eigenvalues() const { return num_eigenvalues_; }
+
+  /** @brief Returns the relative tolerance */
+  double tolerance() const { return tol_; }
+
+  /** @brief Returns the maximum number of iterations */
+  vcl_size_t max_iterations() const { return iterations_; }
+
+  /** @brief Return the number of solver iterations: */
+  vcl_size_t iters() const { return iters_taken_; }
+  void iters(vcl_size_t i) const { iters_taken_ = i; }
+
+  /** @brief Returns the largest relative residual at the end of the solver run */
+  double error() const { return last_error_; }
+  /** @brief Sets the largest relative residual at the end of the solver run */
+  void error(double e) const { last_error_ = e; }
+
+private:
+  vcl_size_t num_eigenvalues_;
+  double tol_;
+  vcl_size_t iterations_;
+
+  //return values from solver
+  mutable vcl_size_t iters_taken_;
+  mutable double last_error_;
+};
+
+namespace detail
+{
+  /** @brief Computes AS = A * S for a sparse system matrix A */
+  template<typename MatrixT, typename NumericT>
+  typename viennacl::enable_if< viennacl::is_any_sparse_matrix<MatrixT>::value>::type
+  lobpcg_apply(MatrixT const & A, viennacl::matrix_base<NumericT> const & S, viennacl::matrix_base<NumericT> & AS)
+  {
+    viennacl::linalg::prod_impl(A, S, AS);
+  }
+
+  /** @brief Computes AS = A * S for a dense system matrix A */
+  template<typename NumericT>
+  void lobpcg_apply(viennacl::matrix_base<NumericT> const & A, viennacl::matrix_base<NumericT> const & S, viennacl::matrix_base<NumericT> & AS)
+  {
+    AS = viennacl::linalg::prod(A, S);
+  }
+
+  /** @brief Orthogonalizes the columns [first, last) of the column-major matrix S against the columns [0, first) and orthonormalizes them.
+  *
+  * Block Gram-Schmidt followed by TSQR is carried out twice, so that columns which are numerically linearly dependent are still orthonormal to the previous ones.
+  */
+  template<typename NumericT>
+  void lobpcg_orthonormalize(viennacl::matrix<NumericT, viennacl::column_major> & S, vcl_size_t first, vcl_size_t last)
+  {
+    if (last <= first)
+      return;
+
+    vcl_size_t n = S.size1();
+    viennacl::matrix_range<viennacl::matrix<NumericT, viennacl::column_major> > S_prev(S, viennacl::range(0, n), viennacl::range(0, first));
+    viennacl::matrix_range<viennacl::matrix<NumericT, viennacl::column_major> > S_new(S, viennacl::range(0, n), viennacl::range(first, last));
+    viennacl::matrix<NumericT, viennacl::column_major> R(last - first, last - first, viennacl::traits::context(S));
+
+    for (vcl_size_t pass = 0; pass < 2; ++pass)
+    {
+      if (first > 0)
+      {
+        viennacl::matrix<NumericT, viennacl::column_major> H = viennacl::linalg::prod(trans(S_prev), S_new);
+        S_new -= viennacl::linalg::prod(S_prev, H);
+      }
+      viennacl::linalg::tsqr(S_new, R);
+    }
+  }
+
+  /** @brief Solves the small symmetric eigenvalue problem of the Rayleigh-Ritz procedure on the host.
+  *
+  * @param G        The s-by-s projected matrix, symmetrized on the host
+  * @param C        The s-by-s matrix receiving the eigenvectors, in the memory domain of G
+  * @param theta    The eigenvalues in ascending order
+  */
+  template<typename NumericT>
+  void lobpcg_rayleigh_ritz(viennacl::matrix<NumericT, viennacl::column_major> const & G,
+                            viennacl::matrix<NumericT, viennacl::column_major> & C,
+                            std::vector<NumericT> & theta)
+  {
+    vcl_size_t s = G.size1();
+    viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+
+    viennacl::matrix<NumericT, viennacl::column_major> G_host(G);
+    G_host.switch_memory_context(host_ctx);
+    NumericT * data_G = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(G_host);
+    vcl_size_t ld = G_host.internal_size1();
+    for (vcl_size_t j = 0; j < s; ++j)
+      for (vcl_size_t i = j + 1; i < s; ++i)
+      {
+        NumericT value = (data_G[j * ld + i] + data_G[i * ld + j]) / NumericT(2);
+        data_G[j * ld + i] = value;
+        data_G[i * ld + j] = value;
+      }
+
+    viennacl::matrix<NumericT, viennacl::column_major> C_host(s, s, host_ctx);
+    viennacl::linalg::host_based::symmetric_eigen(G_host, C_host, theta);
+    C_host.switch_memory_context(viennacl::traits::context(G));
+    C = C_host;
+  }
+}
+
+/**
+*   @brief Computes the smallest eigenvalues and the associated eigenvectors of a symmetric matrix using LOBPCG.
+*
+*   @param A              The symmetric system matrix (sparse or dense)
+*   @param eigenvectors   Dense matrix with at least as many columns as eigenvalues requested. Receives the eigenvectors (one eigenvector per column).
+*   @param tag            Tag with the number of eigenvalues and convergence criteria
+*   @param precond        A preconditioner approximating the inverse of A, e.g. jacobi_precond or amg_precond. Its apply() member is called for each residual.
+*   @return               Returns the smallest eigenvalues in ascending order
+*/
+template<typename MatrixT, typename DenseMatrixT, typename PreconditionerT>
+std::vector< typename viennacl::result_of::cpu_value_type<typename MatrixT::value_type>::type >
+eig(MatrixT const & A, DenseMatrixT & eigenvectors, lobpcg_tag const & tag, PreconditionerT const & precond)
+{
+  typedef typename viennacl::result_of::value_type<MatrixT>::type            NumericType;
+  typedef typename viennacl::result_of::cpu_value_type<NumericType>::type    NumericT;
+  typedef viennacl::matrix<NumericT, viennacl::column_major>                 BlockType;
+  typedef viennacl::matrix_range<BlockType>                                  BlockRangeType;
+
+  vcl_size_t n = A.size1();
+  vcl_size_t k = std::min(tag.num_eigenvalues(), n);
+  if (k == 0)
+    return std::vector<NumericT>();
+
+  viennacl::context ctx = viennacl::traits::context(A);
+  BlockType X(n, k, ctx), AX(n, k, ctx), P(n, k, ctx);
+  BlockType S(n, 3 * k, ctx), AS(n, 3 * k, ctx);
+  viennacl::vector<NumericT> r(n, ctx);
+  std::vector<NumericT> theta;
+  std::vector<NumericT> lambda(k);
+  std::vector<bool> active(k, false);
+  NumericT anorm = 0;    // estimate of the spectral norm of A from the Ritz values
+  NumericT max_residual = 0;
+
+  // random initial block:
+  viennacl::tools::uniform_random_numbers<NumericT> random_gen;
+  std::vector<NumericT> s(n);
+  for (vcl_size_t j = 0; j < k; ++j)
+  {
+    for (vcl_size_t i = 0; i < n; ++i)
+      s[i] = NumericT(0.5) - random_gen();
+    viennacl::vector_base<NumericT> s_j(S.handle(), n, j * S.internal_size1(), 1);
+    viennacl::copy(s, r);
+    s_j = r;
+  }
+
+  vcl_size_t num_active = 0;   // number of columns of W and P in the search space
+  bool has_P = false;
+  vcl_size_t iter = 0;
+  for (;; ++iter)
+  {
+    //
+    // Step 1: Set up the search space S = [X, W, P] with orthonormal columns
+    //
+    vcl_size_t num_cols = k + (has_P ? 2 : 1) * num_active;
+    detail::lobpcg_orthonormalize(S, 0, k);
+    detail::lobpcg_orthonormalize(S, k, k + num_active);
+    if (has_P)
+      detail::lobpcg_orthonormalize(S, k + num_active, num_cols);
+
+    //
+    // Step 2: Rayleigh-Ritz procedure in the search space, using one sparse matrix-dense matrix product:
+    //
+    BlockRangeType S_cols(S, viennacl::range(0, n), viennacl::range(0, num_cols));
+    BlockRangeType AS_cols(AS, viennacl::range(0, n), viennacl::range(0, num_cols));
+    detail::lobpcg_apply(A, S_cols, AS_cols);
+
+    BlockType G = viennacl::linalg::prod(trans(S_cols), AS_cols);
+    BlockType C(num_cols, num_cols, ctx);
+    detail::lobpcg_rayleigh_ritz(G, C, theta);
+    anorm = std::max(anorm, std::max(std::fabs(theta[0]), std::fabs(theta[num_cols - 1])));
+
+    BlockRangeType C_X(C, viennacl::range(0, num_cols), viennacl::range(0, k));
+    X  = viennacl::linalg::prod(S_cols, C_X);
+    AX = viennacl::linalg::prod(AS_cols, C_X);
+    if (num_cols > k)
+    {
+      // new search directions: contributions of W and P to the new X
+      BlockRangeType S_WP(S, viennacl::range(0, n), viennacl::range(k, num_cols));
+      BlockRangeType C_WP(C, viennacl::range(k, num_cols), viennacl::range(0, k));
+      P = viennacl::linalg::prod(S_WP, C_WP);
+    }
+    for (vcl_size_t j = 0; j < k; ++j)
+      lambda[j] = theta[j];
+
+    //
+    // Step 3: Residuals R = A X - X Lambda, convergence check and soft locking
+    //
+    max_residual = 0;
+    vcl_size_t active_before = num_active;
+    num_active = 0;
+    for (vcl_size_t j = 0; j < k; ++j)
+    {
+      viennacl::vector_base<NumericT> x_j(X.handle(), n, j * X.internal_size1(), 1);
+      viennacl::vector_base<NumericT> Ax_j(AX.handle(), n, j * AX.internal_size1(), 1);
+      r = Ax_j - lambda[j] * x_j;
+      NumericT residual = viennacl::linalg::norm_2(r) / anorm;
+      max_residual = std::max(max_residual, residual);
+      active[j] = (residual > NumericT(tag.tolerance())) && (k + 2 * (num_active + 1) <= n);
+      if (!active[j])
+        continue;
+
+      // preconditioned residual goes to the W-block of the next search space:
+      precond.apply(r);
+      viennacl::vector_base<NumericT> w_j(S.handle(), n, (k + num_active) * S.internal_size1(), 1);
+      w_j = r;
+      ++num_active;
+    }
+
+    if (num_active == 0 || iter + 1 >= tag.max_iterations())
+      break;
+
+    // X and the search directions of the active eigenpairs for the next search space:
+    has_P = (active_before > 0);
+    vcl_size_t c = 0;
+    for (vcl_size_t j = 0; j < k; ++j)
+    {
+      viennacl::vector_base<NumericT> x_j(X.handle(), n, j * X.internal_size1(), 1);
+      viennacl::vector_base<NumericT> s_j(S.handle(), n, j * S.internal_size1(), 1);
+      s_j = x_j;
+      if (has_P && active[j])
+      {
+        viennacl::vector_base<NumericT> p_j(P.handle(), n, j * P.internal_size1(), 1);
+        viennacl::vector_base<NumericT> s_p(S.handle(), n, (k + num_active + c) * S.internal_size1(), 1);
+        s_p = p_j;
+        ++c;
+      }
+    }
+  }
+
+  tag.iters(iter + 1);
+  tag.error(max_residual);
+
+  for (vcl_size_t j = 0; j < k; ++j)
+  {
+    viennacl::vector_base<NumericT> x_j(X.handle(), n, j * X.internal_size1(), 1);
+    viennacl::vector_base<NumericT> eigenvector_j(eigenvectors.handle(),
+                                                  n,
+                                                  eigenvectors.row_major() ? j : j * eigenvectors.internal_size1(),
+                                                  eigenvectors.row_major() ? eigenvectors.internal_size2() : 1);
+    eigenvector_j = x_j;
+  }
+  return lambda;
+}
+
+/**
+*   @brief Computes the smallest eigenvalues and the associated eigenvectors of a symmetric matrix using LOBPCG without preconditioner.
+*
+*   @param A              The symmetric system matrix (sparse or dense)
+*   @param eigenvectors   Dense matrix with at least as many columns as eigenvalues requested. Receives the eigenvectors (one eigenvector per column).
+*   @param tag            Tag with the number of eigenvalues and convergence criteria
+*   @return               Returns the smallest eigenvalues in ascending order
+*/
+template<typename MatrixT, typename DenseMatrixT>
+std::vector< typename viennacl::result_of::cpu_value_type<typename MatrixT::value_type>::type >
+eig(MatrixT const & A, DenseMatrixT & eigenvectors, lobpcg_tag const & tag)
+{
+  return viennacl::linalg::eig(A, eigenvectors, tag, viennacl::linalg::no_precond());
+}
+
+/**
+*   @brief Computes the smallest eigenvalues of a symmetric matrix using LOBPCG without preconditioner.
+*
+*   @param A              The symmetric system matrix (sparse or dense)
+*   @param tag            Tag with the number of eigenvalues and convergence criteria
+*   @return               Returns the smallest eigenvalues in ascending order
+*/
+template<typename MatrixT>
+std::vector< typename viennacl::result_of::cpu_value_type<typename MatrixT::value_type>::type >
+eig(MatrixT const & A, lobpcg_tag const & tag)
+{
+  typedef typename viennacl::result_of::cpu_value_type<typename MatrixT::value_type>::type  NumericType;
+
+  viennacl::matrix<NumericType> eigenvectors(A.size1(), tag.num_eigenvalues(), viennacl::traits::context(A));
+  return viennacl::linalg::eig(A, eigenvectors, tag, viennacl::linalg::no_precond());
+}
+
+} // end namespace linalg
+} // end namespace viennacl
+#endif
@@ -19,7 +19,7 @@
 ============================================================================= */
 
 /** @file viennacl/linalg/lu.hpp
-    @brief Implementations of LU factorization for row-major and column-major dense matrices.
+    @brief Implementations of LU factorization (without and with partial pivoting) for row-major and column-major dense matrices.
 */
 
 #include <algorithm>    //for std::min
@@ -29,6 +29,7 @@
 
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/linalg/direct_solve.hpp"
+#include "viennacl/linalg/host_based/lu_operations.hpp"
 
 namespace viennacl
 {
@@ -188,6 +189,83 @@ void lu_factorize(matrix<NumericT, viennacl::column_major> & A)
 }
 
 
+/** @brief LU factorization with partial pivoting P A = L U of a square dense matrix (cf. LAPACK's xGETRF).
+*
+* The factorization is computed in host memory by recursive panel factorization and blocked updates of the trailing matrix.
+* Matrices in other memory domains are transferred to the host and back.
+*
+* @param A       The system matrix, where the LU matrices are directly written to. The implicit unit diagonal of L is not written.
+* @param pivots  The row interchanges: Row k was interchanged with row pivots[k] in the order k = 0, 1, ...
+*/
+template<typename NumericT>
+void lu_factorize(matrix_base<NumericT> & A, std::vector<vcl_size_t> & pivots)
+{
+  switch (viennacl::traits::handle(A).get_active_handle_id())
+  {
+    case viennacl::MAIN_MEMORY:
+      viennacl::linalg::host_based::lu_factorize(A, pivots);
+      break;
+    case viennacl::MEMORY_NOT_INITIALIZED:
+      throw memory_exception("not initialised!");
+    default:
+    {
+      viennacl::matrix_base<NumericT> A_host(A);
+      A_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+      viennacl::linalg::host_based::lu_factorize(A_host, pivots);
+      A_host.switch_memory_context(viennacl::traits::context(A));
+      A = A_host;
+    }
+  }
+}
+
+namespace detail
+{
+  /** @brief Applies the row interchanges of lu_factorize() with pivoting to the load vectors. Objects in other memory domains are permuted in host memory. */
+  template<typename NumericT>
+  void lu_permute(matrix_base<NumericT> & B, std::vector<vcl_size_t> const & pivots)
+  {
+    switch (viennacl::traits::handle(B).get_active_handle_id())
+    {
+      case viennacl::MAIN_MEMORY:
+        viennacl::linalg::host_based::lu_permute(B, pivots);
+        break;
+      case viennacl::MEMORY_NOT_INITIALIZED:
+        throw memory_exception("not initialised!");
+      default:
+      {
+        viennacl::matrix_base<NumericT> B_host(B);
+        B_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+        viennacl::linalg::host_based::lu_permute(B_host, pivots);
+        B_host.switch_memory_context(viennacl::traits::context(B));
+        B = B_host;
+      }
+    }
+  }
+
+  /** @brief Applies the row interchanges of lu_factorize() with pivoting to the load vector. Vectors in other memory domains are permuted in host memory. */
+  template<typename NumericT>
+  void lu_permute(vector_base<NumericT> & vec, std::vector<vcl_size_t> const & pivots)
+  {
+    switch (viennacl::traits::handle(vec).get_active_handle_id())
+    {
+      case viennacl::MAIN_MEMORY:
+        viennacl::linalg::host_based::lu_permute(vec, pivots);
+        break;
+      case viennacl::MEMORY_NOT_INITIALIZED:
+        throw memory_exception("not initialised!");
+      default:
+      {
+        viennacl::vector<NumericT> vec_host(vec);
+        vec_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+        viennacl::linalg::host_based::lu_permute(vec_host, pivots);
+        vec_host.switch_memory_context(viennacl::traits::context(vec));
+        vec = vec_host;
+      }
+    }
+  }
+}
+
+
 //
 // Convenience layer:
 //
@@ -221,6 +299,43 @@ void lu_substitute(matrix<NumericT, F, MatAlignmentV> const & A,
   inplace_solve(A, vec, upper_tag());
 }
 
+/** @brief LU substitution for the system P A X = P B using the factors of an LU factorization with partial pivoting.
+*
+* @param A       The LU factors as computed by lu_factorize(A, pivots)
+* @param pivots  The row interchanges as computed by lu_factorize(A, pivots)
+* @param B       The matrix of load vectors, where the solution is directly written to
+*/
+template<typename NumericT>
+void lu_substitute(matrix_base<NumericT> const & A,
+                   std::vector<vcl_size_t> const & pivots,
+                   matrix_base<NumericT> & B)
+{
+  assert(A.size1() == A.size2() && bool("Matrix must be square"));
+  assert(A.size1() == B.size1() && bool("Matrix must be square"));
+  assert(A.size1() == pivots.size() && bool("Pivot vector does not match the matrix size"));
+  detail::lu_permute(B, pivots);
+  inplace_solve(A, B, unit_lower_tag());
+  inplace_solve(A, B, upper_tag());
+}
+
+/** @brief LU substitution for the system P A x = P b using the factors of an LU factorization with partial pivoting.
+*
+* @param A       The LU factors as computed by lu_factorize(A, pivots)
+* @param pivots  The row interchanges as computed by lu_factorize(A, pivots)
+* @param vec     The load vector, where the solution is directly written to
+*/
+template<typename NumericT>
+void lu_substitute(matrix_base<NumericT> const & A,
+                   std::vector<vcl_size_t> const & pivots,
+                   vector_base<NumericT> & vec)
+{
+  assert(A.size1() == A.size2() && bool("Matrix must be square"));
+  assert(A.size1() == pivots.size() && bool("Pivot vector does not match the matrix size"));
+  detail::lu_permute(vec, pivots);
+  inplace_solve(A, vec, unit_lower_tag());
+  inplace_solve(A, vec, upper_tag());
+}
+
 }
 }
 
@@ -36,6 +36,7 @@
 #include "viennacl/traits/stride.hpp"
 #include "viennacl/vector.hpp"
 #include "viennacl/linalg/host_based/matrix_operations.hpp"
+#include "viennacl/linalg/host_based/symmetric_operations.hpp"
 
 #ifdef VIENNACL_WITH_OPENCL
   #include "viennacl/linalg/opencl/matrix_operations.hpp"
@@ -582,6 +583,22 @@ break;
     /////////////////////////   matrix-matrix products /////////////////////////////////
     //
 
+    namespace detail
+    {
+      /** @brief Returns true if A and B refer to the same entries in memory and beta is zero, so that prod(trans(A), B) and prod(A, trans(B)) are symmetric rank-k updates. */
+      template<typename NumericT, typename ScalarType>
+      bool is_symmetric_product(matrix_base<NumericT> const & A, matrix_base<NumericT> const & B, ScalarType beta)
+      {
+        return !(beta > 0 || beta < 0)
+               && viennacl::traits::handle(A) == viennacl::traits::handle(B)
+               && viennacl::traits::start1(A)  == viennacl::traits::start1(B)  && viennacl::traits::start2(A)  == viennacl::traits::start2(B)
+               && viennacl::traits::stride1(A) == viennacl::traits::stride1(B) && viennacl::traits::stride2(A) == viennacl::traits::stride2(B)
+               && viennacl::traits::size1(A)   == viennacl::traits::size1(B)   && viennacl::traits::size2(A)   == viennacl::traits::size2(B)
+               && A.row_major() == B.row_major();
+      }
+    }
+
+
     /** @brief Carries out matrix-matrix multiplication
     *
     * Implementation of C = prod(A, B);
@@ -649,7 +666,10 @@ break;
       switch (viennacl::traits::handle(A.lhs()).get_active_handle_id())
       {
         case viennacl::MAIN_MEMORY:
-          viennacl::linalg::host_based::prod_impl(A.lhs(), true, B, false, C, alpha, beta);
+          if (detail::is_symmetric_product(A.lhs(), B, beta))
+            viennacl::linalg::host_based::syrk(B, true, C, alpha, beta, false, true);
+          else
+            viennacl::linalg::host_based::prod_impl(A.lhs(), true, B, false, C, alpha, beta);
           break;
 #ifdef VIENNACL_WITH_OPENCL
         case viennacl::OPENCL_MEMORY:
@@ -695,7 +715,10 @@ break;
       switch (viennacl::traits::handle(A).get_active_handle_id())
       {
         case viennacl::MAIN_MEMORY:
-          viennacl::linalg::host_based::prod_impl(A, false, B.lhs(), true, C, alpha, beta);
+          if (detail::is_symmetric_product(A, B.lhs(), beta))
+            viennacl::linalg::host_based::syrk(A, false, C, alpha, beta, false, true);
+          else
+            viennacl::linalg::host_based::prod_impl(A, false, B.lhs(), true, C, alpha, beta);
           break;
 #ifdef VIENNACL_WITH_OPENCL
         case viennacl::OPENCL_MEMORY:
@@ -765,6 +788,280 @@ break;
     }
 
 
+    ///////////////////////// symmetric operations /////////////
+
+    namespace detail
+    {
+      /** @brief Computes one triangle of a symmetric rank-k or rank-2k update in host memory. Used for memory domains without a dedicated kernel. */
+      template<typename NumericT, typename ScalarT1, typename ScalarT2>
+      void syr2k_host(matrix_base<NumericT> const & A, matrix_base<NumericT> const & B, bool two_sided, bool trans,
+                      matrix_base<NumericT> & C, ScalarT1 alpha, ScalarT2 beta, bool upper)
+      {
+        viennacl::matrix_base<NumericT> A_host(A);
+        viennacl::matrix_base<NumericT> B_host(B);
+        viennacl::matrix_base<NumericT> C_host(C);
+        A_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+        B_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+        C_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+        if (two_sided)
+          viennacl::linalg::host_based::syr2k(A_host, B_host, trans, C_host, alpha, beta, upper, false);
+        else
+          viennacl::linalg::host_based::syrk(A_host, trans, C_host, alpha, beta, upper, false);
+        C_host.switch_memory_context(viennacl::traits::context(C));
+        C = C_host;
+      }
+    }
+
+    /** @brief Symmetric rank-k update C = alpha * op(A) op(A)^T + beta * C, where op(A) is A or A^T.
+    *
+    * The full symmetric result is computed. The host implementation computes the lower triangle only and mirrors it. Other backends use the matrix-matrix product.
+    *
+    * @param A        The matrix A
+    * @param trans_A  If true, C = alpha * A^T A + beta * C is computed
+    * @param C        The symmetric result matrix. Must be symmetric if beta is nonzero.
+    * @param alpha    Scaling factor of the product
+    * @param beta     Scaling factor of C
+    */
+    template<typename NumericT, typename ScalarT1, typename ScalarT2>
+    void syrk(matrix_base<NumericT> const & A, bool trans_A,
+              matrix_base<NumericT> & C,
+              ScalarT1 alpha, ScalarT2 beta)
+    {
+      assert(viennacl::traits::size1(C) == viennacl::traits::size2(C) && bool("Size check failed at syrk(): C is not square"));
+      assert(viennacl::traits::size1(C) == (trans_A ? viennacl::traits::size2(A) : viennacl::traits::size1(A)) && bool("Size check failed at syrk(): size mismatch of A and C"));
+
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::syrk(A, trans_A, C, alpha, beta, false, true);
+          break;
+#ifdef VIENNACL_WITH_OPENCL
+        case viennacl::OPENCL_MEMORY:
+          viennacl::linalg::opencl::prod_impl(A, trans_A, A, !trans_A, C, alpha, beta);
+          break;
+#endif
+#ifdef VIENNACL_WITH_HSA
+        case viennacl::HSA_MEMORY:
+          viennacl::linalg::hsa::prod_impl(A, trans_A, A, !trans_A, C, alpha, beta);
+          break;
+#endif
+#ifdef VIENNACL_WITH_CUDA
+        case viennacl::CUDA_MEMORY:
+          viennacl::linalg::cuda::prod_impl(A, trans_A, A, !trans_A, C, alpha, beta);
+          break;
+#endif
+        case viennacl::MEMORY_NOT_INITIALIZED:
+          throw memory_exception("not initialised!");
+        default:
+          throw memory_exception("not implemented");
+      }
+    }
+
+    /** @brief Symmetric rank-k update C = op(A) op(A)^T, where op(A) is A (trans_A = false) or A^T (trans_A = true). */
+    template<typename NumericT>
+    void syrk(matrix_base<NumericT> const & A, bool trans_A, matrix_base<NumericT> & C)
+    {
+      syrk(A, trans_A, C, NumericT(1), NumericT(0));
+    }
+
+    namespace detail
+    {
+      template<typename NumericT, typename ScalarT1, typename ScalarT2>
+      void syrk_triangular(matrix_base<NumericT> const & A, bool trans_A,
+                           matrix_base<NumericT> & C,
+                           ScalarT1 alpha, ScalarT2 beta, bool upper)
+      {
+        assert(viennacl::traits::size1(C) == viennacl::traits::size2(C) && bool("Size check failed at syrk(): C is not square"));
+        assert(viennacl::traits::size1(C) == (trans_A ? viennacl::traits::size2(A) : viennacl::traits::size1(A)) && bool("Size check failed at syrk(): size mismatch of A and C"));
+
+        switch (viennacl::traits::handle(A).get_active_handle_id())
+        {
+          case viennacl::MAIN_MEMORY:
+            viennacl::linalg::host_based::syrk(A, trans_A, C, alpha, beta, upper, false);
+            break;
+          case viennacl::MEMORY_NOT_INITIALIZED:
+            throw memory_exception("not initialised!");
+          default:
+            detail::syr2k_host(A, A, false, trans_A, C, alpha, beta, upper);
+        }
+      }
+    }
+
+    /** @brief Symmetric rank-k update C = alpha * op(A) op(A)^T + beta * C on the lower triangle of C only. The strict upper triangle is not referenced.
+    *
+    * Memory domains other than main memory are processed in host memory.
+    */
+    template<typename NumericT, typename ScalarT1, typename ScalarT2>
+    void syrk(matrix_base<NumericT> const & A, bool trans_A, matrix_base<NumericT> & C, ScalarT1 alpha, ScalarT2 beta, viennacl::linalg::lower_tag)
+    {
+      detail::syrk_triangular(A, trans_A, C, alpha, beta, false);
+    }
+
+    /** @brief Symmetric rank-k update C = alpha * op(A) op(A)^T + beta * C on the upper triangle of C only. The strict lower triangle is not referenced.
+    *
+    * Memory domains other than main memory are processed in host memory.
+    */
+    template<typename NumericT, typename ScalarT1, typename ScalarT2>
+    void syrk(matrix_base<NumericT> const & A, bool trans_A, matrix_base<NumericT> & C, ScalarT1 alpha, ScalarT2 beta, viennacl::linalg::upper_tag)
+    {
+      detail::syrk_triangular(A, trans_A, C, alpha, beta, true);
+    }
+
+    /** @brief Symmetric rank-2k update C = alpha * (op(A) op(B)^T + op(B) op(A)^T) + beta * C, where op() is the identity or the transposition.
+    *
+    * The full symmetric result is computed. The host implementation computes the lower triangle only and mirrors it. Other backends use the matrix-matrix product.
+    *
+    * @param A        The matrix A
+    * @param B        The matrix B of the same size as A
+    * @param trans    If true, C = alpha * (A^T B + B^T A) + beta * C is computed
+    * @param C        The symmetric result matrix. Must be symmetric if beta is nonzero.
+    * @param alpha    Scaling factor of the product
+    * @param beta     Scaling factor of C
+    */
+    template<typename NumericT, typename ScalarT1, typename ScalarT2>
+    void syr2k(matrix_base<NumericT> const & A, matrix_base<NumericT> const & B, bool trans,
+               matrix_base<NumericT> & C,
+               ScalarT1 alpha, ScalarT2 beta)
+    {
+      assert(viennacl::traits::size1(A) == viennacl::traits::size1(B) && viennacl::traits::size2(A) == viennacl::traits::size2(B) && bool("Size check failed at syr2k(): size mismatch of A and B"));
+      assert(viennacl::traits::size1(C) == viennacl::traits::size2(C) && bool("Size check failed at syr2k(): C is not square"));
+      assert(viennacl::traits::size1(C) == (trans ? viennacl::traits::size2(A) : viennacl::traits::size1(A)) && bool("Size check failed at syr2k(): size mismatch of A and C"));
+
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::syr2k(A, B, trans, C, alpha, beta, false, true);
+          break;
+#ifdef VIENNACL_WITH_OPENCL
+        case viennacl::OPENCL_MEMORY:
+          viennacl::linalg::opencl::prod_impl(A, trans, B, !trans, C, alpha, beta);
+          viennacl::linalg::opencl::prod_impl(B, trans, A, !trans, C, alpha, NumericT(1));
+          break;
+#endif
+#ifdef VIENNACL_WITH_HSA
+        case viennacl::HSA_MEMORY:
+          viennacl::linalg::hsa::prod_impl(A, trans, B, !trans, C, alpha, beta);
+          viennacl::linalg::hsa::prod_impl(B, trans, A, !trans, C, alpha, NumericT(1));
+          break;
+#endif
+#ifdef VIENNACL_WITH_CUDA
+        case viennacl::CUDA_MEMORY:
+          viennacl::linalg::cuda::prod_impl(A, trans, B, !trans, C, alpha, beta);
+          viennacl::linalg::cuda::prod_impl(B, trans, A, !trans, C, alpha, NumericT(1));
+          break;
+#endif
+        case viennacl::MEMORY_NOT_INITIALIZED:
+          throw memory_exception("not initialised!");
+        default:
+          throw memory_exception("not implemented");
+      }
+    }
+
+    namespace detail
+    {
+      template<typename NumericT, typename ScalarT1, typename ScalarT2>
+      void syr2k_triangular(matrix_base<NumericT> const & A, matrix_base<NumericT> const & B, bool trans,
+                            matrix_base<NumericT> & C,
+                            ScalarT1 alpha, ScalarT2 beta, bool upper)
+      {
+        assert(viennacl::traits::size1(A) == viennacl::traits::size1(B) && viennacl::traits::size2(A) == viennacl::traits::size2(B) && bool("Size check failed at syr2k(): size mismatch of A and B"));
+        assert(viennacl::traits::size1(C) == viennacl::traits::size2(C) && bool("Size check failed at syr2k(): C is not square"));
+
+        switch (viennacl::traits::handle(A).get_active_handle_id())
+        {
+          case viennacl::MAIN_MEMORY:
+            viennacl::linalg::host_based::syr2k(A, B, trans, C, alpha, beta, upper, false);
+            break;
+          case viennacl::MEMORY_NOT_INITIALIZED:
+            throw memory_exception("not initialised!");
+          default:
+            detail::syr2k_host(A, B, true, trans, C, alpha, beta, upper);
+        }
+      }
+    }
+
+    /** @brief Symmetric rank-2k update C = alpha * (op(A) op(B)^T + op(B) op(A)^T) + beta * C on the lower triangle of C only. The strict upper triangle is not referenced. */
+    template<typename NumericT, typename ScalarT1, typename ScalarT2>
+    void syr2k(matrix_base<NumericT> const & A, matrix_base<NumericT> const & B, bool trans, matrix_base<NumericT> & C, ScalarT1 alpha, ScalarT2 beta, viennacl::linalg::lower_tag)
+    {
+      detail::syr2k_triangular(A, B, trans, C, alpha, beta, false);
+    }
+
+    /** @brief Symmetric rank-2k update C = alpha * (op(A) op(B)^T + op(B) op(A)^T) + beta * C on the upper triangle of C only. The strict lower triangle is not referenced. */
+    template<typename NumericT, typename ScalarT1, typename ScalarT2>
+    void syr2k(matrix_base<NumericT> const & A, matrix_base<NumericT> const & B, bool trans, matrix_base<NumericT> & C, ScalarT1 alpha, ScalarT2 beta, viennacl::linalg::upper_tag)
+    {
+      detail::syr2k_triangular(A, B, trans, C, alpha, beta, true);
+    }
+
+    namespace detail
+    {
+      template<typename NumericT, typename ScalarT1, typename ScalarT2>
+      void symv(matrix_base<NumericT> const & A,
+                vector_base<NumericT> const & x,
+                vector_base<NumericT> & y,
+                ScalarT1 alpha, ScalarT2 beta, bool upper)
+      {
+        assert(viennacl::traits::size1(A) == viennacl::traits::size2(A) && bool("Size check failed at symv(): A is not square"));
+        assert(viennacl::traits::size2(A) == viennacl::traits::size(x) && bool("Size check failed at symv(): size2(A) != size(x)"));
+        assert(viennacl::traits::size1(A) == viennacl::traits::size(y) && bool("Size check failed at symv(): size1(A) != size(y)"));
+
+        switch (viennacl::traits::handle(A).get_active_handle_id())
+        {
+          case viennacl::MAIN_MEMORY:
+            viennacl::linalg::host_based::symv(A, x, y, alpha, beta, upper);
+            break;
+          case viennacl::MEMORY_NOT_INITIALIZED:
+            throw memory_exception("not initialised!");
+          default:
+          {
+            viennacl::matrix_base<NumericT> A_host(A);
+            viennacl::vector<NumericT> x_host(x);
+            viennacl::vector<NumericT> y_host(y);
+            A_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+            x_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+            y_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+            viennacl::linalg::host_based::symv(A_host, x_host, y_host, alpha, beta, upper);
+            y_host.switch_memory_context(viennacl::traits::context(y));
+            y = y_host;
+          }
+        }
+      }
+    }
+
+    /** @brief Symmetric matrix-vector product y = alpha * A x + beta * y, where only the lower triangle of A is referenced.
+    *
+    * Memory domains other than main memory are processed in host memory.
+    *
+    * @param A      The symmetric matrix
+    * @param x      The vector x
+    * @param y      The result vector
+    * @param alpha  Scaling factor of the product
+    * @param beta   Scaling factor of y
+    */
+    template<typename NumericT, typename ScalarT1, typename ScalarT2>
+    void symv(matrix_base<NumericT> const & A, vector_base<NumericT> const & x, vector_base<NumericT> & y, ScalarT1 alpha, ScalarT2 beta, viennacl::linalg::lower_tag)
+    {
+      detail::symv(A, x, y, alpha, beta, false);
+    }
+
+    /** @brief Symmetric matrix-vector product y = alpha * A x + beta * y, where only the upper triangle of A is referenced. */
+    template<typename NumericT, typename ScalarT1, typename ScalarT2>
+    void symv(matrix_base<NumericT> const & A, vector_base<NumericT> const & x, vector_base<NumericT> & y, ScalarT1 alpha, ScalarT2 beta, viennacl::linalg::upper_tag)
+    {
+      detail::symv(A, x, y, alpha, beta, true);
+    }
+
+    /** @brief Symmetric matrix-vector product y = A x, where only the lower triangle of A is referenced. */
+    template<typename NumericT>
+    void symv(matrix_base<NumericT> const & A,
+              vector_base<NumericT> const & x,
+              vector_base<NumericT> & y)
+    {
+      symv(A, x, y, NumericT(1), NumericT(0), viennacl::linalg::lower_tag());
+    }
+
+
     ///////////////////////// summation operations /////////////
 
     template<typename NumericT>
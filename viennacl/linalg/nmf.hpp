@@ -26,6 +26,7 @@
 
 #include "viennacl/vector.hpp"
 #include "viennacl/matrix.hpp"
+#include "viennacl/compressed_matrix.hpp"
 #include "viennacl/linalg/prod.hpp"
 #include "viennacl/linalg/norm_2.hpp"
 #include "viennacl/linalg/norm_frobenius.hpp"
@@ -49,7 +50,37 @@ namespace viennacl
   namespace linalg
   {
 
-    /** @brief The nonnegative matrix factorization (approximation) algorithm as suggested by Lee and Seung. Factorizes a matrix V with nonnegative entries into matrices W and H such that ||V - W*H|| is minimized.
+    namespace detail
+    {
+      /** @brief Runs the nonnegative matrix factorization in host memory and copies the factors back to their original memory context.
+       *
+       *  Used for the update schemes which are only available in host memory as well as for sparse input matrices.
+       */
+      template<typename MatrixT, typename ScalarType>
+      void nmf_on_host(MatrixT const & V, viennacl::matrix_base<ScalarType> & W,
+                       viennacl::matrix_base<ScalarType> & H, viennacl::linalg::nmf_config const & conf)
+      {
+        viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+
+        MatrixT V_host(V);
+        V_host.switch_memory_context(host_ctx);
+        viennacl::matrix_base<ScalarType> W_host(W);
+        W_host.switch_memory_context(host_ctx);
+        viennacl::matrix_base<ScalarType> H_host(H);
+        H_host.switch_memory_context(host_ctx);
+
+        viennacl::linalg::host_based::nmf(V_host, W_host, H_host, conf);
+
+        W_host.switch_memory_context(viennacl::traits::context(W));
+        W = W_host;
+        H_host.switch_memory_context(viennacl::traits::context(H));
+        H = H_host;
+      }
+    }
+
+    /** @brief The nonnegative matrix factorization (approximation) algorithm. Factorizes a matrix V with nonnegative entries into matrices W and H such that ||V - W*H|| is minimized.
+     *
+     * Multiplicative updates as suggested by Lee and Seung are run on all compute backends, the HALS and ANLS schemes (see nmf_config::solver()) are run in host memory.
      *
      * @param V     Input matrix
      * @param W     First factor
@@ -63,6 +94,14 @@ namespace viennacl
       assert(V.size1() == W.size1() && V.size2() == H.size2() && bool("Dimensions of W and H don't allow for V = W * H"));
       assert(W.size2() == H.size1() && bool("Dimensions of W and H don't match, prod(W, H) impossible"));
 
+      if (conf.solver() != viennacl::linalg::nmf_config::multiplicative_update
+          && viennacl::traits::handle(V).get_active_handle_id() != viennacl::MAIN_MEMORY
+          && viennacl::traits::handle(V).get_active_handle_id() != viennacl::MEMORY_NOT_INITIALIZED)
+      {
+        detail::nmf_on_host(V, W, H, conf);
+        return;
+      }
+
       switch (viennacl::traits::handle(V).get_active_handle_id())
       {
         case viennacl::MAIN_MEMORY:
@@ -93,6 +132,32 @@ break;
       }
 
     }
+
+    /** @brief The nonnegative matrix factorization (approximation) algorithm for a sparse matrix V. Computed in host memory.
+     *
+     * @param V     Input matrix
+     * @param W     First factor
+     * @param H     Second factor
+     * @param conf  A configuration object holding tolerances and the like
+     */
+    template<typename ScalarType>
+    void nmf(viennacl::compressed_matrix<ScalarType> const & V, viennacl::matrix_base<ScalarType> & W,
+        viennacl::matrix_base<ScalarType> & H, viennacl::linalg::nmf_config const & conf)
+    {
+      assert(V.size1() == W.size1() && V.size2() == H.size2() && bool("Dimensions of W and H don't allow for V = W * H"));
+      assert(W.size2() == H.size1() && bool("Dimensions of W and H don't match, prod(W, H) impossible"));
+
+      switch (viennacl::traits::handle(V).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::nmf(V, W, H, conf);
+          break;
+        case viennacl::MEMORY_NOT_INITIALIZED:
+          throw memory_exception("not initialised!");
+        default:
+          detail::nmf_on_host(V, W, H, conf);
+      }
+    }
   }
 }
 
@@ -0,0 +1,386 @@
+#ifndef VIENNACL_LINALG_POLYNOMIAL_PRECOND_HPP_
+#define VIENNACL_LINALG_POLYNOMIAL_PRECOND_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/polynomial_precond.hpp
+    @brief Implementations of polynomial preconditioners (Chebyshev, least-squares, truncated Neumann series).
+
+    All preconditioners approximate A^{-1} r by p(A) r for a polynomial p of fixed degree.
+    Each application of the preconditioner only requires sparse matrix-vector products and vector updates,
+    which are fused into a single pass per degree for data in main memory (see polynomial_precond_step()).
+*/
+
+#include <vector>
+#include <cmath>
+#include "viennacl/forwards.h"
+#include "viennacl/vector.hpp"
+#include "viennacl/tools/tools.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/iterative_operations.hpp"
+
+namespace viennacl
+{
+namespace linalg
+{
+
+/** @brief The polynomial families supported by polynomial_precond */
+enum polynomial_precond_type
+{
+  chebyshev_polynomial = 0,      ///< Chebyshev polynomial p minimizing max |1 - lambda p(lambda)| on [lambda_min, lambda_max]
+  least_squares_polynomial,      ///< Polynomial p minimizing the Chebyshev-weighted L2-norm of 1 - lambda p(lambda) on [lambda_min, lambda_max]
+  neumann_polynomial             ///< Truncated Neumann series omega * sum_j (I - omega A)^j with omega = 1 / lambda_max
+};
+
+/** @brief A tag for polynomial preconditioners
+*/
+class polynomial_tag
+{
+public:
+  /** @brief Constructor allowing to set the polynomial type, the degree, and optionally the spectral interval.
+    *
+    * @param type         The polynomial family
+    * @param deg          Degree of the polynomial, i.e. number of sparse matrix-vector products per preconditioner application
+    * @param lambda_min   Lower bound for the spectrum of the system matrix. Ignored for the Neumann series. Estimated if zero (Chebyshev only).
+    * @param lambda_max   Upper bound for the spectrum of the system matrix. Estimated by a few power iterations if zero.
+    */
+  polynomial_tag(polynomial_precond_type type = chebyshev_polynomial, vcl_size_t deg = 4, double lambda_min = 0, double lambda_max = 0)
+    : type_(type), degree_(deg), lambda_min_(lambda_min), lambda_max_(lambda_max), eigenvalue_ratio_(30.0), power_iters_(20) {}
+
+  /** @brief Returns the polynomial family */
+  polynomial_precond_type type() const { return type_; }
+  /** @brief Sets the polynomial family */
+  void type(polynomial_precond_type t) { type_ = t; }
+
+  /** @brief Returns the degree of the polynomial */
+  vcl_size_t degree() const { return degree_; }
+  /** @brief Sets the degree of the polynomial */
+  void degree(vcl_size_t deg) { degree_ = deg; }
+
+  /** @brief Returns the lower bound of the spectral interval. Zero means that the lower bound is determined automatically. */
+  double lambda_min() const { return lambda_min_; }
+  /** @brief Sets the lower bound of the spectral interval */
+  void lambda_min(double val) { if (val >= 0) lambda_min_ = val; }
+
+  /** @brief Returns the upper bound of the spectral interval. Zero means that the upper bound is estimated by power iterations. */
+  double lambda_max() const { return lambda_max_; }
+  /** @brief Sets the upper bound of the spectral interval */
+  void lambda_max(double val) { if (val >= 0) lambda_max_ = val; }
+
+  /** @brief Returns the ratio lambda_max / lambda_min used for the Chebyshev polynomial if no lower bound is provided. */
+  double eigenvalue_ratio() const { return eigenvalue_ratio_; }
+  /** @brief Sets the ratio lambda_max / lambda_min used for the Chebyshev polynomial if no lower bound is provided. */
+  void eigenvalue_ratio(double val) { if (val > 1) eigenvalue_ratio_ = val; }
+
+  /** @brief Returns the number of power iterations used for estimating lambda_max */
+  vcl_size_t power_iterations() const { return power_iters_; }
+  /** @brief Sets the number of power iterations used for estimating lambda_max */
+  void power_iterations(vcl_size_t num) { if (num > 0) power_iters_ = num; }
+
+private:
+  polynomial_precond_type type_;
+  vcl_size_t degree_;
+  double lambda_min_;
+  double lambda_max_;
+  double eigenvalue_ratio_;
+  vcl_size_t power_iters_;
+};
+
+
+namespace detail
+{
+  /** @brief Estimates the largest eigenvalue (in modulus) of a sparse matrix by power iterations. A safety margin of ten percent is added. */
+  template<typename MatrixT, typename NumericT>
+  double polynomial_estimate_lambda_max(MatrixT const & A, viennacl::vector<NumericT> & v, viennacl::vector<NumericT> & Av, vcl_size_t num_iters)
+  {
+    std::vector<NumericT> host_v(v.size());
+    for (vcl_size_t i=0; i<host_v.size(); ++i)
+      host_v[i] = NumericT(1) + NumericT(i % 7) / NumericT(7);   // avoid being orthogonal to the dominant eigenvector for typical matrices
+    viennacl::copy(host_v, v);
+
+    double lambda = 0;
+    NumericT norm_v = viennacl::linalg::norm_2(v);
+    v /= norm_v;
+    for (vcl_size_t k=0; k<num_iters; ++k)
+    {
+      viennacl::linalg::prod_impl(A, v, Av);
+      NumericT norm_Av = viennacl::linalg::norm_2(Av);
+      if (norm_Av <= 0)
+        break;
+      lambda = static_cast<double>(norm_Av);
+      v = Av / norm_Av;
+    }
+
+    return 1.1 * lambda;
+  }
+
+  /** @brief Computes the coefficients c_j of the least-squares polynomial p(lambda) = sum_j c_j T_j(t(lambda)) in the Chebyshev basis of [lambda_min, lambda_max].
+    *
+    * Minimizes the integral of (1 - lambda p(lambda))^2 with Chebyshev weight over the interval.
+    * The integrals are evaluated exactly by Chebyshev-Gauss quadrature, the resulting small normal equations are solved by Gaussian elimination.
+    */
+  inline std::vector<double> polynomial_least_squares_coefficients(vcl_size_t degree, double lambda_min, double lambda_max)
+  {
+    vcl_size_t n = degree + 1;
+    vcl_size_t num_nodes = 2 * (degree + 2);
+    double theta = (lambda_max + lambda_min) / 2.0;
+    double delta = (lambda_max - lambda_min) / 2.0;
+    double pi = 3.1415926535897932384626433832795;
+
+    std::vector<double> G(n * n, 0);
+    std::vector<double> h(n, 0);
+    std::vector<double> T(n);
+    for (vcl_size_t i=0; i<num_nodes; ++i)
+    {
+      double t = std::cos(pi * (2.0 * double(i) + 1.0) / (2.0 * double(num_nodes)));
+      double lambda = theta + delta * t;
+
+      T[0] = 1;
+      if (n > 1)
+        T[1] = t;
+      for (vcl_size_t j=2; j<n; ++j)
+        T[j] = 2.0 * t * T[j-1] - T[j-2];
+
+      for (vcl_size_t j=0; j<n; ++j)
+      {
+        h[j] += lambda * T[j];
+        for (vcl_size_t l=0; l<n; ++l)
+          G[j*n + l] += lambda * lambda * T[j] * T[l];
+      }
+    }
+
+    // Gaussian elimination with partial pivoting:
+    for (vcl_size_t k=0; k<n; ++k)
+    {
+      vcl_size_t pivot = k;
+      for (vcl_size_t i=k+1; i<n; ++i)
+        if (std::fabs(G[i*n + k]) > std::fabs(G[pivot*n + k]))
+          pivot = i;
+      if (pivot != k)
+      {
+        for (vcl_size_t j=0; j<n; ++j)
+          std::swap(G[k*n + j], G[pivot*n + j]);
+        std::swap(h[k], h[pivot]);
+      }
+
+      for (vcl_size_t i=k+1; i<n; ++i)
+      {
+        double factor = G[i*n + k] / G[k*n + k];
+        for (vcl_size_t j=k; j<n; ++j)
+          G[i*n + j] -= factor * G[k*n + j];
+        h[i] -= factor * h[k];
+      }
+    }
+    for (vcl_size_t k=n; k-- > 0;)
+    {
+      for (vcl_size_t j=k+1; j<n; ++j)
+        h[k] -= G[k*n + j] * h[j];
+      h[k] /= G[k*n + k];
+    }
+
+    return h;
+  }
+}
+
+
+/** @brief Polynomial preconditioner class for ViennaCL sparse matrix types, can be supplied to solve()-routines.
+*
+*  Approximates A^{-1} r by p(A) r, where p is a Chebyshev polynomial, a least-squares polynomial, or a truncated Neumann series.
+*  All polynomials are evaluated by three-term recurrences, where each step is a single call to polynomial_precond_step().
+*  The system matrix is referenced, so it must remain valid as long as the preconditioner is used.
+*/
+template<typename MatrixT>
+class polynomial_precond
+{
+  typedef typename viennacl::result_of::cpu_value_type<typename MatrixT::value_type>::type  NumericType;
+  typedef viennacl::vector<NumericType>                                                     VectorType;
+
+public:
+  polynomial_precond(MatrixT const & mat, polynomial_tag const & tag)
+    : A_(&mat), tag_(tag),
+      r_(mat.size1(), viennacl::traits::context(mat)),
+      t0_(mat.size1(), viennacl::traits::context(mat)),
+      t1_(mat.size1(), viennacl::traits::context(mat)),
+      t2_(mat.size1(), viennacl::traits::context(mat)),
+      lambda_min_(0), lambda_max_(0)
+  {
+    init(mat);
+  }
+
+  /** @brief (Re-)initializes the preconditioner for the provided matrix, e.g. after its entries have changed. */
+  void init(MatrixT const & mat)
+  {
+    A_ = &mat;
+
+    lambda_max_ = tag_.lambda_max();
+    if (lambda_max_ <= 0)
+      lambda_max_ = detail::polynomial_estimate_lambda_max(mat, t0_, t1_, tag_.power_iterations());
+    if (lambda_max_ <= 0)
+      lambda_max_ = 1.0;  // zero matrix: fall back to identity scaling
+
+    lambda_min_ = tag_.lambda_min();
+    if (tag_.type() == chebyshev_polynomial && (lambda_min_ <= 0 || lambda_min_ >= lambda_max_))
+      lambda_min_ = lambda_max_ / tag_.eigenvalue_ratio();
+    if (tag_.type() == least_squares_polynomial)
+    {
+      if (lambda_min_ >= lambda_max_)
+        lambda_min_ = 0;
+      ls_coefficients_ = detail::polynomial_least_squares_coefficients(tag_.degree(), lambda_min_, lambda_max_);
+    }
+  }
+
+  /** @brief Returns the lower bound of the spectral interval used for the polynomial */
+  double lambda_min() const { return lambda_min_; }
+  /** @brief Returns the upper bound of the spectral interval used for the polynomial */
+  double lambda_max() const { return lambda_max_; }
+
+  /** @brief Applies the preconditioner to the vector 'vec', i.e. computes vec = p(A) vec */
+  template<unsigned int AlignmentV>
+  void apply(viennacl::vector<NumericType, AlignmentV> & vec) const
+  {
+    assert(viennacl::traits::size(r_) == viennacl::traits::size(vec) && bool("Size mismatch"));
+    r_ = vec;
+
+    switch (tag_.type())
+    {
+    case neumann_polynomial:      apply_neumann(vec);       break;
+    case least_squares_polynomial: apply_least_squares(vec); break;
+    default:                      apply_chebyshev(vec);     break;
+    }
+  }
+
+private:
+  /** @brief Returns the buffer which is neither 'a' nor 'b' */
+  VectorType & free_buffer(VectorType const * a, VectorType const * b) const
+  {
+    if (a != &t0_ && b != &t0_) return t0_;
+    if (a != &t1_ && b != &t1_) return t1_;
+    return t2_;
+  }
+
+  /** @brief z_0 = omega r,  z_{k+1} = z_k - omega A z_k + omega r */
+  template<unsigned int AlignmentV>
+  void apply_neumann(viennacl::vector<NumericType, AlignmentV> & vec) const
+  {
+    NumericType omega = NumericType(1.0 / lambda_max_);
+    vcl_size_t degree = tag_.degree();
+
+    if (degree == 0)
+    {
+      vec = omega * r_;
+      return;
+    }
+
+    VectorType * z_old = &t0_;
+    *z_old = omega * r_;
+    for (vcl_size_t k=1; k<=degree; ++k)
+    {
+      VectorType & z_new = free_buffer(z_old, z_old);
+      if (k == degree)
+        viennacl::linalg::polynomial_precond_step(*A_, *z_old, *z_old, r_, vec, vec, -omega, NumericType(1), NumericType(0), omega, NumericType(0));
+      else
+        viennacl::linalg::polynomial_precond_step(*A_, *z_old, *z_old, r_, z_new, z_new, -omega, NumericType(1), NumericType(0), omega, NumericType(0));
+      z_old = &z_new;
+    }
+  }
+
+  /** @brief Chebyshev iteration for A z = r with initial guess zero, cf. Y. Saad, Iterative Methods for Sparse Linear Systems, Alg. 12.1 */
+  template<unsigned int AlignmentV>
+  void apply_chebyshev(viennacl::vector<NumericType, AlignmentV> & vec) const
+  {
+    double theta  = (lambda_max_ + lambda_min_) / 2.0;
+    double delta  = (lambda_max_ - lambda_min_) / 2.0;
+    double sigma1 = theta / delta;
+    double rho_old = 1.0 / sigma1;
+    vcl_size_t degree = tag_.degree();
+
+    if (degree == 0)
+    {
+      vec = NumericType(1.0 / theta) * r_;
+      return;
+    }
+
+    VectorType * z_prev = &t0_;  // z_0 = 0 is not stored, but accounted for by c = 0 in the first step
+    VectorType * z_curr = &t0_;
+    *z_curr = NumericType(1.0 / theta) * r_;
+    for (vcl_size_t k=1; k<=degree; ++k)
+    {
+      double rho = 1.0 / (2.0 * sigma1 - rho_old);
+      NumericType a = NumericType(-2.0 * rho / delta);
+      NumericType b = NumericType(1.0 + rho * rho_old);
+      NumericType c = (k == 1) ? NumericType(0) : NumericType(-rho * rho_old);
+      NumericType d = NumericType(2.0 * rho / delta);
+
+      VectorType & z_next = free_buffer(z_prev, z_curr);
+      if (k == degree)
+        viennacl::linalg::polynomial_precond_step(*A_, *z_curr, *z_prev, r_, vec, vec, a, b, c, d, NumericType(0));
+      else
+        viennacl::linalg::polynomial_precond_step(*A_, *z_curr, *z_prev, r_, z_next, z_next, a, b, c, d, NumericType(0));
+
+      z_prev = z_curr;
+      z_curr = &z_next;
+      rho_old = rho;
+    }
+  }
+
+  /** @brief Evaluates z = sum_j c_j T_j(t(A)) r with T_{j+1} = 2 t(A) T_j - T_{j-1} and t(A) = (A - theta I) / delta */
+  template<unsigned int AlignmentV>
+  void apply_least_squares(viennacl::vector<NumericType, AlignmentV> & vec) const
+  {
+    double theta = (lambda_max_ + lambda_min_) / 2.0;
+    double delta = (lambda_max_ - lambda_min_) / 2.0;
+    vcl_size_t degree = tag_.degree();
+
+    vec = NumericType(ls_coefficients_[0]) * r_;
+    if (degree == 0)
+      return;
+
+    // T_1 = t(A) r:
+    viennacl::linalg::polynomial_precond_step(*A_, r_, r_, r_, t0_, vec,
+                                              NumericType(1.0 / delta), NumericType(-theta / delta), NumericType(0), NumericType(0),
+                                              NumericType(ls_coefficients_[1]));
+
+    VectorType const * T_prev = &r_;
+    VectorType       * T_curr = &t0_;
+    for (vcl_size_t j=1; j<degree; ++j)
+    {
+      VectorType & T_next = free_buffer(T_prev, T_curr);
+      viennacl::linalg::polynomial_precond_step(*A_, *T_curr, *T_prev, r_, T_next, vec,
+                                                NumericType(2.0 / delta), NumericType(-2.0 * theta / delta), NumericType(-1), NumericType(0),
+                                                NumericType(ls_coefficients_[j+1]));
+      T_prev = T_curr;
+      T_curr = &T_next;
+    }
+  }
+
+  MatrixT const * A_;
+  polynomial_tag tag_;
+  mutable VectorType r_;
+  mutable VectorType t0_;
+  mutable VectorType t1_;
+  mutable VectorType t2_;
+  double lambda_min_;
+  double lambda_max_;
+  std::vector<double> ls_coefficients_;
+};
+
+}
+}
+
+#endif
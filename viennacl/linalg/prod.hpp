@@ -334,6 +334,22 @@ namespace viennacl
     }
 
 
+    /** @brief Product of a dense structured matrix (circulant, Hankel, Toeplitz, Vandermonde) with all columns of a dense matrix */
+    template< typename StructuredMatrixType, typename SCALARTYPE>
+    typename viennacl::enable_if< viennacl::is_any_dense_structured_matrix<StructuredMatrixType>::value,
+                                  viennacl::matrix_expression<const StructuredMatrixType,
+                                                              const matrix_base <SCALARTYPE>,
+                                                              op_prod >
+                                 >::type
+    prod(const StructuredMatrixType & A,
+         const viennacl::matrix_base<SCALARTYPE> & B)
+    {
+      return viennacl::matrix_expression<const StructuredMatrixType,
+                                         const viennacl::matrix_base<SCALARTYPE>,
+                                         op_prod >(A, B);
+    }
+
+
     /** @brief Sparse matrix-matrix product with compressed_matrix objects */
     template<typename NumericT>
     viennacl::matrix_expression<const compressed_matrix<NumericT>,
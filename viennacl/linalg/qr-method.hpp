@@ -24,6 +24,7 @@
 #include "viennacl/linalg/qr-method-common.hpp"
 #include "viennacl/linalg/tql2.hpp"
 #include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/host_based/eigen_operations.hpp"
 
 #include <boost/numeric/ublas/vector.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
@@ -724,6 +725,52 @@ void update_float_QR_column_gpu(matrix_base<SCALARTYPE> & A,
 
     }
 
+    /** @brief Computes the eigenvalues and eigenvectors of a symmetric matrix. On exit, A holds the diagonal matrix of eigenvalues.
+    *
+    * For matrices in host memory, a blocked Householder tridiagonalization followed by divide-and-conquer and a parallel back-transformation is used.
+    * Otherwise, the tridiagonalization is carried out on the device and the tridiagonal problem is solved by the QL method (tql2).
+    */
+    template <typename SCALARTYPE>
+    void qr_method_sym(matrix_base<SCALARTYPE> & A,
+                       matrix_base<SCALARTYPE> & Q,
+                       std::vector<SCALARTYPE> & D,
+                       std::vector<SCALARTYPE> & E)
+    {
+        assert(A.size1() == A.size2() && bool("Input matrix must be square for QR method!"));
+
+        vcl_size_t mat_size = A.size1();
+        D.resize(mat_size);
+        E.resize(mat_size);
+
+        if (viennacl::traits::active_handle_id(A) == viennacl::MAIN_MEMORY)
+        {
+          viennacl::linalg::host_based::symmetric_eigen(A, Q, D);
+          std::fill(E.begin(), E.end(), SCALARTYPE(0));
+        }
+        else
+        {
+          viennacl::vector<SCALARTYPE> vcl_D(mat_size, viennacl::traits::context(A)), vcl_E(mat_size, viennacl::traits::context(A));
+
+          Q = viennacl::identity_matrix<SCALARTYPE>(Q.size1(), viennacl::traits::context(Q));
+
+          // reduce to tridiagonal form
+          detail::tridiagonal_reduction(A, Q);
+
+          // pack diagonal and super-diagonal
+          viennacl::linalg::bidiag_pack(A, vcl_D, vcl_E);
+          copy(vcl_D, D);
+          copy(vcl_E, E);
+
+          // find eigenvalues of symmetric tridiagonal matrix
+          viennacl::linalg::tql2(Q, D, E);
+        }
+
+        viennacl::vector<SCALARTYPE> vcl_eigen_values(mat_size, viennacl::traits::context(A));
+        viennacl::copy(D, vcl_eigen_values);
+        A.clear();
+        viennacl::linalg::matrix_diag_from_vector(vcl_eigen_values, 0, A);
+    }
+
     template <typename SCALARTYPE>
     void qr_method(viennacl::matrix<SCALARTYPE> & A,
                    viennacl::matrix<SCALARTYPE> & Q,
@@ -733,6 +780,11 @@ void update_float_QR_column_gpu(matrix_base<SCALARTYPE> & A,
     {
 
         assert(A.size1() == A.size2() && bool("Input matrix must be square for QR method!"));
+        if (is_symmetric)
+        {
+          detail::qr_method_sym(A, Q, D, E);
+          return;
+        }
     /*    if (!viennacl::is_row_major<F>::value && !is_symmetric)
         {
           std::cout << "qr_method for non-symmetric column-major matrices not implemented yet!" << std::endl;
@@ -802,20 +854,20 @@ void qr_method_nsm(viennacl::matrix<SCALARTYPE>& A,
     detail::qr_method(A, Q, D, E, false);
 }
 
-template <typename SCALARTYPE>
-void qr_method_sym(viennacl::matrix<SCALARTYPE>& A,
-                   viennacl::matrix<SCALARTYPE>& Q,
+template <typename SCALARTYPE, typename F>
+void qr_method_sym(viennacl::matrix<SCALARTYPE, F>& A,
+                   viennacl::matrix<SCALARTYPE, F>& Q,
                    std::vector<SCALARTYPE>& D
                   )
 {
     std::vector<SCALARTYPE> E(A.size1());
 
-    detail::qr_method(A, Q, D, E, true);
+    detail::qr_method_sym(A, Q, D, E);
 }
 
-template <typename SCALARTYPE>
-void qr_method_sym(viennacl::matrix<SCALARTYPE>& A,
-                   viennacl::matrix<SCALARTYPE>& Q,
+template <typename SCALARTYPE, typename F>
+void qr_method_sym(viennacl::matrix<SCALARTYPE, F>& A,
+                   viennacl::matrix<SCALARTYPE, F>& Q,
                    viennacl::vector_base<SCALARTYPE>& D
                   )
 {
@@ -823,7 +875,7 @@ void qr_method_sym(viennacl::matrix<SCALARTYPE>& A,
     std::vector<SCALARTYPE> E(A.size1());
 
     viennacl::copy(D, std_D);
-    detail::qr_method(A, Q, std_D, E, true);
+    detail::qr_method_sym(A, Q, std_D, E);
     viennacl::copy(std_D, D);
 }
 
@@ -0,0 +1,455 @@
+#ifndef VIENNACL_LINALG_RANDOMIZED_SVD_HPP_
+#define VIENNACL_LINALG_RANDOMIZED_SVD_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/randomized_svd.hpp
+*   @brief Randomized range finder, randomized truncated SVD and randomized eigendecomposition for sparse and dense matrices.
+*
+*   The range of A is sampled by a random test matrix, refined by power iterations with re-orthonormalization by TSQR,
+*   and A is projected onto the resulting orthonormal basis (Halko, Martinsson, Tropp, SIAM Review, 2011).
+*   All products with A are block products (sparse matrix-dense matrix or dense matrix-dense matrix), thus A is streamed once per block product.
+*   The test matrix is either Gaussian or a subsampled randomized Hartley transform (a real-valued SRFT), which for dense matrices is applied by the FFT.
+*/
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+#include "viennacl/vector.hpp"
+#include "viennacl/matrix.hpp"
+#include "viennacl/matrix_proxy.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/fft.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/sparse_matrix_operations.hpp"
+#include "viennacl/linalg/tsqr.hpp"
+#include "viennacl/linalg/lobpcg.hpp"
+#include "viennacl/linalg/host_based/svd_operations.hpp"
+#include "viennacl/linalg/host_based/amg_operations.hpp"
+#include "viennacl/tools/random.hpp"
+
+namespace viennacl
+{
+namespace linalg
+{
+
+/** @brief A tag for the randomized SVD and the randomized eigendecomposition. Used for supplying parameters and for dispatching the svd() and eig() functions.
+*/
+class randomized_tag
+{
+public:
+  /** @brief The type of the random test matrix sampling the range */
+  enum sketch_type
+  {
+    gaussian_sketch = 0,   ///< Independent standard normally distributed entries
+    srft_sketch            ///< Subsampled randomized Hartley transform, applied by the FFT for dense matrices
+  };
+
+  /** @brief The constructor
+  *
+  * @param oversampling       Number of additional samples of the range of A. Larger values improve the accuracy.
+  * @param power_iterations   Number of power iterations. Larger values improve the accuracy for slowly decaying singular values.
+  * @param sketch             The type of the random test matrix
+  */
+  randomized_tag(vcl_size_t oversampling = 10, vcl_size_t power_iterations = 2, sketch_type sketch = gaussian_sketch)
+    : oversampling_(oversampling), power_iterations_(power_iterations), sketch_(sketch) {}
+
+  /** @brief Sets the number of additional samples of the range */
+  void oversampling(vcl_size_t o) { oversampling_ = o; }
+  /** @brief Returns the number of additional samples of the range */
+  vcl_size_t oversampling() const { return oversampling_; }
+
+  /** @brief Sets the number of power iterations */
+  void power_iterations(vcl_size_t p) { power_iterations_ = p; }
+  /** @brief Returns the number of power iterations */
+  vcl_size_t power_iterations() const { return power_iterations_; }
+
+  /** @brief Sets the type of the random test matrix */
+  void sketch(sketch_type s) { sketch_ = s; }
+  /** @brief Returns the type of the random test matrix */
+  sketch_type sketch() const { return sketch_; }
+
+private:
+  vcl_size_t oversampling_;
+  vcl_size_t power_iterations_;
+  sketch_type sketch_;
+};
+
+namespace detail
+{
+  /** @brief Wraps a system matrix for the block products A * X and A^T * X. The product with A^T is available for dense matrices only. */
+  template<typename MatrixT>
+  class randomized_operator
+  {
+  public:
+    randomized_operator(MatrixT const & A) : A_(A) {}
+
+    template<typename NumericT>
+    void apply(viennacl::matrix_base<NumericT> const & X, viennacl::matrix_base<NumericT> & Y) const { detail::lobpcg_apply(A_, X, Y); }
+
+    template<typename NumericT>
+    void apply_trans(viennacl::matrix_base<NumericT> const & X, viennacl::matrix_base<NumericT> & Y) const { Y = viennacl::linalg::prod(trans(A_), X); }
+
+  private:
+    MatrixT const & A_;
+  };
+
+  /** @brief Wraps a sparse system matrix for the block products A * X and A^T * X. The transpose is set up once. */
+  template<typename NumericT>
+  class randomized_operator< viennacl::compressed_matrix<NumericT> >
+  {
+  public:
+    randomized_operator(viennacl::compressed_matrix<NumericT> const & A) : A_(A), transposed_(false) {}
+
+    void apply(viennacl::matrix_base<NumericT> const & X, viennacl::matrix_base<NumericT> & Y) const { viennacl::linalg::prod_impl(A_, X, Y); }
+
+    void apply_trans(viennacl::matrix_base<NumericT> const & X, viennacl::matrix_base<NumericT> & Y)
+    {
+      if (!transposed_)
+      {
+        if (viennacl::traits::active_handle_id(A_) == viennacl::MAIN_MEMORY)
+          viennacl::linalg::host_based::amg::amg_transpose(A_, At_);
+        else
+        {
+          viennacl::compressed_matrix<NumericT> A_host(A_);
+          A_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+          viennacl::linalg::host_based::amg::amg_transpose(A_host, At_);
+          At_.switch_memory_context(viennacl::traits::context(A_));
+        }
+        transposed_ = true;
+      }
+      viennacl::linalg::prod_impl(At_, X, Y);
+    }
+
+  private:
+    viennacl::compressed_matrix<NumericT> const & A_;
+    viennacl::compressed_matrix<NumericT> At_;
+    bool transposed_;
+  };
+
+  /** @brief Draws the random signs and the l distinct frequencies in [0, N) of a subsampled randomized Hartley transform */
+  template<typename NumericT>
+  void randomized_srft_setup(vcl_size_t n, vcl_size_t N, vcl_size_t l, std::vector<NumericT> & signs, std::vector<vcl_size_t> & frequencies)
+  {
+    signs.resize(n);
+    for (vcl_size_t i = 0; i < n; ++i)
+      signs[i] = (rand() % 2) ? NumericT(1) : NumericT(-1);
+
+    // partial Fisher-Yates shuffle:
+    std::vector<vcl_size_t> all(N);
+    for (vcl_size_t i = 0; i < N; ++i)
+      all[i] = i;
+    for (vcl_size_t j = 0; j < l; ++j)
+      std::swap(all[j], all[j + static_cast<vcl_size_t>(rand()) % (N - j)]);
+    frequencies.assign(all.begin(), all.begin() + static_cast<long>(l));
+  }
+
+  /** @brief Computes Y = A * Omega for a dense matrix A and a subsampled randomized Hartley transform Omega = D H S.
+  *
+  * The rows of A are scaled by the random signs D, zero-padded to a power of two and transformed by batched FFTs,
+  * from which the l sampled frequencies S of the Hartley transform H are extracted.
+  */
+  template<typename NumericT>
+  void randomized_srft_sketch(viennacl::matrix_base<NumericT> const & A, viennacl::matrix<NumericT, viennacl::column_major> & Y)
+  {
+    vcl_size_t m = A.size1();
+    vcl_size_t n = A.size2();
+    vcl_size_t l = Y.size2();
+    vcl_size_t N = 1;
+    while (N < n)
+      N *= 2;
+
+    std::vector<NumericT> signs;
+    std::vector<vcl_size_t> frequencies;
+    randomized_srft_setup(n, N, l, signs, frequencies);
+
+    viennacl::matrix_base<NumericT> A_host(A);
+    A_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+    NumericT const * data_A = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(A_host);
+    vcl_size_t A_start1 = viennacl::traits::start1(A_host);
+    vcl_size_t A_start2 = viennacl::traits::start2(A_host);
+    vcl_size_t A_inc1   = viennacl::traits::stride1(A_host);
+    vcl_size_t A_inc2   = viennacl::traits::stride2(A_host);
+    vcl_size_t A_internal_size1 = viennacl::traits::internal_size1(A_host);
+    vcl_size_t A_internal_size2 = viennacl::traits::internal_size2(A_host);
+
+    std::vector<std::vector<NumericT> > Y_host(m, std::vector<NumericT>(l));
+
+    // transform blocks of rows at a time in order to limit the size of the complex buffer:
+    vcl_size_t block_rows = std::max<vcl_size_t>(1, std::min<vcl_size_t>(m, (vcl_size_t(1) << 22) / N));
+    std::vector<NumericT> buffer(2 * N * block_rows);
+    viennacl::vector<NumericT> fft_buffer(2 * N * block_rows, viennacl::traits::context(Y));
+    viennacl::fft_plan<NumericT> plan(N);
+    for (vcl_size_t row_start = 0; row_start < m; row_start += block_rows)
+    {
+      vcl_size_t rows = std::min(block_rows, m - row_start);
+
+      std::fill(buffer.begin(), buffer.end(), NumericT(0));
+#ifdef VIENNACL_WITH_OPENMP
+      #pragma omp parallel for
+#endif
+      for (long i2 = 0; i2 < static_cast<long>(rows); ++i2)
+      {
+        vcl_size_t i = static_cast<vcl_size_t>(i2);
+        for (vcl_size_t k = 0; k < n; ++k)
+        {
+          vcl_size_t row = (row_start + i) * A_inc1 + A_start1;
+          vcl_size_t col = k * A_inc2 + A_start2;
+          buffer[2 * (i * N + k)] = signs[k] * data_A[A_host.row_major() ? viennacl::row_major::mem_index(row, col, A_internal_size1, A_internal_size2)
+                                                                         : viennacl::column_major::mem_index(row, col, A_internal_size1, A_internal_size2)];
+        }
+      }
+
+      viennacl::copy(buffer, fft_buffer);
+      viennacl::inplace_fft(fft_buffer, plan, block_rows);
+      viennacl::copy(fft_buffer, buffer);
+
+      // Hartley transform from the Fourier transform with negative sign in the exponent: cas = Re - Im
+      for (vcl_size_t i = 0; i < rows; ++i)
+        for (vcl_size_t j = 0; j < l; ++j)
+          Y_host[row_start + i][j] = buffer[2 * (i * N + frequencies[j])] - buffer[2 * (i * N + frequencies[j]) + 1];
+    }
+
+    viennacl::copy(Y_host, Y);
+  }
+
+  /** @brief Computes Y = A * Omega for a sparse matrix A and a subsampled randomized Hartley transform Omega, which is set up explicitly. */
+  template<typename MatrixT, typename NumericT>
+  typename viennacl::enable_if< viennacl::is_any_sparse_matrix<MatrixT>::value>::type
+  randomized_srft_sketch(MatrixT const & A, viennacl::matrix<NumericT, viennacl::column_major> & Y)
+  {
+    vcl_size_t n = A.size2();
+    vcl_size_t l = Y.size2();
+
+    std::vector<NumericT> signs;
+    std::vector<vcl_size_t> frequencies;
+    randomized_srft_setup(n, n, l, signs, frequencies);
+
+    std::vector<std::vector<NumericT> > Omega_host(n, std::vector<NumericT>(l));
+    for (vcl_size_t k = 0; k < n; ++k)
+      for (vcl_size_t j = 0; j < l; ++j)
+      {
+        double angle = 6.28318530717958647692 * double((k * frequencies[j]) % n) / double(n);
+        Omega_host[k][j] = signs[k] * NumericT(std::cos(angle) + std::sin(angle));
+      }
+
+    viennacl::matrix<NumericT, viennacl::column_major> Omega(n, l, viennacl::traits::context(Y));
+    viennacl::copy(Omega_host, Omega);
+    detail::lobpcg_apply(A, Omega, Y);
+  }
+
+  /** @brief Computes the sketch Y = A * Omega of the range of A with a Gaussian test matrix Omega */
+  template<typename MatrixT, typename NumericT>
+  void randomized_gaussian_sketch(MatrixT const & A, viennacl::matrix<NumericT, viennacl::column_major> & Y)
+  {
+    vcl_size_t n = A.size2();
+    vcl_size_t l = Y.size2();
+
+    viennacl::tools::normal_random_numbers<NumericT> randomizer;
+    std::vector<std::vector<NumericT> > Omega_host(n, std::vector<NumericT>(l));
+    for (vcl_size_t k = 0; k < n; ++k)
+      for (vcl_size_t j = 0; j < l; ++j)
+        Omega_host[k][j] = randomizer();
+
+    viennacl::matrix<NumericT, viennacl::column_major> Omega(n, l, viennacl::traits::context(Y));
+    viennacl::copy(Omega_host, Omega);
+    detail::lobpcg_apply(A, Omega, Y);
+  }
+
+  /** @brief Computes an orthonormal basis Q of the approximate range of A.
+  *
+  * @param A          The system matrix
+  * @param op         The wrapper of A for products with A and A^T
+  * @param Q          The m-by-l matrix receiving the orthonormal basis. l is the number of samples.
+  * @param tag        The tag with the sketch type and the number of power iterations
+  * @param symmetric  If true, A is assumed to be symmetric and power iterations use A instead of A^T
+  */
+  template<typename MatrixT, typename OperatorT, typename NumericT>
+  void randomized_range_finder(MatrixT const & A, OperatorT & op,
+                               viennacl::matrix<NumericT, viennacl::column_major> & Q,
+                               randomized_tag const & tag, bool symmetric)
+  {
+    vcl_size_t n = A.size2();
+    vcl_size_t l = Q.size2();
+    viennacl::context ctx = viennacl::traits::context(Q);
+
+    if (tag.sketch() == randomized_tag::srft_sketch)
+      randomized_srft_sketch(A, Q);
+    else
+      randomized_gaussian_sketch(A, Q);
+
+    viennacl::matrix<NumericT, viennacl::column_major> R(l, l, ctx);
+    viennacl::linalg::tsqr(Q, R);
+
+    viennacl::matrix<NumericT, viennacl::column_major> Z(symmetric ? Q.size1() : n, l, ctx);
+    for (vcl_size_t it = 0; it < tag.power_iterations(); ++it)
+    {
+      if (symmetric)
+        op.apply(Q, Z);
+      else
+        op.apply_trans(Q, Z);
+      viennacl::linalg::tsqr(Z, R);
+      op.apply(Z, Q);
+      viennacl::linalg::tsqr(Q, R);
+    }
+  }
+
+  /** @brief Copies the column-major m-by-k array (leading dimension m) to the matrix M */
+  template<typename NumericT>
+  void randomized_copy_out(std::vector<NumericT> const & data, vcl_size_t m, vcl_size_t k, viennacl::matrix<NumericT, viennacl::column_major> & M)
+  {
+    std::vector<std::vector<NumericT> > M_host(m, std::vector<NumericT>(k));
+    for (vcl_size_t j = 0; j < k; ++j)
+      for (vcl_size_t i = 0; i < m; ++i)
+        M_host[i][j] = data[j * m + i];
+    viennacl::copy(M_host, M);
+  }
+}
+
+/** @brief Computes the k dominant singular triplets A ~ U diag(sigma) V^T of a sparse or dense matrix by a randomized range finder.
+*
+* The number of triplets k is given by the number of columns of U.
+* After the basis Q of the range of A is found, A^T Q = Q_2 R_2 is factored by TSQR, and only the small matrix R_2 is decomposed on the host.
+*
+* @param A       The input matrix (compressed_matrix or dense). Not modified.
+* @param U       The matrix receiving the k left singular vectors as columns (size1(A)-by-k)
+* @param sigma   The k largest singular values in descending order
+* @param V       The matrix receiving the k right singular vectors as columns (size2(A)-by-k)
+* @param tag     The tag with the oversampling, the number of power iterations and the type of sketch
+*/
+template<typename MatrixT, typename NumericT>
+void svd(MatrixT const & A,
+         viennacl::matrix_base<NumericT> & U,
+         std::vector<NumericT> & sigma,
+         viennacl::matrix_base<NumericT> & V,
+         randomized_tag const & tag)
+{
+  typedef viennacl::matrix<NumericT, viennacl::column_major>   BlockType;
+
+  vcl_size_t m = A.size1();
+  vcl_size_t n = A.size2();
+  vcl_size_t k = U.size2();
+
+  assert(U.size1() == m && bool("Size mismatch of left singular vectors!"));
+  assert(V.size1() == n && V.size2() == k && bool("Size mismatch of right singular vectors!"));
+  assert(k <= std::min(m, n) && bool("Number of singular triplets exceeds the matrix dimensions!"));
+
+  sigma.resize(k);
+  if (k == 0)
+    return;
+
+  vcl_size_t l = std::min(k + tag.oversampling(), std::min(m, n));
+  viennacl::context ctx = viennacl::traits::context(A);
+
+  detail::randomized_operator<MatrixT> op(A);
+  BlockType Q(m, l, ctx);
+  detail::randomized_range_finder(A, op, Q, tag, false);
+
+  // B^T = A^T Q = Q_2 R_2 and R_2 = U_R Sigma V_R^T, hence A ~ Q B = (Q V_R) Sigma (Q_2 U_R)^T:
+  BlockType Q2(n, l, ctx), R2(l, l, ctx);
+  op.apply_trans(Q, Q2);
+  viennacl::linalg::tsqr(Q2, R2);
+
+  std::vector<std::vector<NumericT> > R2_host(l, std::vector<NumericT>(l));
+  viennacl::copy(R2, R2_host);
+  std::vector<NumericT> R2_work(l * l);
+  for (vcl_size_t j = 0; j < l; ++j)
+    for (vcl_size_t i = 0; i < l; ++i)
+      R2_work[j * l + i] = R2_host[i][j];
+
+  std::vector<NumericT> s, U_R, V_R;
+  viennacl::linalg::host_based::svd(l, l, &R2_work[0], s, U_R, l, V_R);
+  std::copy(s.begin(), s.begin() + static_cast<long>(k), sigma.begin());
+
+  std::vector<NumericT> V_R_k(V_R.begin(), V_R.begin() + static_cast<long>(l * k));
+  std::vector<NumericT> U_R_k(U_R.begin(), U_R.begin() + static_cast<long>(l * k));
+  BlockType C_U(l, k, ctx), C_V(l, k, ctx);
+  detail::randomized_copy_out(V_R_k, l, k, C_U);
+  detail::randomized_copy_out(U_R_k, l, k, C_V);
+
+  BlockType U_tmp = viennacl::linalg::prod(Q, C_U);
+  BlockType V_tmp = viennacl::linalg::prod(Q2, C_V);
+  for (vcl_size_t j = 0; j < k; ++j)
+  {
+    viennacl::vector_base<NumericT> u_tmp_j(U_tmp.handle(), m, j * U_tmp.internal_size1(), 1);
+    viennacl::vector_base<NumericT> v_tmp_j(V_tmp.handle(), n, j * V_tmp.internal_size1(), 1);
+    viennacl::vector_base<NumericT> u_j(U.handle(), m, U.row_major() ? j : j * U.internal_size1(), U.row_major() ? U.internal_size2() : 1);
+    viennacl::vector_base<NumericT> v_j(V.handle(), n, V.row_major() ? j : j * V.internal_size1(), V.row_major() ? V.internal_size2() : 1);
+    u_j = u_tmp_j;
+    v_j = v_tmp_j;
+  }
+}
+
+/** @brief Computes the k eigenvalues largest in modulus and the associated eigenvectors of a symmetric sparse or dense matrix by a randomized range finder.
+*
+* The number of eigenpairs k is given by the number of columns of the eigenvector matrix.
+* The eigenpairs are obtained from the Rayleigh-Ritz projection of A onto the approximate range.
+*
+* @param A              The symmetric input matrix (sparse or dense). Not modified.
+* @param eigenvectors   The matrix receiving the k eigenvectors as columns
+* @param tag            The tag with the oversampling, the number of power iterations and the type of sketch
+* @return               The k eigenvalues largest in modulus, ordered by decreasing modulus
+*/
+template<typename MatrixT, typename NumericT>
+std::vector<NumericT> eig(MatrixT const & A, viennacl::matrix_base<NumericT> & eigenvectors, randomized_tag const & tag)
+{
+  typedef viennacl::matrix<NumericT, viennacl::column_major>   BlockType;
+
+  vcl_size_t n = A.size1();
+  vcl_size_t k = eigenvectors.size2();
+  assert(eigenvectors.size1() == n && k <= n && bool("Size mismatch of eigenvector matrix!"));
+  if (k == 0)
+    return std::vector<NumericT>();
+
+  vcl_size_t l = std::min(k + tag.oversampling(), n);
+  viennacl::context ctx = viennacl::traits::context(A);
+
+  detail::randomized_operator<MatrixT> op(A);
+  BlockType Q(n, l, ctx), AQ(n, l, ctx), C(l, l, ctx);
+  detail::randomized_range_finder(A, op, Q, tag, true);
+
+  op.apply(Q, AQ);
+  BlockType G = viennacl::linalg::prod(trans(Q), AQ);
+  std::vector<NumericT> theta;
+  detail::lobpcg_rayleigh_ritz(G, C, theta);
+
+  // theta is ascending, hence the eigenvalues of largest modulus are found at either end:
+  std::vector<vcl_size_t> order(k);
+  vcl_size_t lo = 0, hi = l;
+  for (vcl_size_t j = 0; j < k; ++j)
+    order[j] = (std::fabs(theta[lo]) > std::fabs(theta[hi - 1])) ? lo++ : --hi;
+
+  BlockType X = viennacl::linalg::prod(Q, C);
+  std::vector<NumericT> lambda(k);
+  for (vcl_size_t j = 0; j < k; ++j)
+  {
+    lambda[j] = theta[order[j]];
+    viennacl::vector_base<NumericT> x_j(X.handle(), n, order[j] * X.internal_size1(), 1);
+    viennacl::vector_base<NumericT> eigenvector_j(eigenvectors.handle(),
+                                                  n,
+                                                  eigenvectors.row_major() ? j : j * eigenvectors.internal_size1(),
+                                                  eigenvectors.row_major() ? eigenvectors.internal_size2() : 1);
+    eigenvector_j = x_j;
+  }
+  return lambda;
+}
+
+} // end namespace linalg
+} // end namespace viennacl
+#endif
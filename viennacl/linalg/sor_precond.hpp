@@ -0,0 +1,179 @@
+#ifndef VIENNACL_LINALG_SOR_PRECOND_HPP_
+#define VIENNACL_LINALG_SOR_PRECOND_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/sor_precond.hpp
+    @brief Implementation of multicolor Gauss-Seidel, SOR and SSOR preconditioners. Experimental.
+
+    The unknowns are relaxed color by color, where the colors are obtained from a distance-1 coloring of the adjacency graph.
+    Since unknowns of the same color are not coupled, each color is relaxed in parallel.
+    The matrix is stored in multicolor ordering, so that the unknowns of each color are contiguous in memory.
+*/
+
+#include <vector>
+
+#include "viennacl/forwards.h"
+#include "viennacl/vector.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/linalg/host_based/common.hpp"
+#include "viennacl/linalg/host_based/coloring_operations.hpp"
+#include "viennacl/linalg/host_based/reorder_operations.hpp"
+
+namespace viennacl
+{
+namespace linalg
+{
+
+/** @brief A tag for multicolor Gauss-Seidel, SOR and SSOR preconditioners
+*/
+class sor_tag
+{
+public:
+  /** @brief The constructor
+  *
+  * @param omega       The relaxation parameter in (0, 2). omega = 1 yields Gauss-Seidel.
+  * @param sweeps      Number of relaxation sweeps per application of the preconditioner
+  * @param symmetric   If true, each forward sweep is followed by a backward sweep (SSOR), which yields a symmetric preconditioner suitable for the CG method
+  */
+  sor_tag(double omega = 1.0, vcl_size_t sweeps = 1, bool symmetric = false) : omega_(omega), sweeps_(sweeps), symmetric_(symmetric) {}
+
+  /** @brief Returns the relaxation parameter */
+  double omega() const { return omega_; }
+  /** @brief Sets the relaxation parameter. Must be in (0, 2). */
+  void omega(double val) { if (val > 0 && val < 2) omega_ = val; }
+
+  /** @brief Returns the number of sweeps per application of the preconditioner */
+  vcl_size_t sweeps() const { return sweeps_; }
+  /** @brief Sets the number of sweeps per application of the preconditioner */
+  void sweeps(vcl_size_t num) { if (num > 0) sweeps_ = num; }
+
+  /** @brief Returns true if forward and backward sweeps are used (SSOR) */
+  bool symmetric() const { return symmetric_; }
+  /** @brief Sets whether forward and backward sweeps are used (SSOR) */
+  void symmetric(bool b) { symmetric_ = b; }
+
+private:
+  double omega_;
+  vcl_size_t sweeps_;
+  bool symmetric_;
+};
+
+
+/** @brief Multicolor SOR preconditioner class, can be supplied to solve()-routines
+*/
+template<typename MatrixT>
+class sor_precond;
+
+
+/** @brief Multicolor SOR preconditioner class for compressed_matrix, can be supplied to solve()-routines.
+*
+* Each application runs the configured number of (S)SOR sweeps for A z = r starting from z = 0.
+* The sweeps run on the host, vectors in other memory domains are temporarily copied to the host.
+*/
+template<typename NumericT, unsigned int AlignmentV>
+class sor_precond< viennacl::compressed_matrix<NumericT, AlignmentV> >
+{
+  typedef viennacl::compressed_matrix<NumericT, AlignmentV>   MatrixType;
+
+public:
+  sor_precond(MatrixType const & mat, sor_tag const & tag)
+    : tag_(tag), A_(0, 0, 0, viennacl::context(viennacl::MAIN_MEMORY))
+  {
+    init(mat);
+  }
+
+  void apply(viennacl::vector_base<NumericT> & vec) const
+  {
+    if (viennacl::traits::active_handle_id(vec) == viennacl::MAIN_MEMORY)
+    {
+      apply_host(vec);
+      return;
+    }
+
+    viennacl::vector<NumericT> host_vec(vec);
+    viennacl::switch_memory_context(host_vec, viennacl::context(viennacl::MAIN_MEMORY));
+    apply_host(host_vec);
+    viennacl::switch_memory_context(host_vec, viennacl::traits::context(vec));
+    vec = host_vec;
+  }
+
+  /** @brief Returns the number of colors, i.e. the number of sequential steps in each sweep */
+  vcl_size_t colors() const { return color_ptr_.size() - 1; }
+
+private:
+  void init(MatrixType const & mat)
+  {
+    viennacl::context host_context(viennacl::MAIN_MEMORY);
+    MatrixType A_host(0, 0, 0, host_context);
+    if (viennacl::traits::active_handle_id(mat) != viennacl::MAIN_MEMORY)
+      A_host = mat;
+    MatrixType const & A = (viennacl::traits::active_handle_id(mat) == viennacl::MAIN_MEMORY) ? mat : A_host;
+
+    permutation_ = viennacl::linalg::host_based::multicolor_permutation(viennacl::linalg::host_based::jones_plassmann_coloring(A, 1), color_ptr_);
+    viennacl::linalg::host_based::permute(A, permutation_, A_);
+
+    unsigned int const * row_buffer = viennacl::linalg::host_based::detail::extract_raw_pointer<unsigned int>(A_.handle1());
+    unsigned int const * col_buffer = viennacl::linalg::host_based::detail::extract_raw_pointer<unsigned int>(A_.handle2());
+    NumericT     const * elements   = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(A_.handle());
+
+    inv_diag_.resize(A_.size1());
+    for (vcl_size_t row = 0; row < A_.size1(); ++row)
+    {
+      NumericT diag = 0;
+      for (unsigned int j = row_buffer[row]; j < row_buffer[row+1]; ++j)
+        if (col_buffer[j] == row)
+          diag = elements[j];
+      if (diag <= 0 && diag >= 0)
+        throw zero_on_diagonal_exception("ViennaCL: Zero in diagonal encountered while setting up SOR preconditioner!");
+      inv_diag_[row] = NumericT(1) / diag;
+    }
+
+    rhs_ = viennacl::vector<NumericT>(A_.size1(), host_context);
+    result_ = viennacl::vector<NumericT>(A_.size1(), host_context);
+  }
+
+  void apply_host(viennacl::vector_base<NumericT> & vec) const
+  {
+    viennacl::linalg::host_based::permute(vec, permutation_, rhs_);
+    result_.clear();
+
+    NumericT omega = NumericT(tag_.omega());
+    for (vcl_size_t i = 0; i < tag_.sweeps(); ++i)
+    {
+      viennacl::linalg::host_based::multicolor_sor_sweep(A_, inv_diag_, color_ptr_, rhs_, result_, omega, true);
+      if (tag_.symmetric())
+        viennacl::linalg::host_based::multicolor_sor_sweep(A_, inv_diag_, color_ptr_, rhs_, result_, omega, false);
+    }
+
+    viennacl::linalg::host_based::inverse_permute(result_, permutation_, vec);
+  }
+
+  sor_tag tag_;
+  MatrixType A_;
+  std::vector<NumericT> inv_diag_;
+  std::vector<unsigned int> color_ptr_;
+  std::vector<unsigned int> permutation_;
+  mutable viennacl::vector<NumericT> rhs_;
+  mutable viennacl::vector<NumericT> result_;
+};
+
+}
+}
+
+#endif
@@ -38,17 +38,22 @@
 #include "viennacl/linalg/detail/spai/spai_tag.hpp"
 #include "viennacl/linalg/qr.hpp"
 #include "viennacl/linalg/prod.hpp"
+#ifdef VIENNACL_WITH_OPENCL
 #include "viennacl/linalg/detail/spai/spai-dynamic.hpp"
 #include "viennacl/linalg/detail/spai/spai-static.hpp"
 #include "viennacl/linalg/detail/spai/sparse_vector.hpp"
 #include "viennacl/linalg/detail/spai/block_matrix.hpp"
 #include "viennacl/linalg/detail/spai/block_vector.hpp"
-#include "viennacl/linalg/detail/spai/fspai.hpp"
 #include "viennacl/linalg/detail/spai/spai.hpp"
+#endif
+#include "viennacl/linalg/detail/spai/fspai.hpp"
+#include "viennacl/linalg/host_based/spai_operations.hpp"
+#include "viennacl/linalg/host_based/ilu_operations.hpp"
 
 //boost includes
 #include "boost/numeric/ublas/vector.hpp"
 #include "boost/numeric/ublas/matrix.hpp"
+#include "boost/numeric/ublas/matrix_sparse.hpp"
 #include "boost/numeric/ublas/matrix_proxy.hpp"
 #include "boost/numeric/ublas/vector_proxy.hpp"
 #include "boost/numeric/ublas/storage.hpp"
@@ -73,6 +78,7 @@ namespace viennacl
         //UBLAS version
         template<typename MatrixType>
         class spai_precond
+#ifdef VIENNACL_WITH_OPENCL
         {
         public:
             typedef typename MatrixType::value_type ScalarType;
@@ -114,9 +120,17 @@ namespace viennacl
             // result of SPAI
             MatrixType spai_m_;
         };
+#else
+        ; // the SPAI implementation for uBLAS types is based on OpenCL kernels
+#endif
 
         //VIENNACL version
         /** @brief Implementation of the SParse Approximate Inverse Algorithm for a ViennaCL compressed_matrix.
+         *
+         * For matrices in host memory (or if OpenCL is not enabled) a static-pattern SPAI with the sparsity pattern of A is computed
+         * on the host using OpenMP, cf. viennacl::linalg::host_based::spai_static_setup(). The dynamic-pattern SPAI is computed using OpenCL otherwise.
+         * The host path is static-pattern only: Of the options in spai_tag it only honors getIsRight(), the residual thresholds, the iteration limit and getIsStatic() are ignored.
+         *
          * @param Matrix matrix that is used for computations
          * @param Vector vector that is used for computations
          */
@@ -138,6 +152,47 @@ namespace viennacl
             spai_precond(const MatrixType& A,
                          const spai_tag& tag): tag_(tag), spai_m_(viennacl::traits::context(A))
             {
+#ifdef VIENNACL_WITH_OPENCL
+              if (viennacl::traits::active_handle_id(A) == viennacl::OPENCL_MEMORY)
+                init_opencl(A);
+              else
+#endif
+                init_host(A);
+              tmp_.resize(A.size1(), viennacl::traits::context(A), false);
+            }
+            /** @brief Application of current preconditioner, multiplication on the right-hand side vector
+             * @param vec rhs vector
+             */
+            void apply(VectorType& vec) const {
+                tmp_ = viennacl::linalg::prod(spai_m_, vec);
+                vec = tmp_;
+            }
+        private:
+            /** @brief Static-pattern SPAI computed on the host. Data in other memory domains is temporarily copied to the host. Only tag_.getIsRight() is used. */
+            void init_host(const MatrixType& A)
+            {
+                viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+                MatrixType A_host(0, 0, 0, host_ctx);
+                MatrixType M_host(0, 0, 0, host_ctx);
+                A_host = A;
+
+                if (tag_.getIsRight()) // A M = I  <=>  M^T A^T = I
+                {
+                  MatrixType At_host(0, 0, 0, host_ctx);
+                  MatrixType Mt_host(0, 0, 0, host_ctx);
+                  viennacl::linalg::host_based::ilu_transpose(A_host, At_host);
+                  viennacl::linalg::host_based::spai_static_setup(At_host, Mt_host);
+                  viennacl::linalg::host_based::ilu_transpose(Mt_host, M_host);
+                }
+                else
+                  viennacl::linalg::host_based::spai_static_setup(A_host, M_host);
+
+                spai_m_ = M_host;
+            }
+
+#ifdef VIENNACL_WITH_OPENCL
+            void init_opencl(const MatrixType& A)
+            {
                 viennacl::ocl::context & ctx = const_cast<viennacl::ocl::context &>(viennacl::traits::opencl_handle(A).context());
                 viennacl::linalg::opencl::kernels::spai<ScalarType>::init(ctx);
 
@@ -158,16 +213,9 @@ namespace viennacl
                 viennacl::copy(ubls_At, At);
                 viennacl::linalg::detail::spai::computeSPAI(At, ubls_At, ubls_spai_m, spai_m_, tag_);
                 //viennacl::copy(ubls_spai_m, spai_m_);
-                tmp_.resize(A.size1(), viennacl::traits::context(A), false);
-            }
-            /** @brief Application of current preconditioner, multiplication on the right-hand side vector
-             * @param vec rhs vector
-             */
-            void apply(VectorType& vec) const {
-                tmp_ = viennacl::linalg::prod(spai_m_, vec);
-                vec = tmp_;
             }
-        private:
+#endif
+
             // variables
             spai_tag tag_;
             // result of SPAI
@@ -249,6 +297,42 @@ namespace viennacl
             */
             fspai_precond(const MatrixType & A,
                           const fspai_tag & tag) : tag_(tag), L(viennacl::traits::context(A)), L_trans(viennacl::traits::context(A)), temp_apply_vec_(A.size1(), viennacl::traits::context(A))
+            {
+              if (tag_.getIsStatic())
+                init_static(A);
+              else
+                init_dynamic(A);
+            }
+
+
+            /** @brief Application of current preconditioner, multiplication on the right-hand side vector
+            * @param vec rhs vector
+            */
+            void apply(VectorType& vec) const
+            {
+              temp_apply_vec_ = viennacl::linalg::prod(L_trans, vec);
+              vec = viennacl::linalg::prod(L, temp_apply_vec_);
+            }
+
+        private:
+            /** @brief Static-pattern FSPAI with the lower triangular pattern of A, computed directly on the CSR arrays on the host. */
+            void init_static(const MatrixType & A)
+            {
+                viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+                MatrixType A_host(0, 0, 0, host_ctx);
+                MatrixType G_host(0, 0, 0, host_ctx);
+                MatrixType Gt_host(0, 0, 0, host_ctx);
+                A_host = A;
+
+                // A^{-1} is approximately G^T G, hence L = G^T and L_trans = G:
+                viennacl::linalg::host_based::fspai_static_setup(A_host, G_host);
+                viennacl::linalg::host_based::ilu_transpose(G_host, Gt_host);
+
+                L       = Gt_host;
+                L_trans = G_host;
+            }
+
+            void init_dynamic(const MatrixType & A)
             {
                 //UBLASSparseMatrixType ubls_A;
                 UBLASSparseMatrixType ublas_A(A.size1(), A.size2());
@@ -268,17 +352,6 @@ namespace viennacl
                 viennacl::copy(ublas_L_trans, L_trans);
             }
 
-
-            /** @brief Application of current preconditioner, multiplication on the right-hand side vector
-            * @param vec rhs vector
-            */
-            void apply(VectorType& vec) const
-            {
-              temp_apply_vec_ = viennacl::linalg::prod(L_trans, vec);
-              vec = viennacl::linalg::prod(L, temp_apply_vec_);
-            }
-
-        private:
             // variables
             const fspai_tag & tag_;
             MatrixType L;
@@ -419,43 +419,6 @@ break;
     return matrix_expression< const M1, const M1, op_trans>(mat, mat);
   }
 
-  //free functions:
-  /** @brief Implementation of the operation 'result = v1 + A * v2', where A is a matrix
-  *
-  * @param result The vector the result is written to.
-  * @param proxy  An expression template proxy class holding v1, A, and v2.
-  */
-  template<typename SCALARTYPE, typename SparseMatrixType>
-  typename viennacl::enable_if< viennacl::is_any_sparse_matrix<SparseMatrixType>::value,
-                                viennacl::vector<SCALARTYPE> >::type
-  operator+(viennacl::vector_base<SCALARTYPE> & result,
-            const viennacl::vector_expression< const SparseMatrixType, const viennacl::vector_base<SCALARTYPE>, viennacl::op_prod> & proxy)
-  {
-    assert(proxy.lhs().size1() == result.size() && bool("Dimensions for addition of sparse matrix-vector product to vector don't match!"));
-    vector<SCALARTYPE> temp(proxy.lhs().size1());
-    viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), temp);
-    result += temp;
-    return result;
-  }
-
-  /** @brief Implementation of the operation 'result = v1 - A * v2', where A is a matrix
-  *
-  * @param result The vector the result is written to.
-  * @param proxy  An expression template proxy class.
-  */
-  template<typename SCALARTYPE, typename SparseMatrixType>
-  typename viennacl::enable_if< viennacl::is_any_sparse_matrix<SparseMatrixType>::value,
-                                viennacl::vector<SCALARTYPE> >::type
-  operator-(viennacl::vector_base<SCALARTYPE> & result,
-            const viennacl::vector_expression< const SparseMatrixType, const viennacl::vector_base<SCALARTYPE>, viennacl::op_prod> & proxy)
-  {
-    assert(proxy.lhs().size1() == result.size() && bool("Dimensions for addition of sparse matrix-vector product to vector don't match!"));
-    vector<SCALARTYPE> temp(proxy.lhs().size1());
-    viennacl::linalg::prod_impl(proxy.lhs(), proxy.rhs(), temp);
-    result += temp;
-    return result;
-  }
-
 } //namespace viennacl
 
 
@@ -0,0 +1,391 @@
+#ifndef VIENNACL_LINALG_SUBSPACE_ITER_HPP_
+#define VIENNACL_LINALG_SUBSPACE_ITER_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/subspace_iter.hpp
+*   @brief Implementation of subspace iteration (block power iteration) with Rayleigh-Ritz projection for the dominant eigenpairs of symmetric matrices.
+*
+*   A block of vectors is multiplied by the system matrix using a single sparse matrix-dense matrix product per step and is orthonormalized by TSQR.
+*   Every few steps a Rayleigh-Ritz projection extracts the Ritz pairs and checks for convergence.
+*   Optionally, the plain products are replaced by a Chebyshev polynomial filter damping the unwanted part of the spectrum (Zhou and Saad, SIAM J. Matrix Anal. Appl., 2007).
+*/
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include "viennacl/vector.hpp"
+#include "viennacl/matrix.hpp"
+#include "viennacl/matrix_proxy.hpp"
+#include "viennacl/linalg/prod.hpp"
+#include "viennacl/linalg/inner_prod.hpp"
+#include "viennacl/linalg/norm_2.hpp"
+#include "viennacl/linalg/tsqr.hpp"
+#include "viennacl/linalg/lobpcg.hpp"
+#include "viennacl/linalg/host_based/bisect_operations.hpp"
+#include "viennacl/tools/random.hpp"
+
+namespace viennacl
+{
+namespace linalg
+{
+
+/** @brief A tag for subspace iteration. Used for supplying solver parameters and for dispatching the eig() function.
+*/
+class subspace_iter_tag
+{
+public:
+  /** @brief The constructor
+  *
+  * @param numeig           Number of dominant eigenvalues to be computed
+  * @param tol              Relative tolerance for the residuals (eigenpair (lambda, x) is converged if ||A x - lambda x|| < tol * ||A||)
+  * @param max_iterations   The maximum number of block products with the system matrix
+  */
+  subspace_iter_tag(vcl_size_t numeig = 10, double tol = 1e-8, vcl_size_t max_iterations = 10000)
+    : num_eigenvalues_(numeig), tol_(tol), iterations_(max_iterations), subspace_size_(0), rayleigh_ritz_interval_(5), chebyshev_degree_(0),
+      iters_taken_(0), last_error_(0) {}
+
+  /** @brief Sets the number of eigenvalues */
+  void num_eigenvalues(vcl_size_t numeig) { num_eigenvalues_ = numeig; }
+  /** @brief Returns the number of eigenvalues */
+  vcl_size_t num_eigenvalues() const { return num_eigenvalues_; }
+
+  /** @brief Returns the relative tolerance */
+  double tolerance() const { return tol_; }
+
+  /** @brief Returns the maximum number of block products with the system matrix */
+  vcl_size_t max_iterations() const { return iterations_; }
+
+  /** @brief Sets the number of vectors in the iterated block. Additional guard vectors speed up convergence. Zero selects twice the number of eigenvalues. */
+  void subspace_size(vcl_size_t s) { subspace_size_ = s; }
+  /** @brief Returns the number of vectors in the iterated block (zero for the default) */
+  vcl_size_t subspace_size() const { return subspace_size_; }
+
+  /** @brief Sets the number of filtering steps between two Rayleigh-Ritz projections */
+  void rayleigh_ritz_interval(vcl_size_t i) { rayleigh_ritz_interval_ = std::max<vcl_size_t>(i, 1); }
+  /** @brief Returns the number of filtering steps between two Rayleigh-Ritz projections */
+  vcl_size_t rayleigh_ritz_interval() const { return rayleigh_ritz_interval_; }
+
+  /** @brief Sets the degree of the Chebyshev filter polynomial. Zero (default) selects plain block power steps.
+  *
+  * With a Chebyshev filter the largest eigenvalues (rather than the eigenvalues largest in modulus) are computed.
+  */
+  void chebyshev_degree(vcl_size_t d) { chebyshev_degree_ = d; }
+  /** @brief Returns the degree of the Chebyshev filter polynomial */
+  vcl_size_t chebyshev_degree() const { return chebyshev_degree_; }
+
+  /** @brief Return the number of block products with the system matrix: */
+  vcl_size_t iters() const { return iters_taken_; }
+  void iters(vcl_size_t i) const { iters_taken_ = i; }
+
+  /** @brief Returns the largest relative residual at the end of the solver run */
+  double error() const { return last_error_; }
+  /** @brief Sets the largest relative residual at the end of the solver run */
+  void error(double e) const { last_error_ = e; }
+
+private:
+  vcl_size_t num_eigenvalues_;
+  double tol_;
+  vcl_size_t iterations_;
+  vcl_size_t subspace_size_;
+  vcl_size_t rayleigh_ritz_interval_;
+  vcl_size_t chebyshev_degree_;
+
+  //return values from solver
+  mutable vcl_size_t iters_taken_;
+  mutable double last_error_;
+};
+
+namespace detail
+{
+  /** @brief Estimates lower and upper bounds of the spectrum of a symmetric matrix from a few Lanczos steps.
+  *
+  * The extremal Ritz values are widened by the last off-diagonal entry of the Lanczos matrix (Zhou and Li, Linear Algebra Appl., 2011).
+  */
+  template<typename MatrixT, typename NumericT>
+  void subspace_spectrum_bounds(MatrixT const & A, vcl_size_t steps, NumericT & lower, NumericT & upper)
+  {
+    vcl_size_t n = A.size1();
+    steps = std::min(steps, n);
+
+    viennacl::context ctx = viennacl::traits::context(A);
+    viennacl::vector<NumericT> v(n, ctx), v_prev = viennacl::zero_vector<NumericT>(n, ctx), w(n, ctx);
+
+    viennacl::tools::uniform_random_numbers<NumericT> random_gen;
+    std::vector<NumericT> s(n);
+    for (vcl_size_t i = 0; i < n; ++i)
+      s[i] = NumericT(0.5) - random_gen();
+    viennacl::copy(s, v);
+    v /= viennacl::linalg::norm_2(v);
+
+    std::vector<NumericT> alphas, betas(1, NumericT(0));
+    NumericT beta = 0;
+    for (vcl_size_t j = 0; j < steps; ++j)
+    {
+      w = viennacl::linalg::prod(A, v);
+      NumericT alpha = viennacl::linalg::inner_prod(w, v);
+      w -= alpha * v;
+      w -= beta * v_prev;
+      beta = viennacl::linalg::norm_2(w);
+      alphas.push_back(alpha);
+      if (beta <= std::fabs(alpha) * std::numeric_limits<NumericT>::epsilon())
+        break;
+      betas.push_back(beta);
+      v_prev = v;
+      v = w / beta;
+    }
+    betas.resize(alphas.size());
+
+    std::vector<NumericT> theta(alphas.size());
+    viennacl::linalg::host_based::bisect(alphas, betas, theta);
+    lower = theta.front() - beta;
+    upper = theta.back()  + beta;
+  }
+
+  /** @brief Applies the scaled Chebyshev filter of the given degree to the columns of X, damping the interval [lower, cut] and normalizing the filter to one at 'upper'.
+  *
+  * @param A        The system matrix
+  * @param X        The block to be filtered. Overwritten with the filtered block.
+  * @param Y        Work block of the same size as X
+  * @param AY       Work block of the same size as X
+  */
+  template<typename MatrixT, typename NumericT>
+  void subspace_chebyshev_filter(MatrixT const & A, vcl_size_t degree, NumericT lower, NumericT cut, NumericT upper,
+                                 viennacl::matrix<NumericT, viennacl::column_major> & X,
+                                 viennacl::matrix<NumericT, viennacl::column_major> & Y,
+                                 viennacl::matrix<NumericT, viennacl::column_major> & AY)
+  {
+    NumericT e = (cut - lower) / NumericT(2);
+    NumericT c = (cut + lower) / NumericT(2);
+    NumericT sigma = e / (upper - c);
+    NumericT tau = NumericT(2) / sigma;
+
+    // three-term recurrence, with the roles of X, Y and AY rotating:
+    viennacl::matrix<NumericT, viennacl::column_major> * blocks[3] = { &X, &Y, &AY };
+    vcl_size_t i_prev = 0, i_cur = 1, i_next = 2;
+
+    detail::lobpcg_apply(A, X, Y);
+    Y -= c * X;
+    Y *= sigma / e;
+    for (vcl_size_t i = 1; i < degree; ++i)
+    {
+      NumericT sigma_new = NumericT(1) / (tau - sigma);
+      viennacl::matrix<NumericT, viennacl::column_major> & Z = *blocks[i_next];
+      detail::lobpcg_apply(A, *blocks[i_cur], Z);
+      Z -= c * (*blocks[i_cur]);
+      Z *= NumericT(2) * sigma_new / e;
+      Z -= (sigma * sigma_new) * (*blocks[i_prev]);
+      sigma = sigma_new;
+
+      vcl_size_t tmp = i_prev;
+      i_prev = i_cur;
+      i_cur = i_next;
+      i_next = tmp;
+    }
+
+    if (i_cur != 0)
+      X = *blocks[i_cur];
+  }
+}
+
+/**
+*   @brief Computes the dominant eigenvalues and the associated eigenvectors of a symmetric matrix using subspace iteration.
+*
+*   Without Chebyshev filter (default) the eigenvalues largest in modulus are computed, ordered by decreasing modulus.
+*   With a Chebyshev filter (see subspace_iter_tag::chebyshev_degree()) the largest eigenvalues are computed, in descending order.
+*
+*   @param A              The symmetric system matrix (sparse or dense)
+*   @param eigenvectors   Dense matrix with at least as many columns as eigenvalues requested. Receives the eigenvectors (one eigenvector per column).
+*   @param tag            Tag with the number of eigenvalues and convergence criteria
+*   @return               Returns the dominant eigenvalues
+*/
+template<typename MatrixT, typename DenseMatrixT>
+std::vector< typename viennacl::result_of::cpu_value_type<typename MatrixT::value_type>::type >
+eig(MatrixT const & A, DenseMatrixT & eigenvectors, subspace_iter_tag const & tag)
+{
+  typedef typename viennacl::result_of::value_type<MatrixT>::type            NumericType;
+  typedef typename viennacl::result_of::cpu_value_type<NumericType>::type    NumericT;
+  typedef viennacl::matrix<NumericT, viennacl::column_major>                 BlockType;
+
+  vcl_size_t n = A.size1();
+  vcl_size_t k = std::min(tag.num_eigenvalues(), n);
+  if (k == 0)
+    return std::vector<NumericT>();
+  vcl_size_t p = std::min(n, std::max(k, tag.subspace_size() > 0 ? tag.subspace_size() : 2 * k));
+  bool use_chebyshev = (tag.chebyshev_degree() > 0);
+
+  viennacl::context ctx = viennacl::traits::context(A);
+  BlockType X(n, p, ctx), AX(n, p, ctx), Y(n, p, ctx), R(p, p, ctx);
+  viennacl::vector<NumericT> r(n, ctx);
+  std::vector<NumericT> theta;
+  std::vector<NumericT> lambda(k);
+  NumericT anorm = 0;
+  NumericT max_residual = 0;
+
+  // random initial block:
+  viennacl::tools::uniform_random_numbers<NumericT> random_gen;
+  std::vector<NumericT> s(n);
+  for (vcl_size_t j = 0; j < p; ++j)
+  {
+    for (vcl_size_t i = 0; i < n; ++i)
+      s[i] = NumericT(0.5) - random_gen();
+    viennacl::vector_base<NumericT> x_j(X.handle(), n, j * X.internal_size1(), 1);
+    viennacl::copy(s, r);
+    x_j = r;
+  }
+  viennacl::linalg::tsqr(X, R);
+
+  // bounds of the spectrum for the Chebyshev filter, the cut is updated from the Ritz values:
+  NumericT lower = 0, upper = 0, cut = 0;
+  if (use_chebyshev)
+  {
+    detail::subspace_spectrum_bounds(A, 20, lower, upper);
+    cut = (lower + upper) / NumericT(2);
+  }
+
+  vcl_size_t iter = 0;
+  for (vcl_size_t step = 0; ; ++step)
+  {
+    bool rayleigh_ritz = ((step + 1) % tag.rayleigh_ritz_interval() == 0);
+
+    //
+    // Step 1: AX = A X, either for the power step or for the Rayleigh-Ritz projection
+    //
+    if (use_chebyshev)
+    {
+      if (lower < cut && cut < upper)
+      {
+        detail::subspace_chebyshev_filter(A, tag.chebyshev_degree(), lower, cut, upper, X, Y, AX);
+        viennacl::linalg::tsqr(X, R);
+        iter += tag.chebyshev_degree();
+      }
+      else
+        rayleigh_ritz = true;   // degenerate damping interval, only the convergence check is left
+      if (rayleigh_ritz)
+      {
+        detail::lobpcg_apply(A, X, AX);
+        ++iter;
+      }
+    }
+    else
+    {
+      detail::lobpcg_apply(A, X, AX);
+      ++iter;
+    }
+
+    //
+    // Step 2: Rayleigh-Ritz projection, Ritz pairs ordered by decreasing modulus or decreasing value:
+    //
+    bool converged = false;
+    if (rayleigh_ritz || iter >= tag.max_iterations())
+    {
+      BlockType G = viennacl::linalg::prod(trans(X), AX);
+      BlockType C(p, p, ctx);
+      detail::lobpcg_rayleigh_ritz(G, C, theta);
+
+      std::vector<vcl_size_t> order(p);
+      for (vcl_size_t j = 0; j < p; ++j)
+        order[j] = use_chebyshev ? p - 1 - j : j;
+      if (!use_chebyshev)
+      {
+        // theta is ascending, hence the eigenvalues of largest modulus are found at either end:
+        vcl_size_t lo = 0, hi = p;
+        for (vcl_size_t j = 0; j < p; ++j)
+          order[j] = (std::fabs(theta[lo]) > std::fabs(theta[hi - 1])) ? lo++ : --hi;
+      }
+
+      std::vector<std::vector<NumericT> > C_host(p, std::vector<NumericT>(p)), C_sorted(p, std::vector<NumericT>(p));
+      viennacl::copy(C, C_host);
+      for (vcl_size_t i = 0; i < p; ++i)
+        for (vcl_size_t j = 0; j < p; ++j)
+          C_sorted[i][j] = C_host[i][order[j]];
+      viennacl::copy(C_sorted, C);
+
+      Y  = viennacl::linalg::prod(X, C);
+      X  = Y;
+      Y  = viennacl::linalg::prod(AX, C);
+      AX = Y;
+
+      anorm = std::max(anorm, std::max(std::fabs(theta[0]), std::fabs(theta[p - 1])));
+      for (vcl_size_t j = 0; j < k; ++j)
+        lambda[j] = theta[order[j]];
+
+      max_residual = 0;
+      for (vcl_size_t j = 0; j < k; ++j)
+      {
+        viennacl::vector_base<NumericT> x_j(X.handle(), n, j * X.internal_size1(), 1);
+        viennacl::vector_base<NumericT> Ax_j(AX.handle(), n, j * AX.internal_size1(), 1);
+        r = Ax_j - lambda[j] * x_j;
+        max_residual = std::max(max_residual, viennacl::linalg::norm_2(r) / anorm);
+      }
+      converged = (max_residual <= NumericT(tag.tolerance()));
+
+      // the smallest Ritz value in the block separates the wanted from the damped part of the spectrum:
+      if (use_chebyshev)
+        cut = theta[0];
+    }
+
+    if (converged || iter >= tag.max_iterations())
+      break;
+
+    //
+    // Step 3: Power step X <- orth(A X)
+    //
+    if (!use_chebyshev)
+    {
+      X = AX;
+      viennacl::linalg::tsqr(X, R);
+    }
+  }
+
+  tag.iters(iter);
+  tag.error(max_residual);
+
+  for (vcl_size_t j = 0; j < k; ++j)
+  {
+    viennacl::vector_base<NumericT> x_j(X.handle(), n, j * X.internal_size1(), 1);
+    viennacl::vector_base<NumericT> eigenvector_j(eigenvectors.handle(),
+                                                  n,
+                                                  eigenvectors.row_major() ? j : j * eigenvectors.internal_size1(),
+                                                  eigenvectors.row_major() ? eigenvectors.internal_size2() : 1);
+    eigenvector_j = x_j;
+  }
+  return lambda;
+}
+
+/**
+*   @brief Computes the dominant eigenvalues of a symmetric matrix using subspace iteration.
+*
+*   @param A              The symmetric system matrix (sparse or dense)
+*   @param tag            Tag with the number of eigenvalues and convergence criteria
+*   @return               Returns the dominant eigenvalues
+*/
+template<typename MatrixT>
+std::vector< typename viennacl::result_of::cpu_value_type<typename MatrixT::value_type>::type >
+eig(MatrixT const & A, subspace_iter_tag const & tag)
+{
+  typedef typename viennacl::result_of::cpu_value_type<typename MatrixT::value_type>::type  NumericType;
+
+  viennacl::matrix<NumericType> eigenvectors(A.size1(), tag.num_eigenvalues(), viennacl::traits::context(A));
+  return viennacl::linalg::eig(A, eigenvectors, tag);
+}
+
+} // end namespace linalg
+} // end namespace viennacl
+#endif
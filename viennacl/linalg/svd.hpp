@@ -21,26 +21,31 @@
 /** @file viennacl/linalg/svd.hpp
     @brief Provides singular value decomposition using a block-based approach.  Experimental.
 
-    Contributed by Volodymyr Kysenko.
+    Contributed by Volodymyr Kysenko. Host-based implementation and randomized truncated SVD added later.
 */
 
 
-// Note: Boost.uBLAS is required at the moment
-#include <boost/numeric/ublas/vector.hpp>
-#include <boost/numeric/ublas/matrix.hpp>
-
-
 #include <cmath>
+#include <vector>
 
 #include "viennacl/matrix.hpp"
-#include "viennacl/linalg/opencl/kernels/svd.hpp"
 #include "viennacl/linalg/qr-method-common.hpp"
+#include "viennacl/linalg/host_based/svd_operations.hpp"
+#include "viennacl/linalg/randomized_svd.hpp"
+
+#ifdef VIENNACL_WITH_OPENCL
+  // Note: Boost.uBLAS is required for the OpenCL implementation at the moment
+  #include <boost/numeric/ublas/vector.hpp>
+  #include <boost/numeric/ublas/matrix.hpp>
+  #include "viennacl/linalg/opencl/kernels/svd.hpp"
+#endif
 
 namespace viennacl
 {
   namespace linalg
   {
 
+#ifdef VIENNACL_WITH_OPENCL
     namespace detail
     {
 
@@ -479,7 +484,50 @@ namespace viennacl
         }
       }
 
+      /** @brief Computes the singular value decomposition of a matrix A using OpenCL kernels for the bidiagonalization. */
+      template<typename SCALARTYPE, unsigned int ALIGNMENT>
+      void svd_opencl(viennacl::matrix<SCALARTYPE, row_major, ALIGNMENT> & A,
+                      viennacl::matrix<SCALARTYPE, row_major, ALIGNMENT> & QL,
+                      viennacl::matrix<SCALARTYPE, row_major, ALIGNMENT> & QR)
+      {
+        viennacl::ocl::context & ctx = const_cast<viennacl::ocl::context &>(viennacl::traits::opencl_handle(A).context());
+        viennacl::linalg::opencl::kernels::svd<SCALARTYPE>::init(ctx);
+
+        vcl_size_t row_num = A.size1();
+        vcl_size_t col_num = A.size2();
+
+        vcl_size_t to = std::min(row_num, col_num);
+
+
+        //viennacl::vector<SCALARTYPE, ALIGNMENT> d(to);
+        //viennacl::vector<SCALARTYPE, ALIGNMENT> s(to + 1);
+
+        // first stage
+        detail::bidiag(A, QL, QR);
+
+        // second stage
+        //std::vector<SCALARTYPE> dh(to, 0);
+        //std::vector<SCALARTYPE> sh(to + 1, 0);
+        boost::numeric::ublas::vector<SCALARTYPE> dh = boost::numeric::ublas::scalar_vector<SCALARTYPE>(to, 0);
+        boost::numeric::ublas::vector<SCALARTYPE> sh = boost::numeric::ublas::scalar_vector<SCALARTYPE>(to + 1, 0);
+
+
+        viennacl::linalg::opencl::bidiag_pack_svd(A, dh, sh);
+
+        detail::svd_qr_shift( QL, QR, dh, sh);
+
+        // Write resulting diagonal matrix with singular values to A:
+        boost::numeric::ublas::matrix<SCALARTYPE> h_Sigma(row_num, col_num);
+        h_Sigma.clear();
+
+        for (vcl_size_t i = 0; i < to; i++)
+          h_Sigma(i, i) = dh[i];
+
+        copy(h_Sigma, A);
+      }
+
     } // namespace detail
+#endif
 
 
     /** @brief Computes the singular value decomposition of a matrix A. Experimental in 1.3.x
@@ -493,40 +541,45 @@ namespace viennacl
               viennacl::matrix<SCALARTYPE, row_major, ALIGNMENT> & QL,
               viennacl::matrix<SCALARTYPE, row_major, ALIGNMENT> & QR)
     {
-      viennacl::ocl::context & ctx = const_cast<viennacl::ocl::context &>(viennacl::traits::opencl_handle(A).context());
-      viennacl::linalg::opencl::kernels::svd<SCALARTYPE>::init(ctx);
-
-      vcl_size_t row_num = A.size1();
-      vcl_size_t col_num = A.size2();
-
-      vcl_size_t to = std::min(row_num, col_num);
-
-
-      //viennacl::vector<SCALARTYPE, ALIGNMENT> d(to);
-      //viennacl::vector<SCALARTYPE, ALIGNMENT> s(to + 1);
-
-      // first stage
-      detail::bidiag(A, QL, QR);
-
-      // second stage
-      //std::vector<SCALARTYPE> dh(to, 0);
-      //std::vector<SCALARTYPE> sh(to + 1, 0);
-      boost::numeric::ublas::vector<SCALARTYPE> dh = boost::numeric::ublas::scalar_vector<SCALARTYPE>(to, 0);
-      boost::numeric::ublas::vector<SCALARTYPE> sh = boost::numeric::ublas::scalar_vector<SCALARTYPE>(to + 1, 0);
-
-
-      viennacl::linalg::opencl::bidiag_pack_svd(A, dh, sh);
-
-      detail::svd_qr_shift( QL, QR, dh, sh);
-
-      // Write resulting diagonal matrix with singular values to A:
-      boost::numeric::ublas::matrix<SCALARTYPE> h_Sigma(row_num, col_num);
-      h_Sigma.clear();
+      switch (viennacl::traits::handle(A).get_active_handle_id())
+      {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::svd(A, QL, QR);
+          break;
+#ifdef VIENNACL_WITH_OPENCL
+        case viennacl::OPENCL_MEMORY:
+          detail::svd_opencl(A, QL, QR);
+          break;
+#endif
+        case viennacl::MEMORY_NOT_INITIALIZED:
+          throw memory_exception("not initialised!");
+        default:
+          throw memory_exception("not implemented");
+      }
+    }
 
-      for (vcl_size_t i = 0; i < to; i++)
-        h_Sigma(i, i) = dh[i];
 
-      copy(h_Sigma, A);
+    /** @brief Computes the k dominant singular triplets A ~ U diag(sigma) V^T of a matrix A by a randomized range finder with power iterations.
+     *
+     * Convenience wrapper for svd(A, U, sigma, V, randomized_tag(oversampling, power_iterations)) with a Gaussian sketch, cf. viennacl/linalg/randomized_svd.hpp.
+     * The number of triplets k is given by the number of columns of U.
+     *
+     * @param A                 The input matrix. Not modified.
+     * @param U                 The matrix receiving the k left singular vectors as columns (size1(A)-by-k)
+     * @param sigma             The k largest singular values in descending order
+     * @param V                 The matrix receiving the k right singular vectors as columns (size2(A)-by-k)
+     * @param oversampling      Number of additional samples of the range of A. Larger values improve the accuracy.
+     * @param power_iterations  Number of power iterations. Larger values improve the accuracy for slowly decaying singular values.
+     */
+    template<typename NumericT>
+    void svd_truncated(matrix_base<NumericT> const & A,
+                       matrix_base<NumericT> & U,
+                       std::vector<NumericT> & sigma,
+                       matrix_base<NumericT> & V,
+                       vcl_size_t oversampling = 10,
+                       vcl_size_t power_iterations = 2)
+    {
+      viennacl::linalg::svd(A, U, sigma, V, viennacl::linalg::randomized_tag(oversampling, power_iterations));
     }
   }
 }
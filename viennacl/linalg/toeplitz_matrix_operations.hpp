@@ -23,7 +23,9 @@
 */
 
 #include "viennacl/forwards.h"
+#ifdef VIENNACL_WITH_OPENCL
 #include "viennacl/ocl/backend.hpp"
+#endif
 #include "viennacl/scalar.hpp"
 #include "viennacl/vector.hpp"
 #include "viennacl/tools/tools.hpp"
@@ -53,19 +55,27 @@ namespace viennacl
       assert(mat.size1() == result.size());
       assert(mat.size2() == vec.size());
 
-      viennacl::vector<SCALARTYPE> tmp(vec.size() * 4); tmp.clear();
-      viennacl::vector<SCALARTYPE> tmp2(vec.size() * 4);
-
-      viennacl::vector<SCALARTYPE> tep(mat.elements().size() * 2);
-      viennacl::linalg::real_to_complex(mat.elements(), tep, mat.elements().size());
-
+      // product with the circulant embedding of size mat.elements().size():
+      mat.spectrum().prod(mat.elements(), vec, result);
+    }
 
+    /** @brief Carries out the product of a toeplitz_matrix with all columns of a dense matrix
+    *
+    * Implementation of the convenience expression result = prod(mat, B). The spectrum of the matrix is shared by all columns.
+    *
+    * @param mat    The matrix
+    * @param B      The dense matrix
+    * @param result The result matrix
+    */
+    template<class SCALARTYPE, unsigned int ALIGNMENT>
+    void prod_impl(const viennacl::toeplitz_matrix<SCALARTYPE, ALIGNMENT> & mat,
+                   const viennacl::matrix_base<SCALARTYPE> & B,
+                         viennacl::matrix_base<SCALARTYPE> & result)
+    {
+      assert(mat.size1() == result.size1());
+      assert(mat.size2() == B.size1() && B.size2() == result.size2());
 
-      viennacl::copy(vec.begin(), vec.end(), tmp.begin());
-      viennacl::linalg::real_to_complex(tmp, tmp2, vec.size() * 2);
-      viennacl::linalg::convolve(tep, tmp2, tmp);
-      viennacl::linalg::complex_to_real(tmp, tmp2, vec.size() * 2);
-      viennacl::copy(tmp2.begin(), tmp2.begin() + static_cast<vcl_ptrdiff_t>(vec.size()), result.begin());
+      mat.spectrum().prod(mat.elements(), B, result);
     }
 
   } //namespace linalg
@@ -0,0 +1,145 @@
+#ifndef VIENNACL_LINALG_TSQR_HPP
+#define VIENNACL_LINALG_TSQR_HPP
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/linalg/tsqr.hpp
+    @brief QR factorizations of tall and skinny matrices: TSQR and CholeskyQR2.
+
+    Both factorizations overwrite the m-by-n matrix A (m >= n) with the orthonormal factor Q and return the n-by-n upper triangular factor R with nonnegative diagonal.
+    TSQR is unconditionally stable. CholeskyQR2 only needs a symmetric rank-k update and triangular solves with the full matrix and is therefore faster,
+    but requires A to be numerically of full rank (condition number below about 1/sqrt(machine epsilon)).
+*/
+
+#include <vector>
+
+#include "viennacl/forwards.h"
+#include "viennacl/matrix.hpp"
+#include "viennacl/linalg/direct_solve.hpp"
+#include "viennacl/linalg/matrix_operations.hpp"
+#include "viennacl/linalg/host_based/cholesky_operations.hpp"
+#include "viennacl/linalg/host_based/tsqr_operations.hpp"
+
+namespace viennacl
+{
+namespace linalg
+{
+
+/** @brief Computes the QR factorization A = Q R of a tall and skinny matrix by Householder QR factorizations of row blocks, which are combined along a binary reduction tree.
+*
+* Matrices in OpenCL or CUDA memory are factored in host memory.
+*
+* @param A           The m-by-n matrix A with m >= n, overwritten by the factor Q with orthonormal columns
+* @param R           The n-by-n matrix receiving the upper triangular factor R with nonnegative diagonal
+* @param block_rows  Number of rows of the blocks at the leaves of the reduction tree (at least 2n rows are used)
+*/
+template<typename NumericT>
+void tsqr(matrix_base<NumericT> & A, matrix_base<NumericT> & R, vcl_size_t block_rows = VIENNACL_HOST_TSQR_BLOCK_ROWS)
+{
+  assert(A.size1() >= A.size2() && bool("TSQR requires at least as many rows as columns"));
+  assert(R.size1() == A.size2() && R.size2() == A.size2() && bool("Size mismatch of A and R"));
+
+  if (viennacl::traits::handle(A).get_active_handle_id() == viennacl::MAIN_MEMORY && viennacl::traits::handle(R).get_active_handle_id() == viennacl::MAIN_MEMORY)
+    viennacl::linalg::host_based::tsqr(A, R, block_rows);
+  else
+  {
+    viennacl::matrix_base<NumericT> A_host(A);
+    viennacl::matrix_base<NumericT> R_host(R);
+    A_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+    R_host.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+    viennacl::linalg::host_based::tsqr(A_host, R_host, block_rows);
+    A_host.switch_memory_context(viennacl::traits::context(A));
+    R_host.switch_memory_context(viennacl::traits::context(R));
+    A = A_host;
+    R = R_host;
+  }
+}
+
+/** @brief Computes the QR factorization A = Q R of a tall and skinny matrix by two passes of the Cholesky QR algorithm.
+*
+* Each pass computes the Cholesky factorization L L^T = A^T A and replaces A by A L^{-T}. The second pass restores orthogonality lost in the first pass.
+* The rank-k update and the triangular solves operate on A in its memory domain, only the n-by-n Cholesky factorizations are computed in host memory.
+* Throws a zero_on_diagonal_exception if A is numerically rank deficient, in which case tsqr() needs to be used.
+*
+* @param A     The m-by-n matrix A with m >= n, overwritten by the factor Q with orthonormal columns
+* @param R     The n-by-n matrix receiving the upper triangular factor R with nonnegative diagonal
+*/
+template<typename NumericT>
+void cholesky_qr2(matrix_base<NumericT> & A, matrix_base<NumericT> & R)
+{
+  vcl_size_t m = A.size1();
+  vcl_size_t n = A.size2();
+  assert(m >= n && bool("CholeskyQR2 requires at least as many rows as columns"));
+  assert(R.size1() == n && R.size2() == n && bool("Size mismatch of A and R"));
+  if (n == 0)
+    return;
+
+  // A^T sharing the memory of A. Solving L X = A^T in place yields A L^{-T}:
+  viennacl::matrix_base<NumericT> A_trans(A.handle(),
+                                          n, A.start2(), A.stride2(), A.internal_size2(),
+                                          m, A.start1(), A.stride1(), A.internal_size1(),
+                                          !A.row_major());
+
+  viennacl::matrix_base<NumericT> G(n, n, true, viennacl::traits::context(A));
+  std::vector<NumericT> R_buffer(n * n);   // row-major
+  std::vector<NumericT> R_temp(n * n);
+  for (vcl_size_t i = 0; i < n; ++i)
+    R_buffer[i * n + i] = NumericT(1);
+
+  for (vcl_size_t pass = 0; pass < 2; ++pass)
+  {
+    viennacl::linalg::syrk(A, true, G, NumericT(1), NumericT(0));
+
+    viennacl::matrix_base<NumericT> L(G);
+    L.switch_memory_context(viennacl::context(viennacl::MAIN_MEMORY));
+    viennacl::linalg::host_based::cholesky_factorize(L, VIENNACL_HOST_CHOLESKY_BLOCK_SIZE, false);
+
+    // zero the strict upper triangle and accumulate R = L^T R:
+    NumericT * data_L = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(L);
+    vcl_size_t ld = L.internal_size2();
+    for (vcl_size_t i = 0; i < n; ++i)
+      for (vcl_size_t j = i + 1; j < n; ++j)
+        data_L[i * ld + j] = 0;
+
+    for (vcl_size_t i = 0; i < n; ++i)
+      for (vcl_size_t j = i; j < n; ++j)
+      {
+        NumericT sum = 0;
+        for (vcl_size_t k = i; k <= j; ++k)
+          sum += data_L[k * ld + i] * R_buffer[k * n + j];
+        R_temp[i * n + j] = sum;
+      }
+    R_buffer.swap(R_temp);
+
+    L.switch_memory_context(viennacl::traits::context(A));
+    viennacl::linalg::inplace_solve(L, A_trans, viennacl::linalg::lower_tag());
+  }
+
+  viennacl::matrix_base<NumericT> R_host(n, n, R.row_major(), viennacl::context(viennacl::MAIN_MEMORY));
+  NumericT * data_R = viennacl::linalg::host_based::detail::extract_raw_pointer<NumericT>(R_host);
+  for (vcl_size_t i = 0; i < n; ++i)
+    for (vcl_size_t j = 0; j < n; ++j)
+      data_R[R_host.row_major() ? i * R_host.internal_size2() + j : i + j * R_host.internal_size1()] = (j >= i) ? R_buffer[i * n + j] : NumericT(0);
+  R_host.switch_memory_context(viennacl::traits::context(R));
+  R = R_host;
+}
+
+}
+}
+
+#endif
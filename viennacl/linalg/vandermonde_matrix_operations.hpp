@@ -27,7 +27,11 @@
 #include "viennacl/vector.hpp"
 #include "viennacl/tools/tools.hpp"
 #include "viennacl/fft.hpp"
-#include "viennacl/linalg/opencl/vandermonde_matrix_operations.hpp"
+#include "viennacl/linalg/host_based/fft_operations.hpp"
+
+#ifdef VIENNACL_WITH_OPENCL
+  #include "viennacl/linalg/opencl/vandermonde_matrix_operations.hpp"
+#endif
 
 namespace viennacl
 {
@@ -54,14 +58,62 @@ namespace viennacl
 
       switch (viennacl::traits::handle(mat).get_active_handle_id())
       {
+        case viennacl::MAIN_MEMORY:
+          viennacl::linalg::host_based::vandermonde_prod(viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(mat.elements()), 1,
+                                                         viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(vec) + viennacl::traits::start(vec), viennacl::traits::stride(vec), 0,
+                                                         viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(result) + viennacl::traits::start(result), viennacl::traits::stride(result), 0,
+                                                         vec.size(), 1);
+          break;
+#ifdef VIENNACL_WITH_OPENCL
         case viennacl::OPENCL_MEMORY:
           viennacl::linalg::opencl::prod_impl(mat, vec, result);
           break;
+#endif
         default:
           throw std::runtime_error("not implemented");
       }
     }
 
+    /** @brief Carries out the product of a vandermonde_matrix with all columns of a dense matrix
+    *
+    * Implementation of the convenience expression result = prod(mat, B). In host memory, all columns are evaluated in a single sweep over the matrix.
+    *
+    * @param mat    The matrix
+    * @param B      The dense matrix
+    * @param result The result matrix
+    */
+    template<class SCALARTYPE, unsigned int ALIGNMENT>
+    void prod_impl(const viennacl::vandermonde_matrix<SCALARTYPE, ALIGNMENT> & mat,
+                   const viennacl::matrix_base<SCALARTYPE> & B,
+                         viennacl::matrix_base<SCALARTYPE> & result)
+    {
+      assert(mat.size1() == result.size1());
+      assert(mat.size2() == B.size1() && B.size2() == result.size2());
+
+      viennacl::detail::fft::matrix_strides<SCALARTYPE> sb(B);
+      viennacl::detail::fft::matrix_strides<SCALARTYPE> sr(result);
+
+      if (viennacl::traits::handle(mat).get_active_handle_id() == viennacl::MAIN_MEMORY)
+      {
+        viennacl::linalg::host_based::vandermonde_prod(viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(mat.elements()), 1,
+                                                       viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(B) + sb.offset, sb.row_inc, sb.col_inc,
+                                                       viennacl::linalg::host_based::detail::extract_raw_pointer<SCALARTYPE>(result) + sr.offset, sr.row_inc, sr.col_inc,
+                                                       B.size1(), B.size2());
+        return;
+      }
+
+      viennacl::vector<SCALARTYPE> b(B.size1(), viennacl::traits::context(B));
+      viennacl::vector<SCALARTYPE> r(result.size1(), viennacl::traits::context(result));
+      for (vcl_size_t j = 0; j < B.size2(); ++j)
+      {
+        viennacl::vector_base<SCALARTYPE> b_j(const_cast<viennacl::backend::mem_handle &>(B.handle()), B.size1(), sb.offset + j * sb.col_inc, sb.row_inc);
+        viennacl::vector_base<SCALARTYPE> r_j(result.handle(), result.size1(), sr.offset + j * sr.col_inc, sr.row_inc);
+        b = b_j;
+        prod_impl(mat, b, r);
+        r_j = r;
+      }
+    }
+
   } //namespace linalg
 
 
@@ -34,6 +34,7 @@
 #include "viennacl/traits/stride.hpp"
 #include "viennacl/linalg/detail/op_executor.hpp"
 #include "viennacl/linalg/host_based/vector_operations.hpp"
+#include "viennacl/linalg/host_based/fused_operations.hpp"
 
 #ifdef VIENNACL_WITH_OPENCL
   #include "viennacl/linalg/opencl/vector_operations.hpp"
@@ -50,6 +51,114 @@ namespace viennacl
 {
   namespace linalg
   {
+    namespace detail
+    {
+      /** @brief Dispatches vector expressions to the fused host kernels. Expressions which cannot be fused are rejected at compile time, so the fused kernels are only instantiated for supported expressions. */
+      template<bool SupportedV>
+      struct fused_dispatcher
+      {
+        template<typename OpT, typename T, typename ExpressionT>
+        static bool op(vector_base<T> &, ExpressionT const &) { return false; }
+
+        template<typename OpT, typename ReductionT, typename T, typename ExpressionT>
+        static bool op_reduce(vector_base<T> &, ExpressionT const &, T &) { return false; }
+
+        template<typename ReductionT, typename T, typename ExpressionT>
+        static bool reduce(ExpressionT const &, T &) { return false; }
+
+        template<typename T, typename LHS, typename RHS>
+        static bool inner_prod(LHS const &, RHS const &, T &) { return false; }
+      };
+
+      /** \cond */
+      template<>
+      struct fused_dispatcher<true>
+      {
+        template<typename OpT, typename T, typename ExpressionT>
+        static bool op(vector_base<T> & x, ExpressionT const & proxy)
+        {
+          if (!viennacl::linalg::host_based::fused_op_possible(&x, proxy))
+            return false;
+          viennacl::linalg::host_based::fused_op<OpT>(x, proxy);
+          return true;
+        }
+
+        template<typename OpT, typename ReductionT, typename T, typename ExpressionT>
+        static bool op_reduce(vector_base<T> & x, ExpressionT const & proxy, T & result)
+        {
+          if (!viennacl::linalg::host_based::fused_op_possible(&x, proxy))
+            return false;
+          result = viennacl::linalg::host_based::fused_op_reduce<OpT, ReductionT>(x, proxy);
+          return true;
+        }
+
+        template<typename ReductionT, typename T, typename ExpressionT>
+        static bool reduce(ExpressionT const & proxy, T & result)
+        {
+          if (!viennacl::linalg::host_based::fused_op_possible(static_cast<vector_base<T> const *>(NULL), proxy))
+            return false;
+          result = viennacl::linalg::host_based::fused_reduce<ReductionT, T>(proxy);
+          return true;
+        }
+
+        template<typename T, typename LHS, typename RHS>
+        static bool inner_prod(LHS const & lhs, RHS const & rhs, T & result)
+        {
+          if (!viennacl::linalg::host_based::fused_op_possible(static_cast<vector_base<T> const *>(NULL), lhs)
+              || !viennacl::linalg::host_based::fused_op_possible(static_cast<vector_base<T> const *>(NULL), rhs))
+            return false;
+          result = viennacl::linalg::host_based::fused_inner_prod<T>(lhs, rhs);
+          return true;
+        }
+      };
+      /** \endcond */
+
+      /** @brief Evaluates x = proxy, x += proxy or x -= proxy in a single loop if all operands reside in host memory.
+      *
+      * @tparam OpT   One out of {op_assign, op_inplace_add, op_inplace_sub}
+      * @return True if the operation has been carried out. Otherwise x is unchanged and the caller has to fall back to the individual kernels.
+      */
+      template<typename OpT, typename T, typename LHS, typename RHS, typename OP>
+      bool fused_op(vector_base<T> & x, vector_expression<LHS, RHS, OP> const & proxy)
+      {
+        return fused_dispatcher<viennacl::linalg::host_based::fused_expression<T, vector_expression<LHS, RHS, OP> >::supported>::template op<OpT>(x, proxy);
+      }
+
+      /** @brief Evaluates x = proxy, x += proxy or x -= proxy and reduces the updated x in a single loop if all operands reside in host memory.
+      *
+      * @tparam OpT          One out of {op_assign, op_inplace_add, op_inplace_sub}
+      * @tparam ReductionT   One out of {op_sum, op_norm_1, op_norm_2, op_norm_inf}
+      * @return True if the operation has been carried out. Otherwise x and result are unchanged.
+      */
+      template<typename OpT, typename ReductionT, typename T, typename LHS, typename RHS, typename OP>
+      bool fused_op_reduce(vector_base<T> & x, vector_expression<LHS, RHS, OP> const & proxy, T & result)
+      {
+        return fused_dispatcher<viennacl::linalg::host_based::fused_expression<T, vector_expression<LHS, RHS, OP> >::supported>::template op_reduce<OpT, ReductionT>(x, proxy, result);
+      }
+
+      /** @brief Computes a reduction of a vector expression in a single loop without temporaries if all operands reside in host memory.
+      *
+      * @tparam ReductionT   One out of {op_sum, op_norm_1, op_norm_2, op_norm_inf}
+      * @return True if the reduction has been computed. Otherwise result is unchanged.
+      */
+      template<typename ReductionT, typename T, typename LHS, typename RHS, typename OP>
+      bool fused_reduce(vector_expression<LHS, RHS, OP> const & proxy, T & result)
+      {
+        return fused_dispatcher<viennacl::linalg::host_based::fused_expression<T, vector_expression<LHS, RHS, OP> >::supported>::template reduce<ReductionT>(proxy, result);
+      }
+
+      /** @brief Computes the inner product of two vectors or vector expressions in a single loop without temporaries if all operands reside in host memory.
+      *
+      * @return True if the inner product has been computed. Otherwise result is unchanged.
+      */
+      template<typename T, typename LHS, typename RHS>
+      bool fused_inner_prod(LHS const & lhs, RHS const & rhs, T & result)
+      {
+        return fused_dispatcher<   viennacl::linalg::host_based::fused_expression<T, LHS>::supported
+                                && viennacl::linalg::host_based::fused_expression<T, RHS>::supported>::template inner_prod<T>(lhs, rhs, result);
+      }
+    }
+
     template<typename DestNumericT, typename SrcNumericT>
     void convert(vector_base<DestNumericT> & dest, vector_base<SrcNumericT> const & src)
     {
@@ -465,6 +574,13 @@ break;
                          vector_base<T> const & vec2,
                          scalar<T> & result)
     {
+      T value = 0;
+      if (detail::fused_inner_prod(vec1, vec2, value))
+      {
+        result = value;
+        return;
+      }
+
       viennacl::vector<T> temp = vec1;
       inner_prod_impl(temp, vec2, result);
     }
@@ -476,6 +592,13 @@ break;
                          viennacl::vector_expression<LHS, RHS, OP> const & vec2,
                          scalar<T> & result)
     {
+      T value = 0;
+      if (detail::fused_inner_prod(vec1, vec2, value))
+      {
+        result = value;
+        return;
+      }
+
       viennacl::vector<T> temp = vec2;
       inner_prod_impl(vec1, temp, result);
     }
@@ -488,6 +611,13 @@ break;
                          viennacl::vector_expression<LHS2, RHS2, OP2> const & vec2,
                          scalar<T> & result)
     {
+      T value = 0;
+      if (detail::fused_inner_prod(vec1, vec2, value))
+      {
+        result = value;
+        return;
+      }
+
       viennacl::vector<T> temp1 = vec1;
       viennacl::vector<T> temp2 = vec2;
       inner_prod_impl(temp1, temp2, result);
@@ -542,6 +672,9 @@ break;
                         vector_base<T> const & vec2,
                         T & result)
     {
+      if (detail::fused_inner_prod(vec1, vec2, result))
+        return;
+
       viennacl::vector<T> temp = vec1;
       inner_prod_cpu(temp, vec2, result);
     }
@@ -553,6 +686,9 @@ break;
                         viennacl::vector_expression<LHS, RHS, OP> const & vec2,
                         T & result)
     {
+      if (detail::fused_inner_prod(vec1, vec2, result))
+        return;
+
       viennacl::vector<T> temp = vec2;
       inner_prod_cpu(vec1, temp, result);
     }
@@ -565,6 +701,9 @@ break;
                         viennacl::vector_expression<LHS2, RHS2, OP2> const & vec2,
                         S3 & result)
     {
+      if (detail::fused_inner_prod(vec1, vec2, result))
+        return;
+
       viennacl::vector<S3> temp1 = vec1;
       viennacl::vector<S3> temp2 = vec2;
       inner_prod_cpu(temp1, temp2, result);
@@ -651,7 +790,7 @@ break;
     }
 
 
-    /** @brief Computes the l^1-norm of a vector - interface for a vector expression. Creates a temporary.
+    /** @brief Computes the l^1-norm of a vector - interface for a vector expression. Evaluated in a single pass on the host, creates a temporary otherwise.
     *
     * @param vec    The vector expression
     * @param result The result scalar
@@ -660,6 +799,13 @@ break;
     void norm_1_impl(viennacl::vector_expression<LHS, RHS, OP> const & vec,
                      S2 & result)
     {
+      typename viennacl::result_of::cpu_value_type<S2>::type value = 0;
+      if (detail::fused_reduce<op_norm_1>(vec, value))
+      {
+        result = value;
+        return;
+      }
+
       viennacl::vector<typename viennacl::result_of::cpu_value_type<S2>::type> temp = vec;
       norm_1_impl(temp, result);
     }
@@ -702,7 +848,7 @@ break;
       }
     }
 
-    /** @brief Computes the l^1-norm of a vector with final reduction on the CPU - interface for a vector expression. Creates a temporary.
+    /** @brief Computes the l^1-norm of a vector with final reduction on the CPU - interface for a vector expression. Evaluated in a single pass on the host, creates a temporary otherwise.
     *
     * @param vec    The vector expression
     * @param result The result scalar
@@ -711,6 +857,9 @@ break;
     void norm_1_cpu(viennacl::vector_expression<LHS, RHS, OP> const & vec,
                     S2 & result)
     {
+      if (detail::fused_reduce<op_norm_1>(vec, result))
+        return;
+
       viennacl::vector<typename viennacl::result_of::cpu_value_type<LHS>::type> temp = vec;
       norm_1_cpu(temp, result);
     }
@@ -754,7 +903,7 @@ break;
       }
     }
 
-    /** @brief Computes the l^2-norm of a vector - interface for a vector expression. Creates a temporary.
+    /** @brief Computes the l^2-norm of a vector - interface for a vector expression. Evaluated in a single pass on the host, creates a temporary otherwise.
     *
     * @param vec    The vector expression
     * @param result The result scalar
@@ -763,6 +912,13 @@ break;
     void norm_2_impl(viennacl::vector_expression<LHS, RHS, OP> const & vec,
                      scalar<T> & result)
     {
+      T value = 0;
+      if (detail::fused_reduce<op_norm_2>(vec, value))
+      {
+        result = value;
+        return;
+      }
+
       viennacl::vector<T> temp = vec;
       norm_2_impl(temp, result);
     }
@@ -804,7 +960,7 @@ break;
       }
     }
 
-    /** @brief Computes the l^2-norm of a vector with final reduction on the CPU - interface for a vector expression. Creates a temporary.
+    /** @brief Computes the l^2-norm of a vector with final reduction on the CPU - interface for a vector expression. Evaluated in a single pass on the host, creates a temporary otherwise.
     *
     * @param vec    The vector expression
     * @param result The result scalar
@@ -813,6 +969,9 @@ break;
     void norm_2_cpu(viennacl::vector_expression<LHS, RHS, OP> const & vec,
                     S2 & result)
     {
+      if (detail::fused_reduce<op_norm_2>(vec, result))
+        return;
+
       viennacl::vector<typename viennacl::result_of::cpu_value_type<LHS>::type> temp = vec;
       norm_2_cpu(temp, result);
     }
@@ -856,7 +1015,7 @@ break;
       }
     }
 
-    /** @brief Computes the supremum norm of a vector - interface for a vector expression. Creates a temporary.
+    /** @brief Computes the supremum norm of a vector - interface for a vector expression. Evaluated in a single pass on the host, creates a temporary otherwise.
     *
     * @param vec    The vector expression
     * @param result The result scalar
@@ -865,6 +1024,13 @@ break;
     void norm_inf_impl(viennacl::vector_expression<LHS, RHS, OP> const & vec,
                        scalar<T> & result)
     {
+      T value = 0;
+      if (detail::fused_reduce<op_norm_inf>(vec, value))
+      {
+        result = value;
+        return;
+      }
+
       viennacl::vector<T> temp = vec;
       norm_inf_impl(temp, result);
     }
@@ -906,7 +1072,7 @@ break;
       }
     }
 
-    /** @brief Computes the supremum norm of a vector with final reduction on the CPU - interface for a vector expression. Creates a temporary.
+    /** @brief Computes the supremum norm of a vector with final reduction on the CPU - interface for a vector expression. Evaluated in a single pass on the host, creates a temporary otherwise.
     *
     * @param vec    The vector expression
     * @param result The result scalar
@@ -915,6 +1081,9 @@ break;
     void norm_inf_cpu(viennacl::vector_expression<LHS, RHS, OP> const & vec,
                       S2 & result)
     {
+      if (detail::fused_reduce<op_norm_inf>(vec, result))
+        return;
+
       viennacl::vector<typename viennacl::result_of::cpu_value_type<LHS>::type> temp = vec;
       norm_inf_cpu(temp, result);
     }
@@ -1192,7 +1361,7 @@ break;
       }
     }
 
-    /** @brief Computes the sum of a vector with final reduction on the CPU - interface for a vector expression. Creates a temporary.
+    /** @brief Computes the sum of a vector with final reduction on the CPU - interface for a vector expression. Evaluated in a single pass on the host, creates a temporary otherwise.
     *
     * @param vec    The vector expression
     * @param result The result scalar
@@ -1200,6 +1369,13 @@ break;
     template<typename LHS, typename RHS, typename OP, typename NumericT>
     void sum_impl(viennacl::vector_expression<LHS, RHS, OP> const & vec, viennacl::scalar<NumericT> & result)
     {
+      NumericT value = 0;
+      if (detail::fused_reduce<op_sum>(vec, value))
+      {
+        result = value;
+        return;
+      }
+
       viennacl::vector<NumericT> temp = vec;
       sum_impl(temp, result);
     }
@@ -1240,7 +1416,7 @@ break;
       }
     }
 
-    /** @brief Computes the sum of a vector with final reduction on the CPU - interface for a vector expression. Creates a temporary.
+    /** @brief Computes the sum of a vector with final reduction on the CPU - interface for a vector expression. Evaluated in a single pass on the host, creates a temporary otherwise.
     *
     * @param vec    The vector expression
     * @param result The result scalar
@@ -1248,11 +1424,114 @@ break;
     template<typename LHS, typename RHS, typename OP, typename S2>
     void sum_cpu(viennacl::vector_expression<LHS, RHS, OP> const & vec, S2 & result)
     {
+      if (detail::fused_reduce<op_sum>(vec, result))
+        return;
+
       viennacl::vector<typename viennacl::result_of::cpu_value_type<LHS>::type> temp = vec;
       sum_cpu(temp, result);
     }
 
 
+    /** @brief Assigns a vector expression to a vector and returns the l^1-norm of the result, e.g. for a residual r = b - prod(A, x). Evaluated in a single pass on the host.
+    *
+    * @param vec    The result vector (or -range, or -slice)
+    * @param proxy  The vector expression
+    */
+    template<typename T, typename LHS, typename RHS, typename OP>
+    T assign_norm_1(vector_base<T> & vec, vector_expression<const LHS, const RHS, OP> const & proxy)
+    {
+      T result = 0;
+      if (detail::fused_op_reduce<op_assign, op_norm_1>(vec, proxy, result))
+        return result;
+
+      vec = proxy;
+      norm_1_cpu(vec, result);
+      return result;
+    }
+
+    /** @brief Assigns a vector expression to a vector and returns the l^2-norm of the result, e.g. for a residual r = b - prod(A, x). Evaluated in a single pass on the host.
+    *
+    * @param vec    The result vector (or -range, or -slice)
+    * @param proxy  The vector expression
+    */
+    template<typename T, typename LHS, typename RHS, typename OP>
+    T assign_norm_2(vector_base<T> & vec, vector_expression<const LHS, const RHS, OP> const & proxy)
+    {
+      T result = 0;
+      if (detail::fused_op_reduce<op_assign, op_norm_2>(vec, proxy, result))
+        return result;
+
+      vec = proxy;
+      norm_2_cpu(vec, result);
+      return result;
+    }
+
+    /** @brief Assigns a vector expression to a vector and returns the supremum-norm of the result, e.g. for a residual r = b - prod(A, x). Evaluated in a single pass on the host.
+    *
+    * @param vec    The result vector (or -range, or -slice)
+    * @param proxy  The vector expression
+    */
+    template<typename T, typename LHS, typename RHS, typename OP>
+    T assign_norm_inf(vector_base<T> & vec, vector_expression<const LHS, const RHS, OP> const & proxy)
+    {
+      T result = 0;
+      if (detail::fused_op_reduce<op_assign, op_norm_inf>(vec, proxy, result))
+        return result;
+
+      vec = proxy;
+      norm_inf_cpu(vec, result);
+      return result;
+    }
+
+
+    /** @brief Evaluates all reductions of a reduction_list, e.g. reduction_list<T>().inner_prod(x, y).norm_2(r).norm_inf(z).sum(w)
+    *
+    * On the host, all reductions are computed in a single pass over the vectors and the partial results are combined in a fixed tree order, so the results do not depend on the number of threads.
+    * For the other compute backends the reductions are evaluated one after another.
+    *
+    * @param reductions  The reductions. All vectors need to have the same size.
+    * @return The results in the order in which the reductions were added to the list
+    */
+    template<typename T>
+    std::vector<T> reduce_many(reduction_list<T> const & reductions)
+    {
+      std::vector<T> results(reductions.size());
+      if (reductions.size() == 0)
+        return results;
+
+      viennacl::memory_types handle_id = viennacl::traits::handle(reductions.lhs(0)).get_active_handle_id();
+      bool same_memory = true;
+      for (vcl_size_t i=0; i<reductions.size(); ++i)
+      {
+        assert( reductions.lhs(i).size() == reductions.lhs(0).size() && bool("Size mismatch") );
+        assert( reductions.rhs(i).size() == reductions.lhs(0).size() && bool("Size mismatch") );
+        same_memory = same_memory && viennacl::traits::handle(reductions.lhs(i)).get_active_handle_id() == handle_id
+                                  && viennacl::traits::handle(reductions.rhs(i)).get_active_handle_id() == handle_id;
+      }
+
+      if (handle_id == viennacl::MAIN_MEMORY && same_memory)
+      {
+        viennacl::linalg::host_based::reduce_many_impl(reductions, results);
+        return results;
+      }
+
+      for (vcl_size_t i=0; i<reductions.size(); ++i)
+      {
+        switch (reductions.type(i))
+        {
+          case viennacl::REDUCTION_INNER_PROD: inner_prod_cpu(reductions.lhs(i), reductions.rhs(i), results[i]); break;
+          case viennacl::REDUCTION_NORM_1:     norm_1_cpu(reductions.lhs(i), results[i]); break;
+          case viennacl::REDUCTION_NORM_2:     norm_2_cpu(reductions.lhs(i), results[i]); break;
+          case viennacl::REDUCTION_NORM_INF:   norm_inf_cpu(reductions.lhs(i), results[i]); break;
+          case viennacl::REDUCTION_MAX:        max_cpu(reductions.lhs(i), results[i]); break;
+          case viennacl::REDUCTION_MIN:        min_cpu(reductions.lhs(i), results[i]); break;
+          case viennacl::REDUCTION_SUM:        sum_cpu(reductions.lhs(i), results[i]); break;
+        }
+      }
+      return results;
+    }
+
+
 
 
 
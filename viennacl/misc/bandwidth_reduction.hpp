@@ -20,17 +20,78 @@
 
 
 /** @file viennacl/misc/bandwidth_reduction.hpp
-    @brief Convenience include for bandwidth reduction algorithms such as Cuthill-McKee or Gibbs-Poole-Stockmeyer.  Experimental.
+    @brief Convenience include for bandwidth reduction algorithms such as Cuthill-McKee or Gibbs-Poole-Stockmeyer as well as for nested dissection.  Experimental.
 */
 
+#include <vector>
+
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/vector.hpp"
 #include "viennacl/misc/cuthill_mckee.hpp"
 #include "viennacl/misc/gibbs_poole_stockmeyer.hpp"
+#include "viennacl/misc/nested_dissection.hpp"
+#include "viennacl/linalg/host_based/reorder_operations.hpp"
 
 
 namespace viennacl
 {
   //TODO: Add convenience overload here. Which should be default?
 
+  /** @brief Applies a permutation obtained from reorder() to a sparse matrix, i.e. returns B with B(r[i], r[j]) = A(i, j).
+   *
+   * The rows are relabeled in parallel on the host, matrices outside host memory are temporarily copied to the host.
+   * The result resides in the same memory domain as A.
+   *
+   * @param A   The sparse matrix
+   * @param r   Permutation vector, where r[i] is the new label of node i
+   */
+  template<typename NumericT, unsigned int AlignmentV>
+  viennacl::compressed_matrix<NumericT, AlignmentV> permute(viennacl::compressed_matrix<NumericT, AlignmentV> const & A, std::vector<unsigned int> const & r)
+  {
+    viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+    viennacl::compressed_matrix<NumericT, AlignmentV> A_host(0, 0, 0, host_ctx);
+    viennacl::compressed_matrix<NumericT, AlignmentV> B(0, 0, 0, host_ctx);
+    viennacl::linalg::host_based::permute(detail::host_matrix(A, A_host), r, B);
+
+    B.switch_memory_context(viennacl::traits::context(A));
+    return B;
+  }
+
+  /** @brief Applies a permutation obtained from reorder() to a vector, i.e. returns y with y[r[i]] = x[i].
+   *
+   * @param x   The vector, e.g. a right hand side for a permuted system matrix
+   * @param r   Permutation vector, where r[i] is the new index of entry i
+   */
+  template<typename NumericT>
+  viennacl::vector<NumericT> permute(viennacl::vector_base<NumericT> const & x, std::vector<unsigned int> const & r)
+  {
+    viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+    viennacl::vector<NumericT> x_host(x);
+    viennacl::vector<NumericT> y(x.size(), host_ctx);
+    x_host.switch_memory_context(host_ctx);
+    viennacl::linalg::host_based::permute(x_host, r, y);
+
+    y.switch_memory_context(viennacl::traits::context(x));
+    return y;
+  }
+
+  /** @brief Undoes a permutation obtained from reorder() for a vector, i.e. returns x with x[i] = y[r[i]].
+   *
+   * @param y   The permuted vector, e.g. the solution of a permuted system
+   * @param r   Permutation vector, where r[i] is the new index of entry i
+   */
+  template<typename NumericT>
+  viennacl::vector<NumericT> inverse_permute(viennacl::vector_base<NumericT> const & y, std::vector<unsigned int> const & r)
+  {
+    viennacl::context host_ctx(viennacl::MAIN_MEMORY);
+    viennacl::vector<NumericT> y_host(y);
+    viennacl::vector<NumericT> x(y.size(), host_ctx);
+    y_host.switch_memory_context(host_ctx);
+    viennacl::linalg::host_based::inverse_permute(y_host, r, x);
+
+    x.switch_memory_context(viennacl::traits::context(y));
+    return x;
+  }
 
 } //namespace viennacl
 
@@ -36,6 +36,8 @@
 #include <cmath>
 
 #include "viennacl/forwards.h"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/linalg/host_based/reorder_operations.hpp"
 
 namespace viennacl
 {
@@ -605,6 +607,55 @@ std::vector<IndexT> reorder(std::vector< std::map<IndexT, ValueT> > const & matr
 }
 
 
+//
+// Part 3: Cuthill-McKee for compressed_matrix
+//
+
+/** @brief A tag class for selecting the reverse Cuthill-McKee algorithm, which yields the same bandwidth as the Cuthill-McKee algorithm but usually a smaller profile. */
+struct reverse_cuthill_mckee_tag {};
+
+namespace detail
+{
+  /** @brief Returns a copy of a compressed_matrix in host memory, or the matrix itself if it already resides in host memory. */
+  template<typename NumericT, unsigned int AlignmentV>
+  viennacl::compressed_matrix<NumericT, AlignmentV> const & host_matrix(viennacl::compressed_matrix<NumericT, AlignmentV> const & A,
+                                                                        viennacl::compressed_matrix<NumericT, AlignmentV> & A_host)
+  {
+    if (viennacl::traits::active_handle_id(A) == viennacl::MAIN_MEMORY)
+      return A;
+
+    A_host = A;
+    return A_host;
+  }
+}
+
+/** @brief Function for the calculation of a node number permutation to reduce the bandwidth of a sparse matrix by the Cuthill-McKee algorithm
+ *
+ * Works directly on the CSR arrays: Each connected component is started from a pseudo-peripheral node, and the level sets are ordered in parallel (cf. viennacl::linalg::host_based::cuthill_mckee()).
+ * Matrices outside host memory are temporarily copied to the host.
+ *
+ * @param A   The sparse matrix with structurally symmetric pattern
+ * @return permutation vector r. r[i] = l means that the new label of node i will be l.
+ */
+template<typename NumericT, unsigned int AlignmentV>
+std::vector<unsigned int> reorder(viennacl::compressed_matrix<NumericT, AlignmentV> const & A, cuthill_mckee_tag)
+{
+  viennacl::compressed_matrix<NumericT, AlignmentV> A_host(0, 0, 0, viennacl::context(viennacl::MAIN_MEMORY));
+  return viennacl::linalg::host_based::cuthill_mckee(detail::host_matrix(A, A_host), false);
+}
+
+/** @brief Function for the calculation of a node number permutation to reduce the bandwidth and the profile of a sparse matrix by the reverse Cuthill-McKee algorithm
+ *
+ * @param A   The sparse matrix with structurally symmetric pattern
+ * @return permutation vector r. r[i] = l means that the new label of node i will be l.
+ */
+template<typename NumericT, unsigned int AlignmentV>
+std::vector<unsigned int> reorder(viennacl::compressed_matrix<NumericT, AlignmentV> const & A, reverse_cuthill_mckee_tag)
+{
+  viennacl::compressed_matrix<NumericT, AlignmentV> A_host(0, 0, 0, viennacl::context(viennacl::MAIN_MEMORY));
+  return viennacl::linalg::host_based::cuthill_mckee(detail::host_matrix(A, A_host), true);
+}
+
 } //namespace viennacl
 
 
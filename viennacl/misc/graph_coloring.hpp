@@ -0,0 +1,90 @@
+#ifndef VIENNACL_MISC_GRAPH_COLORING_HPP
+#define VIENNACL_MISC_GRAPH_COLORING_HPP
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** @file viennacl/misc/graph_coloring.hpp
+ *  @brief Implementation of parallel graph colorings of sparse matrices and of the multicolor ordering.  Experimental.
+ */
+
+#include <vector>
+
+#include "viennacl/forwards.h"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/misc/cuthill_mckee.hpp"
+#include "viennacl/linalg/host_based/coloring_operations.hpp"
+
+namespace viennacl
+{
+
+/** @brief Tag for graph colorings and for the multicolor ordering */
+class graph_coloring_tag
+{
+public:
+  /** @brief CTOR
+   *
+   * @param distance   1 for a distance-1 coloring (adjacent nodes have different colors), 2 for a distance-2 coloring (nodes with a common neighbor have different colors as well)
+   */
+  graph_coloring_tag(vcl_size_t distance = 1) : distance_(distance) {}
+
+  /** @brief Returns the distance up to which nodes have different colors */
+  vcl_size_t distance() const { return distance_; }
+  /** @brief Sets the distance up to which nodes have different colors. Only 1 and 2 are supported. */
+  void distance(vcl_size_t d) { if (d == 1 || d == 2) distance_ = d; }
+
+private:
+  vcl_size_t distance_;
+};
+
+/** @brief Computes a coloring of the adjacency graph of a sparse matrix such that nodes with the same color are not coupled
+ *
+ * Uses the Jones-Plassmann algorithm, which colors independent sets of nodes in parallel (cf. viennacl::linalg::host_based::jones_plassmann_coloring()). The result does not depend on the number of threads.
+ * Matrices outside host memory are temporarily copied to the host.
+ * For nonsymmetric patterns, the adjacency graph of A + A^T is colored, so that nodes i and k have different colors if a_ik != 0 or a_ki != 0.
+ *
+ * @param A     The sparse matrix
+ * @param tag   Parameters of the coloring
+ * @return The colors 0, 1, ... of the nodes
+ */
+template<typename NumericT, unsigned int AlignmentV>
+std::vector<unsigned int> color(viennacl::compressed_matrix<NumericT, AlignmentV> const & A, graph_coloring_tag const & tag)
+{
+  viennacl::compressed_matrix<NumericT, AlignmentV> A_host(0, 0, 0, viennacl::context(viennacl::MAIN_MEMORY));
+  return viennacl::linalg::host_based::jones_plassmann_coloring(detail::host_matrix(A, A_host), tag.distance());
+}
+
+/** @brief Function for the calculation of a node number permutation which numbers the nodes color by color (multicolor ordering)
+ *
+ * For a distance-1 coloring the diagonal blocks of the reordered matrix are diagonal, hence all unknowns of one color can be updated in parallel in Gauss-Seidel sweeps, factorizations and triangular solves.
+ *
+ * @param A     The sparse matrix
+ * @param tag   Parameters of the coloring
+ * @return permutation vector r. r[i] = l means that the new label of node i will be l.
+ */
+template<typename NumericT, unsigned int AlignmentV>
+std::vector<unsigned int> reorder(viennacl::compressed_matrix<NumericT, AlignmentV> const & A, graph_coloring_tag const & tag)
+{
+  std::vector<unsigned int> color_ptr;
+  return viennacl::linalg::host_based::multicolor_permutation(viennacl::color(A, tag), color_ptr);
+}
+
+} //namespace viennacl
+
+
+#endif
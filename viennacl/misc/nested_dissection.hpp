@@ -0,0 +1,75 @@
+#ifndef VIENNACL_MISC_NESTED_DISSECTION_HPP
+#define VIENNACL_MISC_NESTED_DISSECTION_HPP
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+
+/** @file viennacl/misc/nested_dissection.hpp
+ *  @brief Implementation of a nested dissection ordering for reducing the fill-in of sparse factorizations.  Experimental.
+ */
+
+#include <vector>
+
+#include "viennacl/forwards.h"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/misc/cuthill_mckee.hpp"
+#include "viennacl/linalg/host_based/reorder_operations.hpp"
+
+namespace viennacl
+{
+
+/** @brief Tag for the nested dissection ordering */
+class nested_dissection_tag
+{
+public:
+  /** @brief CTOR
+   *
+   * @param leaf_size   Subgraphs with at most this number of nodes are not dissected any further
+   */
+  nested_dissection_tag(vcl_size_t leaf_size = 64) : leaf_size_(leaf_size) {}
+
+  /** @brief Returns the maximum number of nodes of a subgraph which is not dissected any further */
+  vcl_size_t leaf_size() const { return leaf_size_; }
+  /** @brief Sets the maximum number of nodes of a subgraph which is not dissected any further */
+  void leaf_size(vcl_size_t s) { leaf_size_ = s; }
+
+private:
+  vcl_size_t leaf_size_;
+};
+
+/** @brief Function for the calculation of a node number permutation to reduce the fill-in of factorizations of a sparse matrix by nested dissection
+ *
+ * The adjacency graph is split recursively by level set separators obtained from breadth-first searches rooted at pseudo-peripheral nodes.
+ * Separators are numbered after the two subgraphs they separate, the subgraphs on each level of the recursion are processed in parallel (cf. viennacl::linalg::host_based::nested_dissection()).
+ * Matrices outside host memory are temporarily copied to the host.
+ *
+ * @param A     The sparse matrix with structurally symmetric pattern
+ * @param tag   Parameters of the dissection
+ * @return permutation vector r. r[i] = l means that the new label of node i will be l.
+ */
+template<typename NumericT, unsigned int AlignmentV>
+std::vector<unsigned int> reorder(viennacl::compressed_matrix<NumericT, AlignmentV> const & A, nested_dissection_tag const & tag)
+{
+  viennacl::compressed_matrix<NumericT, AlignmentV> A_host(0, 0, 0, viennacl::context(viennacl::MAIN_MEMORY));
+  return viennacl::linalg::host_based::nested_dissection(detail::host_matrix(A, A_host), tag.leaf_size());
+}
+
+} //namespace viennacl
+
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef VIENNACL_PERMUTED_MATRIX_HPP_
+#define VIENNACL_PERMUTED_MATRIX_HPP_
+
+/* =========================================================================
+   Copyright (c) 2010-2015, Institute for Microelectronics,
+                            Institute for Analysis and Scientific Computing,
+                            TU Wien.
+   Portions of this software are copyright by UChicago Argonne, LLC.
+
+                            -----------------
+                  ViennaCL - The Vienna Computing Library
+                            -----------------
+
+   Project Head:    Karl Rupp                   rupp@iue.tuwien.ac.at
+
+   (A list of authors and contributors can be found in the manual)
+
+   License:         MIT (X11), see file LICENSE in the base directory
+============================================================================= */
+
+/** @file viennacl/permuted_matrix.hpp
+    @brief Implementation of the permuted_matrix class, which stores a sparse matrix in a locality-improving ordering. Experimental.
+*/
+
+#include <vector>
+
+#include "viennacl/forwards.h"
+#include "viennacl/vector.hpp"
+#include "viennacl/compressed_matrix.hpp"
+#include "viennacl/misc/bandwidth_reduction.hpp"
+#include "viennacl/linalg/host_based/reorder_operations.hpp"
+#include "viennacl/linalg/cg.hpp"
+#include "viennacl/linalg/bicgstab.hpp"
+#include "viennacl/linalg/gmres.hpp"
+
+namespace viennacl
+{
+
+/** @brief A sparse matrix stored in a reordered numbering of the unknowns, e.g. the reverse Cuthill-McKee ordering.
+*
+* Sparse matrix-vector products with matrices from unstructured meshes gather the entries of the vector from all over memory.
+* A bandwidth-reducing ordering keeps the accessed entries close together, which improves cache reuse.
+* The calls to solve() permute the right hand side into the internal ordering, run the solver and the preconditioner entirely in the internal ordering,
+* and permute the solution back to the original ordering. Preconditioners need to be set up for the internal matrix().
+*
+* @tparam NumericT     The floating point type (either float or double, checked at compile time)
+* @tparam AlignmentV   The internal memory size for the entries in each row is given by (size()/AlignmentV + 1) * AlignmentV. AlignmentV must be a power of two.
+*/
+template<typename NumericT, unsigned int AlignmentV /* see forwards.h for default argument */>
+class permuted_matrix
+{
+public:
+  typedef viennacl::compressed_matrix<NumericT, AlignmentV>   matrix_type;
+
+  /** @brief Reorders the matrix using the reverse Cuthill-McKee algorithm */
+  explicit permuted_matrix(matrix_type const & A)
+    : permutation_(viennacl::reorder(A, viennacl::reverse_cuthill_mckee_tag())), matrix_(viennacl::permute(A, permutation_)) {}
+
+  /** @brief Reorders the matrix using the reordering algorithm specified by the tag, e.g. cuthill_mckee_tag or nested_dissection_tag */
+  template<typename ReorderTagT>
+  permuted_matrix(matrix_type const & A, ReorderTagT const & tag)
+    : permutation_(viennacl::reorder(A, tag)), matrix_(viennacl::permute(A, permutation_)) {}
+
+  /** @brief Reorders the matrix using a user-supplied permutation, e.g. a space-filling curve ordering of the mesh nodes.
+  *
+  * @param A   The sparse matrix
+  * @param r   Permutation vector, where r[i] is the new index of unknown i
+  */
+  permuted_matrix(matrix_type const & A, std::vector<unsigned int> const & r)
+    : permutation_(r), matrix_(viennacl::permute(A, permutation_)) {}
+
+  vcl_size_t size1() const { return matrix_.size1(); }
+  vcl_size_t size2() const { return matrix_.size2(); }
+  vcl_size_t nnz() const { return matrix_.nnz(); }
+
+  /** @brief Returns the reordered matrix B with B(r[i], r[j]) = A(i, j) */
+  matrix_type const & matrix() const { return matrix_; }
+
+  /** @brief Returns the permutation vector, where r[i] is the new index of unknown i */
+  std::vector<unsigned int> const & permutation() const { return permutation_; }
+
+  /** @brief Permutes a vector from the original ordering into the internal ordering, i.e. y[r[i]] = x[i] */
+  void permute(viennacl::vector_base<NumericT> const & x, viennacl::vector_base<NumericT> & y) const
+  {
+    if (viennacl::traits::active_handle_id(x) == viennacl::MAIN_MEMORY && viennacl::traits::active_handle_id(y) == viennacl::MAIN_MEMORY)
+      viennacl::linalg::host_based::permute(x, permutation_, y);
+    else
+      y = viennacl::permute(x, permutation_);
+  }
+
+  /** @brief Permutes a vector from the internal ordering back to the original ordering, i.e. x[i] = y[r[i]] */
+  void inverse_permute(viennacl::vector_base<NumericT> const & y, viennacl::vector_base<NumericT> & x) const
+  {
+    if (viennacl::traits::active_handle_id(x) == viennacl::MAIN_MEMORY && viennacl::traits::active_handle_id(y) == viennacl::MAIN_MEMORY)
+      viennacl::linalg::host_based::inverse_permute(y, permutation_, x);
+    else
+      x = viennacl::inverse_permute(y, permutation_);
+  }
+
+private:
+  std::vector<unsigned int> permutation_;
+  matrix_type matrix_;
+};
+
+
+namespace linalg
+{
+
+namespace detail
+{
+  /** @brief Solves the system in the internal ordering of the permuted matrix and returns the solution in the original ordering */
+  template<typename NumericT, unsigned int AlignmentV, typename SolverTagT, typename PreconditionerT>
+  viennacl::vector<NumericT> permuted_solve(viennacl::permuted_matrix<NumericT, AlignmentV> const & A, viennacl::vector<NumericT> const & rhs,
+                                            SolverTagT const & tag, PreconditionerT const & precond)
+  {
+    viennacl::vector<NumericT> permuted_rhs(rhs.size(), viennacl::traits::context(rhs));
+    A.permute(rhs, permuted_rhs);
+
+    viennacl::vector<NumericT> permuted_result = viennacl::linalg::solve(A.matrix(), permuted_rhs, tag, precond);
+
+    viennacl::vector<NumericT> result(rhs.size(), viennacl::traits::context(rhs));
+    A.inverse_permute(permuted_result, result);
+    return result;
+  }
+}
+
+/** @brief Solves a system with a permuted matrix using the conjugate gradient method. The preconditioner needs to be set up for A.matrix(). */
+template<typename NumericT, unsigned int AlignmentV, typename PreconditionerT>
+viennacl::vector<NumericT> solve(viennacl::permuted_matrix<NumericT, AlignmentV> const & A, viennacl::vector<NumericT> const & rhs, cg_tag const & tag, PreconditionerT const & precond)
+{
+  return detail::permuted_solve(A, rhs, tag, precond);
+}
+
+/** @brief Solves a system with a permuted matrix using the unpreconditioned conjugate gradient method. */
+template<typename NumericT, unsigned int AlignmentV>
+viennacl::vector<NumericT> solve(viennacl::permuted_matrix<NumericT, AlignmentV> const & A, viennacl::vector<NumericT> const & rhs, cg_tag const & tag)
+{
+  return detail::permuted_solve(A, rhs, tag, viennacl::linalg::no_precond());
+}
+
+/** @brief Solves a system with a permuted matrix using the stabilized bi-conjugate gradient method. The preconditioner needs to be set up for A.matrix(). */
+template<typename NumericT, unsigned int AlignmentV, typename PreconditionerT>
+viennacl::vector<NumericT> solve(viennacl::permuted_matrix<NumericT, AlignmentV> const & A, viennacl::vector<NumericT> const & rhs, bicgstab_tag const & tag, PreconditionerT const & precond)
+{
+  return detail::permuted_solve(A, rhs, tag, precond);
+}
+
+/** @brief Solves a system with a permuted matrix using the unpreconditioned stabilized bi-conjugate gradient method. */
+template<typename NumericT, unsigned int AlignmentV>
+viennacl::vector<NumericT> solve(viennacl::permuted_matrix<NumericT, AlignmentV> const & A, viennacl::vector<NumericT> const & rhs, bicgstab_tag const & tag)
+{
+  return detail::permuted_solve(A, rhs, tag, viennacl::linalg::no_precond());
+}
+
+/** @brief Solves a system with a permuted matrix using the GMRES method. The preconditioner needs to be set up for A.matrix(). */
+template<typename NumericT, unsigned int AlignmentV, typename PreconditionerT>
+viennacl::vector<NumericT> solve(viennacl::permuted_matrix<NumericT, AlignmentV> const & A, viennacl::vector<NumericT> const & rhs, gmres_tag const & tag, PreconditionerT const & precond)
+{
+  return detail::permuted_solve(A, rhs, tag, precond);
+}
+
+/** @brief Solves a system with a permuted matrix using the unpreconditioned GMRES method. */
+template<typename NumericT, unsigned int AlignmentV>
+viennacl::vector<NumericT> solve(viennacl::permuted_matrix<NumericT, AlignmentV> const & A, viennacl::vector<NumericT> const & rhs, gmres_tag const & tag)
+{
+  return detail::permuted_solve(A, rhs, tag, viennacl::linalg::no_precond());
+}
+
+} //namespace linalg
+} //namespace viennacl
+
+#endif
@@ -261,16 +261,16 @@ viennacl::memory_types active_handle_id(T const & obj)
 
 /** \cond */
 template<typename T>
-viennacl::memory_types active_handle_id(circulant_matrix<T> const &) { return OPENCL_MEMORY; }
+viennacl::memory_types active_handle_id(circulant_matrix<T> const & obj) { return obj.elements().handle().get_active_handle_id(); }
 
 template<typename T>
-viennacl::memory_types active_handle_id(hankel_matrix<T> const &) { return OPENCL_MEMORY; }
+viennacl::memory_types active_handle_id(hankel_matrix<T> const & obj) { return obj.elements().elements().handle().get_active_handle_id(); }
 
 template<typename T>
-viennacl::memory_types active_handle_id(toeplitz_matrix<T> const &) { return OPENCL_MEMORY; }
+viennacl::memory_types active_handle_id(toeplitz_matrix<T> const & obj) { return obj.elements().handle().get_active_handle_id(); }
 
 template<typename T>
-viennacl::memory_types active_handle_id(vandermonde_matrix<T> const &) { return OPENCL_MEMORY; }
+viennacl::memory_types active_handle_id(vandermonde_matrix<T> const & obj) { return obj.elements().handle().get_active_handle_id(); }
 
 template<typename LHS, typename RHS, typename OP>
 viennacl::memory_types active_handle_id(viennacl::vector_expression<LHS, RHS, OP> const &);
@@ -26,7 +26,9 @@
 
 #include "viennacl/forwards.h"
 #include "viennacl/vector.hpp"
+#ifdef VIENNACL_WITH_OPENCL
 #include "viennacl/ocl/backend.hpp"
+#endif
 
 #include "viennacl/fft.hpp"
 
@@ -333,6 +335,24 @@ namespace detail
     }
   };
 
+  // C = A * B
+  template<typename T, unsigned int A>
+  struct op_executor<matrix_base<T>, op_assign, matrix_expression<const vandermonde_matrix<T, A>, const matrix_base<T>, op_prod> >
+  {
+    static void apply(matrix_base<T> & lhs, matrix_expression<const vandermonde_matrix<T, A>, const matrix_base<T>, op_prod> const & rhs)
+    {
+      // check for the special case B = A * B
+      if (viennacl::traits::handle(lhs) == viennacl::traits::handle(rhs.rhs()))
+      {
+        viennacl::matrix<T> temp(lhs.size1(), lhs.size2(), viennacl::traits::context(lhs));
+        viennacl::linalg::prod_impl(rhs.lhs(), rhs.rhs(), temp);
+        lhs = temp;
+      }
+      else
+        viennacl::linalg::prod_impl(rhs.lhs(), rhs.rhs(), lhs);
+    }
+  };
+
 } // namespace detail
 } // namespace linalg
 
@@ -287,12 +287,14 @@ vector_base<NumericT, SizeT, DistanceT>::vector_base(NumericT * ptr_to_mem, vien
     elements_.ram_handle().reset(reinterpret_cast<char*>(ptr_to_mem));
     elements_.ram_handle().inc(); //prevents that the user-provided memory is deleted once the vector object is destroyed.
   }
+#ifdef VIENNACL_WITH_HSA
   else if (mem_type == viennacl::HSA_MEMORY)
   {
 	elements_.switch_active_handle_id(viennacl::HSA_MEMORY);
 	elements_.hsa_handle().reset(reinterpret_cast<char*>(ptr_to_mem));
 	elements_.hsa_handle().inc(); //prevents that the user-provided memory is deleted once the vector object is destroyed.
   }
+#endif
 
   elements_.raw_size(sizeof(NumericT) * vec_size);
 
@@ -1220,6 +1222,56 @@ vector_tuple<ScalarT> tie(vector_base<ScalarT> & v0,
 
 // TODO: Add more arguments to tie() here. Maybe use some preprocessor magic to accomplish this.
 
+/** @brief A list of reductions over vectors of the same size, evaluated together by viennacl::linalg::reduce_many().
+*
+* Entries are added by chaining, e.g. reduction_list<T>().inner_prod(x, y).norm_2(r).norm_inf(z).sum(w)
+* The list only holds pointers to the vectors, which thus need to be alive when the reductions are evaluated.
+*/
+template<typename ScalarT>
+class reduction_list
+{
+  typedef vector_base<ScalarT>   VectorType;
+
+public:
+  /** @brief Adds the inner product <x, y> */
+  reduction_list & inner_prod(VectorType const & x, VectorType const & y) { return add(REDUCTION_INNER_PROD, x, y); }
+  /** @brief Adds the l^1-norm of x */
+  reduction_list & norm_1(VectorType const & x)   { return add(REDUCTION_NORM_1, x, x); }
+  /** @brief Adds the l^2-norm of x */
+  reduction_list & norm_2(VectorType const & x)   { return add(REDUCTION_NORM_2, x, x); }
+  /** @brief Adds the supremum-norm of x, i.e. the maximum of the absolute values of its entries */
+  reduction_list & norm_inf(VectorType const & x) { return add(REDUCTION_NORM_INF, x, x); }
+  /** @brief Adds the maximum of the entries of x */
+  reduction_list & max(VectorType const & x)      { return add(REDUCTION_MAX, x, x); }
+  /** @brief Adds the minimum of the entries of x */
+  reduction_list & min(VectorType const & x)      { return add(REDUCTION_MIN, x, x); }
+  /** @brief Adds the sum of the entries of x */
+  reduction_list & sum(VectorType const & x)      { return add(REDUCTION_SUM, x, x); }
+
+  /** @brief Returns the number of reductions in the list */
+  vcl_size_t size() const { return types_.size(); }
+
+  /** @brief Returns the type of the i-th reduction */
+  reduction_types type(vcl_size_t i) const { return types_.at(i); }
+  /** @brief Returns the (first) vector of the i-th reduction */
+  VectorType const & lhs(vcl_size_t i) const { return *(lhs_.at(i)); }
+  /** @brief Returns the second vector of the i-th reduction. Equal to lhs(i) for all reductions other than inner products. */
+  VectorType const & rhs(vcl_size_t i) const { return *(rhs_.at(i)); }
+
+private:
+  reduction_list & add(reduction_types type, VectorType const & x, VectorType const & y)
+  {
+    types_.push_back(type);
+    lhs_.push_back(&x);
+    rhs_.push_back(&y);
+    return *this;
+  }
+
+  std::vector<reduction_types>      types_;
+  std::vector<VectorType const *>   lhs_;
+  std::vector<VectorType const *>   rhs_;
+};
+
 //
 //////////////////// Copy from GPU to CPU //////////////////////////////////
 //
@@ -2172,6 +2224,9 @@ namespace detail
   {
     static void apply(vector_base<T> & lhs, vector_expression<const vector_expression<const LHS, const RHS, OP>, const ScalarType, op_mult> const & proxy)
     {
+      if (fused_op<op_assign>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.lhs());
       lhs = temp * proxy.rhs();
     }
@@ -2183,6 +2238,9 @@ namespace detail
   {
     static void apply(vector_base<T> & lhs, vector_expression<const vector_expression<const LHS, const RHS, OP>, const ScalarType, op_mult> const & proxy)
     {
+      if (fused_op<op_inplace_add>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.lhs());
       lhs += temp * proxy.rhs();
     }
@@ -2194,6 +2252,9 @@ namespace detail
   {
     static void apply(vector_base<T> & lhs, vector_expression<const vector_expression<const LHS, const RHS, OP>, const ScalarType, op_mult> const & proxy)
     {
+      if (fused_op<op_inplace_sub>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.lhs());
       lhs -= temp * proxy.rhs();
     }
@@ -2241,6 +2302,9 @@ namespace detail
   {
     static void apply(vector_base<T> & lhs, vector_expression<const vector_expression<const LHS, const RHS, OP>, const ScalarType, op_div> const & proxy)
     {
+      if (fused_op<op_assign>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.lhs());
       lhs = temp / proxy.rhs();
     }
@@ -2252,6 +2316,9 @@ namespace detail
   {
     static void apply(vector_base<T> & lhs, vector_expression<const vector_expression<const LHS, const RHS, OP>, const ScalarType, op_div> const & proxy)
     {
+      if (fused_op<op_inplace_add>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.lhs());
       lhs += temp / proxy.rhs();
     }
@@ -2263,6 +2330,9 @@ namespace detail
   {
     static void apply(vector_base<T> & lhs, vector_expression<const vector_expression<const LHS, const RHS, OP>, const ScalarType, op_div> const & proxy)
     {
+      if (fused_op<op_inplace_sub>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.lhs());
       lhs -= temp / proxy.rhs();
     }
@@ -2278,6 +2348,9 @@ namespace detail
     template<typename LHS1, typename RHS1>
     static void apply(vector_base<T> & lhs, vector_expression<const LHS1, const RHS1, op_add> const & proxy)
     {
+      if (fused_op<op_assign>(lhs, proxy))
+        return;
+
       bool op_aliasing_lhs = op_aliasing(lhs, proxy.lhs());
       bool op_aliasing_rhs = op_aliasing(lhs, proxy.rhs());
 
@@ -2392,6 +2465,9 @@ namespace detail
     template<typename LHS1, typename RHS1>
     static void apply(vector_base<T> & lhs, vector_expression<const LHS1, const RHS1, op_add> const & proxy)
     {
+      if (fused_op<op_inplace_add>(lhs, proxy))
+        return;
+
       bool op_aliasing_lhs = op_aliasing(lhs, proxy.lhs());
       bool op_aliasing_rhs = op_aliasing(lhs, proxy.rhs());
 
@@ -2515,6 +2591,9 @@ namespace detail
     template<typename LHS1, typename RHS1>
     static void apply(vector_base<T> & lhs, vector_expression<const LHS1, const RHS1, op_add> const & proxy)
     {
+      if (fused_op<op_inplace_sub>(lhs, proxy))
+        return;
+
       bool op_aliasing_lhs = op_aliasing(lhs, proxy.lhs());
       bool op_aliasing_rhs = op_aliasing(lhs, proxy.rhs());
 
@@ -2642,6 +2721,9 @@ namespace detail
     template<typename LHS1, typename RHS1>
     static void apply(vector_base<T> & lhs, vector_expression<const LHS1, const RHS1, op_sub> const & proxy)
     {
+      if (fused_op<op_assign>(lhs, proxy))
+        return;
+
       bool op_aliasing_lhs = op_aliasing(lhs, proxy.lhs());
       bool op_aliasing_rhs = op_aliasing(lhs, proxy.rhs());
 
@@ -2764,6 +2846,9 @@ namespace detail
     template<typename LHS1, typename RHS1>
     static void apply(vector_base<T> & lhs, vector_expression<const LHS1, const RHS1, op_sub> const & proxy)
     {
+      if (fused_op<op_inplace_add>(lhs, proxy))
+        return;
+
       bool op_aliasing_lhs = op_aliasing(lhs, proxy.lhs());
       bool op_aliasing_rhs = op_aliasing(lhs, proxy.rhs());
 
@@ -2887,6 +2972,9 @@ namespace detail
     template<typename LHS1, typename RHS1>
     static void apply(vector_base<T> & lhs, vector_expression<const LHS1, const RHS1, op_sub> const & proxy)
     {
+      if (fused_op<op_inplace_sub>(lhs, proxy))
+        return;
+
       bool op_aliasing_lhs = op_aliasing(lhs, proxy.lhs());
       bool op_aliasing_rhs = op_aliasing(lhs, proxy.rhs());
 
@@ -3033,6 +3121,9 @@ namespace detail
     template<typename LHS2, typename RHS2, typename OP2>
     static void apply(vector_base<T> & lhs, vector_expression<const vector_base<T>, const vector_expression<const LHS2, const RHS2, OP2>, op_element_binary<OP> > const & proxy)
     {
+      if (fused_op<op_assign>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.rhs());
       viennacl::linalg::element_op(lhs, viennacl::vector_expression<const vector_base<T>, const vector_base<T>, op_element_binary<OP> >(proxy.lhs(), temp));
     }
@@ -3041,6 +3132,9 @@ namespace detail
     template<typename LHS1, typename RHS1, typename OP1>
     static void apply(vector_base<T> & lhs, vector_expression<const vector_expression<const LHS1, const RHS1, OP1>, const vector_base<T>, op_element_binary<OP> > const & proxy)
     {
+      if (fused_op<op_assign>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.lhs());
       viennacl::linalg::element_op(lhs, viennacl::vector_expression<const vector_base<T>, const vector_base<T>, op_element_binary<OP> >(temp, proxy.rhs()));
     }
@@ -3052,6 +3146,9 @@ namespace detail
                       const vector_expression<const LHS2, const RHS2, OP2>,
                       op_element_binary<OP> > const & proxy)
     {
+      if (fused_op<op_assign>(lhs, proxy))
+        return;
+
       vector<T> temp1(proxy.lhs());
       vector<T> temp2(proxy.rhs());
       viennacl::linalg::element_op(lhs, viennacl::vector_expression<const vector_base<T>, const vector_base<T>, op_element_binary<OP> >(temp1, temp2));
@@ -3065,6 +3162,9 @@ namespace detail
     // x += y .* z  or  x += y ./ z
     static void apply(vector_base<T> & lhs, vector_expression<const vector_base<T>, const vector_base<T>, op_element_binary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_add>(lhs, proxy))
+        return;
+
       viennacl::vector<T> temp(proxy);
       lhs += temp;
     }
@@ -3073,6 +3173,9 @@ namespace detail
     template<typename LHS2, typename RHS2, typename OP2>
     static void apply(vector_base<T> & lhs, vector_expression<const vector_base<T>, const vector_expression<const LHS2, const RHS2, OP2>,  op_element_binary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_add>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.rhs());
       vector<T> temp2(temp.size());
       viennacl::linalg::element_op(temp2, viennacl::vector_expression<const vector_base<T>, const vector_base<T>, op_element_binary<OP> >(proxy.lhs(), temp));
@@ -3083,6 +3186,9 @@ namespace detail
     template<typename LHS1, typename RHS1, typename OP1>
     static void apply(vector_base<T> & lhs, vector_expression<const vector_expression<const LHS1, const RHS1, OP1>, const vector_base<T>, op_element_binary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_add>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.lhs());
       vector<T> temp2(temp.size());
       viennacl::linalg::element_op(temp2, viennacl::vector_expression<const vector_base<T>, const vector_base<T>, op_element_binary<OP> >(temp, proxy.rhs()));
@@ -3096,6 +3202,9 @@ namespace detail
                       const vector_expression<const LHS2, const RHS2, OP2>,
                       op_element_binary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_add>(lhs, proxy))
+        return;
+
       vector<T> temp1(proxy.lhs());
       vector<T> temp2(proxy.rhs());
       vector<T> temp3(temp1.size());
@@ -3112,6 +3221,9 @@ namespace detail
     // x -= y .* z  or  x -= y ./ z
     static void apply(vector_base<T> & lhs, vector_expression<const vector_base<T>, const vector_base<T>, op_element_binary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_sub>(lhs, proxy))
+        return;
+
       viennacl::vector<T> temp(proxy);
       lhs -= temp;
     }
@@ -3120,6 +3232,9 @@ namespace detail
     template<typename LHS2, typename RHS2, typename OP2>
     static void apply(vector_base<T> & lhs, vector_expression<const vector_base<T>, const vector_expression<const LHS2, const RHS2, OP2>, op_element_binary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_sub>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.rhs());
       vector<T> temp2(temp.size());
       viennacl::linalg::element_op(temp2, viennacl::vector_expression<const vector_base<T>, const vector_base<T>, op_element_binary<OP> >(proxy.lhs(), temp));
@@ -3130,6 +3245,9 @@ namespace detail
     template<typename LHS1, typename RHS1, typename OP1>
     static void apply(vector_base<T> & lhs, vector_expression<const vector_expression<const LHS1, const RHS1, OP1>, const vector_base<T>, op_element_binary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_sub>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.lhs());
       vector<T> temp2(temp.size());
       viennacl::linalg::element_op(temp2, viennacl::vector_expression<const vector_base<T>, const vector_base<T>, op_element_binary<OP> >(temp, proxy.rhs()));
@@ -3143,6 +3261,9 @@ namespace detail
                       const vector_expression<const LHS2, const RHS2, OP2>,
                       op_element_binary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_sub>(lhs, proxy))
+        return;
+
       vector<T> temp1(proxy.lhs());
       vector<T> temp2(proxy.rhs());
       vector<T> temp3(temp1.size());
@@ -3168,6 +3289,9 @@ namespace detail
                       const vector_expression<const LHS2, const RHS2, OP2>,
                       op_element_unary<OP> > const & proxy)
     {
+      if (fused_op<op_assign>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.rhs());
       viennacl::linalg::element_op(lhs, viennacl::vector_expression<const vector_base<T>, const vector_base<T>, op_element_unary<OP> >(temp, temp));
     }
@@ -3179,6 +3303,9 @@ namespace detail
     // x += OP(y)
     static void apply(vector_base<T> & lhs, vector_expression<const vector_base<T>, const vector_base<T>, op_element_unary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_add>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy);
       lhs += temp;
     }
@@ -3189,6 +3316,9 @@ namespace detail
                       const vector_expression<const LHS2, const RHS2, OP2>,
                       op_element_unary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_add>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.rhs());
       viennacl::linalg::element_op(temp, viennacl::vector_expression<const vector_base<T>, const vector_base<T>, op_element_unary<OP> >(temp, temp)); // inplace operation is safe here
       lhs += temp;
@@ -3201,6 +3331,9 @@ namespace detail
     // x -= OP(y)
     static void apply(vector_base<T> & lhs, vector_expression<const vector_base<T>, const vector_base<T>, op_element_unary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_sub>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy);
       lhs -= temp;
     }
@@ -3211,6 +3344,9 @@ namespace detail
                       const vector_expression<const LHS2, const RHS2, OP2>,
                       op_element_unary<OP> > const & proxy)
     {
+      if (fused_op<op_inplace_sub>(lhs, proxy))
+        return;
+
       vector<T> temp(proxy.rhs());
       viennacl::linalg::element_op(temp, viennacl::vector_expression<const vector_base<T>, const vector_base<T>, op_element_unary<OP> >(temp, temp)); // inplace operation is safe here
       lhs -= temp;